@@ -30,9 +30,11 @@ using VALUE_TYPE_RANGE = nvbench::type_list<nvbench::int32_t, nvbench::int64_t>;
 using HASH_RANGE       = nvbench::type_list<cuco::identity_hash<char>,
                                             cuco::xxhash_32<char>,
                                             cuco::xxhash_64<char>,
-                                            cuco::murmurhash3_32<char>>;  //,
-// cuco::murmurhash3_x86_128<char>,
-// cuco::murmurhash3_x64_128<char>>; // TODO handle tuple-like hash value
+                                            cuco::xxhash3_64<char>,
+                                            cuco::murmurhash3_32<char>,
+                                            cuco::murmurhash3_x86_128<char>,
+                                            cuco::murmurhash3_x64_128<char>,
+                                            cuco::xxhash3_128<char>>;
 
 auto constexpr N             = 100'000'000;
 auto constexpr OCCUPANCY     = 0.5;
@@ -51,4 +53,14 @@ auto const MULTIPLICITY_RANGE  = std::vector<nvbench::int64_t>{1, 2, 4, 8, 16};
 auto const MATCHING_RATE_RANGE = nvbench::range(0.1, 1., 0.1);
 auto const SKEW_RANGE          = nvbench::range(0.1, 1., 0.1);
 
+// Tables 10-100x larger than a 50 MB L2 cache for 4-byte keys at 50% occupancy
+auto const N_RANGE_BEYOND_L2 =
+  std::vector<nvbench::int64_t>{62'500'000, 200'000'000, 625'000'000};
+auto const PARTITION_BITS_RANGE = std::vector<nvbench::int64_t>{0, 6, 8, 10};
+// Small batches whose runtime is dominated by launch overheads
+auto const N_RANGE_SMALL_BATCH = std::vector<nvbench::int64_t>{10'000, 100'000, 1'000'000};
+// Table sizes relative to the device memory, from fitting in it to spilled
+auto const DEVICE_MEMORY_RATIO_RANGE = std::vector<nvbench::float64_t>{0.5, 2., 3., 4.};
+auto const OUT_OF_CORE_OCCUPANCY_RANGE = std::vector<nvbench::float64_t>{0.25, 0.5, 0.75};
+
 }  // namespace cuco::benchmark::defaults
@@ -21,8 +21,11 @@
 
 #include <nvbench/nvbench.cuh>
 
+#include <cuda/functional>
 #include <cuda/std/cstddef>
 #include <thrust/device_vector.h>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
 
 #include <cstdint>
 #include <type_traits>
@@ -172,6 +175,80 @@ void string_hash_eval(nvbench::state& state, nvbench::type_list<Hash>)
   });
 }
 
+/**
+ * @brief A benchmark evaluating `cuco::hash_bulk` materializing the hash values of a key column
+ */
+template <typename Hash>
+void hash_bulk_eval(nvbench::state& state, nvbench::type_list<Hash>)
+{
+  using key_type    = typename Hash::argument_type;
+  using result_type = typename Hash::result_type;
+
+  auto const num_keys = state.get_int64("NumInputs");
+
+  thrust::device_vector<key_type> keys(num_keys);
+  thrust::sequence(keys.begin(), keys.end());
+  thrust::device_vector<result_type> hash_values(num_keys);
+
+  state.add_element_count(num_keys);
+  state.add_global_memory_reads<key_type>(num_keys);
+  state.add_global_memory_writes<result_type>(num_keys);
+
+  state.exec([&](nvbench::launch& launch) {
+    cuco::hash_bulk_async(
+      keys.begin(), keys.end(), hash_values.begin(), Hash{}, {launch.get_stream()});
+  });
+}
+
+/**
+ * @brief A benchmark evaluating `cuco::hash_strings_bulk` on a column of random strings with
+ * variable length
+ */
+template <typename Hash>
+void string_hash_bulk_eval(nvbench::state& state, nvbench::type_list<Hash>)
+{
+  static_assert(std::is_same_v<typename Hash::argument_type, cuda::std::byte>,
+                "Argument type must be cuda::std::byte");
+
+  auto const num_keys   = state.get_int64("NumInputs");
+  auto const min_length = state.get_int64("MinLength");
+  auto const max_length = state.get_int64("MaxLength");
+
+  if (min_length > max_length) {
+    state.skip("MinLength > MaxLength");
+    return;
+  }
+
+  auto const sequences =
+    cuco::utility::generate_random_byte_sequences(num_keys, min_length, max_length);
+  auto const& keys    = sequences.first;
+  auto const& storage = sequences.second;
+
+  // The generated sequences are stored back to back, so their offsets form a string column
+  thrust::device_vector<int64_t> offsets(num_keys + 1, static_cast<int64_t>(storage.size()));
+  thrust::transform(keys.begin(),
+                    keys.end(),
+                    offsets.begin(),
+                    cuda::proclaim_return_type<int64_t>(
+                      [chars = thrust::raw_pointer_cast(storage.data())] __device__(auto key) {
+                        return static_cast<int64_t>(key.data() - chars);
+                      }));
+
+  thrust::device_vector<typename Hash::result_type> hash_values(num_keys);
+
+  state.add_element_count(num_keys);
+  state.add_global_memory_reads<cuda::std::byte>(storage.size());
+
+  state.exec([&](nvbench::launch& launch) {
+    cuco::hash_strings_bulk_async(offsets.begin(),
+                                  offsets.end(),
+                                  thrust::raw_pointer_cast(storage.data()),
+                                  hash_values.begin(),
+                                  Hash{},
+                                  {launch.get_stream()});
+  });
+}
+
 NVBENCH_BENCH_TYPES(
   hash_eval,
   NVBENCH_TYPE_AXES(nvbench::type_list<cuco::murmurhash3_32<nvbench::int32_t>,
@@ -183,6 +260,12 @@ NVBENCH_BENCH_TYPES(
                                        cuco::xxhash_64<nvbench::int32_t>,
                                        cuco::xxhash_64<nvbench::int64_t>,
                                        cuco::xxhash_64<large_key<32>>,
+                                       cuco::xxhash3_64<nvbench::int32_t>,
+                                       cuco::xxhash3_64<nvbench::int64_t>,
+                                       cuco::xxhash3_64<large_key<32>>,
+                                       cuco::xxhash3_128<nvbench::int32_t>,
+                                       cuco::xxhash3_128<nvbench::int64_t>,
+                                       cuco::xxhash3_128<large_key<32>>,
                                        cuco::murmurhash3_fmix_32<nvbench::int32_t>,
                                        cuco::murmurhash3_fmix_64<nvbench::int64_t>,
                                        cuco::murmurhash3_x86_128<nvbench::int32_t>,
@@ -201,6 +284,8 @@ NVBENCH_BENCH_TYPES(
   NVBENCH_TYPE_AXES(nvbench::type_list<cuco::murmurhash3_32<cuda::std::byte>,
                                        cuco::xxhash_32<cuda::std::byte>,
                                        cuco::xxhash_64<cuda::std::byte>,
+                                       cuco::xxhash3_64<cuda::std::byte>,
+                                       cuco::xxhash3_128<cuda::std::byte>,
                                        cuco::murmurhash3_x86_128<cuda::std::byte>,
                                        cuco::murmurhash3_x64_128<cuda::std::byte>>))
   .set_name("string_hash_function_eval")
@@ -209,3 +294,29 @@ NVBENCH_BENCH_TYPES(
   .add_int64_axis("NumInputs", {cuco::benchmark::defaults::N / 4})
   .add_int64_axis("MinLength", {1, 4})
   .add_int64_axis("MaxLength", {4, 32, 64});
+
+NVBENCH_BENCH_TYPES(hash_bulk_eval,
+                    NVBENCH_TYPE_AXES(nvbench::type_list<cuco::murmurhash3_32<nvbench::int32_t>,
+                                                         cuco::murmurhash3_32<nvbench::int64_t>,
+                                                         cuco::xxhash_32<nvbench::int32_t>,
+                                                         cuco::xxhash_32<nvbench::int64_t>,
+                                                         cuco::xxhash_64<nvbench::int32_t>,
+                                                         cuco::xxhash_64<nvbench::int64_t>,
+                                                         cuco::xxhash3_64<nvbench::int32_t>,
+                                                         cuco::xxhash3_64<nvbench::int64_t>>))
+  .set_name("hash_bulk_eval")
+  .set_type_axes_names({"Hash"})
+  .set_max_noise(cuco::benchmark::defaults::MAX_NOISE)
+  .add_int64_axis("NumInputs", {cuco::benchmark::defaults::N * 10});
+
+NVBENCH_BENCH_TYPES(string_hash_bulk_eval,
+                    NVBENCH_TYPE_AXES(nvbench::type_list<cuco::murmurhash3_32<cuda::std::byte>,
+                                                         cuco::xxhash_32<cuda::std::byte>,
+                                                         cuco::xxhash_64<cuda::std::byte>,
+                                                         cuco::xxhash3_64<cuda::std::byte>>))
+  .set_name("string_hash_bulk_eval")
+  .set_type_axes_names({"Hash"})
+  .set_max_noise(cuco::benchmark::defaults::MAX_NOISE)
+  .add_int64_axis("NumInputs", {cuco::benchmark::defaults::N / 4})
+  .add_int64_axis("MinLength", {1, 64})
+  .add_int64_axis("MaxLength", {32, 256, 2048});
@@ -18,6 +18,7 @@
 #include <benchmark_utils.hpp>
 
 #include <cuco/static_map.cuh>
+#include <cuco/storage.cuh>
 #include <cuco/utility/key_generator.cuh>
 
 #include <nvbench/nvbench.cuh>
@@ -28,14 +29,25 @@
 using namespace cuco::benchmark;  // defaults, dist_from_state
 using namespace cuco::utility;    // key_generator, distribution
 
+NVBENCH_DECLARE_TYPE_STRINGS(cuco::storage<1>, "AOS", "cuco::storage<1>");
+NVBENCH_DECLARE_TYPE_STRINGS(cuco::soa_storage<1>, "SOA", "cuco::soa_storage<1>");
+
 /**
  * @brief A benchmark evaluating `cuco::static_map::contains_async` performance
  */
-template <typename Key, typename Value, typename Dist>
+template <typename Key, typename Value, typename Dist, typename Storage>
 std::enable_if_t<(sizeof(Key) == sizeof(Value)), void> static_map_contains(
-  nvbench::state& state, nvbench::type_list<Key, Value, Dist>)
+  nvbench::state& state, nvbench::type_list<Key, Value, Dist, Storage>)
 {
   using pair_type = cuco::pair<Key, Value>;
+  using map_type  = cuco::static_map<Key,
+                                    Value,
+                                    cuco::extent<std::size_t>,
+                                    cuda::thread_scope_device,
+                                    thrust::equal_to<Key>,
+                                    cuco::linear_probing<4, cuco::default_hash_function<Key>>,
+                                    cuco::cuda_allocator<pair_type>,
+                                    Storage>;
 
   auto const num_keys      = state.get_int64("NumInputs");
   auto const occupancy     = state.get_float64("Occupancy");
@@ -53,7 +65,7 @@ std::enable_if_t<(sizeof(Key) == sizeof(Value)), void> static_map_contains(
     return pair_type(key, {});
   });
 
-  auto map = cuco::static_map{size, cuco::empty_key<Key>{-1}, cuco::empty_value<Value>{-1}};
+  auto map = map_type{size, cuco::empty_key<Key>{-1}, cuco::empty_value<Value>{-1}};
   map.insert(pairs.begin(), pairs.end());
 
   gen.dropout(keys.begin(), keys.end(), matching_rate);
@@ -67,9 +79,9 @@ std::enable_if_t<(sizeof(Key) == sizeof(Value)), void> static_map_contains(
   });
 }
 
-template <typename Key, typename Value, typename Dist>
+template <typename Key, typename Value, typename Dist, typename Storage>
 std::enable_if_t<(sizeof(Key) != sizeof(Value)), void> static_map_contains(
-  nvbench::state& state, nvbench::type_list<Key, Value, Dist>)
+  nvbench::state& state, nvbench::type_list<Key, Value, Dist, Storage>)
 {
   state.skip("Key should be the same type as Value.");
 }
@@ -77,9 +89,10 @@ std::enable_if_t<(sizeof(Key) != sizeof(Value)), void> static_map_contains(
 NVBENCH_BENCH_TYPES(static_map_contains,
                     NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE,
                                       defaults::VALUE_TYPE_RANGE,
-                                      nvbench::type_list<distribution::unique>))
+                                      nvbench::type_list<distribution::unique>,
+                                      nvbench::type_list<cuco::storage<1>>))
   .set_name("static_map_contains_unique_capacity")
-  .set_type_axes_names({"Key", "Value", "Distribution"})
+  .set_type_axes_names({"Key", "Value", "Distribution", "Storage"})
   .set_max_noise(defaults::MAX_NOISE)
   .add_int64_axis("NumInputs", defaults::N_RANGE_CACHE)
   .add_float64_axis("Occupancy", {defaults::OCCUPANCY})
@@ -88,9 +101,10 @@ NVBENCH_BENCH_TYPES(static_map_contains,
 NVBENCH_BENCH_TYPES(static_map_contains,
                     NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE,
                                       defaults::VALUE_TYPE_RANGE,
-                                      nvbench::type_list<distribution::unique>))
+                                      nvbench::type_list<distribution::unique>,
+                                      nvbench::type_list<cuco::storage<1>>))
   .set_name("static_map_contains_unique_occupancy")
-  .set_type_axes_names({"Key", "Value", "Distribution"})
+  .set_type_axes_names({"Key", "Value", "Distribution", "Storage"})
   .set_max_noise(defaults::MAX_NOISE)
   .add_int64_axis("NumInputs", {defaults::N})
   .add_float64_axis("Occupancy", defaults::OCCUPANCY_RANGE)
@@ -99,9 +113,22 @@ NVBENCH_BENCH_TYPES(static_map_contains,
 NVBENCH_BENCH_TYPES(static_map_contains,
                     NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE,
                                       defaults::VALUE_TYPE_RANGE,
-                                      nvbench::type_list<distribution::unique>))
+                                      nvbench::type_list<distribution::unique>,
+                                      nvbench::type_list<cuco::storage<1>>))
   .set_name("static_map_contains_unique_matching_rate")
-  .set_type_axes_names({"Key", "Value", "Distribution"})
+  .set_type_axes_names({"Key", "Value", "Distribution", "Storage"})
+  .set_max_noise(defaults::MAX_NOISE)
+  .add_int64_axis("NumInputs", {defaults::N})
+  .add_float64_axis("Occupancy", {defaults::OCCUPANCY})
+  .add_float64_axis("MatchingRate", defaults::MATCHING_RATE_RANGE);
+
+NVBENCH_BENCH_TYPES(static_map_contains,
+                    NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE,
+                                      defaults::VALUE_TYPE_RANGE,
+                                      nvbench::type_list<distribution::unique>,
+                                      nvbench::type_list<cuco::storage<1>, cuco::soa_storage<1>>))
+  .set_name("static_map_contains_unique_storage")
+  .set_type_axes_names({"Key", "Value", "Distribution", "Storage"})
   .set_max_noise(defaults::MAX_NOISE)
   .add_int64_axis("NumInputs", {defaults::N})
   .add_float64_axis("Occupancy", {defaults::OCCUPANCY})
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark_defaults.hpp>
+#include <benchmark_utils.hpp>
+
+#include <cuco/static_map.cuh>
+#include <cuco/utility/key_generator.cuh>
+
+#include <nvbench/nvbench.cuh>
+
+#include <thrust/copy.h>
+#include <thrust/device_vector.h>
+#include <thrust/transform.h>
+
+#include <cstddef>
+#include <vector>
+
+using namespace cuco::benchmark;  // defaults, dist_from_state
+using namespace cuco::utility;    // key_generator, distribution
+
+/**
+ * @brief A benchmark evaluating `cuco::static_map::insert_from_host` performance
+ */
+template <typename Key, typename Value, typename Dist>
+std::enable_if_t<(sizeof(Key) == sizeof(Value)), void> static_map_insert_from_host(
+  nvbench::state& state, nvbench::type_list<Key, Value, Dist>)
+{
+  using pair_type = cuco::pair<Key, Value>;
+
+  auto const num_keys   = state.get_int64("NumInputs");
+  auto const occupancy  = state.get_float64("Occupancy");
+  auto const chunk_size = static_cast<std::size_t>(state.get_int64("ChunkSize"));
+  auto const num_stages = static_cast<int32_t>(state.get_int64("NumStages"));
+  auto const pinned     = state.get_int64("Pinned") != 0;
+
+  std::size_t const size = num_keys / occupancy;
+
+  thrust::device_vector<Key> keys(num_keys);
+
+  key_generator gen;
+  gen.generate(dist_from_state<Dist>(state), keys.begin(), keys.end());
+
+  thrust::device_vector<pair_type> d_pairs(num_keys);
+  thrust::transform(keys.begin(), keys.end(), d_pairs.begin(), [] __device__(Key const& key) {
+    return pair_type(key, {});
+  });
+
+  std::vector<pair_type> pageable_pairs(num_keys);
+  pair_type* pinned_pairs = nullptr;
+  if (pinned) {
+    CUCO_CUDA_TRY(cudaMallocHost(&pinned_pairs, sizeof(pair_type) * num_keys));
+    thrust::copy(d_pairs.begin(), d_pairs.end(), pinned_pairs);
+  } else {
+    thrust::copy(d_pairs.begin(), d_pairs.end(), pageable_pairs.begin());
+  }
+  // Only the host copy of the input is kept
+  d_pairs = thrust::device_vector<pair_type>{};
+  keys    = thrust::device_vector<Key>{};
+
+  state.add_element_count(num_keys);
+  state.add_global_memory_reads<pair_type>(num_keys, "InputSize");
+
+  state.exec(nvbench::exec_tag::sync | nvbench::exec_tag::timer,
+             [&](nvbench::launch& launch, auto& timer) {
+               cuco::static_map<Key, Value> map{size,
+                                                cuco::empty_key<Key>{-1},
+                                                cuco::empty_value<Value>{-1},
+                                                {},
+                                                {},
+                                                {},
+                                                {},
+                                                {},
+                                                {launch.get_stream()}};
+
+               timer.start();
+               if (pinned) {
+                 map.insert_from_host(pinned_pairs,
+                                      pinned_pairs + num_keys,
+                                      chunk_size,
+                                      num_stages,
+                                      {launch.get_stream()});
+               } else {
+                 map.insert_from_host(pageable_pairs.begin(),
+                                      pageable_pairs.end(),
+                                      chunk_size,
+                                      num_stages,
+                                      {launch.get_stream()});
+               }
+               timer.stop();
+             });
+
+  if (pinned) { CUCO_CUDA_TRY(cudaFreeHost(pinned_pairs)); }
+}
+
+template <typename Key, typename Value, typename Dist>
+std::enable_if_t<(sizeof(Key) != sizeof(Value)), void> static_map_insert_from_host(
+  nvbench::state& state, nvbench::type_list<Key, Value, Dist>)
+{
+  state.skip("Key should be the same type as Value.");
+}
+
+NVBENCH_BENCH_TYPES(static_map_insert_from_host,
+                    NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE,
+                                      defaults::VALUE_TYPE_RANGE,
+                                      nvbench::type_list<distribution::unique>))
+  .set_name("static_map_insert_from_host_unique_pipeline")
+  .set_type_axes_names({"Key", "Value", "Distribution"})
+  .set_max_noise(defaults::MAX_NOISE)
+  .add_int64_axis("NumInputs", {defaults::N})
+  .add_float64_axis("Occupancy", {defaults::OCCUPANCY})
+  .add_int64_power_of_two_axis("ChunkSize", {20, 22, 24})
+  .add_int64_axis("NumStages", {1, 2, 3, 4})
+  .add_int64_axis("Pinned", {0, 1});
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark_defaults.hpp>
+#include <benchmark_utils.hpp>
+
+#include <cuco/static_set.cuh>
+#include <cuco/utility/key_generator.cuh>
+
+#include <nvbench/nvbench.cuh>
+
+#include <thrust/device_vector.h>
+
+using namespace cuco::benchmark;  // defaults, dist_from_state
+using namespace cuco::utility;    // key_generator, distribution
+
+/**
+ * @brief A benchmark comparing a batch of `cuco::static_set` `_async` operations issued eagerly
+ * against the same batch replayed from a CUDA graph
+ */
+template <typename Key, typename Dist>
+void static_set_graph_replay(nvbench::state& state, nvbench::type_list<Key, Dist>)
+{
+  using set_type = cuco::static_set<Key>;
+
+  auto const num_keys  = state.get_int64("NumInputs");
+  auto const occupancy = state.get_float64("Occupancy");
+  auto const use_graph = state.get_int64("UseGraph") != 0;
+
+  std::size_t const size = num_keys / occupancy;
+
+  thrust::device_vector<Key> keys(num_keys);
+
+  key_generator gen;
+  gen.generate(dist_from_state<Dist>(state), keys.begin(), keys.end());
+
+  set_type set{size, cuco::empty_key<Key>{-1}};
+
+  thrust::device_vector<bool> contained(num_keys);
+  thrust::device_vector<typename set_type::size_type> num_found(1);
+
+  auto const run_batch = [&](cuda::stream_ref stream) {
+    set.clear_async(stream);
+    set.insert_async(keys.begin(), keys.end(), stream);
+    set.contains_async(keys.begin(), keys.end(), contained.begin(), stream);
+    set.count_async(keys.begin(), keys.end(), num_found.data().get(), stream);
+  };
+
+  cudaStream_t capture_stream;
+  cudaGraph_t graph;
+  cudaGraphExec_t graph_exec;
+  CUCO_CUDA_TRY(cudaStreamCreate(&capture_stream));
+  CUCO_CUDA_TRY(cudaDeviceSynchronize());
+  CUCO_CUDA_TRY(cudaStreamBeginCapture(capture_stream, cudaStreamCaptureModeGlobal));
+  run_batch(capture_stream);
+  CUCO_CUDA_TRY(cudaStreamEndCapture(capture_stream, &graph));
+  CUCO_CUDA_TRY(cudaGraphInstantiate(&graph_exec, graph, 0));
+
+  state.add_element_count(num_keys);
+
+  state.exec([&](nvbench::launch& launch) {
+    if (use_graph) {
+      CUCO_CUDA_TRY(cudaGraphLaunch(graph_exec, launch.get_stream()));
+    } else {
+      run_batch({launch.get_stream()});
+    }
+  });
+
+  CUCO_CUDA_TRY(cudaGraphExecDestroy(graph_exec));
+  CUCO_CUDA_TRY(cudaGraphDestroy(graph));
+  CUCO_CUDA_TRY(cudaStreamDestroy(capture_stream));
+}
+
+NVBENCH_BENCH_TYPES(static_set_graph_replay,
+                    NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE,
+                                      nvbench::type_list<distribution::unique>))
+  .set_name("static_set_graph_replay_unique_num_inputs")
+  .set_type_axes_names({"Key", "Distribution"})
+  .set_max_noise(defaults::MAX_NOISE)
+  .add_int64_axis("NumInputs", defaults::N_RANGE_SMALL_BATCH)
+  .add_float64_axis("Occupancy", {defaults::OCCUPANCY})
+  .add_int64_axis("UseGraph", {0, 1});
@@ -55,6 +55,37 @@ void static_set_insert(nvbench::state& state, nvbench::type_list<Key, Dist>)
   });
 }
 
+/**
+ * @brief A benchmark evaluating `cuco::static_set::insert_async` performance with radix-partitioned
+ * input
+ */
+template <typename Key, typename Dist>
+void static_set_insert_partitioned(nvbench::state& state, nvbench::type_list<Key, Dist>)
+{
+  auto const num_keys       = state.get_int64("NumInputs");
+  auto const occupancy      = state.get_float64("Occupancy");
+  auto const partition_bits = state.get_int64("PartitionBits");
+
+  std::size_t const size = num_keys / occupancy;
+
+  thrust::device_vector<Key> keys(num_keys);
+
+  key_generator gen;
+  gen.generate(dist_from_state<Dist>(state), keys.begin(), keys.end());
+
+  state.add_element_count(num_keys);
+
+  cuco::static_set<Key> set{size, cuco::empty_key<Key>{-1}};
+  set.set_input_partitioning(static_cast<int32_t>(partition_bits));
+
+  state.exec(nvbench::exec_tag::timer, [&](nvbench::launch& launch, auto& timer) {
+    timer.start();
+    set.insert_async(keys.begin(), keys.end(), {launch.get_stream()});
+    timer.stop();
+    set.clear_async({launch.get_stream()});
+  });
+}
+
 NVBENCH_BENCH_TYPES(static_set_insert,
                     NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE,
                                       nvbench::type_list<distribution::unique>))
@@ -92,3 +123,13 @@ NVBENCH_BENCH_TYPES(static_set_insert,
   .add_int64_axis("NumInputs", {defaults::N})
   .add_float64_axis("Occupancy", {defaults::OCCUPANCY})
   .add_float64_axis("Skew", defaults::SKEW_RANGE);
+
+NVBENCH_BENCH_TYPES(static_set_insert_partitioned,
+                    NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE,
+                                      nvbench::type_list<distribution::unique>))
+  .set_name("static_set_insert_unique_beyond_l2")
+  .set_type_axes_names({"Key", "Distribution"})
+  .set_max_noise(defaults::MAX_NOISE)
+  .add_int64_axis("NumInputs", defaults::N_RANGE_BEYOND_L2)
+  .add_float64_axis("Occupancy", {defaults::OCCUPANCY})
+  .add_int64_axis("PartitionBits", defaults::PARTITION_BITS_RANGE);
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark_defaults.hpp>
+#include <benchmark_utils.hpp>
+
+#include <cuco/static_set.cuh>
+#include <cuco/utility/allocator.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <cstddef>
+
+using namespace cuco::benchmark;  // defaults
+
+NVBENCH_DECLARE_TYPE_STRINGS(cuco::pinned_allocator<nvbench::int64_t>,
+                             "pinned",
+                             "cuco::pinned_allocator");
+NVBENCH_DECLARE_TYPE_STRINGS(cuco::managed_allocator<nvbench::int64_t>,
+                             "managed",
+                             "cuco::managed_allocator");
+
+/**
+ * @brief Computes the capacity of a table occupying `ratio` times the device memory.
+ *
+ * @tparam Key Key type
+ *
+ * @param ratio Size of the table relative to the device memory
+ *
+ * @return The table capacity
+ */
+template <typename Key>
+std::size_t capacity_from_device_memory_ratio(double ratio)
+{
+  std::size_t free_bytes;
+  std::size_t total_bytes;
+  CUCO_CUDA_TRY(cudaMemGetInfo(&free_bytes, &total_bytes));
+  return static_cast<std::size_t>(ratio * total_bytes / sizeof(Key));
+}
+
+/**
+ * @brief A benchmark evaluating `cuco::static_set::insert_async` performance on tables stored in
+ * host-pinned or managed memory
+ */
+template <typename Key, typename Allocator, typename CGSize>
+void static_set_out_of_core_insert(nvbench::state& state,
+                                   nvbench::type_list<Key, Allocator, CGSize>)
+{
+  using set_type = cuco::static_set<Key,
+                                    cuco::extent<std::size_t>,
+                                    cuda::thread_scope_device,
+                                    thrust::equal_to<Key>,
+                                    cuco::linear_probing<CGSize::value,
+                                                         cuco::default_hash_function<Key>>,
+                                    Allocator>;
+
+  auto const ratio     = state.get_float64("DeviceMemoryRatio");
+  auto const occupancy = state.get_float64("Occupancy");
+
+  auto const size     = capacity_from_device_memory_ratio<Key>(ratio);
+  auto const num_keys = static_cast<std::size_t>(size * occupancy);
+
+  // Keys are generated on the fly since the input would not fit in device memory either
+  auto const keys_begin = thrust::counting_iterator<Key>{0};
+
+  state.add_element_count(num_keys);
+
+  set_type set{size, cuco::empty_key<Key>{-1}};
+
+  state.exec(nvbench::exec_tag::sync | nvbench::exec_tag::timer,
+             [&](nvbench::launch& launch, auto& timer) {
+               set.clear_async({launch.get_stream()});
+
+               timer.start();
+               set.insert_async(keys_begin, keys_begin + num_keys, {launch.get_stream()});
+               timer.stop();
+             });
+}
+
+/**
+ * @brief A benchmark evaluating `cuco::static_set::contains_async` performance on tables stored in
+ * host-pinned or managed memory
+ */
+template <typename Key, typename Allocator, typename CGSize>
+void static_set_out_of_core_contains(nvbench::state& state,
+                                     nvbench::type_list<Key, Allocator, CGSize>)
+{
+  using set_type = cuco::static_set<Key,
+                                    cuco::extent<std::size_t>,
+                                    cuda::thread_scope_device,
+                                    thrust::equal_to<Key>,
+                                    cuco::linear_probing<CGSize::value,
+                                                         cuco::default_hash_function<Key>>,
+                                    Allocator>;
+
+  auto const ratio      = state.get_float64("DeviceMemoryRatio");
+  auto const occupancy  = state.get_float64("Occupancy");
+  auto const batch_size = state.get_int64("BatchSize");
+
+  auto const size     = capacity_from_device_memory_ratio<Key>(ratio);
+  auto const num_keys = static_cast<std::size_t>(size * occupancy);
+
+  auto const keys_begin = thrust::counting_iterator<Key>{0};
+
+  set_type set{size, cuco::empty_key<Key>{-1}};
+  set.insert(keys_begin, keys_begin + num_keys);
+
+  // Half of the batch hits the table
+  auto const queries_begin = keys_begin + (num_keys - batch_size / 2);
+  thrust::device_vector<bool> result(batch_size);
+
+  state.add_element_count(batch_size);
+
+  state.exec([&](nvbench::launch& launch) {
+    set.contains_async(
+      queries_begin, queries_begin + batch_size, result.begin(), {launch.get_stream()});
+  });
+}
+
+// 64-bit keys since tables several times larger than the device memory exceed the 32-bit key space
+using out_of_core_allocators = nvbench::type_list<cuco::pinned_allocator<nvbench::int64_t>,
+                                                  cuco::managed_allocator<nvbench::int64_t>>;
+
+NVBENCH_BENCH_TYPES(static_set_out_of_core_insert,
+                    NVBENCH_TYPE_AXES(nvbench::type_list<nvbench::int64_t>,
+                                      out_of_core_allocators,
+                                      nvbench::enum_type_list<1, 4, 8>))
+  .set_name("static_set_out_of_core_insert")
+  .set_type_axes_names({"Key", "Allocator", "CGSize"})
+  .set_max_noise(defaults::MAX_NOISE)
+  .add_float64_axis("DeviceMemoryRatio", defaults::DEVICE_MEMORY_RATIO_RANGE)
+  .add_float64_axis("Occupancy", defaults::OUT_OF_CORE_OCCUPANCY_RANGE);
+
+NVBENCH_BENCH_TYPES(static_set_out_of_core_contains,
+                    NVBENCH_TYPE_AXES(nvbench::type_list<nvbench::int64_t>,
+                                      out_of_core_allocators,
+                                      nvbench::enum_type_list<1, 4, 8>))
+  .set_name("static_set_out_of_core_contains")
+  .set_type_axes_names({"Key", "Allocator", "CGSize"})
+  .set_max_noise(defaults::MAX_NOISE)
+  .add_float64_axis("DeviceMemoryRatio", defaults::DEVICE_MEMORY_RATIO_RANGE)
+  .add_float64_axis("Occupancy", defaults::OUT_OF_CORE_OCCUPANCY_RANGE)
+  .add_int64_axis("BatchSize", {defaults::BATCH_SIZE});
@@ -23,6 +23,7 @@
 #include <cuco/hash_functions.cuh>
 #include <cuco/utility/allocator.hpp>
 #include <cuco/utility/cuda_thread_scope.cuh>
+#include <cuco/utility/persistence.hpp>
 
 #include <cuda/atomic>
 #include <cuda/std/array>
@@ -32,6 +33,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <string>
 
 namespace cuco {
 
@@ -51,6 +53,8 @@ namespace cuco {
  * independent add or lookup operations from device code. These operations are accessed through
  * non-owning, trivially copyable reference types (or "ref").
  *
+ * @note All `_async` bulk APIs only enqueue kernels and can be captured into a CUDA graph.
+ *
  * @tparam Key Key type
  * @tparam Extent Size type that is used to determine the number of blocks in the filter
  * @tparam Scope The scope in which operations will be performed by individual threads
@@ -340,6 +344,37 @@ class bloom_filter {
    */
   [[nodiscard]] __host__ constexpr allocator_type allocator() const noexcept;
 
+  /**
+   * @brief Writes the filter to a file at `path`.
+   *
+   * The file holds a versioned header, the filter policy including the hash function seed, and the
+   * raw filter blocks. See `cuco::persisted_header` for the layout.
+   *
+   * @note This function synchronizes the given stream.
+   *
+   * @throw cuco::logic_error If the file cannot be written
+   *
+   * @param path Path of the file to write
+   * @param stream CUDA stream used for this operation
+   */
+  __host__ void save(std::string const& path, cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief Replaces the content of the filter by the content of a file written by `save`.
+   *
+   * The file is memory-mapped and copied into the filter in chunks through pinned host memory.
+   * The filter must have the same type, number of blocks and policy as the filter that wrote the
+   * file.
+   *
+   * @note This function synchronizes the given stream.
+   *
+   * @throw cuco::logic_error If the file is invalid or was written by an incompatible filter
+   *
+   * @param path Path of the file to read
+   * @param stream CUDA stream used for this operation
+   */
+  __host__ void load(std::string const& path, cuda::stream_ref stream = {});
+
   /**
    * @brief Get device ref.
    *
@@ -348,6 +383,20 @@ class bloom_filter {
   [[nodiscard]] __host__ constexpr ref_type<> ref() const noexcept;
 
  private:
+  /**
+   * @brief Builds the header describing this filter in a persisted file.
+   *
+   * @return The persisted file header
+   */
+  [[nodiscard]] __host__ persisted_header persisted_header_for() const noexcept;
+
+  /**
+   * @brief Gets the size of the raw filter storage.
+   *
+   * @return The number of bytes of all filter blocks
+   */
+  [[nodiscard]] __host__ std::uint64_t payload_bytes() const noexcept;
+
   allocator_type allocator_;  ///< Allocator used to allocate device-accessible storage
   std::unique_ptr<typename ref_type<>::filter_block_type,
                   detail::custom_deleter<std::size_t, allocator_type>>
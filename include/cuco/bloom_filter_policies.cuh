@@ -43,6 +43,10 @@ using arrow_filter_policy = detail::arrow_filter_policy<Key, XXHash64>;
  * @note `Word` type must be an atomically updatable integral type. `WordsPerBlock` must
  * be a power-of-two.
  *
+ * @note If `Hash` returns a multi-word hash value such as the `cuda::std::array` of a 128-bit hash
+ * function, the block index is derived from its first word and the fingerprint pattern from its
+ * last word.
+ *
  * @tparam Hash Hash function used to generate a key's fingerprint
  * @tparam Word Underlying word/segment type of a filter block
  * @tparam WordsPerBlock Number of words/segments in each block
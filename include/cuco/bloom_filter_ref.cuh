@@ -47,6 +47,7 @@ class bloom_filter_ref {
   using key_type    = typename impl_type::key_type;      ///< Key Type
   using extent_type = typename impl_type::extent_type;   ///< Extent type
   using size_type   = typename extent_type::value_type;  ///< Underlying type of the extent type
+  using policy_type = typename impl_type::policy_type;   ///< Filter policy type
   using word_type =
     typename impl_type::word_type;  ///< Underlying word/segment type of a filter block
   using filter_block_type =
@@ -374,6 +375,13 @@ class bloom_filter_ref {
    */
   [[nodiscard]] __host__ __device__ constexpr extent_type block_extent() const noexcept;
 
+  /**
+   * @brief Gets the filter policy.
+   *
+   * @return The policy, including the hash function, used by the filter
+   */
+  [[nodiscard]] __host__ __device__ constexpr policy_type const& policy() const noexcept;
+
  private:
   impl_type impl_;  ///< Object containing the Blocked Bloom Filter implementation
 };
@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/bucket_storage.cuh>
+#include <cuco/detail/storage/bucket_storage_base.cuh>
+#include <cuco/extent.cuh>
+#include <cuco/utility/allocator.hpp>
+
+#include <cuda/stream_ref>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace cuco {
+namespace detail {
+/// Displacement bound denoting that probing must run until an empty slot is found
+inline constexpr std::int32_t unbounded_displacement = 0xFF;
+}  // namespace detail
+
+/**
+ * @brief Non-owning array of buckets storage reference type with per-bucket displacement bounds.
+ *
+ * Every bucket records the largest displacement, i.e., the number of probing steps, at which an
+ * element whose probing sequence starts at this bucket has been inserted. Lookups stop once they
+ * have probed past that bound instead of running until an empty slot, which caps the length of
+ * negative lookups at high occupancy. Bounds are one byte each and saturate at
+ * `detail::unbounded_displacement`.
+ *
+ * @tparam T Storage element type
+ * @tparam BucketSize Number of slots in each bucket
+ * @tparam Extent Type of extent denoting storage capacity
+ */
+template <typename T, int32_t BucketSize, typename Extent = cuco::extent<std::size_t>>
+class bounded_bucket_storage_ref : public bucket_storage_ref<T, BucketSize, Extent> {
+ public:
+  /// Array of buckets storage ref base class type
+  using base_type = bucket_storage_ref<T, BucketSize, Extent>;
+
+  using base_type::bucket_size;  ///< Number of elements processed per bucket
+
+  using extent_type = typename base_type::extent_type;  ///< Storage extent type
+  using size_type   = typename base_type::size_type;    ///< Storage size type
+  using value_type  = typename base_type::value_type;   ///< Slot type
+  using bucket_type = typename base_type::bucket_type;  ///< Slot bucket type
+
+  /// Type of a word packing the displacement bounds of four buckets
+  using bound_word_type = detail::bucket<std::uint32_t, 1>;
+
+  /**
+   * @brief Constructor of bounded storage ref.
+   *
+   * @param size Number of buckets
+   * @param buckets Pointer to the buckets array
+   * @param bounds Pointer to the displacement bounds array
+   */
+  __host__ __device__ explicit constexpr bounded_bucket_storage_ref(
+    Extent size, bucket_type* buckets, bound_word_type* bounds) noexcept;
+
+  /**
+   * @brief Gets displacement bounds array.
+   *
+   * @return Pointer to the first word of displacement bounds
+   */
+  [[nodiscard]] __host__ __device__ constexpr bound_word_type* bound_data() const noexcept;
+
+  /**
+   * @brief Returns the displacement bound of the given bucket.
+   *
+   * @param index Index of the bucket where probing starts
+   * @return The displacement bound, or `detail::unbounded_displacement`
+   */
+  [[nodiscard]] __device__ std::int32_t displacement_bound(size_type index) const noexcept;
+
+  /**
+   * @brief Raises the displacement bound of the given bucket to at least `displacement`.
+   *
+   * @param index Index of the bucket where probing starts
+   * @param displacement Number of probing steps taken by an insertion
+   */
+  __device__ void record_displacement(size_type index, std::int32_t displacement) const noexcept;
+
+ private:
+  bound_word_type* bounds_;  ///< Pointer to the displacement bounds array
+};
+
+/**
+ * @brief Array of buckets open addressing storage class with per-bucket displacement bounds.
+ *
+ * @tparam T Slot type
+ * @tparam BucketSize Number of slots in each bucket
+ * @tparam Extent Type of extent denoting number of buckets
+ * @tparam Allocator Type of allocator used for device storage (de)allocation
+ */
+template <typename T,
+          int32_t BucketSize,
+          typename Extent    = cuco::extent<std::size_t>,
+          typename Allocator = cuco::cuda_allocator<cuco::bucket<T, BucketSize>>>
+class bounded_bucket_storage : public bucket_storage<T, BucketSize, Extent, Allocator> {
+ public:
+  /// Array of buckets storage base class type
+  using base_type = bucket_storage<T, BucketSize, Extent, Allocator>;
+
+  using base_type::bucket_size;  ///< Number of elements processed per bucket
+
+  using extent_type = typename base_type::extent_type;  ///< Storage extent type
+  using size_type   = typename base_type::size_type;    ///< Storage size type
+  using value_type  = typename base_type::value_type;   ///< Slot type
+  using bucket_type = typename base_type::bucket_type;  ///< Slot bucket type
+
+  /// Storage ref type
+  using ref_type        = bounded_bucket_storage_ref<value_type, bucket_size, extent_type>;
+  using bound_word_type = typename ref_type::bound_word_type;  ///< Displacement bounds word type
+
+  /// Type of the allocator to (de)allocate displacement bounds
+  using bound_allocator_type =
+    typename std::allocator_traits<Allocator>::template rebind_alloc<bound_word_type>;
+  using bound_deleter_type =
+    detail::custom_deleter<size_type, bound_allocator_type>;  ///< Type of bounds deleter
+
+  /**
+   * @brief Constructor of bounded storage.
+   *
+   * @note The input `size` should be exclusively determined by the return value of
+   * `make_bucket_extent` since it depends on the requested low-bound value, the probing scheme, and
+   * the storage.
+   *
+   * @param size Number of buckets to (de)allocate
+   * @param allocator Allocator used for (de)allocating device storage
+   */
+  explicit constexpr bounded_bucket_storage(Extent size, Allocator const& allocator = {});
+
+  bounded_bucket_storage(bounded_bucket_storage&&) = default;  ///< Move constructor
+  /**
+   * @brief Replaces the contents of the storage with another storage.
+   *
+   * @return Reference of the current storage object
+   */
+  bounded_bucket_storage& operator=(bounded_bucket_storage&&) = default;
+  ~bounded_bucket_storage()                                   = default;  ///< Destructor
+
+  bounded_bucket_storage(bounded_bucket_storage const&)            = delete;
+  bounded_bucket_storage& operator=(bounded_bucket_storage const&) = delete;
+
+  /**
+   * @brief Gets displacement bounds array.
+   *
+   * @return Pointer to the first word of displacement bounds
+   */
+  [[nodiscard]] constexpr bound_word_type* bound_data() const noexcept;
+
+  /**
+   * @brief Gets bounded storage reference.
+   *
+   * @return Reference of bounded storage
+   */
+  [[nodiscard]] constexpr ref_type ref() const noexcept;
+
+  /**
+   * @brief Initializes each slot in the storage to contain `key` and resets all displacement
+   * bounds.
+   *
+   * @param key Key to which all keys in `slots` are initialized
+   * @param stream Stream used for executing the kernel
+   */
+  void initialize(value_type key, cuda::stream_ref stream = {});
+
+  /**
+   * @brief Asynchronously initializes each slot in the storage to contain `key` and resets all
+   * displacement bounds.
+   *
+   * @param key Key to which all keys in `slots` are initialized
+   * @param stream Stream used for executing the kernel
+   */
+  void initialize_async(value_type key, cuda::stream_ref stream = {}) noexcept;
+
+ private:
+  /**
+   * @brief Gets the number of displacement bound words.
+   *
+   * @return Number of words holding the bounds of all buckets
+   */
+  [[nodiscard]] constexpr size_type num_bound_words() const noexcept;
+
+  bound_allocator_type bound_allocator_;  ///< Allocator used to (de)allocate bounds
+  bound_deleter_type bound_deleter_;      ///< Custom bounds deleter
+  /// Pointer to the displacement bounds storage
+  std::unique_ptr<bound_word_type, bound_deleter_type> bounds_;
+};
+
+namespace detail {
+/**
+ * @brief Trait indicating whether a storage ref keeps per-bucket displacement bounds.
+ *
+ * @tparam StorageRef Storage ref type
+ */
+template <typename StorageRef>
+struct is_bounded_storage_ref : std::false_type {};
+
+/// Specialization for `cuco::bounded_bucket_storage_ref`
+template <typename T, int32_t BucketSize, typename Extent>
+struct is_bounded_storage_ref<bounded_bucket_storage_ref<T, BucketSize, Extent>>
+  : std::true_type {};
+
+/// Helper variable template for `is_bounded_storage_ref`
+template <typename StorageRef>
+inline constexpr bool is_bounded_storage_ref_v = is_bounded_storage_ref<StorageRef>::value;
+}  // namespace detail
+
+}  // namespace cuco
+
+#include <cuco/detail/storage/bounded_bucket_storage.inl>
@@ -81,7 +81,7 @@ class bucket_storage_ref : public detail::bucket_storage_base<T, BucketSize, Ext
    *
    * @return An iterator to one past the last slot
    */
-  [[nodiscard]] __device__ constexpr iterator end() noexcept;
+  [[nodiscard]] __host__ __device__ constexpr iterator end() noexcept;
 
   /**
    * @brief Returns a const_iterator to one past the last slot.
@@ -91,21 +91,21 @@ class bucket_storage_ref : public detail::bucket_storage_base<T, BucketSize, Ext
    *
    * @return A const_iterator to one past the last slot
    */
-  [[nodiscard]] __device__ constexpr const_iterator end() const noexcept;
+  [[nodiscard]] __host__ __device__ constexpr const_iterator end() const noexcept;
 
   /**
    * @brief Gets buckets array.
    *
    * @return Pointer to the first bucket
    */
-  [[nodiscard]] __device__ constexpr bucket_type* data() noexcept;
+  [[nodiscard]] __host__ __device__ constexpr bucket_type* data() noexcept;
 
   /**
    * @brief Gets bucket array.
    *
    * @return Pointer to the first bucket
    */
-  [[nodiscard]] __device__ constexpr bucket_type* data() const noexcept;
+  [[nodiscard]] __host__ __device__ constexpr bucket_type* data() const noexcept;
 
   /**
    * @brief Returns an array of slots (or a bucket) for a given index.
@@ -113,7 +113,8 @@ class bucket_storage_ref : public detail::bucket_storage_base<T, BucketSize, Ext
    * @param index Index of the bucket
    * @return An array of slots
    */
-  [[nodiscard]] __device__ constexpr bucket_type operator[](size_type index) const noexcept;
+  [[nodiscard]] __host__ __device__ constexpr bucket_type operator[](
+    size_type index) const noexcept;
 
  private:
   bucket_type* buckets_;  ///< Pointer to the buckets array
@@ -209,6 +210,9 @@ class bucket_storage : public detail::bucket_storage_base<T, BucketSize, Extent>
   /**
    * @brief Asynchronously initializes each slot in the bucket storage to contain `key`.
    *
+   * @note With `cuco::host_allocator`, the slots are initialized on the host before this function
+   * returns.
+   *
    * @param key Key to which all keys in `slots` are initialized
    * @param stream Stream used for executing the kernel
    */
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/bucket_storage.cuh>
+#include <cuco/detail/storage/bucket_storage_base.cuh>
+#include <cuco/extent.cuh>
+#include <cuco/utility/allocator.hpp>
+#include <cuco/utility/perf_counters.hpp>
+
+#include <cuda/stream_ref>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace cuco {
+/**
+ * @brief Non-owning array of buckets storage reference type with device performance counters.
+ *
+ * Besides the buckets, the ref points to one 64-bit device counter per `detail::perf_event`.
+ * Container refs bump these counters while probing, see `cuco::perf_counters` for the events
+ * being counted. Increments are aggregated across the converged threads of a warp so that each
+ * event costs at most one atomic per warp.
+ *
+ * @tparam T Storage element type
+ * @tparam BucketSize Number of slots in each bucket
+ * @tparam Extent Type of extent denoting storage capacity
+ */
+template <typename T, int32_t BucketSize, typename Extent = cuco::extent<std::size_t>>
+class counted_bucket_storage_ref : public bucket_storage_ref<T, BucketSize, Extent> {
+ public:
+  /// Array of buckets storage ref base class type
+  using base_type = bucket_storage_ref<T, BucketSize, Extent>;
+
+  using base_type::bucket_size;  ///< Number of elements processed per bucket
+
+  using extent_type = typename base_type::extent_type;  ///< Storage extent type
+  using size_type   = typename base_type::size_type;    ///< Storage size type
+  using value_type  = typename base_type::value_type;   ///< Slot type
+  using bucket_type = typename base_type::bucket_type;  ///< Slot bucket type
+
+  using counter_type = std::uint64_t;  ///< Type of a single performance counter
+
+  /**
+   * @brief Constructor of counted storage ref.
+   *
+   * @param size Number of buckets
+   * @param buckets Pointer to the buckets array
+   * @param counters Pointer to `detail::num_perf_events` device counters
+   */
+  __host__ __device__ explicit constexpr counted_bucket_storage_ref(
+    Extent size, bucket_type* buckets, counter_type* counters) noexcept;
+
+  /**
+   * @brief Gets the device performance counters.
+   *
+   * @return Pointer to the first counter
+   */
+  [[nodiscard]] __host__ __device__ constexpr counter_type* counters() const noexcept;
+
+  /**
+   * @brief Counts one occurrence of `Event` for each converged thread of the calling warp.
+   *
+   * @tparam Event Kind of the event to count
+   */
+  template <detail::perf_event Event>
+  __device__ void record() const noexcept;
+
+ private:
+  counter_type* counters_;  ///< Pointer to the performance counters
+};
+
+/**
+ * @brief Array of buckets open addressing storage class with device performance counters.
+ *
+ * @tparam T Slot type
+ * @tparam BucketSize Number of slots in each bucket
+ * @tparam Extent Type of extent denoting number of buckets
+ * @tparam Allocator Type of allocator used for device storage (de)allocation
+ */
+template <typename T,
+          int32_t BucketSize,
+          typename Extent    = cuco::extent<std::size_t>,
+          typename Allocator = cuco::cuda_allocator<cuco::bucket<T, BucketSize>>>
+class counted_bucket_storage : public bucket_storage<T, BucketSize, Extent, Allocator> {
+ public:
+  /// Array of buckets storage base class type
+  using base_type = bucket_storage<T, BucketSize, Extent, Allocator>;
+
+  using base_type::bucket_size;  ///< Number of elements processed per bucket
+
+  using extent_type = typename base_type::extent_type;  ///< Storage extent type
+  using size_type   = typename base_type::size_type;    ///< Storage size type
+  using value_type  = typename base_type::value_type;   ///< Slot type
+  using bucket_type = typename base_type::bucket_type;  ///< Slot bucket type
+
+  /// Storage ref type
+  using ref_type     = counted_bucket_storage_ref<value_type, bucket_size, extent_type>;
+  using counter_type = typename ref_type::counter_type;  ///< Type of a single performance counter
+
+  /// Type of the allocator to (de)allocate performance counters
+  using counter_allocator_type =
+    typename std::allocator_traits<Allocator>::template rebind_alloc<counter_type>;
+  using counter_deleter_type =
+    detail::custom_deleter<size_type, counter_allocator_type>;  ///< Type of counters deleter
+
+  /**
+   * @brief Constructor of counted storage.
+   *
+   * @note The input `size` should be exclusively determined by the return value of
+   * `make_bucket_extent` since it depends on the requested low-bound value, the probing scheme, and
+   * the storage.
+   *
+   * @param size Number of buckets to (de)allocate
+   * @param allocator Allocator used for (de)allocating device storage
+   */
+  explicit constexpr counted_bucket_storage(Extent size, Allocator const& allocator = {});
+
+  counted_bucket_storage(counted_bucket_storage&&) = default;  ///< Move constructor
+  /**
+   * @brief Replaces the contents of the storage with another storage.
+   *
+   * @return Reference of the current storage object
+   */
+  counted_bucket_storage& operator=(counted_bucket_storage&&) = default;
+  ~counted_bucket_storage()                                   = default;  ///< Destructor
+
+  counted_bucket_storage(counted_bucket_storage const&)            = delete;
+  counted_bucket_storage& operator=(counted_bucket_storage const&) = delete;
+
+  /**
+   * @brief Gets the device performance counters.
+   *
+   * @return Pointer to the first counter
+   */
+  [[nodiscard]] constexpr counter_type* counters() const noexcept;
+
+  /**
+   * @brief Gets counted storage reference.
+   *
+   * @return Reference of counted storage
+   */
+  [[nodiscard]] constexpr ref_type ref() const noexcept;
+
+  /**
+   * @brief Initializes each slot in the storage to contain `key` and resets all performance
+   * counters.
+   *
+   * @param key Key to which all keys in `slots` are initialized
+   * @param stream Stream used for executing the kernel
+   */
+  void initialize(value_type key, cuda::stream_ref stream = {});
+
+  /**
+   * @brief Asynchronously initializes each slot in the storage to contain `key` and resets all
+   * performance counters.
+   *
+   * @param key Key to which all keys in `slots` are initialized
+   * @param stream Stream used for executing the kernel
+   */
+  void initialize_async(value_type key, cuda::stream_ref stream = {}) noexcept;
+
+ private:
+  counter_allocator_type counter_allocator_;  ///< Allocator used to (de)allocate counters
+  counter_deleter_type counter_deleter_;      ///< Custom counters deleter
+  /// Pointer to the performance counters storage
+  std::unique_ptr<counter_type, counter_deleter_type> counters_;
+};
+
+namespace detail {
+/**
+ * @brief Trait indicating whether a storage ref collects device performance counters.
+ *
+ * @tparam StorageRef Storage ref type
+ */
+template <typename StorageRef>
+struct is_counted_storage_ref : std::false_type {};
+
+/// Specialization for `cuco::counted_bucket_storage_ref`
+template <typename T, int32_t BucketSize, typename Extent>
+struct is_counted_storage_ref<counted_bucket_storage_ref<T, BucketSize, Extent>>
+  : std::true_type {};
+
+/// Helper variable template for `is_counted_storage_ref`
+template <typename StorageRef>
+inline constexpr bool is_counted_storage_ref_v = is_counted_storage_ref<StorageRef>::value;
+}  // namespace detail
+
+}  // namespace cuco
+
+#include <cuco/detail/storage/counted_bucket_storage.inl>
@@ -23,6 +23,8 @@
 #include <cuda/stream_ref>
 
 #include <cstddef>
+#include <string>
+#include <vector>
 
 namespace cuco {
 
@@ -161,6 +163,36 @@ template <class Key, class Extent, cuda::thread_scope Scope, class Policy, class
   return allocator_;
 }
 
+template <class Key, class Extent, cuda::thread_scope Scope, class Policy, class Allocator>
+__host__ void bloom_filter<Key, Extent, Scope, Policy, Allocator>::save(
+  std::string const& path, cuda::stream_ref stream) const
+{
+  auto config = std::vector<std::byte>{};
+  detail::append_persisted_config(config, ref_.policy());
+  detail::write_persisted_file(path,
+                               this->persisted_header_for(),
+                               config,
+                               this->data(),
+                               this->payload_bytes(),
+                               detail::is_host_allocator_v<allocator_type>,
+                               stream);
+}
+
+template <class Key, class Extent, cuda::thread_scope Scope, class Policy, class Allocator>
+__host__ void bloom_filter<Key, Extent, Scope, Policy, Allocator>::load(
+  std::string const& path, cuda::stream_ref stream)
+{
+  auto config = std::vector<std::byte>{};
+  detail::append_persisted_config(config, ref_.policy());
+  detail::read_persisted_file(path,
+                              this->persisted_header_for(),
+                              config,
+                              this->data(),
+                              this->payload_bytes(),
+                              detail::is_host_allocator_v<allocator_type>,
+                              stream);
+}
+
 template <class Key, class Extent, cuda::thread_scope Scope, class Policy, class Allocator>
 [[nodiscard]] __host__ constexpr
   typename bloom_filter<Key, Extent, Scope, Policy, Allocator>::ref_type<>
@@ -169,4 +201,28 @@ template <class Key, class Extent, cuda::thread_scope Scope, class Policy, class
   return ref_;
 }
 
-}  // namespace cuco
\ No newline at end of file
+template <class Key, class Extent, cuda::thread_scope Scope, class Policy, class Allocator>
+__host__ persisted_header
+bloom_filter<Key, Extent, Scope, Policy, Allocator>::persisted_header_for() const noexcept
+{
+  persisted_header header{};
+  header.kind             = persisted_kind::bloom_filter;
+  header.type_fingerprint = detail::type_fingerprint<bloom_filter>();
+  header.key_bytes        = sizeof(key_type);
+  header.slot_bytes       = sizeof(word_type);
+  header.bucket_size      = words_per_block;
+  header.cg_size          = 1;
+  header.num_buckets      = static_cast<size_type>(this->block_extent());
+  header.capacity         = header.num_buckets * words_per_block;
+  return header;
+}
+
+template <class Key, class Extent, cuda::thread_scope Scope, class Policy, class Allocator>
+__host__ std::uint64_t
+bloom_filter<Key, Extent, Scope, Policy, Allocator>::payload_bytes() const noexcept
+{
+  return static_cast<std::uint64_t>(static_cast<size_type>(this->block_extent())) *
+         sizeof(typename ref_type<>::filter_block_type);
+}
+
+}  // namespace cuco
@@ -331,6 +331,11 @@ class bloom_filter_impl {
     return num_blocks_;
   }
 
+  [[nodiscard]] __host__ __device__ constexpr policy_type const& policy() const noexcept
+  {
+    return policy_;
+  }
+
   // TODO
   // [[nodiscard]] __host__ double occupancy() const;
   // [[nodiscard]] __host__ double expected_false_positive_rate(size_t unique_keys) const
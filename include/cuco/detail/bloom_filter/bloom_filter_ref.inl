@@ -187,4 +187,12 @@ template <class Key, class Extent, cuda::thread_scope Scope, class Policy>
   return impl_.block_extent();
 }
 
+template <class Key, class Extent, cuda::thread_scope Scope, class Policy>
+[[nodiscard]] __host__ __device__ constexpr
+  typename bloom_filter_ref<Key, Extent, Scope, Policy>::policy_type const&
+  bloom_filter_ref<Key, Extent, Scope, Policy>::policy() const noexcept
+{
+  return impl_.policy();
+}
+
 }  // namespace cuco
\ No newline at end of file
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cuco/detail/error.hpp>
+#include <cuco/detail/utils.cuh>
 
 #include <cuda/std/bit>
 #include <cuda/std/limits>
@@ -42,6 +43,10 @@ class default_filter_policy_impl {
   static constexpr std::uint32_t word_bits       = cuda::std::numeric_limits<word_type>::digits;
   static constexpr std::uint32_t bit_index_width = cuda::std::bit_width(word_bits - 1);
 
+  // Multi-word hash values select the block from their first word and the pattern from their last
+  using pattern_hash_type = cuda::std::decay_t<decltype(cuco::detail::last_hash_word(
+    std::declval<hash_result_type>()))>;
+
  public:
   __host__ __device__ explicit constexpr default_filter_policy_impl(uint32_t pattern_bits,
                                                                     Hash hash)
@@ -58,7 +63,7 @@ class default_filter_policy_impl {
     // filter block
     constexpr uint32_t max_pattern_bits = word_bits * words_per_block;
 
-    constexpr uint32_t hash_bits = cuda::std::numeric_limits<hash_result_type>::digits;
+    constexpr uint32_t hash_bits = cuda::std::numeric_limits<pattern_hash_type>::digits;
     constexpr uint32_t max_pattern_bits_from_hash = hash_bits / bit_index_width;
 
     NV_DISPATCH_TARGET(
@@ -86,7 +91,7 @@ class default_filter_policy_impl {
   template <class Extent>
   __device__ constexpr auto block_index(hash_result_type hash, Extent num_blocks) const
   {
-    return hash % num_blocks;
+    return cuco::detail::hash_word<0>(hash) % num_blocks;
   }
 
   __device__ constexpr word_type word_pattern(hash_result_type hash, std::uint32_t word_index) const
@@ -96,14 +101,15 @@ class default_filter_policy_impl {
     auto const bits_so_far = min_bits_per_word_ * word_index +
                              (word_index < remainder_bits_ ? word_index : remainder_bits_);
 
-    hash >>= bits_so_far * bit_index_width;
+    pattern_hash_type pattern_hash = cuco::detail::last_hash_word(hash);
+    pattern_hash >>= bits_so_far * bit_index_width;
 
     word_type word        = 0;
     int32_t bits_per_word = min_bits_per_word_ + (word_index < remainder_bits_ ? 1 : 0);
 
     for (int32_t bit = 0; bit < bits_per_word; ++bit) {
-      word |= word_type{1} << (hash & bit_index_mask);
-      hash >>= bit_index_width;
+      word |= word_type{1} << (pattern_hash & bit_index_mask);
+      pattern_hash >>= bit_index_width;
     }
 
     return word;
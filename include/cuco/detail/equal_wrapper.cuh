@@ -71,7 +71,7 @@ struct equal_wrapper {
    * @return `EQUAL` if `lhs` and `rhs` are equivalent. `UNEQUAL` otherwise.
    */
   template <typename LHS, typename RHS>
-  __device__ constexpr equal_result equal_to(LHS const& lhs, RHS const& rhs) const noexcept
+  __host__ __device__ constexpr equal_result equal_to(LHS const& lhs, RHS const& rhs) const noexcept
   {
     return equal_(lhs, rhs) ? equal_result::EQUAL : equal_result::UNEQUAL;
   }
@@ -94,7 +94,8 @@ struct equal_wrapper {
    * @return Three way equality comparison result
    */
   template <is_insert IsInsert, typename LHS, typename RHS>
-  __device__ constexpr equal_result operator()(LHS const& lhs, RHS const& rhs) const noexcept
+  __host__ __device__ constexpr equal_result operator()(LHS const& lhs,
+                                                        RHS const& rhs) const noexcept
   {
     if constexpr (IsInsert == is_insert::YES) {
       return (cuco::detail::bitwise_compare(rhs, empty_sentinel_) or
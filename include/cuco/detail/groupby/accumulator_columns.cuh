@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/utility/cuda.hpp>
+
+#include <cuda/atomic>
+#include <cuda/std/array>
+#include <cuda/std/cstdint>
+#include <cuda/std/tuple>
+#include <cuda/std/utility>
+
+#include <cstddef>
+
+namespace cuco::detail::groupby_ns {
+
+template <typename Aggregations>
+class accumulator_columns;
+
+/**
+ * @brief Non-owning view of the per-group accumulators of a `cuco::groupby`.
+ *
+ * Row `i` holds the accumulators of the group whose key is stored in slot `i` of the key
+ * storage. All columns live in a single byte buffer: a row count column comes first, followed by
+ * one column of `Aggregation::accumulator_type` per aggregation, each aligned to its type.
+ *
+ * @tparam Aggregations Aggregation types, see `include/cuco/utility/aggregations.cuh`
+ */
+template <typename... Aggregations>
+class accumulator_columns<cuda::std::tuple<Aggregations...>> {
+  static_assert(sizeof...(Aggregations) > 0, "At least one aggregation is required.");
+  static_assert(((alignof(typename Aggregations::accumulator_type) <= 16) and ...),
+                "Accumulator types must not be over-aligned.");
+
+ public:
+  using index_type = cuco::detail::index_type;  ///< Row index type
+  using count_type = cuda::std::uint64_t;       ///< Row count type
+
+  static constexpr std::size_t num_aggregations = sizeof...(Aggregations);  ///< Column count
+
+  /**
+   * @brief Computes the number of bytes required by `num_rows` rows.
+   *
+   * @param num_rows Number of rows
+   * @return Size of the byte buffer in bytes
+   */
+  [[nodiscard]] __host__ __device__ static constexpr std::size_t bytes(
+    index_type num_rows) noexcept
+  {
+    return offsets(num_rows)[num_aggregations];
+  }
+
+  /**
+   * @brief Constructs a view of the columns held by `base`.
+   *
+   * @param base Pointer to a 16-byte aligned buffer of at least `bytes(num_rows)` bytes
+   * @param num_rows Number of rows
+   */
+  __host__ __device__ accumulator_columns(char* base, index_type num_rows) noexcept
+    : accumulator_columns{base, offsets(num_rows), cuda::std::index_sequence_for<Aggregations...>{}}
+  {
+  }
+
+  /**
+   * @brief Resets the row count and all accumulators of a row to their identities.
+   *
+   * @param row Row index
+   */
+  __device__ void initialize(index_type row) const noexcept
+  {
+    counts_[row] = 0;
+    for_each_column([&](auto i) {
+      using aggregation_type                 = aggregation_t<decltype(i)::value>;
+      cuda::std::get<i>(accumulators_)[row] = aggregation_type::identity();
+    });
+  }
+
+  /**
+   * @brief Atomically applies the `idx`-th input value of each column to a row.
+   *
+   * @tparam Scope Scope of the atomic operations
+   * @tparam ValueIts Tuple of device accessible input iterators, one per aggregation
+   *
+   * @param row Row index
+   * @param values Input value columns
+   * @param idx Index of the input row
+   */
+  template <cuda::thread_scope Scope, typename ValueIts>
+  __device__ void accumulate(index_type row, ValueIts const& values, index_type idx) const noexcept
+  {
+    cuda::atomic_ref<count_type, Scope>{counts_[row]}.fetch_add(1, cuda::memory_order_relaxed);
+    for_each_column([&](auto i) {
+      using aggregation_type = aggregation_t<decltype(i)::value>;
+      using accumulator_type = typename aggregation_type::accumulator_type;
+      typename aggregation_type::reduction_op{}(
+        cuda::atomic_ref<accumulator_type, Scope>{cuda::std::get<i>(accumulators_)[row]},
+        aggregation_type::lift(*(cuda::std::get<i>(values) + idx)));
+    });
+  }
+
+  /**
+   * @brief Atomically merges a row of another set of columns into a row.
+   *
+   * @tparam Scope Scope of the atomic operations
+   *
+   * @param row Row index
+   * @param other Columns to merge from
+   * @param other_row Index of the row in `other`
+   */
+  template <cuda::thread_scope Scope>
+  __device__ void merge(index_type row,
+                        accumulator_columns const& other,
+                        index_type other_row) const noexcept
+  {
+    cuda::atomic_ref<count_type, Scope>{counts_[row]}.fetch_add(other.counts_[other_row],
+                                                                cuda::memory_order_relaxed);
+    for_each_column([&](auto i) {
+      using aggregation_type = aggregation_t<decltype(i)::value>;
+      using accumulator_type = typename aggregation_type::accumulator_type;
+      typename aggregation_type::reduction_op{}(
+        cuda::atomic_ref<accumulator_type, Scope>{cuda::std::get<i>(accumulators_)[row]},
+        cuda::std::get<i>(other.accumulators_)[other_row]);
+    });
+  }
+
+  /**
+   * @brief Writes the results of a row to the `pos`-th element of each output column.
+   *
+   * @tparam OutputIts Tuple of device accessible output iterators, one per aggregation
+   *
+   * @param row Row index
+   * @param outputs Output columns
+   * @param pos Output position
+   */
+  template <typename OutputIts>
+  __device__ void finalize(index_type row, OutputIts const& outputs, index_type pos) const noexcept
+  {
+    auto const num_rows = counts_[row];
+    for_each_column([&](auto i) {
+      using aggregation_type = aggregation_t<decltype(i)::value>;
+      *(cuda::std::get<i>(outputs) + pos) =
+        aggregation_type::finalize(cuda::std::get<i>(accumulators_)[row], num_rows);
+    });
+  }
+
+ private:
+  template <std::size_t I>
+  using aggregation_t = cuda::std::tuple_element_t<I, cuda::std::tuple<Aggregations...>>;
+
+  using offsets_type = cuda::std::array<std::size_t, num_aggregations + 1>;
+
+  /**
+   * @brief Computes the byte offset of each accumulator column and the total size.
+   *
+   * @param num_rows Number of rows
+   * @return Offsets of the accumulator columns followed by the buffer size
+   */
+  [[nodiscard]] __host__ __device__ static constexpr offsets_type offsets(
+    index_type num_rows) noexcept
+  {
+    auto const align_up = [](std::size_t offset, std::size_t alignment) {
+      return (offset + alignment - 1) / alignment * alignment;
+    };
+
+    offsets_type result{};
+    std::size_t end = sizeof(count_type) * num_rows;
+    std::size_t i   = 0;
+    ((end         = align_up(end, alignof(typename Aggregations::accumulator_type)),
+      result[i++] = end,
+      end += sizeof(typename Aggregations::accumulator_type) * num_rows),
+     ...);
+    result[num_aggregations] = end;
+    return result;
+  }
+
+  template <std::size_t... I>
+  __host__ __device__ accumulator_columns(char* base,
+                                          offsets_type const& offsets,
+                                          cuda::std::index_sequence<I...>) noexcept
+    : counts_{reinterpret_cast<count_type*>(base)},
+      accumulators_{
+        reinterpret_cast<typename Aggregations::accumulator_type*>(base + offsets[I])...}
+  {
+  }
+
+  /**
+   * @brief Invokes `f` with the index of each accumulator column as an integral constant.
+   */
+  template <typename F>
+  __device__ static void for_each_column(F&& f) noexcept
+  {
+    for_each_column(f, cuda::std::index_sequence_for<Aggregations...>{});
+  }
+
+  template <typename F, std::size_t... I>
+  __device__ static void for_each_column(F& f, cuda::std::index_sequence<I...>) noexcept
+  {
+    (f(cuda::std::integral_constant<std::size_t, I>{}), ...);
+  }
+
+  count_type* counts_;  ///< Row count column
+  /// Accumulator columns, one per aggregation
+  cuda::std::tuple<typename Aggregations::accumulator_type*...> accumulators_;
+};
+
+}  // namespace cuco::detail::groupby_ns
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/groupby/helpers.cuh>
+#include <cuco/detail/groupby/kernels.cuh>
+#include <cuco/detail/storage/counter_storage.cuh>
+#include <cuco/detail/utility/cuda.hpp>
+#include <cuco/operator.hpp>
+
+#include <cuda/std/tuple>
+
+#include <cstddef>
+
+namespace cuco {
+
+template <class Key,
+          class Aggregations,
+          class Extent,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator>
+constexpr groupby<Key, Aggregations, Extent, KeyEqual, ProbingScheme, Allocator>::groupby(
+  Extent capacity,
+  empty_key<Key> empty_key_sentinel,
+  KeyEqual const& pred,
+  ProbingScheme const& probing_scheme,
+  Allocator const& alloc,
+  cuda::stream_ref stream)
+  : keys_{capacity,
+          empty_key_sentinel,
+          pred,
+          probing_scheme,
+          cuda_thread_scope<thread_scope>{},
+          cuco::storage<1>{},
+          alloc,
+          stream},
+    column_allocator_{alloc},
+    accumulators_{column_allocator_.allocate(columns_type::bytes(keys_.capacity())),
+                  column_deleter_type{columns_type::bytes(keys_.capacity()), column_allocator_}}
+{
+  auto const num_rows  = static_cast<cuco::detail::index_type>(keys_.capacity());
+  auto const grid_size = cuco::detail::grid_size(num_rows);
+
+  detail::groupby_ns::initialize<cuco::detail::default_block_size()>
+    <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(this->columns(),
+                                                                          num_rows);
+}
+
+template <class Key,
+          class Aggregations,
+          class Extent,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator>
+void groupby<Key, Aggregations, Extent, KeyEqual, ProbingScheme, Allocator>::clear(
+  cuda::stream_ref stream)
+{
+  this->clear_async(stream);
+  stream.wait();
+}
+
+template <class Key,
+          class Aggregations,
+          class Extent,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator>
+void groupby<Key, Aggregations, Extent, KeyEqual, ProbingScheme, Allocator>::clear_async(
+  cuda::stream_ref stream) noexcept
+{
+  keys_.clear_async(stream);
+
+  auto const num_rows  = static_cast<cuco::detail::index_type>(keys_.capacity());
+  auto const grid_size = cuco::detail::grid_size(num_rows);
+
+  detail::groupby_ns::initialize<cuco::detail::default_block_size()>
+    <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(this->columns(),
+                                                                          num_rows);
+}
+
+template <class Key,
+          class Aggregations,
+          class Extent,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator>
+template <typename InputIt, typename ValueIts>
+void groupby<Key, Aggregations, Extent, KeyEqual, ProbingScheme, Allocator>::aggregate(
+  InputIt first, InputIt last, ValueIts values, cuda::stream_ref stream)
+{
+  this->aggregate_async(first, last, values, stream);
+  stream.wait();
+}
+
+template <class Key,
+          class Aggregations,
+          class Extent,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator>
+template <typename InputIt, typename ValueIts>
+void groupby<Key, Aggregations, Extent, KeyEqual, ProbingScheme, Allocator>::aggregate_async(
+  InputIt first, InputIt last, ValueIts values, cuda::stream_ref stream) noexcept
+{
+  static_assert(cuda::std::tuple_size_v<ValueIts> == num_aggregations,
+                "One value column is required per aggregation.");
+
+  detail::groupby_ns::dispatch_aggregate<allocator_type>(
+    first, last, values, this->columns(), keys_.ref(op::insert_and_find), stream);
+}
+
+template <class Key,
+          class Aggregations,
+          class Extent,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator>
+template <typename KeyOut, typename OutputIts>
+KeyOut groupby<Key, Aggregations, Extent, KeyEqual, ProbingScheme, Allocator>::retrieve(
+  KeyOut keys_out, OutputIts results_out, cuda::stream_ref stream) const
+{
+  static_assert(cuda::std::tuple_size_v<OutputIts> == num_aggregations,
+                "One output column is required per aggregation.");
+
+  auto counter = detail::counter_storage<size_type, thread_scope, column_allocator_type>{
+    detail::with_stream(column_allocator_, stream)};
+  counter.reset(stream);
+
+  auto const grid_size = cuco::detail::grid_size(keys_.capacity());
+
+  detail::groupby_ns::retrieve<cuco::detail::default_block_size()>
+    <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+      this->columns(), keys_out, results_out, counter.data(), keys_.ref(op::find));
+
+  return keys_out + counter.load_to_host(stream);
+}
+
+template <class Key,
+          class Aggregations,
+          class Extent,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator>
+groupby<Key, Aggregations, Extent, KeyEqual, ProbingScheme, Allocator>::size_type
+groupby<Key, Aggregations, Extent, KeyEqual, ProbingScheme, Allocator>::size(
+  cuda::stream_ref stream) const
+{
+  return keys_.size(stream);
+}
+
+template <class Key,
+          class Aggregations,
+          class Extent,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator>
+constexpr auto groupby<Key, Aggregations, Extent, KeyEqual, ProbingScheme, Allocator>::capacity()
+  const noexcept
+{
+  return keys_.capacity();
+}
+
+template <class Key,
+          class Aggregations,
+          class Extent,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator>
+constexpr groupby<Key, Aggregations, Extent, KeyEqual, ProbingScheme, Allocator>::key_type
+groupby<Key, Aggregations, Extent, KeyEqual, ProbingScheme, Allocator>::empty_key_sentinel()
+  const noexcept
+{
+  return keys_.empty_key_sentinel();
+}
+
+template <class Key,
+          class Aggregations,
+          class Extent,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator>
+groupby<Key, Aggregations, Extent, KeyEqual, ProbingScheme, Allocator>::key_set_type const&
+groupby<Key, Aggregations, Extent, KeyEqual, ProbingScheme, Allocator>::keys() const noexcept
+{
+  return keys_;
+}
+
+template <class Key,
+          class Aggregations,
+          class Extent,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator>
+groupby<Key, Aggregations, Extent, KeyEqual, ProbingScheme, Allocator>::columns_type
+groupby<Key, Aggregations, Extent, KeyEqual, ProbingScheme, Allocator>::columns() const noexcept
+{
+  return columns_type{accumulators_.get(), static_cast<cuco::detail::index_type>(keys_.capacity())};
+}
+}  // namespace cuco
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/groupby/kernels.cuh>
+#include <cuco/detail/utility/cuda.cuh>
+#include <cuco/detail/utility/cuda.hpp>
+#include <cuco/detail/utils.hpp>
+#include <cuco/extent.cuh>
+#include <cuco/static_set.cuh>
+#include <cuco/storage.cuh>
+
+#include <cuda/stream_ref>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace cuco::detail::groupby_ns {
+
+/**
+ * @brief Dispatches to the shared memory pre-aggregation kernel if `num_elements_per_thread > 2`
+ * and the block-local table fits into static shared memory, else fallbacks to the global memory
+ * aggregation kernel.
+ *
+ * @tparam Allocator Allocator type used to created shared memory set
+ * @tparam InputIt Device accessible input iterator whose `value_type` is convertible to the
+ * container's `key_type`
+ * @tparam ValueIts Tuple of device accessible input iterators, one per aggregation
+ * @tparam Columns Accumulator columns type
+ * @tparam Ref Type of non-owning device ref allowing access to storage
+ *
+ * @param first Beginning of the sequence of keys
+ * @param last End of the sequence of keys
+ * @param values Input value columns
+ * @param columns Accumulator columns parallel to the slot storage
+ * @param ref Non-owning container device ref used to access the slot storage
+ * @param stream CUDA stream used for aggregate operation
+ */
+template <typename Allocator,
+          typename InputIt,
+          typename ValueIts,
+          typename Columns,
+          typename Ref>
+void dispatch_aggregate(
+  InputIt first, InputIt last, ValueIts values, Columns columns, Ref ref, cuda::stream_ref stream)
+{
+  auto const num = cuco::detail::distance(first, last);
+  if (num == 0) { return; }
+
+  int32_t const default_grid_size = cuco::detail::grid_size(num);
+
+  using shmem_size_type = int32_t;
+
+  // Smaller than the `insert_or_apply` block so that several accumulator columns fit
+  int32_t constexpr shmem_block_size                = 256;
+  shmem_size_type constexpr cardinality_threshold   = shmem_block_size;
+  shmem_size_type constexpr shared_set_num_elements = cardinality_threshold + shmem_block_size;
+  float constexpr load_factor                       = 0.7;
+  shmem_size_type constexpr shared_set_size =
+    static_cast<shmem_size_type>((1.0 / load_factor) * shared_set_num_elements);
+
+  using extent_type     = cuco::extent<shmem_size_type, shared_set_size>;
+  using shared_set_type = cuco::static_set<typename Ref::key_type,
+                                           extent_type,
+                                           cuda::thread_scope_block,
+                                           typename Ref::key_equal,
+                                           typename Ref::probing_scheme_type,
+                                           Allocator,
+                                           cuco::storage<1>>;
+
+  using shared_set_ref_type    = typename shared_set_type::template ref_type<>;
+  auto constexpr bucket_extent = cuco::make_bucket_extent<shared_set_ref_type>(extent_type{});
+
+  std::size_t constexpr max_static_shmem_bytes = 48 * 1024;
+  std::size_t constexpr shmem_bytes =
+    sizeof(typename shared_set_ref_type::bucket_type) * bucket_extent.value() +
+    Columns::bytes(bucket_extent.value());
+
+  if constexpr (shmem_bytes <= max_static_shmem_bytes) {
+    auto aggregate_shmem_fn_ptr = aggregate_shmem<shmem_block_size,
+                                                  shared_set_ref_type,
+                                                  InputIt,
+                                                  ValueIts,
+                                                  Columns,
+                                                  Ref>;
+
+    int32_t const max_op_grid_size =
+      cuco::detail::max_occupancy_grid_size(shmem_block_size, aggregate_shmem_fn_ptr);
+
+    int32_t const shmem_default_grid_size =
+      cuco::detail::grid_size(num, 1, cuco::detail::default_stride(), shmem_block_size);
+
+    auto const shmem_grid_size         = std::min(shmem_default_grid_size, max_op_grid_size);
+    auto const num_elements_per_thread = num / (shmem_grid_size * shmem_block_size);
+
+    // use shared_memory only if each thread has atleast 3 elements to process
+    if (num_elements_per_thread > 2) {
+      aggregate_shmem<shmem_block_size, shared_set_ref_type>
+        <<<shmem_grid_size, shmem_block_size, 0, stream.get()>>>(
+          first, num, values, columns, ref, bucket_extent);
+      return;
+    }
+  }
+
+  aggregate<cuco::detail::default_block_size()>
+    <<<default_grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+      first, num, values, columns, ref);
+}
+}  // namespace cuco::detail::groupby_ns
@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/bitwise_compare.cuh>
+#include <cuco/detail/utility/cuda.cuh>
+#include <cuco/operator.hpp>
+
+#include <cuda/atomic>
+
+#include <cooperative_groups.h>
+#include <cooperative_groups/reduce.h>
+
+#include <iterator>
+
+namespace cuco::detail::groupby_ns {
+CUCO_SUPPRESS_KERNEL_WARNINGS
+
+/**
+ * @brief Computes the flat slot index of the slot pointed to by `iter`.
+ *
+ * The flat slot index is also the index of the corresponding row of accumulators.
+ *
+ * @tparam Ref Type of non-owning device container ref allowing access to storage
+ * @tparam Iterator Slot iterator type
+ *
+ * @param ref Non-owning container device ref used to access the slot storage
+ * @param iter Iterator to a slot
+ *
+ * @return The flat slot index
+ */
+template <typename Ref, typename Iterator>
+__device__ constexpr cuco::detail::index_type slot_index(Ref const& ref, Iterator iter) noexcept
+{
+  auto const* const slots =
+    reinterpret_cast<typename Ref::value_type const*>(ref.storage_ref().data());
+  return static_cast<cuco::detail::index_type>(&(*iter) - slots);
+}
+
+/**
+ * @brief Resets the first `n` rows of accumulators.
+ *
+ * @tparam BlockSize Number of threads in each block
+ * @tparam Columns Accumulator columns type
+ *
+ * @param columns Accumulator columns
+ * @param n Number of rows to reset
+ */
+template <int32_t BlockSize, typename Columns>
+CUCO_KERNEL __launch_bounds__(BlockSize) void initialize(Columns columns,
+                                                         cuco::detail::index_type n)
+{
+  auto const loop_stride = cuco::detail::grid_stride();
+  auto idx               = cuco::detail::global_thread_id();
+
+  while (idx < n) {
+    columns.initialize(idx);
+    idx += loop_stride;
+  }
+}
+
+/**
+ * @brief Aggregates the rows in `[0, n)` directly into the global accumulators.
+ *
+ * @tparam BlockSize Number of threads in each block
+ * @tparam InputIt Device accessible input iterator whose `value_type` is convertible to the
+ * container's `key_type`
+ * @tparam ValueIts Tuple of device accessible input iterators, one per aggregation
+ * @tparam Columns Accumulator columns type
+ * @tparam Ref Type of non-owning device container ref allowing access to storage
+ *
+ * @param first Beginning of the sequence of keys
+ * @param n Number of input rows
+ * @param values Input value columns
+ * @param columns Accumulator columns parallel to the slot storage
+ * @param ref Non-owning container device ref used to access the slot storage
+ */
+template <int32_t BlockSize,
+          typename InputIt,
+          typename ValueIts,
+          typename Columns,
+          typename Ref>
+CUCO_KERNEL __launch_bounds__(BlockSize) void aggregate(
+  InputIt first, cuco::detail::index_type n, ValueIts values, Columns columns, Ref ref)
+{
+  auto const loop_stride = cuco::detail::grid_stride();
+  auto idx               = cuco::detail::global_thread_id();
+
+  while (idx < n) {
+    typename std::iterator_traits<InputIt>::value_type const& key = *(first + idx);
+    auto const row = slot_index(ref, ref.insert_and_find(key).first);
+    columns.template accumulate<Ref::thread_scope>(row, values, idx);
+    idx += loop_stride;
+  }
+}
+
+/**
+ * @brief Aggregates the rows in `[0, n)` into a block-local table in shared memory first, then
+ * merges the block-local groups into the global accumulators.
+ *
+ * Each block aggregates its rows in shared memory until the number of distinct keys it has seen
+ * exceeds `BlockSize`. The block-local groups are then merged into the global table and the
+ * remaining rows of the block are aggregated directly into the global accumulators.
+ *
+ * @tparam BlockSize Number of threads in each block
+ * @tparam SharedSetRefType The Shared Memory Set Ref Type
+ * @tparam InputIt Device accessible input iterator whose `value_type` is convertible to the
+ * container's `key_type`
+ * @tparam ValueIts Tuple of device accessible input iterators, one per aggregation
+ * @tparam Columns Accumulator columns type
+ * @tparam Ref Type of non-owning device container ref allowing access to storage
+ *
+ * @param first Beginning of the sequence of keys
+ * @param n Number of input rows
+ * @param values Input value columns
+ * @param columns Accumulator columns parallel to the slot storage
+ * @param ref Non-owning container device ref used to access the slot storage
+ * @param bucket_extent Bucket Extent used for shared memory set slot storage
+ */
+template <int32_t BlockSize,
+          typename SharedSetRefType,
+          typename InputIt,
+          typename ValueIts,
+          typename Columns,
+          typename Ref>
+CUCO_KERNEL __launch_bounds__(BlockSize) void aggregate_shmem(
+  InputIt first,
+  cuco::detail::index_type n,
+  ValueIts values,
+  Columns columns,
+  Ref ref,
+  typename SharedSetRefType::extent_type bucket_extent)
+{
+  namespace cg = cooperative_groups;
+  using Key    = typename Ref::key_type;
+
+  auto const block       = cg::this_thread_block();
+  auto const thread_idx  = block.thread_rank();
+  auto const loop_stride = cuco::detail::grid_stride();
+  auto idx               = cuco::detail::global_thread_id();
+
+  auto warp                  = cg::tiled_partition<32>(block);
+  auto const warp_thread_idx = warp.thread_rank();
+
+  // Shared set and accumulators initialization
+  __shared__ typename SharedSetRefType::bucket_type buckets[bucket_extent.value()];
+  __shared__ alignas(16) char shared_accumulators[Columns::bytes(bucket_extent.value())];
+  auto storage           = typename SharedSetRefType::storage_ref_type(bucket_extent, buckets);
+  auto const num_buckets = storage.num_buckets();
+
+  auto const shared_columns = Columns{shared_accumulators, num_buckets};
+  for (auto i = thread_idx; i < num_buckets; i += BlockSize) {
+    shared_columns.initialize(i);
+  }
+
+  using atomic_type = cuda::atomic<int32_t, cuda::thread_scope_block>;
+  __shared__ atomic_type block_cardinality;
+  if (thread_idx == 0) { new (&block_cardinality) atomic_type{}; }
+  block.sync();
+
+  auto shared_set     = SharedSetRefType{cuco::empty_key<Key>{ref.empty_key_sentinel()},
+                                     ref.key_eq(),
+                                     ref.probing_scheme(),
+                                         {},
+                                     storage};
+  auto shared_set_ref = shared_set.rebind_operators(cuco::op::insert_and_find);
+  shared_set_ref.initialize(block);
+  block.sync();
+
+  while ((idx - thread_idx) < n) {
+    int32_t inserted         = 0;
+    int32_t warp_cardinality = 0;
+    // aggregate into the shared table first
+    if (idx < n) {
+      typename std::iterator_traits<InputIt>::value_type const& key = *(first + idx);
+      auto const [iter, is_new] = shared_set_ref.insert_and_find(key);
+      shared_columns.template accumulate<cuda::thread_scope_block>(
+        slot_index(shared_set_ref, iter), values, idx);
+      inserted = is_new;
+    }
+    if (idx - warp_thread_idx < n) {  // all threads in warp particpate
+      warp_cardinality = cg::reduce(warp, inserted, cg::plus<int32_t>());
+    }
+    if (warp_thread_idx == 0) {
+      block_cardinality.fetch_add(warp_cardinality, cuda::memory_order_relaxed);
+    }
+    block.sync();
+    // snapshot the cardinality so that no warp runs ahead before all threads have read it
+    auto const cardinality = block_cardinality.load(cuda::memory_order_relaxed);
+    block.sync();
+    if (cardinality > BlockSize) { break; }
+    idx += loop_stride;
+  }
+
+  // merge the shared groups into the global table
+  auto bucket_idx = thread_idx;
+  while (bucket_idx < num_buckets) {
+    auto const key = storage[bucket_idx][0];
+    if (not cuco::detail::bitwise_compare(key, ref.empty_key_sentinel())) {
+      auto const row = slot_index(ref, ref.insert_and_find(key).first);
+      columns.template merge<Ref::thread_scope>(row, shared_columns, bucket_idx);
+    }
+    bucket_idx += BlockSize;
+  }
+
+  // aggregate the remaining rows of blocks whose cardinality exceeds the threshold into the
+  // global table
+  if (block_cardinality > BlockSize) {
+    idx += loop_stride;
+    while (idx < n) {
+      typename std::iterator_traits<InputIt>::value_type const& key = *(first + idx);
+      auto const row = slot_index(ref, ref.insert_and_find(key).first);
+      columns.template accumulate<Ref::thread_scope>(row, values, idx);
+      idx += loop_stride;
+    }
+  }
+}
+
+/**
+ * @brief Writes the key and the results of every group to the output columns.
+ *
+ * @tparam BlockSize Number of threads in each block
+ * @tparam Columns Accumulator columns type
+ * @tparam KeyOut Device accessible random access output iterator
+ * @tparam OutputIts Tuple of device accessible random access output iterators, one per
+ * aggregation
+ * @tparam AtomicT Atomic counter type
+ * @tparam Ref Type of non-owning device container ref allowing access to storage
+ *
+ * @param columns Accumulator columns parallel to the slot storage
+ * @param keys_out Beginning of the output sequence of keys
+ * @param results_out Output columns
+ * @param counter Number of groups written so far
+ * @param ref Non-owning container device ref used to access the slot storage
+ */
+template <int32_t BlockSize,
+          typename Columns,
+          typename KeyOut,
+          typename OutputIts,
+          typename AtomicT,
+          typename Ref>
+CUCO_KERNEL __launch_bounds__(BlockSize) void retrieve(
+  Columns columns, KeyOut keys_out, OutputIts results_out, AtomicT* counter, Ref ref)
+{
+  auto const storage     = ref.storage_ref();
+  auto const n           = static_cast<cuco::detail::index_type>(storage.num_buckets());
+  auto const loop_stride = cuco::detail::grid_stride();
+  auto idx               = cuco::detail::global_thread_id();
+
+  while (idx < n) {
+    auto const key = storage[idx][0];
+    if (not cuco::detail::bitwise_compare(key, ref.empty_key_sentinel())) {
+      auto const pos    = counter->fetch_add(1, cuda::memory_order_relaxed);
+      *(keys_out + pos) = key;
+      columns.finalize(idx, results_out, pos);
+    }
+    idx += loop_stride;
+  }
+}
+
+}  // namespace cuco::detail::groupby_ns
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cuco/detail/error.hpp>
+#include <cuco/detail/hash_functions/kernels.cuh>
+#include <cuco/detail/utility/cuda.hpp>
+#include <cuco/detail/utility/host_parallel.hpp>
+#include <cuco/detail/utils.hpp>
+
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/memory.h>
+#include <thrust/type_traits/is_contiguous_iterator.h>
+
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+namespace cuco {
+namespace detail::hash_functions_ns {
+
+/// Number of bytes loaded by each thread of the vectorized bulk hashing kernel
+constexpr std::size_t vector_load_bytes() noexcept { return 16; }
+
+/**
+ * @brief Checks whether the given range lives in host memory that the device cannot access.
+ *
+ * Pointers are checked at runtime, other iterators by their thrust system.
+ *
+ * @tparam Iterator Random access iterator type
+ *
+ * @param first Beginning of the range
+ *
+ * @return `true` if the range must be processed on the host
+ */
+template <typename Iterator>
+[[nodiscard]] bool is_host_only(Iterator first)
+{
+  if constexpr (std::is_pointer_v<Iterator>) {
+    cudaPointerAttributes attributes{};
+    CUCO_CUDA_TRY(cudaPointerGetAttributes(&attributes, first));
+    return attributes.type == cudaMemoryTypeUnregistered;
+  } else {
+    return std::is_same_v<thrust::iterator_system_t<Iterator>, thrust::host_system_tag>;
+  }
+}
+
+/**
+ * @brief Checks whether the given range lives in device memory that the host cannot access.
+ *
+ * Pointers are checked at runtime, other iterators by their thrust system.
+ *
+ * @tparam Iterator Random access iterator type
+ *
+ * @param first Beginning of the range
+ *
+ * @return `true` if the range must be processed on the device
+ */
+template <typename Iterator>
+[[nodiscard]] bool is_device_only(Iterator first)
+{
+  if constexpr (std::is_pointer_v<Iterator>) {
+    cudaPointerAttributes attributes{};
+    CUCO_CUDA_TRY(cudaPointerGetAttributes(&attributes, first));
+    return attributes.type == cudaMemoryTypeDevice;
+  } else {
+    return std::is_same_v<thrust::iterator_system_t<Iterator>, thrust::device_system_tag>;
+  }
+}
+
+/**
+ * @brief Checks whether a bulk operation on the given ranges must run on the host.
+ *
+ * @throw std::invalid_argument If some ranges are host-only while others are device-only
+ *
+ * @tparam Iterators Random access iterator types
+ *
+ * @param firsts Beginnings of all input and output ranges of the operation
+ *
+ * @return `true` if any range lives in host memory that the device cannot access
+ */
+template <typename... Iterators>
+[[nodiscard]] bool runs_on_host(Iterators... firsts)
+{
+  auto const host_only   = (is_host_only(firsts) or ...);
+  auto const device_only = (is_device_only(firsts) or ...);
+  CUCO_EXPECTS(not(host_only and device_only),
+               "Host-only and device-only memory cannot be mixed in a bulk hash operation.",
+               std::invalid_argument);
+  return host_only;
+}
+
+}  // namespace detail::hash_functions_ns
+
+template <typename InputIt, typename OutputIt, typename Hash>
+void hash_bulk_async(
+  InputIt first, InputIt last, OutputIt output_begin, Hash const& hash, cuda::stream_ref stream)
+{
+  namespace ns = detail::hash_functions_ns;
+
+  auto const num = cuco::detail::distance(first, last);
+  if (num == 0) { return; }
+
+  if (ns::runs_on_host(first, output_begin)) {
+    detail::host_parallel_for(num, [&](detail::index_type i) { output_begin[i] = hash(first[i]); });
+    return;
+  }
+
+  using key_type               = typename std::iterator_traits<InputIt>::value_type;
+  auto constexpr block_size    = cuco::detail::default_block_size();
+  auto constexpr is_vectorized = thrust::is_contiguous_iterator_v<InputIt> and
+                                 sizeof(key_type) < ns::vector_load_bytes() and
+                                 ns::vector_load_bytes() % sizeof(key_type) == 0;
+
+  // Loads `vector_size` keys per instruction if the input is a suitably aligned array
+  if constexpr (is_vectorized) {
+    auto constexpr vector_size = static_cast<int32_t>(ns::vector_load_bytes() / sizeof(key_type));
+    auto const* const keys     = thrust::raw_pointer_cast(&*first);
+    if (reinterpret_cast<std::uintptr_t>(keys) % ns::vector_load_bytes() == 0) {
+      auto const grid_size = cuco::detail::grid_size(num, 1, vector_size, block_size);
+      ns::hash_n_vectorized<block_size, vector_size>
+        <<<grid_size, block_size, 0, stream.get()>>>(keys, num, output_begin, hash);
+      CUCO_CUDA_TRY(cudaPeekAtLastError());
+      return;
+    }
+  }
+
+  auto const grid_size = cuco::detail::grid_size(num);
+  ns::hash_n<block_size>
+    <<<grid_size, block_size, 0, stream.get()>>>(first, num, output_begin, hash);
+  CUCO_CUDA_TRY(cudaPeekAtLastError());
+}
+
+template <typename InputIt, typename OutputIt, typename Hash>
+void hash_bulk(
+  InputIt first, InputIt last, OutputIt output_begin, Hash const& hash, cuda::stream_ref stream)
+{
+  hash_bulk_async(first, last, output_begin, hash, stream);
+  stream.wait();
+}
+
+template <typename OffsetIt, typename OutputIt, typename Hash>
+void hash_strings_bulk_async(OffsetIt offsets_first,
+                             OffsetIt offsets_last,
+                             cuda::std::byte const* chars,
+                             OutputIt output_begin,
+                             Hash const& hash,
+                             cuda::stream_ref stream)
+{
+  namespace ns = detail::hash_functions_ns;
+
+  auto const num_offsets = cuco::detail::distance(offsets_first, offsets_last);
+  CUCO_EXPECTS(num_offsets > 0, "The offsets must contain at least one element.");
+  auto const num = num_offsets - 1;
+  if (num == 0) { return; }
+
+  if (ns::runs_on_host(offsets_first, chars, output_begin)) {
+    detail::host_parallel_for(num, [&](detail::index_type i) {
+      auto const begin = static_cast<detail::index_type>(offsets_first[i]);
+      auto const size  = static_cast<detail::index_type>(offsets_first[i + 1]) - begin;
+      output_begin[i]  = hash.compute_hash(chars + begin, size);
+    });
+    return;
+  }
+
+  auto constexpr block_size = cuco::detail::default_block_size();
+  auto const grid_size      = cuco::detail::grid_size(num);
+  ns::hash_strings_n<block_size>
+    <<<grid_size, block_size, 0, stream.get()>>>(offsets_first, num, chars, output_begin, hash);
+  CUCO_CUDA_TRY(cudaPeekAtLastError());
+}
+
+template <typename OffsetIt, typename OutputIt, typename Hash>
+void hash_strings_bulk(OffsetIt offsets_first,
+                       OffsetIt offsets_last,
+                       cuda::std::byte const* chars,
+                       OutputIt output_begin,
+                       Hash const& hash,
+                       cuda::stream_ref stream)
+{
+  hash_strings_bulk_async(offsets_first, offsets_last, chars, output_begin, hash, stream);
+  stream.wait();
+}
+
+}  // namespace cuco
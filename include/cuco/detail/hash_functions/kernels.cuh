@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/utility/cuda.cuh>
+
+#include <cuda/std/cstddef>
+
+#include <cooperative_groups.h>
+
+#include <cstdint>
+
+namespace cuco::detail::hash_functions_ns {
+CUCO_SUPPRESS_KERNEL_WARNINGS
+
+/// Strings longer than this number of bytes are staged in shared memory by the whole warp
+constexpr int32_t long_string_bytes() noexcept { return 64; }
+/// Number of bytes of the per-warp shared memory buffer long strings are staged in
+constexpr int32_t string_tile_bytes() noexcept { return 1024; }
+
+/**
+ * @brief Aligned vector of keys loaded with a single instruction.
+ *
+ * @tparam Key Key type
+ * @tparam VectorSize Number of keys per vector
+ */
+template <typename Key, int32_t VectorSize>
+struct alignas(sizeof(Key) * VectorSize) key_vector {
+  Key data[VectorSize];  ///< Keys of the vector
+};
+
+/**
+ * @brief Hashes the `n` elements of `input` into `output`.
+ *
+ * @tparam BlockSize Number of threads in each block
+ * @tparam InputIt Device accessible random access input iterator
+ * @tparam OutputIt Device accessible random access output iterator
+ * @tparam Hash Hash function type
+ *
+ * @param input Beginning of the input sequence
+ * @param n Number of input elements
+ * @param output Beginning of the output sequence
+ * @param hash Hash function
+ */
+template <int32_t BlockSize, typename InputIt, typename OutputIt, typename Hash>
+CUCO_KERNEL __launch_bounds__(BlockSize) void hash_n(InputIt input,
+                                                     cuco::detail::index_type n,
+                                                     OutputIt output,
+                                                     Hash hash)
+{
+  auto const loop_stride = cuco::detail::grid_stride();
+  auto idx               = cuco::detail::global_thread_id();
+
+  while (idx < n) {
+    output[idx] = hash(input[idx]);
+    idx += loop_stride;
+  }
+}
+
+/**
+ * @brief Hashes the `n` keys of the aligned array `input` into `output`, loading `VectorSize`
+ * keys per thread with a single vector load.
+ *
+ * @tparam BlockSize Number of threads in each block
+ * @tparam VectorSize Number of keys per vector load
+ * @tparam Key Key type
+ * @tparam OutputIt Device accessible random access output iterator
+ * @tparam Hash Hash function type
+ *
+ * @param input Beginning of the input array, aligned to `sizeof(Key) * VectorSize`
+ * @param n Number of input keys
+ * @param output Beginning of the output sequence
+ * @param hash Hash function
+ */
+template <int32_t BlockSize, int32_t VectorSize, typename Key, typename OutputIt, typename Hash>
+CUCO_KERNEL __launch_bounds__(BlockSize) void hash_n_vectorized(Key const* input,
+                                                                cuco::detail::index_type n,
+                                                                OutputIt output,
+                                                                Hash hash)
+{
+  using vector_type = key_vector<Key, VectorSize>;
+
+  auto const num_vectors = n / VectorSize;
+  auto const vectors     = reinterpret_cast<vector_type const*>(input);
+  auto const loop_stride = cuco::detail::grid_stride();
+  auto idx               = cuco::detail::global_thread_id();
+
+  while (idx < num_vectors) {
+    auto const keys = vectors[idx];
+#pragma unroll
+    for (int32_t i = 0; i < VectorSize; ++i) {
+      output[idx * VectorSize + i] = hash(keys.data[i]);
+    }
+    idx += loop_stride;
+  }
+
+  // Remaining keys not filling a whole vector
+  idx = num_vectors * VectorSize + cuco::detail::global_thread_id();
+  if (idx < n) { output[idx] = hash(input[idx]); }
+}
+
+/**
+ * @brief Hashes the `n` strings of a column given by `offsets` and `chars` into `output`.
+ *
+ * Each warp processes 32 consecutive strings at a time, each lane hashing its own string. Long
+ * strings would make every lane read its own scattered characters, so the whole warp first stages
+ * as many of them as fit into a shared memory buffer with coalesced loads, after which their lanes
+ * hash the staged copies in parallel. Strings exceeding the staging buffer are hashed directly from
+ * global memory.
+ *
+ * @tparam BlockSize Number of threads in each block
+ * @tparam OffsetIt Device accessible random access iterator of integral string offsets
+ * @tparam OutputIt Device accessible random access output iterator
+ * @tparam Hash Hash function type providing `compute_hash(bytes, size)`
+ *
+ * @param offsets Beginning of the `n + 1` string offsets into `chars`
+ * @param n Number of strings
+ * @param chars Characters of all strings
+ * @param output Beginning of the output sequence
+ * @param hash Hash function
+ */
+template <int32_t BlockSize, typename OffsetIt, typename OutputIt, typename Hash>
+CUCO_KERNEL __launch_bounds__(BlockSize) void hash_strings_n(OffsetIt offsets,
+                                                             cuco::detail::index_type n,
+                                                             cuda::std::byte const* chars,
+                                                             OutputIt output,
+                                                             Hash hash)
+{
+  namespace cg = cooperative_groups;
+
+  constexpr auto warp_size       = 32;
+  constexpr auto warps_per_block = BlockSize / warp_size;
+  static_assert(BlockSize % warp_size == 0, "Block size must be a multiple of the warp size.");
+
+  __shared__ alignas(16) cuda::std::byte tiles[warps_per_block][string_tile_bytes()];
+
+  auto const warp    = cg::tiled_partition<warp_size>(cg::this_thread_block());
+  auto const lane    = static_cast<int32_t>(warp.thread_rank());
+  auto const warp_id = threadIdx.x / warp_size;
+  auto* const tile   = tiles[warp_id];
+
+  auto const loop_stride = cuco::detail::grid_stride();
+  auto base              = cuco::detail::global_thread_id() - lane;
+
+  while (base < n) {
+    auto const idx                 = base + lane;
+    cuco::detail::index_type begin = 0;
+    cuco::detail::index_type size  = 0;
+    bool is_long                   = false;
+    if (idx < n) {
+      begin   = static_cast<cuco::detail::index_type>(offsets[idx]);
+      size    = static_cast<cuco::detail::index_type>(offsets[idx + 1]) - begin;
+      is_long = size > long_string_bytes();
+      if (not is_long) { output[idx] = hash.compute_hash(chars + begin, size); }
+    }
+
+    auto const is_staged = is_long and size <= string_tile_bytes();
+    if (is_long and not is_staged) { output[idx] = hash.compute_hash(chars + begin, size); }
+
+    auto pending = warp.ballot(is_staged);
+    while (pending != 0) {
+      // Stages the pending strings in lane order until the tile is full
+      cuco::detail::index_type tile_size   = 0;
+      cuco::detail::index_type tile_offset = -1;
+      while (pending != 0) {
+        auto const owner      = __ffs(pending) - 1;
+        auto const owner_size = warp.shfl(size, owner);
+        if (tile_size + owner_size > string_tile_bytes()) { break; }
+
+        auto const owner_begin = warp.shfl(begin, owner);
+        for (auto i = lane; i < owner_size; i += warp_size) {
+          tile[tile_size + i] = chars[owner_begin + i];
+        }
+        if (lane == owner) { tile_offset = tile_size; }
+        tile_size += owner_size;
+        pending &= pending - 1;
+      }
+      warp.sync();
+      if (tile_offset >= 0) { output[idx] = hash.compute_hash(tile + tile_offset, size); }
+      warp.sync();
+    }
+    base += loop_stride;
+  }
+}
+
+}  // namespace cuco::detail::hash_functions_ns
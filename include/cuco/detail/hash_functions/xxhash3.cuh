@@ -0,0 +1,705 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/hash_functions/utils.cuh>
+#include <cuco/extent.cuh>
+
+#include <cuda/std/array>
+#include <cuda/std/cstddef>
+
+#include <cstdint>
+
+/*
+ * XXH3 implementation from
+ * https://github.com/Cyan4973/xxHash
+ * -----------------------------------------------------------------------------
+ * xxHash - Extremely Fast Hash algorithm
+ * Header File
+ * Copyright (C) 2012-2021 Yann Collet
+ *
+ * BSD 2-Clause License (https://www.opensource.org/licenses/bsd-license.php)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above
+ *      copyright notice, this list of conditions and the following disclaimer
+ *      in the documentation and/or other materials provided with the
+ *      distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+namespace cuco::detail {
+namespace xxhash3_ns {
+
+constexpr std::uint32_t prime32_1 = 0x9e3779b1u;
+constexpr std::uint32_t prime32_2 = 0x85ebca77u;
+constexpr std::uint32_t prime32_3 = 0xc2b2ae3du;
+constexpr std::uint64_t prime64_1 = 0x9e3779b185ebca87ull;
+constexpr std::uint64_t prime64_2 = 0xc2b2ae3d27d4eb4full;
+constexpr std::uint64_t prime64_3 = 0x165667b19e3779f9ull;
+constexpr std::uint64_t prime64_4 = 0x85ebca77c2b2ae63ull;
+constexpr std::uint64_t prime64_5 = 0x27d4eb2f165667c5ull;
+constexpr std::uint64_t prime_mx1 = 0x165667919e3779f9ull;
+constexpr std::uint64_t prime_mx2 = 0x9fb21c651e98df25ull;
+
+constexpr std::size_t secret_size            = 192;
+constexpr std::size_t secret_size_min        = 136;
+constexpr std::size_t stripe_len             = 64;
+constexpr std::size_t secret_consume_rate    = 8;
+constexpr std::size_t midsize_max            = 240;
+constexpr std::size_t midsize_startoffset    = 3;
+constexpr std::size_t midsize_lastoffset     = 17;
+constexpr std::size_t secret_lastacc_start   = 7;
+constexpr std::size_t secret_mergeaccs_start = 11;
+
+/// 128-bit intermediate value
+struct uint128 {
+  std::uint64_t low;   ///< Lower 64 bits
+  std::uint64_t high;  ///< Upper 64 bits
+};
+
+// Reads 8 bytes of the default secret starting at byte `offset`. The secret is a local array so
+// that reads at constant offsets fold into immediates on the device.
+constexpr __host__ __device__ std::uint64_t default_secret(std::size_t offset) noexcept
+{
+  // clang-format off
+  constexpr std::uint8_t secret[secret_size] = {
+    0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+    0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+    0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+    0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+    0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+    0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+    0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+    0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+    0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+    0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+    0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+    0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e};
+  // clang-format on
+
+  std::uint64_t word = 0;
+  for (std::size_t i = 0; i < 8; ++i) {
+    word |= static_cast<std::uint64_t>(secret[offset + i]) << (8 * i);
+  }
+  return word;
+}
+
+constexpr __host__ __device__ std::uint32_t read32(cuda::std::byte const* bytes,
+                                                   std::size_t offset) noexcept
+{
+  return load_chunk<std::uint32_t>(bytes + offset, 0);
+}
+
+constexpr __host__ __device__ std::uint64_t read64(cuda::std::byte const* bytes,
+                                                   std::size_t offset) noexcept
+{
+  return load_chunk<std::uint64_t>(bytes + offset, 0);
+}
+
+constexpr __host__ __device__ std::uint32_t swap32(std::uint32_t x) noexcept
+{
+  return ((x << 24) & 0xff000000u) | ((x << 8) & 0x00ff0000u) | ((x >> 8) & 0x0000ff00u) |
+         ((x >> 24) & 0x000000ffu);
+}
+
+constexpr __host__ __device__ std::uint64_t swap64(std::uint64_t x) noexcept
+{
+  return (static_cast<std::uint64_t>(swap32(static_cast<std::uint32_t>(x))) << 32) |
+         swap32(static_cast<std::uint32_t>(x >> 32));
+}
+
+constexpr __host__ __device__ uint128 mult64to128(std::uint64_t lhs, std::uint64_t rhs) noexcept
+{
+#if defined(__CUDA_ARCH__)
+  return {lhs * rhs, __umul64hi(lhs, rhs)};
+#else
+  auto const lo_lo = (lhs & 0xffffffffull) * (rhs & 0xffffffffull);
+  auto const hi_lo = (lhs >> 32) * (rhs & 0xffffffffull);
+  auto const lo_hi = (lhs & 0xffffffffull) * (rhs >> 32);
+  auto const hi_hi = (lhs >> 32) * (rhs >> 32);
+  auto const cross = (lo_lo >> 32) + (hi_lo & 0xffffffffull) + lo_hi;
+  return {(cross << 32) | (lo_lo & 0xffffffffull), (hi_lo >> 32) + (cross >> 32) + hi_hi};
+#endif
+}
+
+constexpr __host__ __device__ std::uint64_t mul128_fold64(std::uint64_t lhs,
+                                                          std::uint64_t rhs) noexcept
+{
+  auto const product = mult64to128(lhs, rhs);
+  return product.low ^ product.high;
+}
+
+constexpr __host__ __device__ std::uint64_t xorshift64(std::uint64_t v, int shift) noexcept
+{
+  return v ^ (v >> shift);
+}
+
+// avalanche helper of XXH64
+constexpr __host__ __device__ std::uint64_t xxh64_avalanche(std::uint64_t h) noexcept
+{
+  h ^= h >> 33;
+  h *= prime64_2;
+  h ^= h >> 29;
+  h *= prime64_3;
+  h ^= h >> 32;
+  return h;
+}
+
+constexpr __host__ __device__ std::uint64_t avalanche(std::uint64_t h) noexcept
+{
+  h = xorshift64(h, 37);
+  h *= prime_mx1;
+  h = xorshift64(h, 32);
+  return h;
+}
+
+// avalanche helper for 4 to 8 byte inputs
+constexpr __host__ __device__ std::uint64_t rrmxmx(std::uint64_t h, std::uint64_t len) noexcept
+{
+  h ^= rotl64(h, 49) ^ rotl64(h, 24);
+  h *= prime_mx2;
+  h ^= (h >> 35) + len;
+  h *= prime_mx2;
+  return xorshift64(h, 28);
+}
+
+constexpr __host__ __device__ std::uint64_t mix16B(cuda::std::byte const* input,
+                                                   std::size_t secret_offset,
+                                                   std::uint64_t seed) noexcept
+{
+  return mul128_fold64(read64(input, 0) ^ (default_secret(secret_offset) + seed),
+                       read64(input, 8) ^ (default_secret(secret_offset + 8) - seed));
+}
+
+constexpr __host__ __device__ uint128 mix32B(uint128 acc,
+                                             cuda::std::byte const* input_1,
+                                             cuda::std::byte const* input_2,
+                                             std::size_t secret_offset,
+                                             std::uint64_t seed) noexcept
+{
+  acc.low += mix16B(input_1, secret_offset, seed);
+  acc.low ^= read64(input_2, 0) + read64(input_2, 8);
+  acc.high += mix16B(input_2, secret_offset + 16, seed);
+  acc.high ^= read64(input_1, 0) + read64(input_1, 8);
+  return acc;
+}
+
+/**
+ * @brief Accumulator state of inputs longer than 240 bytes.
+ *
+ * Long inputs are processed in 64-byte stripes with a secret derived from the seed, which is
+ * materialized since it is read at unaligned offsets.
+ */
+class long_state {
+ public:
+  /**
+   * @brief Derives the secret of `seed` and processes all stripes of `input`.
+   *
+   * @param input The input bytes
+   * @param len Number of input bytes, greater than 240
+   * @param seed Seed of the hash function
+   */
+  __host__ __device__ long_state(cuda::std::byte const* input,
+                                 std::size_t len,
+                                 std::uint64_t seed) noexcept
+    : acc_{prime32_3, prime64_1, prime64_2, prime64_3, prime64_4, prime32_2, prime64_5, prime32_1}
+  {
+#pragma unroll
+    for (std::size_t i = 0; i < secret_size / 16; ++i) {
+      auto const lo = default_secret(16 * i) + seed;
+      auto const hi = default_secret(16 * i + 8) - seed;
+      memcpy(secret_ + 16 * i, &lo, sizeof(lo));
+      memcpy(secret_ + 16 * i + 8, &hi, sizeof(hi));
+    }
+
+    constexpr auto stripes_per_block = (secret_size - stripe_len) / secret_consume_rate;
+    constexpr auto block_len         = stripe_len * stripes_per_block;
+    auto const num_blocks            = (len - 1) / block_len;
+
+    for (std::size_t n = 0; n < num_blocks; ++n) {
+      this->accumulate(input + n * block_len, stripes_per_block);
+      this->scramble();
+    }
+
+    auto const num_stripes = ((len - 1) - block_len * num_blocks) / stripe_len;
+    this->accumulate(input + num_blocks * block_len, num_stripes);
+    this->accumulate_512(input + len - stripe_len,
+                         secret_size - stripe_len - secret_lastacc_start);
+  }
+
+  /**
+   * @brief Merges the accumulators into a 64-bit value.
+   *
+   * @param secret_offset Offset of the secret bytes used for merging
+   * @param start Initial value
+   *
+   * @return The merged value
+   */
+  [[nodiscard]] __host__ __device__ std::uint64_t merge(std::size_t secret_offset,
+                                                        std::uint64_t start) const noexcept
+  {
+    auto result = start;
+#pragma unroll
+    for (std::size_t i = 0; i < 4; ++i) {
+      result += mul128_fold64(acc_[2 * i] ^ read64(secret_, secret_offset + 16 * i),
+                              acc_[2 * i + 1] ^ read64(secret_, secret_offset + 16 * i + 8));
+    }
+    return avalanche(result);
+  }
+
+ private:
+  __host__ __device__ void accumulate_512(cuda::std::byte const* input,
+                                          std::size_t secret_offset) noexcept
+  {
+#pragma unroll
+    for (std::size_t i = 0; i < 8; ++i) {
+      auto const data_val = read64(input, 8 * i);
+      auto const data_key = data_val ^ read64(secret_, secret_offset + 8 * i);
+      acc_[i ^ 1] += data_val;
+      acc_[i] += (data_key & 0xffffffffull) * (data_key >> 32);
+    }
+  }
+
+  __host__ __device__ void accumulate(cuda::std::byte const* input,
+                                      std::size_t num_stripes) noexcept
+  {
+    for (std::size_t n = 0; n < num_stripes; ++n) {
+      this->accumulate_512(input + n * stripe_len, n * secret_consume_rate);
+    }
+  }
+
+  __host__ __device__ void scramble() noexcept
+  {
+#pragma unroll
+    for (std::size_t i = 0; i < 8; ++i) {
+      auto acc = xorshift64(acc_[i], 47);
+      acc ^= read64(secret_, secret_size - stripe_len + 8 * i);
+      acc_[i] = acc * prime32_1;
+    }
+  }
+
+  std::uint64_t acc_[8];
+  cuda::std::byte secret_[secret_size];
+};
+
+}  // namespace xxhash3_ns
+
+/**
+ * @brief A `XXH3_64bits` hash function to hash the given argument on host and device.
+ *
+ * XXH3 implementation from https://github.com/Cyan4973/xxHash, producing the same values as
+ * `XXH3_64bits_withSeed`. Inputs of at most 16 bytes take a dedicated path without loops.
+ *
+ * @tparam Key The type of the values to hash
+ */
+template <typename Key>
+struct XXHash3_64 {
+  using argument_type = Key;            ///< The type of the values taken as argument
+  using result_type   = std::uint64_t;  ///< The type of the hash values produced
+
+  /**
+   * @brief Constructs a XXH3 64-bit hash function with the given `seed`.
+   *
+   * @param seed A custom number to randomize the resulting hash value
+   */
+  __host__ __device__ constexpr XXHash3_64(std::uint64_t seed = 0) : seed_{seed} {}
+
+  /**
+   * @brief Returns a hash value for its argument, as a value of type `result_type`.
+   *
+   * @param key The input argument to hash
+   * @return The resulting hash value for `key`
+   */
+  constexpr result_type __host__ __device__ operator()(Key const& key) const noexcept
+  {
+    if constexpr (sizeof(Key) <= 16) {
+      Key const key_copy = key;
+      return compute_hash(reinterpret_cast<cuda::std::byte const*>(&key_copy),
+                          cuco::extent<std::size_t, sizeof(Key)>{});
+    } else {
+      return compute_hash(reinterpret_cast<cuda::std::byte const*>(&key),
+                          cuco::extent<std::size_t, sizeof(Key)>{});
+    }
+  }
+
+  /**
+   * @brief Returns a hash value for its argument, as a value of type `result_type`.
+   *
+   * @tparam Extent The extent type
+   *
+   * @param bytes The input argument to hash
+   * @param size The extent of the data in bytes
+   * @return The resulting hash value
+   */
+  template <typename Extent>
+  constexpr result_type __host__ __device__ compute_hash(cuda::std::byte const* bytes,
+                                                         Extent size) const noexcept
+  {
+    using namespace xxhash3_ns;
+
+    std::size_t const len = size;
+    if (len <= 16) {
+      if (len > 8) { return this->hash_9to16(bytes, len); }
+      if (len >= 4) { return this->hash_4to8(bytes, len); }
+      if (len > 0) { return this->hash_1to3(bytes, len); }
+      return xxh64_avalanche(seed_ ^ (default_secret(56) ^ default_secret(64)));
+    }
+    if (len <= 128) { return this->hash_17to128(bytes, len); }
+    if (len <= midsize_max) { return this->hash_129to240(bytes, len); }
+    return long_state{bytes, len, seed_}.merge(secret_mergeaccs_start, len * prime64_1);
+  }
+
+  /**
+   * @brief Returns a hash value for its argument, as a value of type `result_type`.
+   *
+   * @note This API is to ensure backward compatibility with existing use cases using `std::byte`.
+   * Users are encouraged to use the appropriate `cuda::std::byte` overload whenever possible for
+   * better support and performance on the device.
+   *
+   * @tparam Extent The extent type
+   *
+   * @param bytes The input argument to hash
+   * @param size The extent of the data in bytes
+   * @return The resulting hash value
+   */
+  template <typename Extent>
+  constexpr result_type __host__ __device__ compute_hash(std::byte const* bytes,
+                                                         Extent size) const noexcept
+  {
+    return this->compute_hash(reinterpret_cast<cuda::std::byte const*>(bytes), size);
+  }
+
+ private:
+  constexpr __host__ __device__ std::uint64_t hash_1to3(cuda::std::byte const* bytes,
+                                                        std::size_t len) const noexcept
+  {
+    using namespace xxhash3_ns;
+
+    auto const c1       = cuda::std::to_integer<std::uint32_t>(bytes[0]);
+    auto const c2       = cuda::std::to_integer<std::uint32_t>(bytes[len >> 1]);
+    auto const c3       = cuda::std::to_integer<std::uint32_t>(bytes[len - 1]);
+    auto const combined = (c1 << 16) | (c2 << 24) | c3 | (static_cast<std::uint32_t>(len) << 8);
+    auto const bitflip  = static_cast<std::uint32_t>(default_secret(0) ^ default_secret(4)) + seed_;
+    return xxh64_avalanche(static_cast<std::uint64_t>(combined) ^ bitflip);
+  }
+
+  constexpr __host__ __device__ std::uint64_t hash_4to8(cuda::std::byte const* bytes,
+                                                        std::size_t len) const noexcept
+  {
+    using namespace xxhash3_ns;
+
+    auto const seed =
+      seed_ ^ (static_cast<std::uint64_t>(swap32(static_cast<std::uint32_t>(seed_))) << 32);
+    auto const input1  = read32(bytes, 0);
+    auto const input2  = read32(bytes, len - 4);
+    auto const bitflip = (default_secret(8) ^ default_secret(16)) - seed;
+    auto const input64 = input2 + (static_cast<std::uint64_t>(input1) << 32);
+    return rrmxmx(input64 ^ bitflip, len);
+  }
+
+  constexpr __host__ __device__ std::uint64_t hash_9to16(cuda::std::byte const* bytes,
+                                                         std::size_t len) const noexcept
+  {
+    using namespace xxhash3_ns;
+
+    auto const bitflip1 = (default_secret(24) ^ default_secret(32)) + seed_;
+    auto const bitflip2 = (default_secret(40) ^ default_secret(48)) - seed_;
+    auto const input_lo = read64(bytes, 0) ^ bitflip1;
+    auto const input_hi = read64(bytes, len - 8) ^ bitflip2;
+    auto const acc = len + swap64(input_lo) + input_hi + mul128_fold64(input_lo, input_hi);
+    return avalanche(acc);
+  }
+
+  constexpr __host__ __device__ std::uint64_t hash_17to128(cuda::std::byte const* bytes,
+                                                           std::size_t len) const noexcept
+  {
+    using namespace xxhash3_ns;
+
+    std::uint64_t acc = len * prime64_1;
+    if (len > 32) {
+      if (len > 64) {
+        if (len > 96) {
+          acc += mix16B(bytes + 48, 96, seed_);
+          acc += mix16B(bytes + len - 64, 112, seed_);
+        }
+        acc += mix16B(bytes + 32, 64, seed_);
+        acc += mix16B(bytes + len - 48, 80, seed_);
+      }
+      acc += mix16B(bytes + 16, 32, seed_);
+      acc += mix16B(bytes + len - 32, 48, seed_);
+    }
+    acc += mix16B(bytes, 0, seed_);
+    acc += mix16B(bytes + len - 16, 16, seed_);
+    return avalanche(acc);
+  }
+
+  constexpr __host__ __device__ std::uint64_t hash_129to240(cuda::std::byte const* bytes,
+                                                            std::size_t len) const noexcept
+  {
+    using namespace xxhash3_ns;
+
+    std::uint64_t acc = len * prime64_1;
+#pragma unroll
+    for (std::size_t i = 0; i < 8; ++i) {
+      acc += mix16B(bytes + 16 * i, 16 * i, seed_);
+    }
+    acc = avalanche(acc);
+
+    auto acc_end = mix16B(bytes + len - 16, secret_size_min - midsize_lastoffset, seed_);
+    // Bounded by the largest number of rounds so that all secret offsets are constants
+    auto const num_rounds = len / 16;
+#pragma unroll
+    for (std::size_t i = 8; i < midsize_max / 16; ++i) {
+      if (i < num_rounds) {
+        acc_end += mix16B(bytes + 16 * i, 16 * (i - 8) + midsize_startoffset, seed_);
+      }
+    }
+    return avalanche(acc + acc_end);
+  }
+
+  std::uint64_t seed_;
+};
+
+/**
+ * @brief A `XXH3_128bits` hash function to hash the given argument on host and device.
+ *
+ * XXH3 implementation from https://github.com/Cyan4973/xxHash, producing the same values as
+ * `XXH3_128bits_withSeed`. The result holds the lower 64 bits of the reference `XXH128_hash_t` in
+ * its first element and the upper 64 bits in its second element.
+ *
+ * @tparam Key The type of the values to hash
+ */
+template <typename Key>
+struct XXHash3_128 {
+  using argument_type = Key;  ///< The type of the values taken as argument
+  using result_type =
+    cuda::std::array<std::uint64_t, 2>;  ///< The type of the hash values produced
+
+  /**
+   * @brief Constructs a XXH3 128-bit hash function with the given `seed`.
+   *
+   * @param seed A custom number to randomize the resulting hash value
+   */
+  __host__ __device__ constexpr XXHash3_128(std::uint64_t seed = 0) : seed_{seed} {}
+
+  /**
+   * @brief Returns a hash value for its argument, as a value of type `result_type`.
+   *
+   * @param key The input argument to hash
+   * @return The resulting hash value for `key`
+   */
+  constexpr result_type __host__ __device__ operator()(Key const& key) const noexcept
+  {
+    if constexpr (sizeof(Key) <= 16) {
+      Key const key_copy = key;
+      return compute_hash(reinterpret_cast<cuda::std::byte const*>(&key_copy),
+                          cuco::extent<std::size_t, sizeof(Key)>{});
+    } else {
+      return compute_hash(reinterpret_cast<cuda::std::byte const*>(&key),
+                          cuco::extent<std::size_t, sizeof(Key)>{});
+    }
+  }
+
+  /**
+   * @brief Returns a hash value for its argument, as a value of type `result_type`.
+   *
+   * @tparam Extent The extent type
+   *
+   * @param bytes The input argument to hash
+   * @param size The extent of the data in bytes
+   * @return The resulting hash value
+   */
+  template <typename Extent>
+  constexpr result_type __host__ __device__ compute_hash(cuda::std::byte const* bytes,
+                                                         Extent size) const noexcept
+  {
+    using namespace xxhash3_ns;
+
+    std::size_t const len = size;
+    if (len <= 16) {
+      if (len > 8) { return this->hash_9to16(bytes, len); }
+      if (len >= 4) { return this->hash_4to8(bytes, len); }
+      if (len > 0) { return this->hash_1to3(bytes, len); }
+      return {xxh64_avalanche(seed_ ^ (default_secret(64) ^ default_secret(72))),
+              xxh64_avalanche(seed_ ^ (default_secret(80) ^ default_secret(88)))};
+    }
+    if (len <= 128) { return this->hash_17to128(bytes, len); }
+    if (len <= midsize_max) { return this->hash_129to240(bytes, len); }
+
+    long_state const state{bytes, len, seed_};
+    return {state.merge(secret_mergeaccs_start, len * prime64_1),
+            state.merge(secret_size - stripe_len - secret_mergeaccs_start, ~(len * prime64_2))};
+  }
+
+  /**
+   * @brief Returns a hash value for its argument, as a value of type `result_type`.
+   *
+   * @note This API is to ensure backward compatibility with existing use cases using `std::byte`.
+   * Users are encouraged to use the appropriate `cuda::std::byte` overload whenever possible for
+   * better support and performance on the device.
+   *
+   * @tparam Extent The extent type
+   *
+   * @param bytes The input argument to hash
+   * @param size The extent of the data in bytes
+   * @return The resulting hash value
+   */
+  template <typename Extent>
+  constexpr result_type __host__ __device__ compute_hash(std::byte const* bytes,
+                                                         Extent size) const noexcept
+  {
+    return this->compute_hash(reinterpret_cast<cuda::std::byte const*>(bytes), size);
+  }
+
+ private:
+  constexpr __host__ __device__ result_type hash_1to3(cuda::std::byte const* bytes,
+                                                      std::size_t len) const noexcept
+  {
+    using namespace xxhash3_ns;
+
+    auto const c1 = cuda::std::to_integer<std::uint32_t>(bytes[0]);
+    auto const c2 = cuda::std::to_integer<std::uint32_t>(bytes[len >> 1]);
+    auto const c3 = cuda::std::to_integer<std::uint32_t>(bytes[len - 1]);
+    auto const combinedl =
+      (c1 << 16) | (c2 << 24) | c3 | (static_cast<std::uint32_t>(len) << 8);
+    auto const combinedh = rotl32(swap32(combinedl), 13);
+    auto const bitflipl =
+      static_cast<std::uint32_t>(default_secret(0) ^ default_secret(4)) + seed_;
+    auto const bitfliph =
+      static_cast<std::uint32_t>(default_secret(8) ^ default_secret(12)) - seed_;
+    return {xxh64_avalanche(static_cast<std::uint64_t>(combinedl) ^ bitflipl),
+            xxh64_avalanche(static_cast<std::uint64_t>(combinedh) ^ bitfliph)};
+  }
+
+  constexpr __host__ __device__ result_type hash_4to8(cuda::std::byte const* bytes,
+                                                      std::size_t len) const noexcept
+  {
+    using namespace xxhash3_ns;
+
+    auto const seed =
+      seed_ ^ (static_cast<std::uint64_t>(swap32(static_cast<std::uint32_t>(seed_))) << 32);
+    auto const input_lo = read32(bytes, 0);
+    auto const input_hi = read32(bytes, len - 4);
+    auto const input64  = input_lo + (static_cast<std::uint64_t>(input_hi) << 32);
+    auto const bitflip  = (default_secret(16) ^ default_secret(24)) + seed;
+
+    auto m128 = mult64to128(input64 ^ bitflip, prime64_1 + (len << 2));
+    m128.high += m128.low << 1;
+    m128.low ^= m128.high >> 3;
+    m128.low = xorshift64(m128.low, 35);
+    m128.low *= prime_mx2;
+    m128.low = xorshift64(m128.low, 28);
+    return {m128.low, avalanche(m128.high)};
+  }
+
+  constexpr __host__ __device__ result_type hash_9to16(cuda::std::byte const* bytes,
+                                                       std::size_t len) const noexcept
+  {
+    using namespace xxhash3_ns;
+
+    auto const bitflipl = (default_secret(32) ^ default_secret(40)) - seed_;
+    auto const bitfliph = (default_secret(48) ^ default_secret(56)) + seed_;
+    auto const input_lo = read64(bytes, 0);
+    auto input_hi       = read64(bytes, len - 8);
+
+    auto m128 = mult64to128(input_lo ^ input_hi ^ bitflipl, prime64_1);
+    m128.low += static_cast<std::uint64_t>(len - 1) << 54;
+    input_hi ^= bitfliph;
+    m128.high += input_hi + (input_hi & 0xffffffffull) * (prime32_2 - 1);
+    m128.low ^= swap64(m128.high);
+
+    auto h128 = mult64to128(m128.low, prime64_2);
+    h128.high += m128.high * prime64_2;
+    return {avalanche(h128.low), avalanche(h128.high)};
+  }
+
+  constexpr __host__ __device__ result_type hash_17to128(cuda::std::byte const* bytes,
+                                                         std::size_t len) const noexcept
+  {
+    using namespace xxhash3_ns;
+
+    uint128 acc{len * prime64_1, 0};
+    if (len > 32) {
+      if (len > 64) {
+        if (len > 96) { acc = mix32B(acc, bytes + 48, bytes + len - 64, 96, seed_); }
+        acc = mix32B(acc, bytes + 32, bytes + len - 48, 64, seed_);
+      }
+      acc = mix32B(acc, bytes + 16, bytes + len - 32, 32, seed_);
+    }
+    acc = mix32B(acc, bytes, bytes + len - 16, 0, seed_);
+    return this->finalize(acc, len);
+  }
+
+  constexpr __host__ __device__ result_type hash_129to240(cuda::std::byte const* bytes,
+                                                          std::size_t len) const noexcept
+  {
+    using namespace xxhash3_ns;
+
+    uint128 acc{len * prime64_1, 0};
+#pragma unroll
+    for (std::size_t i = 32; i < 160; i += 32) {
+      acc = mix32B(acc, bytes + i - 32, bytes + i - 16, i - 32, seed_);
+    }
+    acc.low  = avalanche(acc.low);
+    acc.high = avalanche(acc.high);
+
+    // Bounded by the largest input length so that all secret offsets are constants
+#pragma unroll
+    for (std::size_t i = 160; i <= midsize_max; i += 32) {
+      if (i <= len) {
+        acc = mix32B(acc, bytes + i - 32, bytes + i - 16, midsize_startoffset + i - 160, seed_);
+      }
+    }
+    acc = mix32B(acc,
+                 bytes + len - 16,
+                 bytes + len - 32,
+                 secret_size_min - midsize_lastoffset - 16,
+                 std::uint64_t{0} - seed_);
+    return this->finalize(acc, len);
+  }
+
+  constexpr __host__ __device__ result_type finalize(xxhash3_ns::uint128 acc,
+                                                     std::size_t len) const noexcept
+  {
+    using namespace xxhash3_ns;
+
+    auto const low  = acc.low + acc.high;
+    auto const high = acc.low * prime64_1 + acc.high * prime64_4 + (len - seed_) * prime64_2;
+    return {avalanche(low), std::uint64_t{0} - avalanche(high)};
+  }
+
+  std::uint64_t seed_;
+};
+
+}  // namespace cuco::detail
@@ -111,6 +111,13 @@ constexpr void hyperloglog<T, Scope, Hash, Allocator>::merge(ref_type<OtherScope
   ref_.merge(other_ref, stream);
 }
 
+template <class T, cuda::thread_scope Scope, class Hash, class Allocator>
+constexpr void hyperloglog<T, Scope, Hash, Allocator>::estimate_async(
+  std::size_t* output, cuda::stream_ref stream) const
+{
+  ref_.estimate_async(output, stream);
+}
+
 template <class T, cuda::thread_scope Scope, class Hash, class Allocator>
 constexpr std::size_t hyperloglog<T, Scope, Hash, Allocator>::estimate(
   cuda::stream_ref stream) const
@@ -164,4 +171,48 @@ constexpr size_t hyperloglog<T, Scope, Hash, Allocator>::sketch_alignment() noex
   return ref_type<>::sketch_alignment();
 }
 
-}  // namespace cuco
\ No newline at end of file
+template <class T, cuda::thread_scope Scope, class Hash, class Allocator>
+void hyperloglog<T, Scope, Hash, Allocator>::save(std::string const& path,
+                                                  cuda::stream_ref stream) const
+{
+  auto config = std::vector<std::byte>{};
+  detail::append_persisted_config(config, this->hash_function());
+  detail::write_persisted_file(path,
+                               this->persisted_header_for(),
+                               config,
+                               sketch_.get(),
+                               this->sketch_bytes(),
+                               detail::is_host_allocator_v<allocator_type>,
+                               stream);
+}
+
+template <class T, cuda::thread_scope Scope, class Hash, class Allocator>
+void hyperloglog<T, Scope, Hash, Allocator>::load(std::string const& path, cuda::stream_ref stream)
+{
+  auto config = std::vector<std::byte>{};
+  detail::append_persisted_config(config, this->hash_function());
+  detail::read_persisted_file(path,
+                              this->persisted_header_for(),
+                              config,
+                              sketch_.get(),
+                              this->sketch_bytes(),
+                              detail::is_host_allocator_v<allocator_type>,
+                              stream);
+}
+
+template <class T, cuda::thread_scope Scope, class Hash, class Allocator>
+persisted_header hyperloglog<T, Scope, Hash, Allocator>::persisted_header_for() const noexcept
+{
+  persisted_header header{};
+  header.kind             = persisted_kind::hyperloglog;
+  header.type_fingerprint = detail::type_fingerprint<hyperloglog>();
+  header.key_bytes        = sizeof(value_type);
+  header.slot_bytes       = sizeof(register_type);
+  header.bucket_size      = 1;
+  header.cg_size          = 1;
+  header.capacity         = this->sketch_bytes() / sizeof(register_type);
+  header.num_buckets      = header.capacity;
+  return header;
+}
+
+}  // namespace cuco
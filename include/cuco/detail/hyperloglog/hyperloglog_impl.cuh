@@ -393,6 +393,20 @@ class hyperloglog_impl {
     return estimate;
   }
 
+  /**
+   * @brief Asynchronously computes the estimated distinct items count.
+   *
+   * @note Since the estimate is computed on the device, the call can be captured into a CUDA graph.
+   *
+   * @param output Device location the approximate distinct items count is written to
+   * @param stream CUDA stream this operation is executed in
+   */
+  __host__ constexpr void estimate_async(std::size_t* output, cuda::stream_ref stream) const
+  {
+    auto constexpr block_size = 1024;
+    cuco::hyperloglog_ns::detail::estimate<<<1, block_size, 0, stream.get()>>>(output, *this);
+  }
+
   /**
    * @brief Compute the estimated distinct items count.
    *
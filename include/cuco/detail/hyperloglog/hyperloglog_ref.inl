@@ -98,6 +98,13 @@ __device__ std::size_t hyperloglog_ref<T, Scope, Hash>::estimate(
   return impl_.estimate(group);
 }
 
+template <class T, cuda::thread_scope Scope, class Hash>
+__host__ constexpr void hyperloglog_ref<T, Scope, Hash>::estimate_async(
+  std::size_t* output, cuda::stream_ref stream) const
+{
+  impl_.estimate_async(output, stream);
+}
+
 template <class T, cuda::thread_scope Scope, class Hash>
 __host__ constexpr std::size_t hyperloglog_ref<T, Scope, Hash>::estimate(
   cuda::stream_ref stream) const
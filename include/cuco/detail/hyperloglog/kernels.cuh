@@ -132,7 +132,6 @@ CUCO_KERNEL void merge(OtherRefType other_ref, RefType ref)
   if (block.group_index().x == 0) { ref.merge(block, other_ref); }
 }
 
-// TODO this kernel currently isn't being used
 template <class RefType>
 CUCO_KERNEL void estimate(std::size_t* cardinality, RefType ref)
 {
@@ -18,6 +18,11 @@
 #include <cuco/detail/bitwise_compare.cuh>
 #include <cuco/detail/pair/traits.hpp>
 
+#include <cuda/std/tuple>
+#include <cuda/std/type_traits>
+
+#include <cstdint>
+
 namespace cuco::detail::open_addressing_ns {
 
 /**
@@ -88,7 +93,7 @@ struct slot_is_filled {
    * @return `true` if slot is filled
    */
   template <typename S>
-  __device__ constexpr bool operator()(S const& slot) const noexcept
+  __host__ __device__ constexpr bool operator()(S const& slot) const noexcept
   {
     auto const key = [&]() {
       if constexpr (HasPayload) {
@@ -107,4 +112,105 @@ struct slot_is_filled {
   }
 };
 
+/**
+ * @brief Device functor returning whether the given slot holds an erased key
+ *
+ * @tparam HasPayload Flag indicating whether the slot contains a payload
+ * @tparam T The slot key type
+ */
+template <bool HasPayload, typename T>
+struct slot_is_erased {
+  T erased_sentinel_;  ///< Key value that represents an erased slot
+
+  /**
+   * @brief Constructs `slot_is_erased` functor with the given sentinel
+   *
+   * @param erased_sentinel Key sentinel indicating an erased slot
+   */
+  explicit constexpr slot_is_erased(T const& erased_sentinel) noexcept
+    : erased_sentinel_{erased_sentinel}
+  {
+  }
+
+  /**
+   * @brief Indicates if the target slot `slot` holds an erased key.
+   *
+   * @tparam S The slot type
+   *
+   * @param slot The slot
+   *
+   * @return `true` if slot is erased
+   */
+  template <typename S>
+  __device__ constexpr bool operator()(S const& slot) const noexcept
+  {
+    if constexpr (HasPayload) {
+      return cuco::detail::bitwise_compare(slot.first, erased_sentinel_);
+    } else {
+      return cuco::detail::bitwise_compare(slot, erased_sentinel_);
+    }
+  }
+};
+
+/**
+ * @brief Device functor returning the partition of the table an input element probes first
+ *
+ * The buckets are split into `2^partition_bits` contiguous partitions, so that the partition of an
+ * element is given by the high bits of its initial probing position.
+ *
+ * @tparam HasPayload Flag indicating whether the slot contains a payload
+ * @tparam Key The container key type
+ * @tparam ProbingScheme Probing scheme type
+ * @tparam Extent Bucket extent type
+ */
+template <bool HasPayload, typename Key, typename ProbingScheme, typename Extent>
+struct probe_partition {
+  ProbingScheme probing_scheme_;  ///< Probing scheme of the container
+  Extent bucket_extent_;          ///< Number of buckets of the container
+  int32_t partition_bits_;        ///< Number of bits of the partition identifier
+
+  /**
+   * @brief Constructs `probe_partition` functor with the given probing parameters
+   *
+   * @param probing_scheme Probing scheme of the container
+   * @param bucket_extent Number of buckets of the container
+   * @param partition_bits Number of bits of the partition identifier
+   */
+  explicit constexpr probe_partition(ProbingScheme const& probing_scheme,
+                                     Extent bucket_extent,
+                                     int32_t partition_bits) noexcept
+    : probing_scheme_{probing_scheme},
+      bucket_extent_{bucket_extent},
+      partition_bits_{partition_bits}
+  {
+  }
+
+  /**
+   * @brief Computes the partition first probed by the given input element.
+   *
+   * @tparam T The input element or probe key type
+   *
+   * @param input The input element or probe key
+   *
+   * @return Partition identifier in `[0, 2^partition_bits)`
+   */
+  template <typename T>
+  __device__ constexpr uint32_t operator()(T const& input) const noexcept
+  {
+    auto const key = [&]() {
+      if constexpr (not HasPayload or cuda::std::is_convertible_v<T, Key>) {
+        return input;
+      } else if constexpr (cuco::detail::is_cuda_std_pair_like<T>::value) {
+        return cuda::std::get<0>(input);
+      } else {
+        return input.first;
+      }
+    }();
+    auto const bucket = static_cast<uint64_t>(*probing_scheme_(key, bucket_extent_));
+    auto const num_buckets =
+      static_cast<uint64_t>(static_cast<typename Extent::value_type>(bucket_extent_));
+    return static_cast<uint32_t>((bucket << partition_bits_) / num_buckets);
+  }
+};
+
 }  // namespace cuco::detail::open_addressing_ns
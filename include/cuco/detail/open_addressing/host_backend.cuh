@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cuco/detail/utility/cuda.hpp>
+#include <cuco/detail/utility/host_parallel.hpp>
+
+#include <iterator>
+#include <type_traits>
+
+/**
+ * @brief Host counterparts of the bulk operation kernels of open addressing containers.
+ *
+ * Every input element is processed by a single host thread through the scalar (`cg_size == 1`)
+ * device ref APIs, which thus perform the same probing and the same atomic slot updates as the
+ * kernels do.
+ */
+namespace cuco::detail::open_addressing_ns::host {
+
+/**
+ * @brief Inserts all elements in the range `[first, first + n)` if `pred` of the corresponding
+ * stencil returns true.
+ *
+ * @tparam InputIt Host accessible input iterator whose `value_type` is convertible to the
+ * container's `value_type`
+ * @tparam StencilIt Host accessible random access iterator whose value_type is convertible to
+ * Predicate's argument type
+ * @tparam Predicate Unary predicate callable whose return type must be convertible to `bool` and
+ * argument type is convertible from `std::iterator_traits<StencilIt>::value_type`
+ * @tparam Ref Type of non-owning container ref allowing access to storage
+ *
+ * @param first Beginning of the sequence of input elements
+ * @param n Number of input elements
+ * @param stencil Beginning of the stencil sequence
+ * @param pred Predicate to test on every element in the range `[stencil, stencil + n)`
+ * @param ref Non-owning container ref used to access the slot storage
+ *
+ * @return Number of successfully inserted elements
+ */
+template <typename InputIt, typename StencilIt, typename Predicate, typename Ref>
+cuco::detail::index_type insert_if_n(
+  InputIt first, cuco::detail::index_type n, StencilIt stencil, Predicate pred, Ref ref)
+{
+  return cuco::detail::host_parallel_sum(n, [&](auto idx) {
+    if (not pred(*(stencil + idx))) { return false; }
+    typename std::iterator_traits<InputIt>::value_type const& insert_element{*(first + idx)};
+    return ref.insert(insert_element);
+  });
+}
+
+/**
+ * @brief Erases the keys in the range `[first, first + n)`.
+ *
+ * @tparam InputIt Host accessible input iterator whose `value_type` is convertible to the
+ * container's `key_type`
+ * @tparam Ref Type of non-owning container ref allowing access to storage
+ *
+ * @param first Beginning of the sequence of keys
+ * @param n Number of keys to erase
+ * @param ref Non-owning container ref used to access the slot storage
+ */
+template <typename InputIt, typename Ref>
+void erase(InputIt first, cuco::detail::index_type n, Ref ref)
+{
+  cuco::detail::host_parallel_for(n, [&](auto idx) {
+    typename std::iterator_traits<InputIt>::value_type const& erase_element{*(first + idx)};
+    ref.erase(erase_element);
+  });
+}
+
+/**
+ * @brief Indicates whether the keys in the range `[first, first + n)` are contained in the
+ * container if `pred` of the corresponding stencil returns true.
+ *
+ * @note If `pred( *(stencil + i) )` is false, stores false to `(output_begin + i)`.
+ * @note Output elements are written concurrently, so `output_begin` must not be a packed
+ * container iterator like the ones of `std::vector<bool>`.
+ *
+ * @tparam InputIt Host accessible input iterator
+ * @tparam StencilIt Host accessible random access iterator whose value_type is convertible to
+ * Predicate's argument type
+ * @tparam Predicate Unary predicate callable whose return type must be convertible to `bool` and
+ * argument type is convertible from `std::iterator_traits<StencilIt>::value_type`
+ * @tparam OutputIt Host accessible output iterator assignable from `bool`
+ * @tparam Ref Type of non-owning container ref allowing access to storage
+ *
+ * @param first Beginning of the sequence of keys
+ * @param n Number of keys
+ * @param stencil Beginning of the stencil sequence
+ * @param pred Predicate to test on every element in the range `[stencil, stencil + n)`
+ * @param output_begin Beginning of the sequence of booleans for the presence of each key
+ * @param ref Non-owning container ref used to access the slot storage
+ */
+template <typename InputIt, typename StencilIt, typename Predicate, typename OutputIt, typename Ref>
+void contains_if_n(InputIt first,
+                   cuco::detail::index_type n,
+                   StencilIt stencil,
+                   Predicate pred,
+                   OutputIt output_begin,
+                   Ref ref)
+{
+  cuco::detail::host_parallel_for(n, [&](auto idx) {
+    typename std::iterator_traits<InputIt>::value_type const& key = *(first + idx);
+    *(output_begin + idx) = pred(*(stencil + idx)) ? ref.contains(key) : false;
+  });
+}
+
+/**
+ * @brief Finds the equivalent container elements of all keys in the range `[first, first + n)`
+ * if `pred` of the corresponding stencil returns true.
+ *
+ * @note If `pred( *(stencil + i) )` is true, stores the payload (map) or the key (set) of the
+ * matched element, or the empty sentinel if there is no match, to `(output_begin + i)`. Otherwise,
+ * stores the empty sentinel.
+ *
+ * @tparam InputIt Host accessible input iterator
+ * @tparam StencilIt Host accessible random access iterator whose value_type is convertible to
+ * Predicate's argument type
+ * @tparam Predicate Unary predicate callable whose return type must be convertible to `bool` and
+ * argument type is convertible from `std::iterator_traits<StencilIt>::value_type`
+ * @tparam OutputIt Host accessible output iterator
+ * @tparam Ref Type of non-owning container ref allowing access to storage
+ *
+ * @param first Beginning of the sequence of keys
+ * @param n Number of keys
+ * @param stencil Beginning of the stencil sequence
+ * @param pred Predicate to test on every element in the range `[stencil, stencil + n)`
+ * @param output_begin Beginning of the sequence of matches retrieved for each key
+ * @param ref Non-owning container ref used to access the slot storage
+ */
+template <typename InputIt, typename StencilIt, typename Predicate, typename OutputIt, typename Ref>
+void find_if_n(InputIt first,
+               cuco::detail::index_type n,
+               StencilIt stencil,
+               Predicate pred,
+               OutputIt output_begin,
+               Ref ref)
+{
+  auto constexpr has_payload = not std::is_same_v<typename Ref::key_type, typename Ref::value_type>;
+
+  auto const sentinel = [&]() {
+    if constexpr (has_payload) {
+      return ref.empty_value_sentinel();
+    } else {
+      return ref.empty_key_sentinel();
+    }
+  }();
+
+  cuco::detail::host_parallel_for(n, [&](auto idx) {
+    if (not pred(*(stencil + idx))) {
+      *(output_begin + idx) = sentinel;
+      return;
+    }
+    typename std::iterator_traits<InputIt>::value_type const& key = *(first + idx);
+    auto const found                                              = ref.find(key);
+    if constexpr (has_payload) {
+      *(output_begin + idx) = found == ref.end() ? sentinel : found->second;
+    } else {
+      *(output_begin + idx) = found == ref.end() ? sentinel : *found;
+    }
+  });
+}
+
+/**
+ * @brief Calculates the number of filled slots for the given bucket storage.
+ *
+ * @tparam StorageRef Type of non-owning ref allowing access to storage
+ * @tparam Predicate Type of predicate indicating if the given slot is filled
+ *
+ * @param storage Non-owning ref used to access the slot storage
+ * @param is_filled Predicate indicating if the given slot is filled
+ *
+ * @return Number of filled slots
+ */
+template <typename StorageRef, typename Predicate>
+cuco::detail::index_type size(StorageRef storage, Predicate is_filled)
+{
+  return cuco::detail::host_parallel_sum(storage.num_buckets(), [&](auto idx) {
+    cuco::detail::index_type count = 0;
+    for (auto const& slot : storage[idx]) {
+      count += static_cast<cuco::detail::index_type>(is_filled(slot));
+    }
+    return count;
+  });
+}
+
+/**
+ * @brief Inserts all filled slots of the given storage into the container.
+ *
+ * @tparam StorageRef Type of non-owning ref allowing access to the old storage
+ * @tparam ContainerRef Type of non-owning container ref allowing access to the new storage
+ * @tparam Predicate Type of predicate indicating if the given slot is filled
+ *
+ * @param storage_ref Non-owning ref used to access the old storage
+ * @param container_ref Non-owning container ref used to insert into the new storage
+ * @param is_filled Predicate indicating if the given slot is filled
+ */
+template <typename StorageRef, typename ContainerRef, typename Predicate>
+void rehash(StorageRef storage_ref, ContainerRef container_ref, Predicate is_filled)
+{
+  cuco::detail::host_parallel_for(storage_ref.num_buckets(), [&](auto idx) {
+    for (auto const& slot : storage_ref[idx]) {
+      if (is_filled(slot)) { container_ref.insert(slot); }
+    }
+  });
+}
+
+}  // namespace cuco::detail::open_addressing_ns::host
@@ -15,19 +15,126 @@
  */
 #pragma once
 
+#include <cuco/detail/pair/traits.hpp>
 #include <cuco/detail/utility/cuda.cuh>
 
 #include <cub/block/block_reduce.cuh>
 #include <cuda/atomic>
 #include <cuda/functional>
+#include <cuda/std/tuple>
+#include <cuda/std/type_traits>
+#include <nv/target>
 
 #include <cooperative_groups.h>
 
+#include <cstdint>
+#include <cstring>
 #include <iterator>
 
 namespace cuco::detail::open_addressing_ns {
 CUCO_SUPPRESS_KERNEL_WARNINGS
 
+/**
+ * @brief Computes the lanes of the calling warp whose tiles hold a key bitwise equal to the key of
+ * the calling tile.
+ *
+ * @note Must be called by all threads of the warp. An inactive tile only matches itself.
+ * @note Keys are compared bitwise: keys comparing equal with different object representations, or
+ * keys larger than 8 bytes, are never matched with other tiles.
+ * @note Matching requires compute capability 7.0. On older architectures, every tile only matches
+ * itself.
+ *
+ * @tparam KeyFn Nullary callable returning the key of the calling tile
+ *
+ * @param key_of Callable returning the key of the calling tile. Only invoked if `active` is true
+ * @param active Flag indicating whether the calling tile holds a key
+ *
+ * @return Bitmask of the warp lanes holding a key bitwise equal to the one of the calling lane
+ */
+template <typename KeyFn>
+__device__ uint32_t match_warp_keys(KeyFn key_of, bool active) noexcept
+{
+  using key_type = cuda::std::decay_t<decltype(key_of())>;
+
+  auto const lane_mask = 1u << (threadIdx.x % cuco::detail::warp_size());
+  if constexpr (sizeof(key_type) > sizeof(uint64_t)) {
+    return lane_mask;
+  } else {
+    using bits_type = cuda::std::
+      conditional_t<sizeof(key_type) <= sizeof(uint32_t), uint32_t, unsigned long long>;
+    bits_type bits = 0;
+    if (active) {
+      auto const key = key_of();
+      std::memcpy(&bits, &key, sizeof(key_type));
+    }
+    NV_IF_TARGET(NV_PROVIDES_SM_70,
+                 (auto const active_mask = __ballot_sync(0xffffffff, active);
+                  auto const peers       = __match_any_sync(0xffffffff, bits);
+                  return active ? peers & active_mask : lane_mask;),
+                 (return lane_mask;))
+  }
+}
+
+/**
+ * @brief Indicates whether the calling tile is the first of the warp tiles matched by `peers`.
+ *
+ * @tparam CGSize Number of threads in each CG
+ *
+ * @param peers Bitmask of warp lanes returned by `match_warp_keys`
+ *
+ * @return `true` if the calling tile represents all the tiles matched by `peers`
+ */
+template <int32_t CGSize>
+__device__ bool is_warp_representative(uint32_t peers) noexcept
+{
+  auto const lane = static_cast<int32_t>(threadIdx.x % cuco::detail::warp_size());
+  return (__ffs(peers) - 1) / CGSize == lane / CGSize;
+}
+
+/**
+ * @brief Returns the key of an element to be inserted into the container accessed by `Ref`.
+ *
+ * @tparam Ref Type of non-owning device container ref
+ * @tparam Value Input type which is convertible to `Ref::value_type`
+ *
+ * @param value The input element
+ *
+ * @return The key of `value`
+ */
+template <typename Ref, typename Value>
+__device__ constexpr auto input_key(Value const& value) noexcept
+{
+  if constexpr (cuda::std::is_same_v<typename Ref::key_type, typename Ref::value_type>) {
+    return value;
+  } else if constexpr (cuco::detail::is_cuda_std_pair_like<Value>::value) {
+    return cuda::std::get<0>(value);
+  } else {
+    return value.first;
+  }
+}
+
+/**
+ * @brief Returns an atomic view of the given counter.
+ *
+ * Integral counters, e.g., caller-provided device or pinned host memory, are accessed through a
+ * `cuda::atomic_ref` while atomic counters are returned as is.
+ *
+ * @tparam T Integral type or atomic type that follows the same semantics as `cuda::(std::)atomic`
+ *
+ * @param counter Pointer to the counter
+ *
+ * @return Atomic view of `*counter`
+ */
+template <typename T>
+__device__ decltype(auto) counter_ref(T* counter) noexcept
+{
+  if constexpr (cuda::std::is_integral_v<T>) {
+    return cuda::atomic_ref<T, cuda::thread_scope_device>{*counter};
+  } else {
+    return *counter;
+  }
+}
+
 /**
  * @brief Inserts all elements in the range `[first, first + n)` and returns the number of
  * successful insertions if `pred` of the corresponding stencil returns true.
@@ -52,7 +159,11 @@ CUCO_SUPPRESS_KERNEL_WARNINGS
  * @param stencil Beginning of the stencil sequence
  * @param pred Predicate to test on every element in the range `[stencil, stencil + n)`
  * @param num_successes Number of successful inserted elements
+ * @param size_counter Optional container size counter also incremented by the number of successful
+ * insertions. Ignored if `nullptr`
  * @param ref Non-owning container device ref used to access the slot storage
+ * @param dedup_inputs Flag indicating whether only one of the bitwise equal keys processed by a
+ * warp at a time is inserted. Ignored if the container allows duplicate keys
  */
 template <int32_t CGSize,
           int32_t BlockSize,
@@ -66,17 +177,28 @@ CUCO_KERNEL __launch_bounds__(BlockSize) void insert_if_n(InputIt first,
                                                           StencilIt stencil,
                                                           Predicate pred,
                                                           AtomicT* num_successes,
-                                                          Ref ref)
+                                                          AtomicT* size_counter,
+                                                          Ref ref,
+                                                          bool dedup_inputs)
 {
+  dedup_inputs = dedup_inputs and not Ref::allows_duplicates;
+
   using BlockReduce = cub::BlockReduce<typename Ref::size_type, BlockSize>;
   __shared__ typename BlockReduce::TempStorage temp_storage;
   typename Ref::size_type thread_num_successes = 0;
 
   auto const loop_stride = cuco::detail::grid_stride() / CGSize;
   auto idx               = cuco::detail::global_thread_id() / CGSize;
+  auto const warp_tile   = (threadIdx.x % cuco::detail::warp_size()) / CGSize;
 
-  while (idx < n) {
-    if (pred(*(stencil + idx))) {
+  // all tiles of a warp iterate together so that duplicates can be matched across them
+  while (idx - warp_tile < n) {
+    auto const active = idx < n and pred(*(stencil + idx));
+    auto const is_representative =
+      not dedup_inputs or
+      is_warp_representative<CGSize>(
+        match_warp_keys([&]() { return input_key<Ref>(*(first + idx)); }, active));
+    if (active and is_representative) {
       typename std::iterator_traits<InputIt>::value_type const& insert_element{*(first + idx)};
       if constexpr (CGSize == 1) {
         if (ref.insert(insert_element)) { thread_num_successes++; };
@@ -94,6 +216,9 @@ CUCO_KERNEL __launch_bounds__(BlockSize) void insert_if_n(InputIt first,
   auto const block_num_successes = BlockReduce(temp_storage).Sum(thread_num_successes);
   if (threadIdx.x == 0) {
     num_successes->fetch_add(block_num_successes, cuda::std::memory_order_relaxed);
+    if (size_counter != nullptr) {
+      size_counter->fetch_add(block_num_successes, cuda::std::memory_order_relaxed);
+    }
   }
 }
 
@@ -113,39 +238,75 @@ CUCO_KERNEL __launch_bounds__(BlockSize) void insert_if_n(InputIt first,
  * convertible to Predicate's argument type
  * @tparam Predicate Unary predicate callable whose return type must be convertible to `bool`
  * and argument type is convertible from `std::iterator_traits<StencilIt>::value_type`
+ * @tparam AtomicT Atomic counter type
  * @tparam Ref Type of non-owning device ref allowing access to storage
  *
  * @param first Beginning of the sequence of input elements
  * @param n Number of input elements
  * @param stencil Beginning of the stencil sequence
  * @param pred Predicate to test on every element in the range `[stencil, stencil + n)`
+ * @param size_counter Optional container size counter incremented by the number of successful
+ * insertions. Ignored if `nullptr`
  * @param ref Non-owning container device ref used to access the slot storage
+ * @param dedup_inputs Flag indicating whether only one of the bitwise equal keys processed by a
+ * warp at a time is inserted. Ignored if the container allows duplicate keys
  */
 template <int32_t CGSize,
           int32_t BlockSize,
           typename InputIt,
           typename StencilIt,
           typename Predicate,
+          typename AtomicT,
           typename Ref>
-CUCO_KERNEL __launch_bounds__(BlockSize) void insert_if_n(
-  InputIt first, cuco::detail::index_type n, StencilIt stencil, Predicate pred, Ref ref)
+CUCO_KERNEL __launch_bounds__(BlockSize) void insert_if_n(InputIt first,
+                                                          cuco::detail::index_type n,
+                                                          StencilIt stencil,
+                                                          Predicate pred,
+                                                          AtomicT* size_counter,
+                                                          Ref ref,
+                                                          bool dedup_inputs)
 {
+  using size_type = typename Ref::size_type;
+
+  dedup_inputs = dedup_inputs and not Ref::allows_duplicates;
+
+  size_type thread_num_successes = 0;
+
   auto const loop_stride = cuco::detail::grid_stride() / CGSize;
   auto idx               = cuco::detail::global_thread_id() / CGSize;
+  auto const warp_tile   = (threadIdx.x % cuco::detail::warp_size()) / CGSize;
 
-  while (idx < n) {
-    if (pred(*(stencil + idx))) {
+  // all tiles of a warp iterate together so that duplicates can be matched across them
+  while (idx - warp_tile < n) {
+    auto const active = idx < n and pred(*(stencil + idx));
+    auto const is_representative =
+      not dedup_inputs or
+      is_warp_representative<CGSize>(
+        match_warp_keys([&]() { return input_key<Ref>(*(first + idx)); }, active));
+    if (active and is_representative) {
       typename std::iterator_traits<InputIt>::value_type const& insert_element{*(first + idx)};
       if constexpr (CGSize == 1) {
-        ref.insert(insert_element);
+        if (ref.insert(insert_element)) { thread_num_successes++; }
       } else {
         auto const tile =
           cooperative_groups::tiled_partition<CGSize>(cooperative_groups::this_thread_block());
-        ref.insert(tile, insert_element);
+        if (ref.insert(tile, insert_element) and tile.thread_rank() == 0) {
+          thread_num_successes++;
+        }
       }
     }
     idx += loop_stride;
   }
+
+  // `size_counter` is the same for all threads, so the whole block takes this branch or none
+  if (size_counter != nullptr) {
+    using BlockReduce = cub::BlockReduce<size_type, BlockSize>;
+    __shared__ typename BlockReduce::TempStorage temp_storage;
+    auto const block_num_successes = BlockReduce(temp_storage).Sum(thread_num_successes);
+    if (threadIdx.x == 0) {
+      size_counter->fetch_add(block_num_successes, cuda::std::memory_order_relaxed);
+    }
+  }
 }
 
 /**
@@ -155,31 +316,48 @@ CUCO_KERNEL __launch_bounds__(BlockSize) void insert_if_n(
  * @tparam BlockSize Number of threads in each block
  * @tparam InputIt Device accessible input iterator whose `value_type` is
  * convertible to the `value_type` of the data structure
+ * @tparam AtomicT Atomic counter type
  * @tparam Ref Type of non-owning device ref allowing access to storage
  *
  * @param first Beginning of the sequence of input elements
  * @param n Number of input elements
+ * @param size_counter Optional container size counter decremented by the number of successful
+ * erasures. Ignored if `nullptr`
  * @param ref Non-owning container device ref used to access the slot storage
  */
-template <int32_t CGSize, int32_t BlockSize, typename InputIt, typename Ref>
+template <int32_t CGSize, int32_t BlockSize, typename InputIt, typename AtomicT, typename Ref>
 CUCO_KERNEL __launch_bounds__(BlockSize) void erase(InputIt first,
                                                     cuco::detail::index_type n,
+                                                    AtomicT* size_counter,
                                                     Ref ref)
 {
-  auto const loop_stride = cuco::detail::grid_stride() / CGSize;
-  auto idx               = cuco::detail::global_thread_id() / CGSize;
+  using size_type = typename Ref::size_type;
+
+  auto const loop_stride      = cuco::detail::grid_stride() / CGSize;
+  auto idx                    = cuco::detail::global_thread_id() / CGSize;
+  size_type thread_num_erased = 0;
 
   while (idx < n) {
     typename std::iterator_traits<InputIt>::value_type const& erase_element{*(first + idx)};
     if constexpr (CGSize == 1) {
-      ref.erase(erase_element);
+      if (ref.erase(erase_element)) { thread_num_erased++; }
     } else {
       auto const tile =
         cooperative_groups::tiled_partition<CGSize>(cooperative_groups::this_thread_block());
-      ref.erase(tile, erase_element);
+      if (ref.erase(tile, erase_element) and tile.thread_rank() == 0) { thread_num_erased++; }
     }
     idx += loop_stride;
   }
+
+  // `size_counter` is the same for all threads, so the whole block takes this branch or none
+  if (size_counter != nullptr) {
+    using BlockReduce = cub::BlockReduce<size_type, BlockSize>;
+    __shared__ typename BlockReduce::TempStorage temp_storage;
+    auto const block_num_erased = BlockReduce(temp_storage).Sum(thread_num_erased);
+    if (threadIdx.x == 0) {
+      size_counter->fetch_sub(block_num_erased, cuda::std::memory_order_relaxed);
+    }
+  }
 }
 
 /**
@@ -432,12 +610,15 @@ CUCO_KERNEL __launch_bounds__(BlockSize) void find_if_n(InputIt first,
  * is constructible from `map::iterator` type
  * @tparam InsertedIt Device accessible random access output iterator whose `value_type`
  * is constructible from `bool`
+ * @tparam AtomicT Atomic counter type
  * @tparam Ref Type of non-owning device container ref allowing access to storage
  *
  * @param first Beginning of the sequence of input elements
  * @param n Number of input elements
  * @param found_begin Beginning of the sequence of elements found for each key
  * @param inserted_begin Beginning of the sequence of booleans for the presence of each key
+ * @param size_counter Optional container size counter incremented by the number of successful
+ * insertions. Ignored if `nullptr`
  * @param ref Non-owning container device ref used to access the slot storage
  */
 template <int32_t CGSize,
@@ -445,11 +626,13 @@ template <int32_t CGSize,
           typename InputIt,
           typename FoundIt,
           typename InsertedIt,
+          typename AtomicT,
           typename Ref>
 CUCO_KERNEL __launch_bounds__(BlockSize) void insert_and_find(InputIt first,
                                                               cuco::detail::index_type n,
                                                               FoundIt found_begin,
                                                               InsertedIt inserted_begin,
+                                                              AtomicT* size_counter,
                                                               Ref ref)
 {
   namespace cg = cooperative_groups;
@@ -474,6 +657,9 @@ CUCO_KERNEL __launch_bounds__(BlockSize) void insert_and_find(InputIt first,
   __shared__ output_type output_location_buffer[BlockSize / CGSize];
   __shared__ bool output_inserted_buffer[BlockSize / CGSize];
 
+  using size_type               = typename Ref::size_type;
+  size_type thread_num_inserted = 0;
+
   while ((idx - thread_idx / CGSize) < n) {  // the whole thread block falls into the same iteration
     if constexpr (CGSize == 1) {
       if (idx < n) {
@@ -487,6 +673,7 @@ CUCO_KERNEL __launch_bounds__(BlockSize) void insert_and_find(InputIt first,
          */
         output_location_buffer[thread_idx] = output(iter);
         output_inserted_buffer[thread_idx] = inserted;
+        thread_num_inserted += static_cast<size_type>(inserted);
       }
       block.sync();
       if (idx < n) {
@@ -501,11 +688,101 @@ CUCO_KERNEL __launch_bounds__(BlockSize) void insert_and_find(InputIt first,
         if (tile.thread_rank() == 0) {
           *(found_begin + idx)    = output(iter);
           *(inserted_begin + idx) = inserted;
+          thread_num_inserted += static_cast<size_type>(inserted);
         }
       }
     }
     idx += loop_stride;
   }
+
+  // `size_counter` is the same for all threads, so the whole block takes this branch or none
+  if (size_counter != nullptr) {
+    using BlockReduce = cub::BlockReduce<size_type, BlockSize>;
+    __shared__ typename BlockReduce::TempStorage temp_storage;
+    auto const block_num_inserted = BlockReduce(temp_storage).Sum(thread_num_inserted);
+    if (threadIdx.x == 0) {
+      size_counter->fetch_add(block_num_inserted, cuda::std::memory_order_relaxed);
+    }
+  }
+}
+
+/**
+ * @brief Inserts all elements in the range `[first, first + n)` and copies the elements that could
+ * not be placed to `unplaced_begin`.
+ *
+ * @note An element is unplaced if neither it nor an element with an equivalent key is contained in
+ * the container after the insertion attempt, i.e., if its probing sequence is exhausted. The order
+ * of unplaced elements in the output is unspecified.
+ *
+ * @tparam CGSize Number of threads in each CG
+ * @tparam BlockSize Number of threads in each block
+ * @tparam InputIt Device accessible input iterator whose `value_type` is
+ * convertible to the `value_type` of the data structure
+ * @tparam OutputIt Device accessible random access output iterator whose `value_type` is
+ * constructible from `std::iterator_traits<InputIt>::value_type`
+ * @tparam AtomicT Atomic counter type
+ * @tparam Ref Type of non-owning device container ref allowing access to storage
+ *
+ * @param first Beginning of the sequence of input elements
+ * @param n Number of input elements
+ * @param unplaced_begin Beginning of the sequence of unplaced elements
+ * @param num_unplaced Number of unplaced elements
+ * @param size_counter Optional container size counter incremented by the number of successful
+ * insertions. Ignored if `nullptr`
+ * @param ref Non-owning container device ref used to access the slot storage
+ */
+template <int32_t CGSize,
+          int32_t BlockSize,
+          typename InputIt,
+          typename OutputIt,
+          typename AtomicT,
+          typename Ref>
+CUCO_KERNEL __launch_bounds__(BlockSize) void try_insert_n(InputIt first,
+                                                           cuco::detail::index_type n,
+                                                           OutputIt unplaced_begin,
+                                                           AtomicT* num_unplaced,
+                                                           AtomicT* size_counter,
+                                                           Ref ref)
+{
+  using size_type   = typename Ref::size_type;
+  using BlockReduce = cub::BlockReduce<size_type, BlockSize>;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+  size_type thread_num_inserted = 0;
+
+  auto const loop_stride = cuco::detail::grid_stride() / CGSize;
+  auto idx               = cuco::detail::global_thread_id() / CGSize;
+
+  while (idx < n) {
+    typename std::iterator_traits<InputIt>::value_type const& insert_element{*(first + idx)};
+    if constexpr (CGSize == 1) {
+      auto const [iter, inserted] = ref.insert_and_find(insert_element);
+      thread_num_inserted += static_cast<size_type>(inserted);
+      if (not inserted and iter == ref.end()) {
+        auto const offset = num_unplaced->fetch_add(1, cuda::std::memory_order_relaxed);
+        *(unplaced_begin + offset) = insert_element;
+      }
+    } else {
+      auto const tile =
+        cooperative_groups::tiled_partition<CGSize>(cooperative_groups::this_thread_block());
+      auto const [iter, inserted] = ref.insert_and_find(tile, insert_element);
+      if (tile.thread_rank() == 0) {
+        thread_num_inserted += static_cast<size_type>(inserted);
+        if (not inserted and iter == ref.end()) {
+          auto const offset = num_unplaced->fetch_add(1, cuda::std::memory_order_relaxed);
+          *(unplaced_begin + offset) = insert_element;
+        }
+      }
+    }
+    idx += loop_stride;
+  }
+
+  // `size_counter` is the same for all threads, so the whole block takes this branch or none
+  if (size_counter != nullptr) {
+    auto const block_num_inserted = BlockReduce(temp_storage).Sum(thread_num_inserted);
+    if (threadIdx.x == 0) {
+      size_counter->fetch_add(block_num_inserted, cuda::std::memory_order_relaxed);
+    }
+  }
 }
 
 /**
@@ -515,13 +792,15 @@ CUCO_KERNEL __launch_bounds__(BlockSize) void insert_and_find(InputIt first,
  * @tparam CGSize Number of threads in each CG
  * @tparam BlockSize Number of threads in each block
  * @tparam InputIt Device accessible input iterator
- * @tparam AtomicT Atomic counter type
+ * @tparam AtomicT Integral counter type or atomic counter type
  * @tparam Ref Type of non-owning device container ref allowing access to storage
  *
  * @param first Beginning of the sequence of input elements
  * @param n Number of input elements
  * @param count Number of matches
  * @param ref Non-owning container device ref used to access the slot storage
+ * @param dedup_inputs Flag indicating whether bitwise equal keys processed by a warp at a time are
+ * counted once and the result scaled by their multiplicity
  */
 template <bool IsOuter,
           int32_t CGSize,
@@ -532,7 +811,8 @@ template <bool IsOuter,
 CUCO_KERNEL __launch_bounds__(BlockSize) void count(InputIt first,
                                                     cuco::detail::index_type n,
                                                     AtomicT* count,
-                                                    Ref ref)
+                                                    Ref ref,
+                                                    bool dedup_inputs)
 {
   using size_type = typename Ref::size_type;
 
@@ -544,31 +824,44 @@ CUCO_KERNEL __launch_bounds__(BlockSize) void count(InputIt first,
 
   auto const loop_stride = cuco::detail::grid_stride() / CGSize;
   auto idx               = cuco::detail::global_thread_id() / CGSize;
+  auto const warp_tile   = (threadIdx.x % cuco::detail::warp_size()) / CGSize;
 
-  while (idx < n) {
-    typename std::iterator_traits<InputIt>::value_type const& key = *(first + idx);
-    if constexpr (CGSize == 1) {
-      if constexpr (IsOuter) {
-        thread_count += max(ref.count(key), outer_min_count);
-      } else {
-        thread_count += ref.count(key);
-      }
-    } else {
-      auto const tile =
-        cooperative_groups::tiled_partition<CGSize>(cooperative_groups::this_thread_block());
-      if constexpr (IsOuter) {
-        auto temp_count = ref.count(tile, key);
-        if (tile.all(temp_count == 0) and tile.thread_rank() == 0) { ++temp_count; }
-        thread_count += temp_count;
+  // all tiles of a warp iterate together so that duplicates can be matched across them
+  while (idx - warp_tile < n) {
+    auto const active = idx < n;
+    // number of tiles whose count is computed by the calling tile
+    size_type multiplicity = 1;
+    if (dedup_inputs) {
+      auto const peers = match_warp_keys([&]() { return *(first + idx); }, active);
+      multiplicity     = is_warp_representative<CGSize>(peers) ? __popc(peers) / CGSize : 0;
+    }
+    if (active and multiplicity > 0) {
+      typename std::iterator_traits<InputIt>::value_type const& key = *(first + idx);
+      if constexpr (CGSize == 1) {
+        if constexpr (IsOuter) {
+          thread_count += multiplicity * max(ref.count(key), outer_min_count);
+        } else {
+          thread_count += multiplicity * ref.count(key);
+        }
       } else {
-        thread_count += ref.count(tile, key);
+        auto const tile =
+          cooperative_groups::tiled_partition<CGSize>(cooperative_groups::this_thread_block());
+        if constexpr (IsOuter) {
+          auto temp_count = ref.count(tile, key);
+          if (tile.all(temp_count == 0) and tile.thread_rank() == 0) { ++temp_count; }
+          thread_count += multiplicity * temp_count;
+        } else {
+          thread_count += multiplicity * ref.count(tile, key);
+        }
       }
     }
     idx += loop_stride;
   }
 
   auto const block_count = BlockReduce(temp_storage).Sum(thread_count);
-  if (threadIdx.x == 0) { count->fetch_add(block_count, cuda::std::memory_order_relaxed); }
+  if (threadIdx.x == 0) {
+    counter_ref(count).fetch_add(block_count, cuda::std::memory_order_relaxed);
+  }
 }
 
 /**
@@ -586,7 +879,7 @@ CUCO_KERNEL __launch_bounds__(BlockSize) void count(InputIt first,
  * convertible to the `InputProbeIt`'s `value_type`
  * @tparam OutputMatchIt Device accessible input iterator whose `value_type` is
  * convertible to the container's `value_type`
- * @tparam AtomicCounter Integral atomic type that follows the same semantics as
+ * @tparam AtomicCounter Integral type or integral atomic type that follows the same semantics as
  * `cuda::(std::)atomic(_ref)`
  * @tparam Ref Type of non-owning device ref allowing access to storage
  *
@@ -595,8 +888,8 @@ CUCO_KERNEL __launch_bounds__(BlockSize) void count(InputIt first,
  * @param output_probe Beginning of the sequence of keys corresponding to matching elements in
  * `output_match`
  * @param output_match Beginning of the sequence of matching elements
- * @param atomic_counter Pointer to an atomic object of integral type that is used to count the
- * number of output elements
+ * @param atomic_counter Pointer to an integral or atomic object that is used to count the number of
+ * output elements
  * @param ref Non-owning container device ref used to access the slot storage
  */
 template <bool IsOuter,
@@ -623,20 +916,21 @@ CUCO_KERNEL void retrieve(InputProbeIt input_probe,
     min(n, static_cast<cuco::detail::index_type>(block_begin_offset + tiles_in_block));
 
   if (block_begin_offset < block_end_offset) {
+    auto&& counter = counter_ref(atomic_counter);
     if constexpr (IsOuter) {
       ref.retrieve_outer<BlockSize>(block,
                                     input_probe + block_begin_offset,
                                     input_probe + block_end_offset,
                                     output_probe,
                                     output_match,
-                                    atomic_counter);
+                                    &counter);
     } else {
       ref.retrieve<BlockSize>(block,
                               input_probe + block_begin_offset,
                               input_probe + block_end_offset,
                               output_probe,
                               output_match,
-                              atomic_counter);
+                              &counter);
     }
   }
 }
@@ -647,7 +941,7 @@ CUCO_KERNEL void retrieve(InputProbeIt input_probe,
  * @tparam BlockSize Number of threads in each block
  * @tparam StorageRef Type of non-owning ref allowing access to storage
  * @tparam Predicate Type of predicate indicating if the given slot is filled
- * @tparam AtomicT Atomic counter type
+ * @tparam AtomicT Integral counter type or atomic counter type
  *
  * @param storage Non-owning device ref used to access the slot storage
  * @param is_filled Predicate indicating if the given slot is filled
@@ -678,7 +972,9 @@ CUCO_KERNEL __launch_bounds__(BlockSize) void size(StorageRef storage,
   using BlockReduce = cub::BlockReduce<size_type, BlockSize>;
   __shared__ typename BlockReduce::TempStorage temp_storage;
   auto const block_count = BlockReduce(temp_storage).Sum(thread_count);
-  if (threadIdx.x == 0) { count->fetch_add(block_count, cuda::std::memory_order_relaxed); }
+  if (threadIdx.x == 0) {
+    counter_ref(count).fetch_add(block_count, cuda::std::memory_order_relaxed);
+  }
 }
 
 template <int32_t BlockSize, typename ContainerRef, typename Predicate>
@@ -729,4 +1025,438 @@ CUCO_KERNEL __launch_bounds__(BlockSize) void rehash(
   }
 }
 
+/**
+ * @brief Moves the elements held by the buckets `[first_bucket, first_bucket + n)` of the old
+ * storage into the container, leaving erased slots behind.
+ *
+ * @note Migrated slots are erased rather than emptied so that the probing sequences of the
+ * elements still held by the old storage stay intact.
+ *
+ * @tparam BlockSize Number of threads in each block
+ * @tparam StorageRef Type of non-owning ref allowing access to the old storage
+ * @tparam ContainerRef Type of non-owning device container ref to the new storage
+ * @tparam Predicate Type of predicate indicating if the given slot is filled
+ *
+ * @param old_storage Non-owning device ref used to access the old slot storage
+ * @param first_bucket Index of the first bucket to migrate
+ * @param n Number of buckets to migrate
+ * @param container_ref Non-owning device container ref used to insert into the new storage
+ * @param is_filled Predicate indicating if the given slot is filled
+ * @param erased_slot Slot value indicating an erased slot
+ */
+template <int32_t BlockSize, typename StorageRef, typename ContainerRef, typename Predicate>
+CUCO_KERNEL __launch_bounds__(BlockSize) void migrate(
+  StorageRef old_storage,
+  cuco::detail::index_type first_bucket,
+  cuco::detail::index_type n,
+  ContainerRef container_ref,
+  Predicate is_filled,
+  typename StorageRef::value_type erased_slot)
+{
+  namespace cg = cooperative_groups;
+
+  auto constexpr bucket_size = StorageRef::bucket_size;
+  auto constexpr cg_size     = ContainerRef::cg_size;
+
+  __shared__ typename ContainerRef::value_type buffer[BlockSize * bucket_size];
+  __shared__ unsigned int buffer_size;
+
+  auto const block = cg::this_thread_block();
+  auto const tile  = cg::tiled_partition<cg_size>(block);
+
+  auto const thread_rank         = block.thread_rank();
+  auto constexpr tiles_per_block = BlockSize / cg_size;
+  auto const tile_rank           = tile.meta_group_rank();
+  auto const loop_stride         = cuco::detail::grid_stride();
+  auto idx                       = cuco::detail::global_thread_id();
+
+  while (idx - thread_rank < n) {
+    if (thread_rank == 0) { buffer_size = 0; }
+    block.sync();
+
+    // gather the elements of the old storage in shmem and erase them from their slots
+    if (idx < n) {
+      auto& bucket = old_storage.data()[first_bucket + idx];
+      for (auto& slot : bucket) {
+        if (is_filled(slot)) {
+          buffer[atomicAdd_block(&buffer_size, 1)] = slot;
+          slot                                     = erased_slot;
+        }
+      }
+    }
+    block.sync();
+
+    auto const local_buffer_size = buffer_size;
+
+    for (auto tidx = tile_rank; tidx < local_buffer_size; tidx += tiles_per_block) {
+      container_ref.insert(tile, buffer[tidx]);
+    }
+    block.sync();
+
+    idx += loop_stride;
+  }
+}
+
+/**
+ * @brief Moves the elements of every cluster into the tombstones on their probing paths.
+ *
+ * @note A cluster is a maximal run of non-empty slots, possibly wrapping around the end of the
+ * storage. With linear probing, an element and all slots between its home slot and itself belong
+ * to the same cluster, so each cluster is compacted independently by the thread owning its first
+ * slot. Elements are visited in probing order and moved to the first tombstone at or after their
+ * home slot, which leaves all tombstones of a compacted cluster off any probing path. Moved-from
+ * slots are marked as erased; no slot is emptied, so cluster boundaries stay stable while the
+ * kernel runs.
+ * @note Every move depends on the tombstones left by the previous ones, so a cluster cannot be
+ * split among threads. A cluster of length `L` costs its thread O(L) slot visits plus the
+ * displacement of every moved element, i.e., O(L^2) in the worst case, while all other threads
+ * idle. Near-full storages whose clusters span most of the slots thus degrade to a serial pass.
+ *
+ * @tparam BlockSize Number of threads in each block
+ * @tparam StorageRef Type of non-owning ref allowing access to storage
+ * @tparam ProbingScheme Type of the linear probing scheme
+ * @tparam Key Key type
+ * @tparam AtomicT Atomic counter type
+ *
+ * @param storage Non-owning device ref used to access the slot storage
+ * @param probing_scheme Probing scheme used to compute home slots
+ * @param empty_key Key sentinel indicating an empty slot
+ * @param erased_key Key sentinel indicating an erased slot
+ * @param num_clusters Number of compacted clusters
+ */
+template <int32_t BlockSize,
+          typename StorageRef,
+          typename ProbingScheme,
+          typename Key,
+          typename AtomicT>
+CUCO_KERNEL __launch_bounds__(BlockSize) void compact_clusters(StorageRef storage,
+                                                               ProbingScheme probing_scheme,
+                                                               Key empty_key,
+                                                               Key erased_key,
+                                                               AtomicT* num_clusters)
+{
+  auto constexpr bucket_size = StorageRef::bucket_size;
+  auto constexpr has_payload = not std::is_same_v<Key, typename StorageRef::value_type>;
+
+  auto const num_slots = static_cast<cuco::detail::index_type>(storage.capacity());
+  auto const key_of    = [&](cuco::detail::index_type idx) -> Key& {
+    auto& slot = storage.data()[idx / bucket_size][idx % bucket_size];
+    if constexpr (has_payload) {
+      return slot.first;
+    } else {
+      return slot;
+    }
+  };
+  auto const is_empty = [&](cuco::detail::index_type idx) {
+    return cuco::detail::bitwise_compare(key_of(idx), empty_key);
+  };
+  auto const is_free = [&](cuco::detail::index_type idx) {
+    return is_empty(idx) or cuco::detail::bitwise_compare(key_of(idx), erased_key);
+  };
+
+  auto const loop_stride = cuco::detail::grid_stride();
+  auto start             = cuco::detail::global_thread_id();
+
+  while (start < num_slots) {
+    auto const prev = (start == 0 ? num_slots : start) - 1;
+    if (is_empty(prev) and not is_empty(start)) {
+      num_clusters->fetch_add(1, cuda::std::memory_order_relaxed);
+      // Slots are addressed by their offset from the cluster start
+      auto const slot_at = [&](cuco::detail::index_type offset) {
+        return (start + offset) % num_slots;
+      };
+      auto first_free = num_slots;
+      for (cuco::detail::index_type pos = 0; pos < num_slots and not is_empty(slot_at(pos));
+           ++pos) {
+        auto const idx = slot_at(pos);
+        if (cuco::detail::bitwise_compare(key_of(idx), erased_key)) {
+          if (first_free == num_slots) { first_free = pos; }
+          continue;
+        }
+        if (first_free >= pos) { continue; }
+
+        auto const home_bucket = *probing_scheme(key_of(idx), storage.bucket_extent());
+        auto const home = static_cast<cuco::detail::index_type>(home_bucket) * bucket_size;
+        auto const home_pos = (home + num_slots - start) % num_slots;
+        if (home_pos >= pos) { continue; }
+
+        auto target = cuda::std::max(home_pos, first_free);
+        while (target < pos and not is_free(slot_at(target))) {
+          ++target;
+        }
+        if (target == pos) { continue; }
+
+        auto& dst = storage.data()[slot_at(target) / bucket_size][slot_at(target) % bucket_size];
+        dst       = storage.data()[idx / bucket_size][idx % bucket_size];
+        key_of(idx) = erased_key;
+
+        if (target == first_free) {
+          do {
+            ++first_free;
+          } while (not is_free(slot_at(first_free)));
+        }
+      }
+    }
+    start += loop_stride;
+  }
+}
+
+/**
+ * @brief Turns all erased slots into empty slots once every cluster has been compacted.
+ *
+ * @note If no cluster was compacted, i.e., the storage has no empty slot, tombstones may still be
+ * on probing paths and are left untouched.
+ *
+ * @tparam BlockSize Number of threads in each block
+ * @tparam StorageRef Type of non-owning ref allowing access to storage
+ * @tparam Key Key type
+ * @tparam AtomicT Atomic counter type
+ *
+ * @param storage Non-owning device ref used to access the slot storage
+ * @param empty_slot Slot value indicating an empty slot
+ * @param erased_key Key sentinel indicating an erased slot
+ * @param num_clusters Number of compacted clusters
+ */
+template <int32_t BlockSize, typename StorageRef, typename Key, typename AtomicT>
+CUCO_KERNEL __launch_bounds__(BlockSize) void release_tombstones(
+  StorageRef storage,
+  typename StorageRef::value_type empty_slot,
+  Key erased_key,
+  AtomicT const* num_clusters)
+{
+  if (num_clusters->load(cuda::std::memory_order_relaxed) == 0) { return; }
+
+  auto constexpr has_payload = not std::is_same_v<Key, typename StorageRef::value_type>;
+
+  auto const loop_stride = cuco::detail::grid_stride();
+  auto idx               = cuco::detail::global_thread_id();
+  auto const n           = storage.num_buckets();
+
+  while (idx < n) {
+    auto& bucket = storage.data()[idx];
+#pragma unroll
+    for (auto& slot : bucket) {
+      auto const& key = [&]() -> Key const& {
+        if constexpr (has_payload) {
+          return slot.first;
+        } else {
+          return slot;
+        }
+      }();
+      if (cuco::detail::bitwise_compare(key, erased_key)) { slot = empty_slot; }
+    }
+    idx += loop_stride;
+  }
+}
+
+/**
+ * @brief Computes the partition of each input element along with its position in the input.
+ *
+ * @tparam BlockSize Number of threads in each block
+ * @tparam InputIt Device accessible random access input iterator
+ * @tparam PartitionFn Unary callable returning the partition of an input element
+ * @tparam PartitionT Partition identifier type
+ * @tparam IndexT Input position type
+ *
+ * @param first Beginning of the sequence of input elements
+ * @param n Number of input elements
+ * @param partition_of Callable returning the partition of an input element
+ * @param partitions Output partition of each input element
+ * @param indices Output position of each input element
+ */
+template <int32_t BlockSize,
+          typename InputIt,
+          typename PartitionFn,
+          typename PartitionT,
+          typename IndexT>
+CUCO_KERNEL __launch_bounds__(BlockSize) void partition_n(InputIt first,
+                                                          cuco::detail::index_type n,
+                                                          PartitionFn partition_of,
+                                                          PartitionT* partitions,
+                                                          IndexT* indices)
+{
+  auto const loop_stride = cuco::detail::grid_stride();
+  auto idx               = cuco::detail::global_thread_id();
+
+  while (idx < n) {
+    partitions[idx] = partition_of(*(first + idx));
+    indices[idx]    = static_cast<IndexT>(idx);
+    idx += loop_stride;
+  }
+}
+
+/**
+ * @brief Computes the number of probing steps from the home bucket of `key` to the bucket with
+ * index `bucket_idx`.
+ *
+ * @tparam CGSize Number of threads in each CG
+ * @tparam ProbingScheme Probing scheme type
+ * @tparam Key Key type
+ * @tparam Extent Bucket extent type
+ *
+ * @param tile The CG computing the probe length
+ * @param probing_scheme Probing scheme used to compute the probing sequence of `key`
+ * @param key Key of the element
+ * @param bucket_extent Number of buckets covered by probing sequences
+ * @param bucket_idx Index of the bucket holding the element
+ * @param max_steps Number of probing steps of a full probing cycle
+ *
+ * @return The probe length, or `max_steps` if `bucket_idx` is not on the probing sequence
+ */
+template <int32_t CGSize, typename ProbingScheme, typename Key, typename Extent>
+__device__ cuco::detail::index_type probe_length(
+  cooperative_groups::thread_block_tile<CGSize> const& tile,
+  ProbingScheme const& probing_scheme,
+  Key const& key,
+  Extent bucket_extent,
+  cuco::detail::index_type bucket_idx,
+  cuco::detail::index_type max_steps) noexcept
+{
+  // Buckets beyond the extent, e.g., stash buckets, are not on any probing sequence
+  if (bucket_idx >= static_cast<cuco::detail::index_type>(bucket_extent)) { return max_steps; }
+
+  auto probing_iter = [&]() {
+    if constexpr (CGSize == 1) {
+      return probing_scheme(key, bucket_extent);
+    } else {
+      return probing_scheme(tile, key, bucket_extent);
+    }
+  }();
+
+  for (cuco::detail::index_type step = 0; step < max_steps; ++step) {
+    if (tile.any(static_cast<cuco::detail::index_type>(*probing_iter) == bucket_idx)) {
+      return step;
+    }
+    ++probing_iter;
+  }
+  return max_steps;
+}
+
+/**
+ * @brief Gathers probe length and occupancy statistics of the slot storage.
+ *
+ * Each CG inspects one bucket at a time. It counts the filled and erased slots of the bucket and
+ * computes the probe length of each element held by the bucket. Histograms are first accumulated
+ * per block in shared memory.
+ *
+ * @tparam CGSize Number of threads in each CG
+ * @tparam BlockSize Number of threads in each block
+ * @tparam NumProbeLengthBins Number of bins of the probe length histogram
+ * @tparam StorageRef Type of non-owning ref allowing access to storage
+ * @tparam ProbingScheme Probing scheme type
+ * @tparam Key Key type
+ * @tparam T Counter type
+ *
+ * @param storage Non-owning device ref used to access the slot storage
+ * @param probing_scheme Probing scheme used to compute home buckets
+ * @param empty_key Key sentinel indicating an empty slot
+ * @param erased_key Key sentinel indicating an erased slot
+ * @param probe_lengths Probe length histogram. The last bin also counts longer probe lengths
+ * @param bucket_fills Histogram of the number of filled slots per bucket
+ * @param num_tombstones Number of erased slots
+ * @param max_probe_length Longest probe length
+ */
+template <int32_t CGSize,
+          int32_t BlockSize,
+          int32_t NumProbeLengthBins,
+          typename StorageRef,
+          typename ProbingScheme,
+          typename Key,
+          typename T>
+CUCO_KERNEL __launch_bounds__(BlockSize) void probe_statistics(StorageRef storage,
+                                                               ProbingScheme probing_scheme,
+                                                               Key empty_key,
+                                                               Key erased_key,
+                                                               T* probe_lengths,
+                                                               T* bucket_fills,
+                                                               T* num_tombstones,
+                                                               T* max_probe_length)
+{
+  namespace cg = cooperative_groups;
+
+  auto constexpr bucket_size = StorageRef::bucket_size;
+  auto constexpr has_payload = not std::is_same_v<Key, typename StorageRef::value_type>;
+  using block_ref_type       = cuda::atomic_ref<T, cuda::thread_scope_block>;
+  using device_ref_type      = cuda::atomic_ref<T, cuda::thread_scope_device>;
+
+  __shared__ T block_probe_lengths[NumProbeLengthBins];
+  __shared__ T block_bucket_fills[bucket_size + 1];
+  __shared__ T block_counters[2];  // tombstones, longest probe length
+
+  auto const block = cg::this_thread_block();
+  for (auto i = block.thread_rank(); i < NumProbeLengthBins; i += BlockSize) {
+    block_probe_lengths[i] = 0;
+  }
+  for (auto i = block.thread_rank(); i <= bucket_size; i += BlockSize) {
+    block_bucket_fills[i] = 0;
+  }
+  if (block.thread_rank() < 2) { block_counters[block.thread_rank()] = 0; }
+  block.sync();
+
+  auto const tile        = cg::tiled_partition<CGSize>(block);
+  auto const num_buckets = static_cast<cuco::detail::index_type>(storage.num_buckets());
+  auto const max_steps =
+    (static_cast<cuco::detail::index_type>(storage.bucket_extent()) + CGSize - 1) / CGSize;
+
+  auto const loop_stride = cuco::detail::grid_stride() / CGSize;
+  auto idx               = cuco::detail::global_thread_id() / CGSize;
+
+  while (idx < num_buckets) {
+    auto const bucket  = storage[idx];
+    int32_t num_filled = 0;
+    T num_erased       = 0;
+    T longest          = 0;
+    for (int32_t i = 0; i < bucket_size; ++i) {
+      auto const& key = [&]() -> Key const& {
+        if constexpr (has_payload) {
+          return bucket[i].first;
+        } else {
+          return bucket[i];
+        }
+      }();
+      if (cuco::detail::bitwise_compare(key, empty_key)) { continue; }
+      if (cuco::detail::bitwise_compare(key, erased_key)) {
+        ++num_erased;
+        continue;
+      }
+      ++num_filled;
+      auto const length = probe_length<CGSize>(
+        tile, probing_scheme, key, storage.bucket_extent(), idx, max_steps);
+      longest = cuda::std::max(longest, static_cast<T>(length));
+      if (tile.thread_rank() == 0) {
+        auto const bin = cuda::std::min(length, cuco::detail::index_type{NumProbeLengthBins - 1});
+        block_ref_type{block_probe_lengths[bin]}.fetch_add(1, cuda::memory_order_relaxed);
+      }
+    }
+    if (tile.thread_rank() == 0) {
+      block_ref_type{block_bucket_fills[num_filled]}.fetch_add(1, cuda::memory_order_relaxed);
+      if (num_erased > 0) {
+        block_ref_type{block_counters[0]}.fetch_add(num_erased, cuda::memory_order_relaxed);
+      }
+      if (longest > 0) {
+        block_ref_type{block_counters[1]}.fetch_max(longest, cuda::memory_order_relaxed);
+      }
+    }
+    idx += loop_stride;
+  }
+  block.sync();
+
+  for (auto i = block.thread_rank(); i < NumProbeLengthBins; i += BlockSize) {
+    if (block_probe_lengths[i] > 0) {
+      device_ref_type{probe_lengths[i]}.fetch_add(block_probe_lengths[i],
+                                                  cuda::memory_order_relaxed);
+    }
+  }
+  for (auto i = block.thread_rank(); i <= bucket_size; i += BlockSize) {
+    if (block_bucket_fills[i] > 0) {
+      device_ref_type{bucket_fills[i]}.fetch_add(block_bucket_fills[i],
+                                                 cuda::memory_order_relaxed);
+    }
+  }
+  if (block.thread_rank() == 0) {
+    device_ref_type{*num_tombstones}.fetch_add(block_counters[0], cuda::memory_order_relaxed);
+    device_ref_type{*max_probe_length}.fetch_max(block_counters[1], cuda::memory_order_relaxed);
+  }
+}
+
 }  // namespace cuco::detail::open_addressing_ns
@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/pair/traits.hpp>
+
+#include <cuda/std/tuple>
+#include <cuda/std/type_traits>
+
+#include <cooperative_groups.h>
+
+namespace cuco::detail::open_addressing_ns {
+
+/**
+ * @brief Device container ref spanning both storages of an incremental rehash.
+ *
+ * While an incremental rehash is pending, every element is held by exactly one of the two
+ * storages: elements not migrated yet stay in the old storage, while migrated and newly inserted
+ * elements live in the new one. This ref exposes the operations of `Ref`, which accesses the new
+ * storage, extended to the elements left behind in the old storage:
+ *  - lookups search the new storage first, then the old one
+ *  - inserts fail if an equivalent key is still held by the old storage
+ *  - erases remove the key from whichever storage holds it
+ *
+ * @tparam Ref Type of non-owning device container ref to the new storage
+ * @tparam OldRef Type of non-owning device container ref to the old storage, providing the
+ * `contains`, `find`, `erase` and `count` operators
+ */
+template <typename Ref, typename OldRef>
+class migrating_ref : public Ref {
+ public:
+  using Ref::cg_size;  ///< Cooperative group size
+
+  using key_type       = typename Ref::key_type;        ///< Key type
+  using value_type     = typename Ref::value_type;      ///< Element type
+  using size_type      = typename Ref::size_type;       ///< Size type
+  using iterator       = typename Ref::iterator;        ///< Slot iterator type
+  using const_iterator = typename Ref::const_iterator;  ///< Const slot iterator type
+
+  /**
+   * @brief Constructs a ref spanning both storages of an incremental rehash.
+   *
+   * @param ref Non-owning device container ref to the new storage
+   * @param old_ref Non-owning device container ref to the old storage
+   */
+  __host__ __device__ explicit constexpr migrating_ref(Ref const& ref,
+                                                       OldRef const& old_ref) noexcept
+    : Ref{ref}, old_ref_{old_ref}
+  {
+  }
+
+  /**
+   * @brief Inserts an element unless its key is contained in either storage.
+   *
+   * @tparam Value Input type which is convertible to `value_type`
+   *
+   * @param value The element to insert
+   *
+   * @return True if the given element is successfully inserted
+   */
+  template <typename Value>
+  __device__ bool insert(Value const& value) noexcept
+  {
+    if (old_ref_.contains(key_of(value))) { return false; }
+    return Ref::insert(value);
+  }
+
+  /**
+   * @brief Inserts an element unless its key is contained in either storage.
+   *
+   * @tparam Value Input type which is convertible to `value_type`
+   *
+   * @param group The Cooperative Group used to perform group insert
+   * @param value The element to insert
+   *
+   * @return True if the given element is successfully inserted
+   */
+  template <typename Value>
+  __device__ bool insert(cooperative_groups::thread_block_tile<cg_size> const& group,
+                         Value const& value) noexcept
+  {
+    if (old_ref_.contains(group, key_of(value))) { return false; }
+    return Ref::insert(group, value);
+  }
+
+  /**
+   * @brief Erases the key from whichever storage holds it.
+   *
+   * @tparam ProbeKey Input type which is convertible to `key_type`
+   *
+   * @param key Key to erase
+   *
+   * @return True if the given key is successfully erased
+   */
+  template <typename ProbeKey>
+  __device__ bool erase(ProbeKey const& key) noexcept
+  {
+    return old_ref_.erase(key) or Ref::erase(key);
+  }
+
+  /**
+   * @brief Erases the key from whichever storage holds it.
+   *
+   * @tparam ProbeKey Input type which is convertible to `key_type`
+   *
+   * @param group The Cooperative Group used to perform group erase
+   * @param key Key to erase
+   *
+   * @return True if the given key is successfully erased
+   */
+  template <typename ProbeKey>
+  __device__ bool erase(cooperative_groups::thread_block_tile<cg_size> const& group,
+                        ProbeKey const& key) noexcept
+  {
+    return old_ref_.erase(group, key) or Ref::erase(group, key);
+  }
+
+  /**
+   * @brief Indicates whether the probe key is contained in either storage.
+   *
+   * @tparam ProbeKey Probe key type
+   *
+   * @param key The key to search for
+   *
+   * @return A boolean indicating whether the probe key is present
+   */
+  template <typename ProbeKey>
+  [[nodiscard]] __device__ bool contains(ProbeKey const& key) const noexcept
+  {
+    return Ref::contains(key) or old_ref_.contains(key);
+  }
+
+  /**
+   * @brief Indicates whether the probe key is contained in either storage.
+   *
+   * @tparam ProbeKey Probe key type
+   *
+   * @param group The Cooperative Group used to perform group contains
+   * @param key The key to search for
+   *
+   * @return A boolean indicating whether the probe key is present
+   */
+  template <typename ProbeKey>
+  [[nodiscard]] __device__ bool contains(
+    cooperative_groups::thread_block_tile<cg_size> const& group, ProbeKey const& key) const noexcept
+  {
+    return Ref::contains(group, key) or old_ref_.contains(group, key);
+  }
+
+  /**
+   * @brief Finds the element with key equivalent to the probe key in either storage.
+   *
+   * @tparam ProbeKey Probe key type
+   *
+   * @param key The key to search for
+   *
+   * @return An iterator to the matching element or `end()` if there is none
+   */
+  template <typename ProbeKey>
+  [[nodiscard]] __device__ auto find(ProbeKey const& key) const noexcept
+  {
+    auto const found = Ref::find(key);
+    if (found != Ref::end()) { return found; }
+    auto const old_found = old_ref_.find(key);
+    return old_found == old_ref_.end() ? found : old_found;
+  }
+
+  /**
+   * @brief Finds the element with key equivalent to the probe key in either storage.
+   *
+   * @tparam ProbeKey Probe key type
+   *
+   * @param group The Cooperative Group used to perform this operation
+   * @param key The key to search for
+   *
+   * @return An iterator to the matching element or `end()` if there is none
+   */
+  template <typename ProbeKey>
+  [[nodiscard]] __device__ auto find(cooperative_groups::thread_block_tile<cg_size> const& group,
+                                     ProbeKey const& key) const noexcept
+  {
+    auto const found = Ref::find(group, key);
+    if (found != Ref::end()) { return found; }
+    auto const old_found = old_ref_.find(group, key);
+    return old_found == old_ref_.end() ? found : old_found;
+  }
+
+  /**
+   * @brief Counts the occurrences of the probe key in both storages.
+   *
+   * @tparam ProbeKey Probe key type
+   *
+   * @param key The key to count for
+   *
+   * @return Number of occurrences found by the current thread
+   */
+  template <typename ProbeKey>
+  [[nodiscard]] __device__ size_type count(ProbeKey const& key) const noexcept
+  {
+    return Ref::count(key) + old_ref_.count(key);
+  }
+
+  /**
+   * @brief Counts the occurrences of the probe key in both storages.
+   *
+   * @tparam ProbeKey Probe key type
+   *
+   * @param group The Cooperative Group used to perform this operation
+   * @param key The key to count for
+   *
+   * @return Number of occurrences found by the current thread
+   */
+  template <typename ProbeKey>
+  [[nodiscard]] __device__ size_type count(
+    cooperative_groups::thread_block_tile<cg_size> const& group, ProbeKey const& key) const noexcept
+  {
+    return Ref::count(group, key) + old_ref_.count(group, key);
+  }
+
+ private:
+  /**
+   * @brief Extracts the key of an element to be inserted.
+   *
+   * @tparam Value Input type which is convertible to `value_type`
+   *
+   * @param value The input element
+   *
+   * @return The key of `value`
+   */
+  template <typename Value>
+  [[nodiscard]] __device__ static constexpr auto key_of(Value const& value) noexcept
+  {
+    if constexpr (cuda::std::is_same_v<key_type, value_type>) {
+      return value;
+    } else if constexpr (cuco::detail::is_cuda_std_pair_like<Value>::value) {
+      return cuda::std::get<0>(value);
+    } else {
+      return value.first;
+    }
+  }
+
+  OldRef old_ref_;  ///< Non-owning device container ref to the old storage
+};
+
+}  // namespace cuco::detail::open_addressing_ns
@@ -18,24 +18,39 @@
 
 #include <cuco/detail/__config>
 #include <cuco/detail/open_addressing/functors.cuh>
+#include <cuco/detail/open_addressing/host_backend.cuh>
 #include <cuco/detail/open_addressing/kernels.cuh>
+#include <cuco/detail/open_addressing/migrating_ref.cuh>
 #include <cuco/detail/storage/counter_storage.cuh>
 #include <cuco/detail/utility/cuda.hpp>
+#include <cuco/detail/utility/host_staging_pipeline.hpp>
 #include <cuco/detail/utils.hpp>
 #include <cuco/extent.cuh>
 #include <cuco/operator.hpp>
 #include <cuco/probing_scheme.cuh>
 #include <cuco/storage.cuh>
+#include <cuco/utility/allocator.hpp>
+#include <cuco/utility/container_statistics.hpp>
+#include <cuco/utility/perf_counters.hpp>
+#include <cuco/utility/persistence.hpp>
 #include <cuco/utility/traits.hpp>
 
 #include <cub/device/device_for.cuh>
+#include <cub/device/device_radix_sort.cuh>
 #include <cub/device/device_select.cuh>
 #include <cuda/atomic>
+#include <cuda/std/functional>
+#include <thrust/functional.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/permutation_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 
 #include <cmath>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 namespace cuco {
 namespace detail {
@@ -84,6 +99,13 @@ class open_addressing_impl {
   /// Determines if the container is a key/value or key-only store
   static constexpr auto has_payload = not std::is_same_v<Key, Value>;
 
+  /// Determines if bitwise equal keys are exactly the keys comparing equal, which the warp-level
+  /// input deduplication relies on
+  static constexpr auto supports_input_deduplication =
+    (std::is_same_v<KeyEqual, cuda::std::equal_to<Key>> or
+     std::is_same_v<KeyEqual, thrust::equal_to<Key>>) and
+    std::has_unique_object_representations_v<Key>;
+
  public:
   static constexpr auto cg_size      = ProbingScheme::cg_size;  ///< CG size used for probing
   static constexpr auto bucket_size  = Storage::bucket_size;    ///< Bucket size used for probing
@@ -103,6 +125,40 @@ class open_addressing_impl {
   using allocator_type = typename storage_type::allocator_type;    ///< Allocator type
 
   using storage_ref_type = typename storage_type::ref_type;  ///< Non-owning bucket storage ref type
+  /// Type of the optional counter tracking the number of contained elements
+  using size_counter_type = detail::counter_storage<size_type, thread_scope, allocator_type>;
+  using size_counter_value_type =
+    typename size_counter_type::value_type;  ///< Atomic type of the size counter
+
+  /// Indicates whether bulk operations run on host threads instead of CUDA kernels
+  static constexpr auto is_host_backend = cuco::detail::is_host_allocator_v<allocator_type>;
+  /// Indicates whether device kernels access the storage in pinned or managed memory
+  static constexpr auto has_out_of_core_storage =
+    cuco::detail::is_pinned_allocator_v<allocator_type> or
+    cuco::detail::is_managed_allocator_v<allocator_type>;
+
+  /// Allocator type of the temporaries of bulk operations, which always live in device memory
+  using temporary_allocator_type = std::conditional_t<has_out_of_core_storage,
+                                                      cuco::stream_ordered_allocator<char>,
+                                                      allocator_type>;
+  /// Type of the temporary counters of bulk operations
+  using temporary_counter_type =
+    detail::counter_storage<size_type, thread_scope, temporary_allocator_type>;
+
+  static_assert(not is_host_backend or
+                  (cg_size == 1 and std::is_same_v<Storage, cuco::storage<bucket_size>> and
+                   not cuco::is_cuckoo_probing<ProbingScheme>::value),
+                "The host backend requires scalar, non-cuckoo probing and the default "
+                "cuco::storage.");
+
+  /// Indicates whether the storage can be rehashed incrementally
+  static constexpr auto supports_incremental_rehash =
+    not(cuco::detail::is_soa_storage_ref_v<storage_ref_type> or
+        cuco::detail::is_tagged_storage_ref_v<storage_ref_type> or
+        cuco::detail::is_stash_storage_ref_v<storage_ref_type> or is_host_backend);
+
+  /// Maximum number of radix partition bits of bulk inserts and lookups
+  static constexpr int32_t max_partition_bits = 16;
 
   /**
    * @brief Constructs a statically-sized open addressing data structure with the specified initial
@@ -237,7 +293,24 @@ class open_addressing_impl {
    *
    * @param stream CUDA stream this operation is executed in
    */
-  void clear(cuda::stream_ref stream) { storage_.initialize(empty_slot_sentinel_, stream); }
+  void clear(cuda::stream_ref stream)
+  {
+    this->clear_async(stream);
+    this->wait(stream);
+  }
+
+  /**
+   * @brief Waits until all operations previously submitted to `stream` have completed.
+   *
+   * @note Host backend operations complete before returning, so this is a no-op for them and no
+   * CUDA device is required.
+   *
+   * @param stream CUDA stream to wait for
+   */
+  void wait(cuda::stream_ref stream) const
+  {
+    if constexpr (not is_host_backend) { stream.wait(); }
+  }
 
   /**
    * @brief Asynchronously erases all elements from the container. After this call, `size()` returns
@@ -247,9 +320,127 @@ class open_addressing_impl {
    */
   void clear_async(cuda::stream_ref stream) noexcept
   {
+    old_storage_.reset();
     storage_.initialize_async(empty_slot_sentinel_, stream);
+    if (size_counter_.has_value()) { size_counter_->reset(stream); }
+  }
+
+  /**
+   * @brief Asynchronously migrates the slot storage to the given location.
+   *
+   * @param location Device ordinal, or `cudaCpuDeviceId` for the host
+   * @param stream CUDA stream this operation is executed in
+   */
+  void prefetch_async(int location, cuda::stream_ref stream) const
+  {
+    static_assert(cuco::detail::is_managed_allocator_v<allocator_type>,
+                  "Prefetching requires cuco::managed_allocator.");
+    static_assert(is_persistable, "Prefetching requires contiguous slot storage.");
+    CUCO_CUDA_TRY(cudaMemPrefetchAsync(
+      storage_.ref().data(), this->payload_bytes(), location, stream.get()));
+  }
+
+  /**
+   * @brief Enables tracking of the number of contained elements so that `size()` becomes a
+   * constant-time operation.
+   *
+   * @note Once enabled, the bulk `insert`, `insert_if`, `insert_and_find` and `erase` APIs keep an
+   * internal device counter up to date and `size()` reads this counter instead of scanning the
+   * whole storage.
+   * @note Mutations performed through device-side container refs in user kernels are not tracked.
+   * Call this function again after such modifications to resynchronize the counter.
+   * @note This function does not synchronize the given stream.
+   *
+   * @param stream CUDA stream used to initialize the counter
+   */
+  void enable_size_tracking(cuda::stream_ref stream)
+  {
+    static_assert(not is_host_backend, "Size tracking is not supported by the host backend.");
+    if (not size_counter_.has_value()) { size_counter_.emplace(this->allocator()); }
+    size_counter_->reset(stream);
+    this->count_filled_slots_async(size_counter_->data(), stream);
+  }
+
+  /**
+   * @brief Indicates whether the number of contained elements is tracked by an internal counter.
+   *
+   * @return `true` if `enable_size_tracking` has been called
+   */
+  [[nodiscard]] bool is_size_tracked() const noexcept { return size_counter_.has_value(); }
+
+  /**
+   * @brief Gets the device pointer to the internal size counter.
+   *
+   * @return Pointer to the atomic size counter or `nullptr` if size tracking is disabled
+   */
+  [[nodiscard]] size_counter_value_type* size_counter() const noexcept
+  {
+    return size_counter_.has_value() ? size_counter_->data() : nullptr;
+  }
+
+  /**
+   * @brief Sets the number of radix partitions the input of bulk inserts and lookups is split into.
+   *
+   * When enabled, bulk `insert`, `insert_if`, `contains`, `contains_if`, `find` and `find_if`
+   * first sort the input positions by the high `partition_bits` bits of each key's initial probing
+   * position, and then process the keys in that order. Consecutive thread blocks thus work on the
+   * same contiguous slice of the table, which stays L2-resident while it is being probed. This
+   * pays off once the table is several times larger than the L2 cache and a partition slice,
+   * i.e., `capacity() * sizeof(value_type) / 2^partition_bits`, fits in it.
+   *
+   * @note Partitioning only reorders the work: results are written to the same output positions
+   * as with unpartitioned execution.
+   * @note The partitioned path needs `O(n)` temporary device memory obtained from the container
+   * allocator.
+   *
+   * @throw If `partition_bits` is not in `[0, max_partition_bits]`
+   *
+   * @param partition_bits Number of partition bits. `0` disables partitioning
+   */
+  void set_input_partitioning(int32_t partition_bits)
+  {
+    static_assert(not is_host_backend, "Input partitioning is not supported by the host backend.");
+    CUCO_EXPECTS(partition_bits >= 0 and partition_bits <= max_partition_bits,
+                 "Invalid number of partition bits");
+    partition_bits_ = partition_bits;
+  }
+
+  /**
+   * @brief Gets the number of radix partitions bits of bulk inserts and lookups.
+   *
+   * @return Number of partition bits, `0` if partitioning is disabled
+   */
+  [[nodiscard]] int32_t input_partition_bits() const noexcept { return partition_bits_; }
+
+  /**
+   * @brief Enables or disables the warp-level deduplication of the input of bulk inserts and
+   * counts.
+   *
+   * When enabled, the threads of a warp first match their keys against each other and only one
+   * representative per distinct key accesses the table. Bulk `insert` and `insert_if` of
+   * containers with unique keys drop the other copies, which would fail to insert anyway, while
+   * `count` and `count_outer` scale the count of the representative by the number of copies.
+   * This removes most of the contention on hot slots for heavily skewed inputs, at the cost of a
+   * few warp-wide operations per key for inputs with few duplicates.
+   *
+   * @note Has no effect unless `KeyEqual` is `cuda::std::equal_to<Key>` or `thrust::equal_to<Key>`
+   * and `Key` has unique object representations. Otherwise, bitwise equal keys may compare unequal,
+   * e.g., floating point NaNs, and merging them would change the results.
+   *
+   * @param enabled Flag indicating whether inputs are deduplicated
+   */
+  void set_input_deduplication(bool enabled) noexcept
+  {
+    dedup_inputs_ = enabled and supports_input_deduplication;
   }
 
+  /**
+   * @brief Indicates whether the input of bulk inserts and counts is deduplicated within warps.
+   *
+   * @return `true` if input deduplication is enabled
+   */
+  [[nodiscard]] bool input_deduplication() const noexcept { return dedup_inputs_; }
+
   /**
    * @brief Inserts all keys in the range `[first, last)` and returns the number of successful
    * insertions.
@@ -276,6 +467,84 @@ class open_addressing_impl {
     return this->insert_if(first, last, always_true, thrust::identity{}, container_ref, stream);
   }
 
+  /**
+   * @brief Inserts all keys in the host range `[first, last)` by streaming them to the device in
+   * chunks, and returns the number of successful insertions.
+   *
+   * @note Chunks are staged through pinned buffers and inserted by kernels overlapping the copies
+   * of the following chunks. Device memory usage is bounded by `num_stages * chunk_size` input
+   * elements regardless of the input size. The buffers and streams are kept by the container and
+   * reused by subsequent calls with the same chunk size in bytes and number of stages.
+   * @note This function synchronizes the given stream.
+   *
+   * @tparam InputIt Host accessible random access input iterator where
+   * <tt>std::is_convertible<std::iterator_traits<InputIt>::value_type,
+   * open_addressing_impl::value_type></tt> is `true`
+   * @tparam Ref Type of non-owning device container ref allowing access to storage
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param container_ref Non-owning device container ref used to access the slot storage
+   * @param chunk_size Number of keys copied to the device per chunk
+   * @param num_stages Number of chunks in flight
+   * @param stream CUDA stream used for insert
+   *
+   * @return Number of successfully inserted keys
+   */
+  template <typename InputIt, typename Ref>
+  size_type insert_from_host(InputIt first,
+                             InputIt last,
+                             Ref container_ref,
+                             std::size_t chunk_size,
+                             int32_t num_stages,
+                             cuda::stream_ref stream)
+  {
+    if constexpr (is_host_backend) {
+      return this->insert(first, last, container_ref, stream);
+    } else {
+      using input_type = typename std::iterator_traits<InputIt>::value_type;
+
+      auto const num_keys = cuco::detail::distance(first, last);
+      if (num_keys == 0) { return 0; }
+
+      auto counter = temporary_counter_type{this->temporary_allocator(stream)};
+      counter.reset(stream);
+
+      // The pinned buffers and streams are kept across calls of the same shape
+      auto const chunk_bytes = sizeof(input_type) * chunk_size;
+      if (not(host_pipeline_.has_value() and host_pipeline_->matches(chunk_bytes, num_stages))) {
+        host_pipeline_.reset();
+        host_pipeline_.emplace(chunk_bytes, num_stages, this->persistent_allocator());
+      }
+      host_pipeline_->run(
+        first,
+        num_keys,
+        [&](input_type const* chunk, cuco::detail::index_type n, cuda::stream_ref chunk_stream) {
+          auto const always_true = thrust::constant_iterator<bool>{true};
+          this->partitioned_apply(
+            chunk,
+            n,
+            [&](auto permute, auto m) {
+              auto const grid_size = cuco::detail::grid_size(m, cg_size);
+              detail::open_addressing_ns::insert_if_n<cg_size, cuco::detail::default_block_size()>
+                <<<grid_size, cuco::detail::default_block_size(), 0, chunk_stream.get()>>>(
+                  permute(chunk),
+                  m,
+                  permute(always_true),
+                  thrust::identity{},
+                  counter.data(),
+                  this->size_counter(),
+                  container_ref,
+                  dedup_inputs_);
+            },
+            chunk_stream);
+        },
+        stream);
+
+      return counter.load_to_host(stream);
+    }
+  }
+
   /**
    * @brief Asynchronously inserts all keys in the range `[first, last)`.
    *
@@ -293,7 +562,7 @@ class open_addressing_impl {
   void insert_async(InputIt first,
                     InputIt last,
                     Ref container_ref,
-                    cuda::stream_ref stream) noexcept
+                    cuda::stream_ref stream)
   {
     auto const always_true = thrust::constant_iterator<bool>{true};
     this->insert_if_async(first, last, always_true, thrust::identity{}, container_ref, stream);
@@ -336,17 +605,33 @@ class open_addressing_impl {
     auto const num_keys = cuco::detail::distance(first, last);
     if (num_keys == 0) { return 0; }
 
-    auto counter =
-      detail::counter_storage<size_type, thread_scope, allocator_type>{this->allocator()};
-    counter.reset(stream);
-
-    auto const grid_size = cuco::detail::grid_size(num_keys, cg_size);
-
-    detail::open_addressing_ns::insert_if_n<cg_size, cuco::detail::default_block_size()>
-      <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
-        first, num_keys, stencil, pred, counter.data(), container_ref);
-
-    return counter.load_to_host(stream);
+    if constexpr (is_host_backend) {
+      return detail::open_addressing_ns::host::insert_if_n(
+        first, num_keys, stencil, pred, container_ref);
+    } else {
+      auto counter = temporary_counter_type{this->temporary_allocator(stream)};
+      counter.reset(stream);
+
+      this->partitioned_apply(
+        first,
+        num_keys,
+        [&](auto permute, auto n) {
+          auto const grid_size = cuco::detail::grid_size(n, cg_size);
+          detail::open_addressing_ns::insert_if_n<cg_size, cuco::detail::default_block_size()>
+            <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+              permute(first),
+              n,
+              permute(stencil),
+              pred,
+              counter.data(),
+              this->size_counter(),
+              container_ref,
+              dedup_inputs_);
+        },
+        stream);
+
+      return counter.load_to_host(stream);
+    }
   }
 
   /**
@@ -377,16 +662,31 @@ class open_addressing_impl {
                        StencilIt stencil,
                        Predicate pred,
                        Ref container_ref,
-                       cuda::stream_ref stream) noexcept
+                       cuda::stream_ref stream)
   {
     auto const num_keys = cuco::detail::distance(first, last);
     if (num_keys == 0) { return; }
 
-    auto const grid_size = cuco::detail::grid_size(num_keys, cg_size);
-
-    detail::open_addressing_ns::insert_if_n<cg_size, cuco::detail::default_block_size()>
-      <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
-        first, num_keys, stencil, pred, container_ref);
+    if constexpr (is_host_backend) {
+      detail::open_addressing_ns::host::insert_if_n(first, num_keys, stencil, pred, container_ref);
+    } else {
+      this->partitioned_apply(
+        first,
+        num_keys,
+        [&](auto permute, auto n) {
+          auto const grid_size = cuco::detail::grid_size(n, cg_size);
+          detail::open_addressing_ns::insert_if_n<cg_size, cuco::detail::default_block_size()>
+            <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+              permute(first),
+              n,
+              permute(stencil),
+              pred,
+              this->size_counter(),
+              container_ref,
+              dedup_inputs_);
+        },
+        stream);
+    }
   }
 
   /**
@@ -421,6 +721,7 @@ class open_addressing_impl {
                              Ref container_ref,
                              cuda::stream_ref stream) noexcept
   {
+    static_assert(not is_host_backend, "insert_and_find is not supported by the host backend.");
     auto const num_keys = cuco::detail::distance(first, last);
     if (num_keys == 0) { return; }
 
@@ -428,7 +729,60 @@ class open_addressing_impl {
 
     detail::open_addressing_ns::insert_and_find<cg_size, cuco::detail::default_block_size()>
       <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
-        first, num_keys, found_begin, inserted_begin, container_ref);
+        first, num_keys, found_begin, inserted_begin, this->size_counter(), container_ref);
+  }
+
+  /**
+   * @brief Inserts all elements in the range `[first, last)` and copies the elements that could not
+   * be placed to `unplaced_begin`.
+   *
+   * @note An element is unplaced if its probing sequence is exhausted before an empty slot or an
+   * equivalent key is found. With `cuco::stash_storage`, this happens after a bounded number of
+   * probing steps once the stash is full, so inserting into an overloaded table returns the
+   * overflowing elements instead of running for the length of the whole table.
+   * @note Not available with struct of arrays or tagged storage, which do not support
+   * `insert_and_find`.
+   * @note This function synchronizes the given stream.
+   *
+   * @tparam InputIt Device accessible input iterator whose `value_type` is
+   * convertible to the `value_type` of the data structure
+   * @tparam OutputIt Device accessible random access output iterator whose `value_type` is
+   * constructible from `std::iterator_traits<InputIt>::value_type`
+   * @tparam Ref Type of non-owning device container ref allowing access to storage
+   *
+   * @param first Beginning of the sequence of input elements
+   * @param last End of the sequence of input elements
+   * @param unplaced_begin Beginning of the sequence of unplaced elements
+   * @param container_ref Non-owning device container ref used to access the slot storage
+   * @param stream CUDA stream used for the operation
+   *
+   * @return Iterator indicating the end of the sequence of unplaced elements
+   */
+  template <typename InputIt, typename OutputIt, typename Ref>
+  OutputIt try_insert(InputIt first,
+                      InputIt last,
+                      OutputIt unplaced_begin,
+                      Ref container_ref,
+                      cuda::stream_ref stream)
+  {
+    static_assert(not is_host_backend, "try_insert is not supported by the host backend.");
+    // Unplaced elements are told apart from duplicates by `insert_and_find`
+    static_assert(not(cuco::detail::is_soa_storage_ref_v<storage_ref_type> or
+                      cuco::detail::is_tagged_storage_ref_v<storage_ref_type>),
+                  "try_insert is not supported with struct of arrays or tagged storage.");
+    auto const num_keys = cuco::detail::distance(first, last);
+    if (num_keys == 0) { return unplaced_begin; }
+
+    auto counter = temporary_counter_type{this->temporary_allocator(stream)};
+    counter.reset(stream);
+
+    auto const grid_size = cuco::detail::grid_size(num_keys, cg_size);
+
+    detail::open_addressing_ns::try_insert_n<cg_size, cuco::detail::default_block_size()>
+      <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+        first, num_keys, unplaced_begin, counter.data(), this->size_counter(), container_ref);
+
+    return unplaced_begin + counter.load_to_host(stream);
   }
 
   /**
@@ -464,11 +818,15 @@ class open_addressing_impl {
     auto const num_keys = cuco::detail::distance(first, last);
     if (num_keys == 0) { return; }
 
-    auto const grid_size = cuco::detail::grid_size(num_keys, cg_size);
+    if constexpr (is_host_backend) {
+      detail::open_addressing_ns::host::erase(first, num_keys, container_ref);
+    } else {
+      auto const grid_size = cuco::detail::grid_size(num_keys, cg_size);
 
-    detail::open_addressing_ns::erase<cg_size, cuco::detail::default_block_size()>
-      <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
-        first, num_keys, container_ref);
+      detail::open_addressing_ns::erase<cg_size, cuco::detail::default_block_size()>
+        <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+          first, num_keys, this->size_counter(), container_ref);
+    }
   }
 
   /**
@@ -490,7 +848,7 @@ class open_addressing_impl {
                       InputIt last,
                       OutputIt output_begin,
                       Ref container_ref,
-                      cuda::stream_ref stream) const noexcept
+                      cuda::stream_ref stream) const
   {
     auto const always_true = thrust::constant_iterator<bool>{true};
     this->contains_if_async(
@@ -533,16 +891,26 @@ class open_addressing_impl {
                          Predicate pred,
                          OutputIt output_begin,
                          Ref container_ref,
-                         cuda::stream_ref stream) const noexcept
+                         cuda::stream_ref stream) const
   {
     auto const num_keys = cuco::detail::distance(first, last);
     if (num_keys == 0) { return; }
 
-    auto const grid_size = cuco::detail::grid_size(num_keys, cg_size);
-
-    detail::open_addressing_ns::contains_if_n<cg_size, cuco::detail::default_block_size()>
-      <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+    if constexpr (is_host_backend) {
+      detail::open_addressing_ns::host::contains_if_n(
         first, num_keys, stencil, pred, output_begin, container_ref);
+    } else {
+      this->partitioned_apply(
+        first,
+        num_keys,
+        [&](auto permute, auto n) {
+          auto const grid_size = cuco::detail::grid_size(n, cg_size);
+          detail::open_addressing_ns::contains_if_n<cg_size, cuco::detail::default_block_size()>
+            <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+              permute(first), n, permute(stencil), pred, permute(output_begin), container_ref);
+        },
+        stream);
+    }
   }
 
   /**
@@ -564,7 +932,7 @@ class open_addressing_impl {
                   InputIt last,
                   OutputIt output_begin,
                   Ref container_ref,
-                  cuda::stream_ref stream) const noexcept
+                  cuda::stream_ref stream) const
   {
     auto const always_true = thrust::constant_iterator<bool>{true};
 
@@ -608,16 +976,26 @@ class open_addressing_impl {
                      Predicate pred,
                      OutputIt output_begin,
                      Ref container_ref,
-                     cuda::stream_ref stream) const noexcept
+                     cuda::stream_ref stream) const
   {
     auto const num_keys = cuco::detail::distance(first, last);
     if (num_keys == 0) { return; }
 
-    auto const grid_size = cuco::detail::grid_size(num_keys, cg_size);
-
-    detail::open_addressing_ns::find_if_n<cg_size, cuco::detail::default_block_size()>
-      <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+    if constexpr (is_host_backend) {
+      detail::open_addressing_ns::host::find_if_n(
         first, num_keys, stencil, pred, output_begin, container_ref);
+    } else {
+      this->partitioned_apply(
+        first,
+        num_keys,
+        [&](auto permute, auto n) {
+          auto const grid_size = cuco::detail::grid_size(n, cg_size);
+          detail::open_addressing_ns::find_if_n<cg_size, cuco::detail::default_block_size()>
+            <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+              permute(first), n, permute(stencil), pred, permute(output_begin), container_ref);
+        },
+        stream);
+    }
   }
 
   /**
@@ -705,6 +1083,44 @@ class open_addressing_impl {
       first, last, output_probe, output_match, container_ref, stream);
   }
 
+  /**
+   * @brief Asynchronously retrieves all the slots corresponding to all keys in the range `[first,
+   * last)` and writes the number of retrieved slots to `num_retrieved`.
+   *
+   * Same as `retrieve` except that the output size is written to `num_retrieved` instead of being
+   * returned, so that no host synchronization is needed.
+   *
+   * @tparam InputProbeIt Device accessible input iterator
+   * @tparam OutputProbeIt Device accessible input iterator whose `value_type` is
+   * convertible to the `InputProbeIt`'s `value_type`
+   * @tparam OutputMatchIt Device accessible input iterator whose `value_type` is
+   * convertible to the container's `value_type`
+   * @tparam Ref Type of non-owning device container ref allowing access to storage
+   *
+   * @param first Beginning of the input sequence of keys
+   * @param last End of the input sequence of keys
+   * @param output_probe Beginning of the sequence of keys corresponding to matching elements in
+   * `output_match`
+   * @param output_match Beginning of the sequence of matching elements
+   * @param num_retrieved Device accessible location the number of retrieved slots is accumulated
+   * in
+   * @param container_ref Non-owning device reference to the container
+   * @param stream CUDA stream this operation is executed in
+   */
+  template <class InputProbeIt, class OutputProbeIt, class OutputMatchIt, class Ref>
+  void retrieve_async(InputProbeIt first,
+                      InputProbeIt last,
+                      OutputProbeIt output_probe,
+                      OutputMatchIt output_match,
+                      size_type* num_retrieved,
+                      Ref container_ref,
+                      cuda::stream_ref stream) const
+  {
+    auto constexpr is_outer = false;
+    this->retrieve_impl_async<is_outer>(
+      first, last, output_probe, output_match, num_retrieved, container_ref, stream);
+  }
+
   /**
    * @brief Counts the occurrences of keys in `[first, last)` contained in the container
    *
@@ -751,6 +1167,29 @@ class open_addressing_impl {
     return this->count<is_outer>(first, last, container_ref, stream);
   }
 
+  /**
+   * @brief Asynchronously counts the occurrences of keys in `[first, last)` contained in the
+   * container and writes the sum to `output`.
+   *
+   * @tparam Input Device accessible input iterator
+   * @tparam Ref Type of non-owning device container ref allowing access to storage
+   *
+   * @param first Beginning of the sequence of keys to count
+   * @param last End of the sequence of keys to count
+   * @param output Device accessible location the sum of occurrences is accumulated in
+   * @param stream CUDA stream used for count
+   */
+  template <typename InputIt, typename Ref>
+  void count_async(InputIt first,
+                   InputIt last,
+                   size_type* output,
+                   Ref container_ref,
+                   cuda::stream_ref stream) const
+  {
+    auto constexpr is_outer = false;
+    this->count_async<is_outer>(first, last, output, container_ref, stream);
+  }
+
   /**
    * @brief Retrieves all keys contained in the container.
    *
@@ -771,13 +1210,18 @@ class open_addressing_impl {
   template <typename OutputIt>
   [[nodiscard]] OutputIt retrieve_all(OutputIt output_begin, cuda::stream_ref stream) const
   {
+    static_assert(not is_host_backend, "retrieve_all is not supported by the host backend.");
+    CUCO_EXPECTS(not this->is_rehashing(),
+                 "retrieve_all is not available while an incremental rehash is pending.",
+                 std::logic_error);
+
     using temp_allocator_type =
-      typename std::allocator_traits<allocator_type>::template rebind_alloc<char>;
+      typename std::allocator_traits<temporary_allocator_type>::template rebind_alloc<char>;
 
     cuco::detail::index_type constexpr stride = std::numeric_limits<int32_t>::max();
 
     cuco::detail::index_type h_num_out{0};
-    auto temp_allocator = temp_allocator_type{this->allocator()};
+    auto temp_allocator = temp_allocator_type{this->temporary_allocator(stream)};
     auto d_num_out      = reinterpret_cast<size_type*>(
       std::allocator_traits<temp_allocator_type>::allocate(temp_allocator, sizeof(size_type)));
 
@@ -830,6 +1274,68 @@ class open_addressing_impl {
     return output_begin + h_num_out;
   }
 
+  /**
+   * @brief Asynchronously retrieves all keys contained in the container and writes their number to
+   * `num_out`.
+   *
+   * @note Unlike `retrieve_all`, the selection runs in a single pass and thus requires a capacity
+   * not exceeding `std::numeric_limits<int32_t>::max()`.
+   *
+   * @throw std::invalid_argument if the capacity exceeds `std::numeric_limits<int32_t>::max()`
+   *
+   * @tparam OutputIt Device accessible random access output iterator whose `value_type` is
+   * convertible from the container's `value_type`
+   *
+   * @param output_begin Beginning output iterator for keys
+   * @param num_out Device accessible location the number of retrieved keys is written to
+   * @param stream CUDA stream used for this operation
+   */
+  template <typename OutputIt>
+  void retrieve_all_async(OutputIt output_begin, size_type* num_out, cuda::stream_ref stream) const
+  {
+    static_assert(not is_host_backend, "retrieve_all is not supported by the host backend.");
+    CUCO_EXPECTS(not this->is_rehashing(),
+                 "retrieve_all is not available while an incremental rehash is pending.",
+                 std::logic_error);
+    CUCO_EXPECTS(this->capacity() <= static_cast<size_type>(std::numeric_limits<int32_t>::max()),
+                 "retrieve_all_async requires a capacity not exceeding INT32_MAX.",
+                 std::invalid_argument);
+
+    using temp_allocator_type =
+      typename std::allocator_traits<temporary_allocator_type>::template rebind_alloc<char>;
+
+    auto const num_items = static_cast<int32_t>(this->capacity());
+    auto const begin     = thrust::make_transform_iterator(
+      thrust::counting_iterator<size_type>{0},
+      detail::open_addressing_ns::get_slot<has_payload, storage_ref_type>(this->storage_ref()));
+    auto const is_filled = detail::open_addressing_ns::slot_is_filled<has_payload, key_type>{
+      this->empty_key_sentinel(), this->erased_key_sentinel()};
+
+    std::size_t temp_storage_bytes = 0;
+    CUCO_CUDA_TRY(cub::DeviceSelect::If(nullptr,
+                                        temp_storage_bytes,
+                                        begin,
+                                        output_begin,
+                                        num_out,
+                                        num_items,
+                                        is_filled,
+                                        stream.get()));
+
+    auto temp_allocator = temp_allocator_type{this->temporary_allocator(stream)};
+    auto d_temp_storage = temp_allocator.allocate(temp_storage_bytes);
+
+    CUCO_CUDA_TRY(cub::DeviceSelect::If(d_temp_storage,
+                                        temp_storage_bytes,
+                                        begin,
+                                        output_begin,
+                                        num_out,
+                                        num_items,
+                                        is_filled,
+                                        stream.get()));
+
+    temp_allocator.deallocate(d_temp_storage, temp_storage_bytes);
+  }
+
   /**
    * @brief Asynchronously applies the given function object `callback_op` to the copy of every
    * filled slot in the container
@@ -844,6 +1350,11 @@ class open_addressing_impl {
   template <typename CallbackOp>
   void for_each_async(CallbackOp&& callback_op, cuda::stream_ref stream) const
   {
+    static_assert(not is_host_backend, "for_each is not supported by the host backend.");
+    CUCO_EXPECTS(not this->is_rehashing(),
+                 "for_each is not available while an incremental rehash is pending.",
+                 std::logic_error);
+
     auto const is_filled = detail::open_addressing_ns::slot_is_filled<has_payload, key_type>{
       this->empty_key_sentinel(), this->erased_key_sentinel()};
 
@@ -881,6 +1392,7 @@ class open_addressing_impl {
                       Ref container_ref,
                       cuda::stream_ref stream) const noexcept
   {
+    static_assert(not is_host_backend, "for_each is not supported by the host backend.");
     auto const num_keys = cuco::detail::distance(first, last);
     if (num_keys == 0) { return; }
 
@@ -895,6 +1407,8 @@ class open_addressing_impl {
    * @brief Gets the number of elements in the container
    *
    * @note This function synchronizes the given stream.
+   * @note If size tracking is enabled, this is a constant-time operation. Otherwise, the whole
+   * storage is scanned.
    *
    * @param stream CUDA stream used to get the number of inserted elements
    *
@@ -902,61 +1416,348 @@ class open_addressing_impl {
    */
   [[nodiscard]] size_type size(cuda::stream_ref stream) const
   {
-    auto counter =
-      detail::counter_storage<size_type, thread_scope, allocator_type>{this->allocator()};
-    counter.reset(stream);
-
-    auto const grid_size = cuco::detail::grid_size(storage_.num_buckets());
-    auto const is_filled = detail::open_addressing_ns::slot_is_filled<has_payload, key_type>{
-      this->empty_key_sentinel(), this->erased_key_sentinel()};
+    if constexpr (is_host_backend) {
+      return detail::open_addressing_ns::host::size(
+        storage_.ref(),
+        detail::open_addressing_ns::slot_is_filled<has_payload, key_type>{
+          this->empty_key_sentinel(), this->erased_key_sentinel()});
+    } else {
+      if (this->is_size_tracked()) { return size_counter_->load_to_host(stream); }
 
-    // TODO: custom kernel to be replaced by cub::DeviceReduce::Sum when cub version is bumped to
-    // v2.1.0
-    detail::open_addressing_ns::size<cuco::detail::default_block_size()>
-      <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
-        storage_.ref(), is_filled, counter.data());
+      auto counter = temporary_counter_type{this->temporary_allocator(stream)};
+      counter.reset(stream);
+      this->count_filled_slots_async(counter.data(), stream);
 
-    return counter.load_to_host(stream);
+      return counter.load_to_host(stream);
+    }
   }
 
   /**
-   * @brief Regenerates the container
-   *
-   * @note This function synchronizes the given stream. For asynchronous execution use
-   * `rehash_async`.
+   * @brief Asynchronously writes the number of elements in the container to `output`.
    *
-   * @tparam Container The container type this function operates on
+   * @note The result is available in `output` once all work previously submitted to `stream`,
+   * including this operation, has completed. This allows a subsequent kernel in the same stream to
+   * read the container size without a host round trip.
+   * @note `output` must be device accessible, e.g., device or pinned host memory, since it is used
+   * as the accumulator of the storage scan. No temporary memory is allocated, so the operation can
+   * be captured into a CUDA graph.
    *
-   * @param extent The container's new `bucket_extent` after this operation took place
-   * @param container The container to be rehashed
+   * @param output Pointer to the location where the number of elements is written
    * @param stream CUDA stream used for this operation
    */
-  template <typename Container>
-  void rehash(Container const& container, cuda::stream_ref stream)
+  void size_async(size_type* output, cuda::stream_ref stream) const
   {
-    this->rehash_async(container, stream);
-    stream.wait();
+    if constexpr (is_host_backend) {
+      *output = this->size(stream);
+    } else {
+      if (this->is_size_tracked()) {
+        CUCO_CUDA_TRY(cudaMemcpyAsync(
+          output, size_counter_->data(), sizeof(size_type), cudaMemcpyDefault, stream.get()));
+        return;
+      }
+
+      CUCO_CUDA_TRY(cudaMemsetAsync(output, 0, sizeof(size_type), stream.get()));
+      this->count_filled_slots_async(output, stream);
+    }
   }
 
   /**
-   * @brief Asynchronously reserves at least the specified number of slots and regenerates the
-   * container
+   * @brief Gets the number of elements currently held in the overflow stash.
    *
-   * @note Changes the number of buckets to a value that is not less than `extent`, then
-   * rehashes the container, i.e. puts the elements into appropriate slots considering
-   * that the total number of slots has changed.
+   * @note This function synchronizes the given stream.
+   * @note Only available with `cuco::stash_storage`.
    *
-   * @note This function synchronizes the given stream. For asynchronous execution use
-   * `rehash_async`.
+   * @param stream CUDA stream used to get the number of stashed elements
    *
-   * @note Behavior is undefined if the desired `extent` is insufficient to store all of the
-   * contained elements.
+   * @return The number of stashed elements
+   */
+  [[nodiscard]] size_type stash_size(cuda::stream_ref stream) const
+  {
+    static_assert(cuco::detail::is_stash_storage_ref_v<storage_ref_type>,
+                  "stash_size requires cuco::stash_storage.");
+
+    size_type h_stash_size;
+    CUCO_CUDA_TRY(cudaMemcpyAsync(&h_stash_size,
+                                  this->storage_ref().stash_counter(),
+                                  sizeof(size_type),
+                                  cudaMemcpyDeviceToHost,
+                                  stream.get()));
+    stream.wait();
+    return h_stash_size;
+  }
+
+  /**
+   * @brief Gets the device performance counters accumulated since the container was last
+   * initialized, cleared or reset.
    *
-   * @note This function is not available if the conatiner's `extent_type` is static.
+   * @note This function synchronizes the given stream.
+   * @note Only available with `cuco::counted_storage`.
    *
-   * @tparam Container The container type this function operates on
+   * @param stream CUDA stream used to get the counters
    *
-   * @param extent The container's new `bucket_extent` after this operation took place
+   * @return The performance counters
+   */
+  [[nodiscard]] cuco::perf_counters perf_counters(cuda::stream_ref stream) const
+  {
+    static_assert(cuco::detail::is_counted_storage_ref_v<storage_ref_type>,
+                  "perf_counters requires cuco::counted_storage.");
+
+    cuco::perf_counters h_counters;
+    CUCO_CUDA_TRY(cudaMemcpyAsync(&h_counters,
+                                  this->storage_ref().counters(),
+                                  sizeof(cuco::perf_counters),
+                                  cudaMemcpyDeviceToHost,
+                                  stream.get()));
+    stream.wait();
+    return h_counters;
+  }
+
+  /**
+   * @brief Asynchronously resets all device performance counters to zero.
+   *
+   * @note Only available with `cuco::counted_storage`.
+   *
+   * @param stream CUDA stream used to reset the counters
+   */
+  void reset_perf_counters_async(cuda::stream_ref stream)
+  {
+    static_assert(cuco::detail::is_counted_storage_ref_v<storage_ref_type>,
+                  "reset_perf_counters requires cuco::counted_storage.");
+    CUCO_CUDA_TRY(cudaMemsetAsync(
+      this->storage_ref().counters(), 0, sizeof(cuco::perf_counters), stream.get()));
+  }
+
+  /**
+   * @brief Gets the number of erased slots (tombstones) in the container.
+   *
+   * @note This function synchronizes the given stream.
+   * @note Tombstones lengthen the probing sequences of all operations just like live elements do.
+   * Comparing this count against `capacity()` tells when `purge_tombstones` pays off.
+   *
+   * @param stream CUDA stream used to get the number of erased slots
+   *
+   * @return The number of erased slots
+   */
+  [[nodiscard]] size_type tombstone_count(cuda::stream_ref stream) const
+  {
+    static_assert(not is_host_backend, "tombstone_count is not supported by the host backend.");
+    // Without a distinct erased key sentinel, `erase` is unavailable and every empty slot would
+    // otherwise be counted as erased
+    if (this->empty_key_sentinel() == this->erased_key_sentinel()) { return 0; }
+
+    auto counter = temporary_counter_type{this->temporary_allocator(stream)};
+    counter.reset(stream);
+
+    auto const grid_size = cuco::detail::grid_size(storage_.num_buckets());
+    auto const is_erased = detail::open_addressing_ns::slot_is_erased<has_payload, key_type>{
+      this->erased_key_sentinel()};
+
+    detail::open_addressing_ns::size<cuco::detail::default_block_size()>
+      <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+        storage_.ref(), is_erased, counter.data());
+
+    return counter.load_to_host(stream);
+  }
+
+  /**
+   * @brief Removes all tombstones from the container in place.
+   *
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `purge_tombstones_async`.
+   *
+   * @param stream CUDA stream used for this operation
+   */
+  void purge_tombstones(cuda::stream_ref stream)
+  {
+    this->purge_tombstones_async(stream);
+    stream.wait();
+  }
+
+  /**
+   * @brief Asynchronously removes all tombstones from the container in place.
+   *
+   * @note Unlike `rehash`, no second storage is allocated: live elements are moved backwards into
+   * the erased slots of their own probing sequences, after which every erased slot is turned into
+   * an empty one. The number of elements is unchanged.
+   * @note If the container has no empty slot at all, tombstones are left in place.
+   * @note Without a distinct erased key sentinel there are no tombstones and this is a no-op.
+   * @note Only available with `cuco::linear_probing` and the default `cuco::storage`.
+   * @note Clusters are compacted one thread each, so the longest cluster bounds the latency; see
+   * `compact_clusters`.
+   *
+   * @param stream CUDA stream used for this operation
+   */
+  void purge_tombstones_async(cuda::stream_ref stream)
+  {
+    static_assert(not is_host_backend, "Tombstone purging is not supported by the host backend.");
+    static_assert(cuco::is_linear_probing<probing_scheme_type>::value,
+                  "Tombstone purging requires cuco::linear_probing.");
+    static_assert(not(cuco::detail::is_soa_storage_ref_v<storage_ref_type> or
+                      cuco::detail::is_tagged_storage_ref_v<storage_ref_type> or
+                      cuco::detail::is_bounded_storage_ref_v<storage_ref_type> or
+                      cuco::detail::is_stash_storage_ref_v<storage_ref_type>),
+                  "Tombstone purging requires the default cuco::storage.");
+
+    auto const num_slots = storage_.capacity();
+    if (num_slots == 0 or this->empty_key_sentinel() == this->erased_key_sentinel()) { return; }
+
+    if (not num_clusters_.has_value()) { num_clusters_.emplace(this->allocator()); }
+    num_clusters_->reset(stream);
+
+    auto constexpr block_size = cuco::detail::default_block_size();
+    auto const grid_size      = cuco::detail::grid_size(num_slots);
+
+    detail::open_addressing_ns::compact_clusters<block_size>
+      <<<grid_size, block_size, 0, stream.get()>>>(storage_.ref(),
+                                                   this->probing_scheme(),
+                                                   this->empty_key_sentinel(),
+                                                   this->erased_key_sentinel(),
+                                                   num_clusters_->data());
+
+    detail::open_addressing_ns::release_tombstones<block_size>
+      <<<cuco::detail::grid_size(storage_.num_buckets()), block_size, 0, stream.get()>>>(
+        storage_.ref(), empty_slot_sentinel_, this->erased_key_sentinel(), num_clusters_->data());
+  }
+
+  /**
+   * @brief Purges tombstones if they occupy more than the given fraction of the capacity.
+   *
+   * @note This function synchronizes the given stream.
+   *
+   * @param max_tombstone_ratio Largest tolerated ratio of erased slots to `capacity()`
+   * @param stream CUDA stream used for this operation
+   *
+   * @return `true` if tombstones have been purged
+   */
+  bool purge_tombstones_if(double max_tombstone_ratio, cuda::stream_ref stream)
+  {
+    auto const num_tombstones = this->tombstone_count(stream);
+    if (static_cast<double>(num_tombstones) <=
+        max_tombstone_ratio * static_cast<double>(this->capacity())) {
+      return false;
+    }
+    this->purge_tombstones(stream);
+    return true;
+  }
+
+  /**
+   * @brief Gathers probe length and occupancy statistics of the container.
+   *
+   * @note This function synchronizes the given stream.
+   * @note The whole storage is scanned and the probing sequence of every element is replayed up to
+   * the element's bucket, so the cost grows with the probe lengths.
+   *
+   * @throw std::logic_error If an incremental rehash is pending
+   *
+   * @param stream CUDA stream used for this operation
+   *
+   * @return The container statistics
+   */
+  [[nodiscard]] container_statistics<size_type> statistics(cuda::stream_ref stream) const
+  {
+    static_assert(not is_host_backend, "statistics is not supported by the host backend.");
+    CUCO_EXPECTS(not this->is_rehashing(),
+                 "statistics is not available while an incremental rehash is pending.",
+                 std::logic_error);
+
+    using statistics_type = container_statistics<size_type>;
+    auto constexpr num_probe_length_bins = statistics_type::num_probe_length_bins;
+    auto constexpr num_bucket_fill_bins  = bucket_size + 1;
+    // probe length histogram, bucket fill histogram, tombstones, longest probe length
+    auto constexpr num_counters = num_probe_length_bins + num_bucket_fill_bins + 2;
+
+    using counter_allocator_type =
+      typename std::allocator_traits<temporary_allocator_type>::template rebind_alloc<size_type>;
+    auto counter_allocator = counter_allocator_type{this->temporary_allocator(stream)};
+    auto d_counters        = counter_allocator.allocate(num_counters);
+    CUCO_CUDA_TRY(
+      cudaMemsetAsync(d_counters, 0, sizeof(size_type) * num_counters, stream.get()));
+
+    auto const d_probe_lengths = d_counters;
+    auto const d_bucket_fills  = d_probe_lengths + num_probe_length_bins;
+    auto const d_tombstones    = d_bucket_fills + num_bucket_fill_bins;
+
+    if (storage_.num_buckets() > 0) {
+      auto const grid_size = cuco::detail::grid_size(storage_.num_buckets(), cg_size);
+
+      detail::open_addressing_ns::
+        probe_statistics<cg_size, cuco::detail::default_block_size(), num_probe_length_bins>
+        <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+          storage_.ref(),
+          this->probing_scheme(),
+          this->empty_key_sentinel(),
+          this->erased_key_sentinel(),
+          d_probe_lengths,
+          d_bucket_fills,
+          d_tombstones,
+          d_tombstones + 1);
+    }
+
+    std::vector<size_type> h_counters(num_counters);
+    CUCO_CUDA_TRY(cudaMemcpyAsync(h_counters.data(),
+                                  d_counters,
+                                  sizeof(size_type) * num_counters,
+                                  cudaMemcpyDeviceToHost,
+                                  stream.get()));
+    stream.wait();
+    counter_allocator.deallocate(d_counters, num_counters);
+
+    auto const probe_lengths_begin = h_counters.begin();
+    auto const bucket_fills_begin  = probe_lengths_begin + num_probe_length_bins;
+    auto const tombstones_it       = bucket_fills_begin + num_bucket_fill_bins;
+
+    statistics_type stats{};
+    stats.capacity               = this->capacity();
+    stats.num_buckets            = storage_.num_buckets();
+    stats.num_tombstones         = *tombstones_it;
+    stats.max_probe_length       = *(tombstones_it + 1);
+    stats.probe_length_histogram = std::vector<size_type>(probe_lengths_begin, bucket_fills_begin);
+    stats.bucket_fill_histogram  = std::vector<size_type>(bucket_fills_begin, tombstones_it);
+    stats.num_elements           = 0;
+    for (int32_t fill = 0; fill < num_bucket_fill_bins; ++fill) {
+      stats.num_elements += static_cast<size_type>(fill) * stats.bucket_fill_histogram[fill];
+    }
+    return stats;
+  }
+
+  /**
+   * @brief Regenerates the container
+   *
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `rehash_async`.
+   *
+   * @tparam Container The container type this function operates on
+   *
+   * @param extent The container's new `bucket_extent` after this operation took place
+   * @param container The container to be rehashed
+   * @param stream CUDA stream used for this operation
+   */
+  template <typename Container>
+  void rehash(Container const& container, cuda::stream_ref stream)
+  {
+    this->rehash_async(container, stream);
+    this->wait(stream);
+  }
+
+  /**
+   * @brief Asynchronously reserves at least the specified number of slots and regenerates the
+   * container
+   *
+   * @note Changes the number of buckets to a value that is not less than `extent`, then
+   * rehashes the container, i.e. puts the elements into appropriate slots considering
+   * that the total number of slots has changed.
+   *
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `rehash_async`.
+   *
+   * @note Behavior is undefined if the desired `extent` is insufficient to store all of the
+   * contained elements.
+   *
+   * @note This function is not available if the conatiner's `extent_type` is static.
+   *
+   * @tparam Container The container type this function operates on
+   *
+   * @param extent The container's new `bucket_extent` after this operation took place
    * @param container The container to be rehashed
    * @param stream CUDA stream used for this operation
    */
@@ -964,7 +1765,7 @@ class open_addressing_impl {
   void rehash(extent_type extent, Container const& container, cuda::stream_ref stream)
   {
     this->rehash_async(extent, container, stream);
-    stream.wait();
+    this->wait(stream);
   }
 
   /**
@@ -1004,9 +1805,12 @@ class open_addressing_impl {
   template <typename Container>
   void rehash_async(extent_type extent, Container const& container, cuda::stream_ref stream)
   {
+    this->rehash_finish_async(container, stream);
+
     auto const old_storage = std::move(this->storage_);
     new (&storage_) storage_type{extent, this->allocator()};
-    this->clear_async(stream);
+    // reinitialize the new storage only: rehashing does not change the number of elements
+    storage_.initialize_async(empty_slot_sentinel_, stream);
 
     auto const num_buckets = old_storage.num_buckets();
     if (num_buckets == 0) { return; }
@@ -1017,8 +1821,188 @@ class open_addressing_impl {
     auto const is_filled      = detail::open_addressing_ns::slot_is_filled<has_payload, key_type>{
       this->empty_key_sentinel(), this->erased_key_sentinel()};
 
-    detail::open_addressing_ns::rehash<block_size><<<grid_size, block_size, 0, stream.get()>>>(
-      old_storage.ref(), container.ref(op::insert), is_filled);
+    if constexpr (is_host_backend) {
+      detail::open_addressing_ns::host::rehash(
+        old_storage.ref(), container.ref(op::insert), is_filled);
+    } else {
+      detail::open_addressing_ns::rehash<block_size><<<grid_size, block_size, 0, stream.get()>>>(
+        old_storage.ref(), container.ref(op::insert), is_filled);
+      // a stream-ordered allocator must not release the old storage before it has been read
+      detail::release_after(old_storage.allocator(), stream);
+    }
+  }
+
+  /**
+   * @brief Asynchronously starts an incremental rehash into a storage of at least the specified
+   * number of buckets.
+   *
+   * @note Unlike `rehash_async`, the old storage is kept alive and its elements are migrated
+   * `buckets_per_step` buckets at a time by subsequent calls to `rehash_step_async`. Until the
+   * migration completes, lookups through a `migrating_ref` consult both storages.
+   * @note A pending incremental rehash is completed first.
+   *
+   * @tparam Container The container type this function operates on
+   *
+   * @param extent The container's new `bucket_extent` after this operation took place
+   * @param buckets_per_step Number of old buckets migrated by each step
+   * @param container The container to be rehashed
+   * @param stream CUDA stream used for this operation
+   *
+   * @throw std::logic_error if a unique erased key sentinel value was not provided at
+   * construction
+   */
+  template <typename Container>
+  void rehash_incremental_async(extent_type extent,
+                                size_type buckets_per_step,
+                                Container const& container,
+                                cuda::stream_ref stream)
+  {
+    static_assert(supports_incremental_rehash,
+                  "Incremental rehashing does not support SoA, tagged or stash storage.");
+    CUCO_EXPECTS(this->empty_key_sentinel() != this->erased_key_sentinel(),
+                 "Incremental rehashing requires a unique erased key sentinel.",
+                 std::logic_error);
+    CUCO_EXPECTS(buckets_per_step > 0, "Number of buckets per step must be positive.");
+
+    this->rehash_finish_async(container, stream);
+
+    old_storage_.emplace(std::move(this->storage_));
+    new (&storage_) storage_type{extent, old_storage_->allocator()};
+    storage_.initialize_async(empty_slot_sentinel_, stream);
+
+    migrated_buckets_ = 0;
+    buckets_per_step_ = buckets_per_step;
+
+    if (old_storage_->num_buckets() == 0) { old_storage_.reset(); }
+  }
+
+  /**
+   * @brief Asynchronously migrates the next `buckets_per_step` buckets of a pending incremental
+   * rehash.
+   *
+   * @note The old storage is released once all of its buckets have been migrated. No effect if no
+   * incremental rehash is pending.
+   *
+   * @tparam Container The container type this function operates on
+   *
+   * @param container The container being rehashed
+   * @param stream CUDA stream used for this operation
+   */
+  template <typename Container>
+  void rehash_step_async(Container const& container, cuda::stream_ref stream)
+  {
+    if constexpr (supports_incremental_rehash) {
+      if (not this->is_rehashing()) { return; }
+      this->migrate_async(buckets_per_step_, container, stream);
+    }
+  }
+
+  /**
+   * @brief Asynchronously migrates all remaining buckets of a pending incremental rehash.
+   *
+   * @note No effect if no incremental rehash is pending.
+   *
+   * @tparam Container The container type this function operates on
+   *
+   * @param container The container being rehashed
+   * @param stream CUDA stream used for this operation
+   */
+  template <typename Container>
+  void rehash_finish_async(Container const& container, cuda::stream_ref stream)
+  {
+    if constexpr (supports_incremental_rehash) {
+      if (not this->is_rehashing()) { return; }
+      this->migrate_async(old_storage_->num_buckets() - migrated_buckets_, container, stream);
+    }
+  }
+
+  /**
+   * @brief Indicates whether an incremental rehash is pending.
+   *
+   * @return `true` if some elements are still held by the old storage
+   */
+  [[nodiscard]] bool is_rehashing() const noexcept { return old_storage_.has_value(); }
+
+  /**
+   * @brief Wraps `container_ref` so that it also accesses the storage of a pending incremental
+   * rehash, and invokes `func` with the result.
+   *
+   * @note If no incremental rehash is pending, `func` is invoked with `container_ref` itself.
+   *
+   * @tparam Ref Type of non-owning device container ref to the current storage
+   * @tparam OldRef Type of non-owning device container ref providing the `contains`, `find`,
+   * `erase` and `count` operators
+   * @tparam Func Type of callable accepting either ref
+   *
+   * @param container_ref Non-owning device container ref to the current storage
+   * @param old_ref Container ref rebound to the old storage if an incremental rehash is pending
+   * @param func Callable to invoke
+   *
+   * @return The result of `func`
+   */
+  template <typename Ref, typename OldRef, typename Func>
+  decltype(auto) visit_ref(Ref const& container_ref, OldRef const& old_ref, Func&& func) const
+  {
+    if constexpr (supports_incremental_rehash) {
+      if (this->is_rehashing()) {
+        return func(detail::open_addressing_ns::migrating_ref{
+          container_ref, old_ref.rebind_storage_ref(old_storage_->ref())});
+      }
+    }
+    return func(container_ref);
+  }
+
+  /**
+   * @brief Writes the container configuration and its raw slot storage to a file.
+   *
+   * @note This function synchronizes the given stream.
+   *
+   * @throw cuco::logic_error If an incremental rehash is pending
+   *
+   * @param path Path of the file to write
+   * @param kind Kind of the persisted container
+   * @param stream CUDA stream used for this operation
+   */
+  void save(std::string const& path, persisted_kind kind, cuda::stream_ref stream) const
+  {
+    static_assert(is_persistable, "Only cuco::storage and cuco::counted_storage can be persisted.");
+    CUCO_EXPECTS(not this->is_rehashing(),
+                 "Cannot persist a container during an incremental rehash.");
+    detail::write_persisted_file(path,
+                                 this->persisted_header_for(kind),
+                                 this->persisted_config(),
+                                 storage_.ref().data(),
+                                 this->payload_bytes(),
+                                 is_host_backend,
+                                 stream);
+  }
+
+  /**
+   * @brief Replaces the content of the container by the raw slot storage of a file written by
+   * `save`, without rehashing any element.
+   *
+   * @note The container must have the same type, capacity, probing scheme and sentinels as the one
+   * that wrote the file. `cuco::read_persisted_header` gives the capacity to construct it with.
+   * @note This function synchronizes the given stream.
+   *
+   * @throw cuco::logic_error If the file is invalid or was written by an incompatible container
+   *
+   * @param path Path of the file to read
+   * @param kind Kind of the loading container
+   * @param stream CUDA stream used for this operation
+   */
+  void load(std::string const& path, persisted_kind kind, cuda::stream_ref stream)
+  {
+    static_assert(is_persistable, "Only cuco::storage and cuco::counted_storage can be persisted.");
+    auto const reader = detail::persisted_file_reader{
+      path, this->persisted_header_for(kind), this->persisted_config(), this->payload_bytes()};
+    // The file is valid, so the elements of a pending rehash can be discarded
+    old_storage_.reset();
+    reader.read_payload(storage_.ref().data(), is_host_backend, stream);
+    if (size_counter_.has_value()) {
+      size_counter_->reset(stream);
+      this->count_filled_slots_async(size_counter_->data(), stream);
+    }
   }
 
   /**
@@ -1090,6 +2074,113 @@ class open_addressing_impl {
   [[nodiscard]] constexpr storage_ref_type storage_ref() const noexcept { return storage_.ref(); }
 
  private:
+  /**
+   * @brief Gets the allocator used for the temporaries of an operation.
+   *
+   * @note A stream-ordered allocator is rebound to `stream`, so that temporaries are allocated and
+   * released in the order of the operation instead of synchronizing the device. This is also what
+   * makes temporaries legal while `stream` is captured into a CUDA graph.
+   * @note With pinned or managed storage, temporaries come from a device pool owned by the
+   * container instead of the container allocator, whose releases would synchronize the device.
+   *
+   * @throw std::logic_error if `stream` is being captured and the allocator is not stream-ordered
+   *
+   * @param stream CUDA stream of the operation
+   *
+   * @return The allocator for temporaries
+   */
+  [[nodiscard]] temporary_allocator_type temporary_allocator(cuda::stream_ref stream) const
+  {
+    if constexpr (has_out_of_core_storage) {
+      if (not temporary_pool_.has_value()) { temporary_pool_.emplace(stream); }
+      return temporary_pool_->rebind_stream(stream);
+    } else {
+      if constexpr (not detail::is_stream_ordered_allocator_v<allocator_type>) {
+        CUCO_EXPECTS(not cuco::detail::is_capturing(stream),
+                     "Temporary allocations during CUDA graph capture require a stream-ordered "
+                     "allocator such as cuco::stream_ordered_allocator.",
+                     std::logic_error);
+      }
+      return detail::with_stream(this->allocator(), stream);
+    }
+  }
+
+  /**
+   * @brief Gets the allocator used for the device buffers kept by the container across operations.
+   *
+   * @return The container allocator, or the device pool of temporaries with pinned or managed
+   * storage
+   */
+  [[nodiscard]] temporary_allocator_type persistent_allocator() const
+  {
+    if constexpr (has_out_of_core_storage) {
+      return this->temporary_allocator(cuda::stream_ref{});
+    } else {
+      return this->allocator();
+    }
+  }
+
+  /// Indicates whether the storage consists of the slot buckets only and can thus be persisted
+  static constexpr auto is_persistable =
+    not(cuco::detail::is_soa_storage_ref_v<storage_ref_type> or
+        cuco::detail::is_tagged_storage_ref_v<storage_ref_type> or
+        cuco::detail::is_bounded_storage_ref_v<storage_ref_type> or
+        cuco::detail::is_stash_storage_ref_v<storage_ref_type>);
+
+  /**
+   * @brief Gets the size of the raw slot storage.
+   *
+   * @return The number of bytes of all slot buckets
+   */
+  [[nodiscard]] std::uint64_t payload_bytes() const noexcept
+  {
+    return static_cast<std::uint64_t>(storage_.num_buckets()) *
+           sizeof(typename storage_ref_type::bucket_type);
+  }
+
+  /**
+   * @brief Builds the header describing this container in a persisted file.
+   *
+   * @param kind Kind of the persisted container
+   *
+   * @return The persisted file header
+   */
+  [[nodiscard]] persisted_header persisted_header_for(persisted_kind kind) const noexcept
+  {
+    persisted_header header{};
+    header.kind             = kind;
+    // The allocator does not affect the layout of the payload
+    header.type_fingerprint = detail::type_fingerprint<
+      cuda::std::tuple<key_type, value_type, probing_scheme_type, storage_ref_type>>();
+    header.key_bytes        = sizeof(key_type);
+    header.slot_bytes       = sizeof(value_type);
+    header.bucket_size      = bucket_size;
+    header.cg_size          = cg_size;
+    header.capacity         = this->capacity();
+    header.num_buckets      = storage_.num_buckets();
+    return header;
+  }
+
+  /**
+   * @brief Serializes the hash functions, including their seeds, and the sentinels into a
+   * configuration blob.
+   *
+   * @note Every field is appended on its own so that padding bytes never enter the blob.
+   *
+   * @return The configuration blob
+   */
+  [[nodiscard]] std::vector<std::byte> persisted_config() const
+  {
+    auto config = std::vector<std::byte>{};
+    detail::append_persisted_config(config, probing_scheme_.hash_function());
+    detail::append_persisted_config(config, this->empty_key_sentinel());
+    if constexpr (has_payload) {
+      detail::append_persisted_config(config, empty_slot_sentinel_.second);
+    }
+    detail::append_persisted_config(config, erased_key_sentinel_);
+    return config;
+  }
+
   /**
    * @brief Counts the occurrences of keys in `[first, last)` contained in the container
    *
@@ -1111,18 +2202,18 @@ class open_addressing_impl {
                                 Ref container_ref,
                                 cuda::stream_ref stream) const noexcept
   {
+    static_assert(not is_host_backend, "count is not supported by the host backend.");
     auto const num_keys = cuco::detail::distance(first, last);
     if (num_keys == 0) { return 0; }
 
-    auto counter =
-      detail::counter_storage<size_type, thread_scope, allocator_type>{this->allocator()};
+    auto counter = temporary_counter_type{this->temporary_allocator(stream)};
     counter.reset(stream);
 
     auto const grid_size = cuco::detail::grid_size(num_keys, cg_size);
 
     detail::open_addressing_ns::count<IsOuter, cg_size, cuco::detail::default_block_size()>
       <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
-        first, num_keys, counter.data(), container_ref);
+        first, num_keys, counter.data(), container_ref, dedup_inputs_);
 
     return counter.load_to_host(stream);
   }
@@ -1168,11 +2259,11 @@ class open_addressing_impl {
                                                         Ref container_ref,
                                                         cuda::stream_ref stream) const
   {
+    static_assert(not is_host_backend, "retrieve is not supported by the host backend.");
     auto const n = detail::distance(first, last);
     if (n == 0) { return {output_probe, output_match}; }
 
-    using counter_type = detail::counter_storage<size_type, thread_scope, allocator_type>;
-    auto counter       = counter_type{this->allocator()};
+    auto counter = temporary_counter_type{this->temporary_allocator(stream)};
     counter.reset(stream.get());
 
     int32_t constexpr block_size = cuco::detail::default_block_size();
@@ -1189,6 +2280,258 @@ class open_addressing_impl {
     return {output_probe + num_retrieved, output_match + num_retrieved};
   }
 
+  /**
+   * @brief Asynchronously counts the occurrences of keys in `[first, last)` contained in the
+   * container and writes the sum to `output`.
+   *
+   * @note If `IsOuter` is `true`, the occurrence of a non-match key is 1. Else, it's 0.
+   *
+   * @tparam IsOuter Flag indicating whether it's an outer count or not
+   * @tparam Input Device accessible input iterator
+   * @tparam Ref Type of non-owning device container ref allowing access to storage
+   *
+   * @param first Beginning of the sequence of keys to count
+   * @param last End of the sequence of keys to count
+   * @param output Device accessible location the sum of occurrences is accumulated in
+   * @param stream CUDA stream used for count
+   */
+  template <bool IsOuter, typename InputIt, typename Ref>
+  void count_async(InputIt first,
+                   InputIt last,
+                   size_type* output,
+                   Ref container_ref,
+                   cuda::stream_ref stream) const
+  {
+    static_assert(not is_host_backend, "count is not supported by the host backend.");
+    CUCO_CUDA_TRY(cudaMemsetAsync(output, 0, sizeof(size_type), stream.get()));
+
+    auto const num_keys = cuco::detail::distance(first, last);
+    if (num_keys == 0) { return; }
+
+    auto const grid_size = cuco::detail::grid_size(num_keys, cg_size);
+
+    detail::open_addressing_ns::count<IsOuter, cg_size, cuco::detail::default_block_size()>
+      <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+        first, num_keys, output, container_ref, dedup_inputs_);
+  }
+
+  /**
+   * @brief Asynchronously retrieves all the slots corresponding to all keys in the range `[first,
+   * last)` and writes the number of retrieved slots to `num_retrieved`.
+   *
+   * @tparam IsOuter Flag indicating if an inner or outer retrieve operation should be performed
+   * @tparam InputProbeIt Device accessible input iterator whose `value_type` is
+   * convertible to the container's `key_type`
+   * @tparam OutputProbeIt Device accessible input iterator whose `value_type` is
+   * convertible to the container's `key_type`
+   * @tparam OutputMatchIt Device accessible input iterator whose `value_type` is
+   * convertible to the container's `value_type`
+   * @tparam Ref Type of non-owning device container ref allowing access to storage
+   *
+   * @param first Beginning of the input sequence of keys
+   * @param last End of the input sequence of keys
+   * @param output_probe Beginning of the sequence of keys corresponding to matching elements in
+   * `output_match`
+   * @param output_match Beginning of the sequence of matching elements
+   * @param num_retrieved Device accessible location the number of retrieved slots is accumulated
+   * in
+   * @param container_ref Non-owning device reference to the container
+   * @param stream CUDA stream this operation is executed in
+   */
+  template <bool IsOuter, class InputProbeIt, class OutputProbeIt, class OutputMatchIt, class Ref>
+  void retrieve_impl_async(InputProbeIt first,
+                           InputProbeIt last,
+                           OutputProbeIt output_probe,
+                           OutputMatchIt output_match,
+                           size_type* num_retrieved,
+                           Ref container_ref,
+                           cuda::stream_ref stream) const
+  {
+    static_assert(not is_host_backend, "retrieve is not supported by the host backend.");
+    CUCO_CUDA_TRY(cudaMemsetAsync(num_retrieved, 0, sizeof(size_type), stream.get()));
+
+    auto const n = detail::distance(first, last);
+    if (n == 0) { return; }
+
+    int32_t constexpr block_size = cuco::detail::default_block_size();
+
+    auto constexpr grid_stride = 1;
+    auto const grid_size       = cuco::detail::grid_size(n, cg_size, grid_stride, block_size);
+
+    detail::open_addressing_ns::retrieve<IsOuter, block_size>
+      <<<grid_size, block_size, 0, stream.get()>>>(
+        first, n, output_probe, output_match, num_retrieved, container_ref);
+  }
+
+  /**
+   * @brief Asynchronously accumulates the number of filled slots into `counter`.
+   *
+   * @tparam Counter Integral counter type or atomic counter type
+   *
+   * @param counter Pointer to the device accessible counter
+   * @param stream CUDA stream used for this operation
+   */
+  template <typename Counter>
+  void count_filled_slots_async(Counter* counter, cuda::stream_ref stream) const
+  {
+    auto const grid_size = cuco::detail::grid_size(storage_.num_buckets());
+    auto const is_filled = detail::open_addressing_ns::slot_is_filled<has_payload, key_type>{
+      this->empty_key_sentinel(), this->erased_key_sentinel()};
+
+    // TODO: custom kernel to be replaced by cub::DeviceReduce::Sum when cub version is bumped to
+    // v2.1.0
+    detail::open_addressing_ns::size<cuco::detail::default_block_size()>
+      <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+        storage_.ref(), is_filled, counter);
+
+    // elements not migrated yet by a pending incremental rehash
+    if (this->is_rehashing()) {
+      detail::open_addressing_ns::size<cuco::detail::default_block_size()>
+        <<<cuco::detail::grid_size(old_storage_->num_buckets()),
+           cuco::detail::default_block_size(),
+           0,
+           stream.get()>>>(old_storage_->ref(), is_filled, counter);
+    }
+  }
+
+  /**
+   * @brief Invokes `launch` on the input in radix-partitioned order if partitioning is enabled, or
+   * in input order otherwise.
+   *
+   * `launch(permute, n)` must process `n` elements, reading and writing the `i`-th of them through
+   * `permute(it)[i]` for every per-element iterator `it`. With partitioning enabled, the input is
+   * processed in batches, each of them sorted by the partition first probed by its elements.
+   *
+   * @tparam InputIt Device accessible random access input iterator
+   * @tparam Launch Host callable launching the kernels of a bulk operation
+   *
+   * @param first Beginning of the sequence of input elements
+   * @param num_keys Number of input elements
+   * @param launch Host callable launching the kernels of a bulk operation
+   * @param stream CUDA stream used for this operation
+   */
+  template <typename InputIt, typename Launch>
+  void partitioned_apply(InputIt first,
+                         cuco::detail::index_type num_keys,
+                         Launch&& launch,
+                         cuda::stream_ref stream) const
+  {
+    if (partition_bits_ == 0) {
+      launch([](auto it) { return it; }, num_keys);
+      return;
+    }
+
+    using partition_type = uint32_t;
+    using index_type     = int32_t;
+    using temp_allocator_type =
+      typename std::allocator_traits<temporary_allocator_type>::template rebind_alloc<char>;
+
+    cuco::detail::index_type constexpr batch_size = std::numeric_limits<index_type>::max();
+
+    auto const partition_of =
+      detail::open_addressing_ns::probe_partition<has_payload,
+                                                  key_type,
+                                                  probing_scheme_type,
+                                                  extent_type>{
+        probing_scheme_, storage_.bucket_extent(), partition_bits_};
+    auto temp_allocator = temp_allocator_type{this->temporary_allocator(stream)};
+
+    for (cuco::detail::index_type offset = 0; offset < num_keys; offset += batch_size) {
+      auto const n = static_cast<index_type>(std::min(num_keys - offset, batch_size));
+
+      auto const partitions_bytes = 2 * sizeof(partition_type) * n;
+      auto const indices_bytes    = 2 * sizeof(index_type) * n;
+      auto partitions =
+        reinterpret_cast<partition_type*>(temp_allocator.allocate(partitions_bytes));
+      auto indices = reinterpret_cast<index_type*>(temp_allocator.allocate(indices_bytes));
+
+      detail::open_addressing_ns::partition_n<cuco::detail::default_block_size()>
+        <<<cuco::detail::grid_size(n),
+           cuco::detail::default_block_size(),
+           0,
+           stream.get()>>>(first + offset, n, partition_of, partitions, indices);
+
+      std::size_t temp_storage_bytes = 0;
+      CUCO_CUDA_TRY(cub::DeviceRadixSort::SortPairs(nullptr,
+                                                    temp_storage_bytes,
+                                                    partitions,
+                                                    partitions + n,
+                                                    indices,
+                                                    indices + n,
+                                                    n,
+                                                    0,
+                                                    partition_bits_,
+                                                    stream.get()));
+      auto d_temp_storage = temp_allocator.allocate(temp_storage_bytes);
+      CUCO_CUDA_TRY(cub::DeviceRadixSort::SortPairs(d_temp_storage,
+                                                    temp_storage_bytes,
+                                                    partitions,
+                                                    partitions + n,
+                                                    indices,
+                                                    indices + n,
+                                                    n,
+                                                    0,
+                                                    partition_bits_,
+                                                    stream.get()));
+
+      auto const sorted_indices = indices + n;
+      launch(
+        [offset, sorted_indices](auto it) {
+          return thrust::make_permutation_iterator(it + offset, sorted_indices);
+        },
+        static_cast<cuco::detail::index_type>(n));
+
+      temp_allocator.deallocate(d_temp_storage, temp_storage_bytes);
+      temp_allocator.deallocate(reinterpret_cast<char*>(indices), indices_bytes);
+      temp_allocator.deallocate(reinterpret_cast<char*>(partitions), partitions_bytes);
+    }
+  }
+
+  /**
+   * @brief Asynchronously migrates up to `max_buckets` buckets of the old storage.
+   *
+   * @tparam Container The container type this function operates on
+   *
+   * @param max_buckets Maximum number of buckets to migrate
+   * @param container The container being rehashed
+   * @param stream CUDA stream used for this operation
+   */
+  template <typename Container>
+  void migrate_async(size_type max_buckets, Container const& container, cuda::stream_ref stream)
+  {
+    auto const old_num_buckets = static_cast<size_type>(old_storage_->num_buckets());
+    auto const num_buckets     = std::min(max_buckets, old_num_buckets - migrated_buckets_);
+
+    if (num_buckets > 0) {
+      auto constexpr block_size = cuco::detail::default_block_size();
+      auto constexpr stride     = cuco::detail::default_stride();
+      auto const grid_size      = cuco::detail::grid_size(num_buckets, 1, stride, block_size);
+      auto const is_filled      = detail::open_addressing_ns::slot_is_filled<has_payload, key_type>{
+        this->empty_key_sentinel(), this->erased_key_sentinel()};
+      auto const erased_slot = [&]() {
+        if constexpr (has_payload) {
+          return value_type{this->erased_key_sentinel(), this->empty_slot_sentinel_.second};
+        } else {
+          return this->erased_key_sentinel();
+        }
+      }();
+
+      detail::open_addressing_ns::migrate<block_size><<<grid_size, block_size, 0, stream.get()>>>(
+        old_storage_->ref(),
+        migrated_buckets_,
+        num_buckets,
+        container.ref(op::insert),
+        is_filled,
+        erased_slot);
+    }
+
+    migrated_buckets_ += num_buckets;
+    if (migrated_buckets_ == old_num_buckets) {
+      detail::release_after(old_storage_->allocator(), stream);
+      old_storage_.reset();
+    }
+  }
+
   /**
    * @brief Extracts the key from a given slot.
    *
@@ -1212,6 +2555,19 @@ class open_addressing_impl {
   key_equal predicate_;                 ///< Key equality binary predicate
   probing_scheme_type probing_scheme_;  ///< Probing scheme
   storage_type storage_;                ///< Slot bucket storage
+  std::optional<size_counter_type> size_counter_;  ///< Optional counter of contained elements
+  /// Scratch counter of compacted clusters, allocated on the first tombstone purge
+  std::optional<size_counter_type> num_clusters_;
+  /// Device pool of the temporaries of pinned or managed containers, created on first use
+  mutable std::optional<temporary_allocator_type> temporary_pool_;
+  /// Buffers and streams of `insert_from_host`, created on first use
+  std::optional<detail::host_staging_pipeline<temporary_allocator_type>> host_pipeline_;
+  /// Storage still holding the elements not migrated yet by a pending incremental rehash
+  std::optional<storage_type> old_storage_;
+  size_type migrated_buckets_{0};  ///< Number of old buckets migrated so far
+  size_type buckets_per_step_{0};  ///< Number of old buckets migrated by each rehash step
+  int32_t partition_bits_{0};      ///< Number of radix partition bits of bulk operations
+  bool dedup_inputs_{false};       ///< Whether bulk inputs are deduplicated within warps
 };
 
 }  // namespace detail
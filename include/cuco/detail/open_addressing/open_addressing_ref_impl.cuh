@@ -19,11 +19,18 @@
 #include <cuco/detail/equal_wrapper.cuh>
 #include <cuco/detail/probing_scheme/probing_scheme_base.cuh>
 #include <cuco/detail/utility/cuda.cuh>
+#include <cuco/detail/utils.cuh>
+#include <cuco/bounded_bucket_storage.cuh>
+#include <cuco/counted_bucket_storage.cuh>
 #include <cuco/extent.cuh>
 #include <cuco/pair.cuh>
 #include <cuco/probing_scheme.cuh>
+#include <cuco/soa_bucket_storage.cuh>
+#include <cuco/stash_bucket_storage.cuh>
+#include <cuco/tagged_bucket_storage.cuh>
 
 #include <cuda/atomic>
+#include <cuda/std/limits>
 #include <cuda/std/type_traits>
 #include <thrust/distance.h>
 #include <thrust/execution_policy.h>
@@ -36,6 +43,7 @@
 
 #include <cooperative_groups.h>
 
+#include <climits>
 #include <cstdint>
 #include <type_traits>
 
@@ -106,6 +114,24 @@ class open_addressing_ref_impl {
   /// Flag indicating whether duplicate keys are allowed or not
   static constexpr auto allows_duplicates = AllowsDuplicates;
 
+  /// Determines if keys and payloads are stored in separate arrays
+  static constexpr auto is_soa = cuco::detail::is_soa_storage_ref_v<StorageRef>;
+
+  /// Determines if every slot is shadowed by a hash tag
+  static constexpr auto is_tagged = cuco::detail::is_tagged_storage_ref_v<StorageRef>;
+
+  /// Determines if lookups stop at the per-bucket displacement bound
+  static constexpr auto is_bounded = cuco::detail::is_bounded_storage_ref_v<StorageRef>;
+
+  /// Determines if probing falls back to an overflow stash after a bounded number of steps
+  static constexpr auto is_stash = cuco::detail::is_stash_storage_ref_v<StorageRef>;
+
+  /// Determines if probing events are counted in device performance counters
+  static constexpr auto is_counted = cuco::detail::is_counted_storage_ref_v<StorageRef>;
+
+  /// Determines if inserts displace resident elements once all candidate buckets are full
+  static constexpr auto is_cuckoo = cuco::is_cuckoo_probing<ProbingScheme>::value;
+
   // TODO: how to re-enable this check?
   // static_assert(is_bucket_extent_v<typename StorageRef::extent_type>,
   // "Extent is not a valid cuco::bucket_extent");
@@ -316,6 +342,11 @@ class open_addressing_ref_impl {
   template <typename CG>
   __device__ void make_copy(CG const& g, bucket_type* const memory_to_use) const noexcept
   {
+    static_assert(not is_soa, "make_copy is not supported with struct of arrays storage.");
+    static_assert(not is_tagged, "make_copy is not supported with tagged storage.");
+    static_assert(not is_bounded, "make_copy is not supported with bounded storage.");
+    static_assert(not is_stash, "make_copy is not supported with stash storage.");
+    static_assert(not is_counted, "make_copy is not supported with counted storage.");
     auto const num_buckets = static_cast<size_type>(this->bucket_extent());
 #if defined(CUCO_HAS_CUDA_BARRIER)
 #pragma nv_diagnostic push
@@ -351,6 +382,11 @@ class open_addressing_ref_impl {
   template <typename CG>
   __device__ constexpr void initialize(CG const& tile) noexcept
   {
+    static_assert(not is_soa, "initialize is not supported with struct of arrays storage.");
+    static_assert(not is_tagged, "initialize is not supported with tagged storage.");
+    static_assert(not is_bounded, "initialize is not supported with bounded storage.");
+    static_assert(not is_stash, "initialize is not supported with stash storage.");
+    static_assert(not is_counted, "initialize is not supported with counted storage.");
     auto tid                = tile.thread_rank();
     auto* const buckets_ptr = this->storage_ref().data();
     while (tid < static_cast<size_type>(this->bucket_extent())) {
@@ -374,45 +410,63 @@ class open_addressing_ref_impl {
    * @return True if the given element is successfully inserted
    */
   template <typename Value>
-  __device__ bool insert(Value const& value) noexcept
+  __host__ __device__ bool insert(Value const& value) noexcept
   {
     static_assert(cg_size == 1, "Non-CG operation is incompatible with the current probing scheme");
+    if constexpr (is_tagged) { return this->tagged_insert(value); }
 
-    auto const val      = this->heterogeneous_value(value);
-    auto const key      = this->extract_key(val);
-    auto probing_iter   = probing_scheme_(key, storage_ref_.bucket_extent());
-    auto const init_idx = *probing_iter;
+    auto const val       = this->heterogeneous_value(value);
+    auto const key       = this->extract_key(val);
+    auto probing_iter    = this->probing_iterator(key);
+    auto const init_idx  = *probing_iter;
+    int32_t displacement = 0;
 
     while (true) {
-      auto const bucket_slots = storage_ref_[*probing_iter];
+      auto const bucket_slots = this->probe_bucket(*probing_iter);
+      this->count_event<perf_event::PROBE_STEP>();
 
       for (auto& slot_content : bucket_slots) {
         auto const eq_res =
-          this->predicate_.operator()<is_insert::YES>(key, this->extract_key(slot_content));
+          this->predicate_.operator()<is_insert::YES>(key, this->probe_slot_key(slot_content));
 
         if constexpr (not allows_duplicates) {
           // If the key is already in the container, return false
-          if (eq_res == detail::equal_result::EQUAL) { return false; }
+          if (eq_res == detail::equal_result::EQUAL) {
+            this->count_event<perf_event::DUPLICATE_HIT>();
+            return false;
+          }
         }
         if (eq_res == detail::equal_result::AVAILABLE) {
           auto const intra_bucket_index = thrust::distance(bucket_slots.begin(), &slot_content);
-          switch (attempt_insert((storage_ref_.data() + *probing_iter)->data() + intra_bucket_index,
-                                 slot_content,
-                                 val)) {
+          switch (attempt_insert(
+            this->slot_address(*probing_iter, intra_bucket_index), slot_content, val)) {
             case insert_result::DUPLICATE: {
               if constexpr (allows_duplicates) {
                 [[fallthrough]];
               } else {
+                this->count_event<perf_event::DUPLICATE_HIT>();
                 return false;
               }
             }
             case insert_result::CONTINUE: continue;
-            case insert_result::SUCCESS: return true;
+            case insert_result::SUCCESS: {
+              this->record_displacement(init_idx, displacement);
+              this->record_stash_insert(*probing_iter);
+              return true;
+            }
           }
         }
       }
+      this->count_event<perf_event::BUCKET_FULL>();
       ++probing_iter;
-      if (*probing_iter == init_idx) { return false; }
+      ++displacement;
+      if (*probing_iter == init_idx) {
+        if constexpr (is_cuckoo) {
+          return this->cuckoo_insert(val);
+        } else {
+          return false;
+        }
+      }
     }
   }
 
@@ -430,18 +484,23 @@ class open_addressing_ref_impl {
   __device__ bool insert(cooperative_groups::thread_block_tile<cg_size> const& group,
                          Value const& value) noexcept
   {
-    auto const val      = this->heterogeneous_value(value);
-    auto const key      = this->extract_key(val);
-    auto probing_iter   = probing_scheme_(group, key, storage_ref_.bucket_extent());
-    auto const init_idx = *probing_iter;
+    if constexpr (is_tagged) { return this->tagged_insert(group, value); }
+
+    auto const val       = this->heterogeneous_value(value);
+    auto const key       = this->extract_key(val);
+    auto probing_iter    = this->probing_iterator(group, key);
+    auto const init_idx  = *probing_iter;
+    auto const home_idx  = this->home_bucket(group, init_idx);
+    int32_t displacement = 0;
 
     while (true) {
-      auto const bucket_slots = storage_ref_[*probing_iter];
+      auto const bucket_slots = this->probe_bucket(*probing_iter);
+      this->count_event<perf_event::PROBE_STEP>(group);
 
       auto const [state, intra_bucket_index] = [&]() {
         for (auto i = 0; i < bucket_size; ++i) {
-          switch (
-            this->predicate_.operator()<is_insert::YES>(key, this->extract_key(bucket_slots[i]))) {
+          switch (this->predicate_.operator()<is_insert::YES>(
+            key, this->probe_slot_key(bucket_slots[i]))) {
             case detail::equal_result::AVAILABLE:
               return bucket_probing_results{detail::equal_result::AVAILABLE, i};
             case detail::equal_result::EQUAL: {
@@ -460,7 +519,10 @@ class open_addressing_ref_impl {
 
       if constexpr (not allows_duplicates) {
         // If the key is already in the container, return false
-        if (group.any(state == detail::equal_result::EQUAL)) { return false; }
+        if (group.any(state == detail::equal_result::EQUAL)) {
+          this->count_event<perf_event::DUPLICATE_HIT>(group);
+          return false;
+        }
       }
 
       auto const group_contains_available = group.ballot(state == detail::equal_result::AVAILABLE);
@@ -468,25 +530,41 @@ class open_addressing_ref_impl {
         auto const src_lane = __ffs(group_contains_available) - 1;
         auto const status =
           (group.thread_rank() == src_lane)
-            ? attempt_insert((storage_ref_.data() + *probing_iter)->data() + intra_bucket_index,
+            ? attempt_insert(this->slot_address(*probing_iter, intra_bucket_index),
                              bucket_slots[intra_bucket_index],
                              val)
             : insert_result::CONTINUE;
 
         switch (group.shfl(status, src_lane)) {
-          case insert_result::SUCCESS: return true;
+          case insert_result::SUCCESS: {
+            if (group.thread_rank() == src_lane) {
+              this->record_displacement(home_idx, displacement);
+              this->record_stash_insert(*probing_iter);
+            }
+            return true;
+          }
           case insert_result::DUPLICATE: {
             if constexpr (allows_duplicates) {
               [[fallthrough]];
             } else {
+              this->count_event<perf_event::DUPLICATE_HIT>(group);
               return false;
             }
           }
           default: continue;
         }
       } else {
+        this->count_event<perf_event::BUCKET_FULL>(group);
         ++probing_iter;
-        if (*probing_iter == init_idx) { return false; }
+        ++displacement;
+        if (*probing_iter == init_idx) {
+          if constexpr (is_cuckoo) {
+            auto const status = group.thread_rank() == 0 and this->cuckoo_insert(val);
+            return group.shfl(status, 0);
+          } else {
+            return false;
+          }
+        }
       }
     }
   }
@@ -509,6 +587,8 @@ class open_addressing_ref_impl {
   __device__ thrust::pair<iterator, bool> insert_and_find(Value const& value) noexcept
   {
     static_assert(cg_size == 1, "Non-CG operation is incompatible with the current probing scheme");
+    static_assert(not is_soa, "insert_and_find is not supported with struct of arrays storage.");
+    static_assert(not is_tagged, "insert_and_find is not supported with tagged storage.");
 #if __CUDA_ARCH__ < 700
     // Spinning to ensure that the write to the value part took place requires
     // independent thread scheduling introduced with the Volta architecture.
@@ -517,13 +597,15 @@ class open_addressing_ref_impl {
       "insert_and_find is not supported for pair types larger than 8 bytes on pre-Volta GPUs.");
 #endif
 
-    auto const val      = this->heterogeneous_value(value);
-    auto const key      = this->extract_key(val);
-    auto probing_iter   = probing_scheme_(key, storage_ref_.bucket_extent());
-    auto const init_idx = *probing_iter;
+    auto const val       = this->heterogeneous_value(value);
+    auto const key       = this->extract_key(val);
+    auto probing_iter    = this->probing_iterator(key);
+    auto const init_idx  = *probing_iter;
+    int32_t displacement = 0;
 
     while (true) {
       auto const bucket_slots = storage_ref_[*probing_iter];
+      this->count_event<perf_event::PROBE_STEP>();
 
       for (auto i = 0; i < bucket_size; ++i) {
         auto const eq_res =
@@ -532,6 +614,7 @@ class open_addressing_ref_impl {
 
         // If the key is already in the container, return false
         if (eq_res == detail::equal_result::EQUAL) {
+          this->count_event<perf_event::DUPLICATE_HIT>();
           if constexpr (has_payload) {
             // wait to ensure that the write to the value part also took place
             this->wait_for_payload((bucket_ptr + i)->second, this->empty_value_sentinel());
@@ -541,6 +624,8 @@ class open_addressing_ref_impl {
         if (eq_res == detail::equal_result::AVAILABLE) {
           switch (this->attempt_insert_stable(bucket_ptr + i, bucket_slots[i], val)) {
             case insert_result::SUCCESS: {
+              this->record_displacement(init_idx, displacement);
+              this->record_stash_insert(*probing_iter);
               if constexpr (has_payload) {
                 // wait to ensure that the write to the value part also took place
                 this->wait_for_payload((bucket_ptr + i)->second, this->empty_value_sentinel());
@@ -548,6 +633,7 @@ class open_addressing_ref_impl {
               return {iterator{&bucket_ptr[i]}, true};
             }
             case insert_result::DUPLICATE: {
+              this->count_event<perf_event::DUPLICATE_HIT>();
               if constexpr (has_payload) {
                 // wait to ensure that the write to the value part also took place
                 this->wait_for_payload((bucket_ptr + i)->second, this->empty_value_sentinel());
@@ -558,7 +644,9 @@ class open_addressing_ref_impl {
           }
         }
       }
+      this->count_event<perf_event::BUCKET_FULL>();
       ++probing_iter;
+      ++displacement;
       if (*probing_iter == init_idx) { return {this->end(), false}; }
     };
   }
@@ -582,6 +670,8 @@ class open_addressing_ref_impl {
   __device__ thrust::pair<iterator, bool> insert_and_find(
     cooperative_groups::thread_block_tile<cg_size> const& group, Value const& value) noexcept
   {
+    static_assert(not is_soa, "insert_and_find is not supported with struct of arrays storage.");
+    static_assert(not is_tagged, "insert_and_find is not supported with tagged storage.");
 #if __CUDA_ARCH__ < 700
     // Spinning to ensure that the write to the value part took place requires
     // independent thread scheduling introduced with the Volta architecture.
@@ -590,13 +680,16 @@ class open_addressing_ref_impl {
       "insert_and_find is not supported for pair types larger than 8 bytes on pre-Volta GPUs.");
 #endif
 
-    auto const val      = this->heterogeneous_value(value);
-    auto const key      = this->extract_key(val);
-    auto probing_iter   = probing_scheme_(group, key, storage_ref_.bucket_extent());
-    auto const init_idx = *probing_iter;
+    auto const val       = this->heterogeneous_value(value);
+    auto const key       = this->extract_key(val);
+    auto probing_iter    = this->probing_iterator(group, key);
+    auto const init_idx  = *probing_iter;
+    auto const home_idx  = this->home_bucket(group, init_idx);
+    int32_t displacement = 0;
 
     while (true) {
       auto const bucket_slots = storage_ref_[*probing_iter];
+      this->count_event<perf_event::PROBE_STEP>(group);
 
       auto const [state, intra_bucket_index] = [&]() {
         auto res = detail::equal_result::UNEQUAL;
@@ -614,6 +707,7 @@ class open_addressing_ref_impl {
       // If the key is already in the container, return false
       auto const group_finds_equal = group.ballot(state == detail::equal_result::EQUAL);
       if (group_finds_equal) {
+        this->count_event<perf_event::DUPLICATE_HIT>(group);
         auto const src_lane = __ffs(group_finds_equal) - 1;
         auto const res      = group.shfl(reinterpret_cast<intptr_t>(slot_ptr), src_lane);
         if (group.thread_rank() == src_lane) {
@@ -638,6 +732,8 @@ class open_addressing_ref_impl {
         switch (group.shfl(status, src_lane)) {
           case insert_result::SUCCESS: {
             if (group.thread_rank() == src_lane) {
+              this->record_displacement(home_idx, displacement);
+              this->record_stash_insert(*probing_iter);
               if constexpr (has_payload) {
                 // wait to ensure that the write to the value part also took place
                 this->wait_for_payload(slot_ptr->second, this->empty_value_sentinel());
@@ -647,6 +743,7 @@ class open_addressing_ref_impl {
             return {iterator{reinterpret_cast<value_type*>(res)}, true};
           }
           case insert_result::DUPLICATE: {
+            this->count_event<perf_event::DUPLICATE_HIT>(group);
             if (group.thread_rank() == src_lane) {
               if constexpr (has_payload) {
                 // wait to ensure that the write to the value part also took place
@@ -659,7 +756,9 @@ class open_addressing_ref_impl {
           default: continue;
         }
       } else {
+        this->count_event<perf_event::BUCKET_FULL>(group);
         ++probing_iter;
+        ++displacement;
         if (*probing_iter == init_idx) { return {this->end(), false}; }
       }
     }
@@ -675,37 +774,42 @@ class open_addressing_ref_impl {
    * @return True if the given element is successfully erased
    */
   template <typename ProbeKey>
-  __device__ bool erase(ProbeKey const& key) noexcept
+  __host__ __device__ bool erase(ProbeKey const& key) noexcept
   {
     static_assert(cg_size == 1, "Non-CG operation is incompatible with the current probing scheme");
+    if constexpr (is_tagged) { return this->tagged_erase(key); }
 
-    auto probing_iter   = probing_scheme_(key, storage_ref_.bucket_extent());
-    auto const init_idx = *probing_iter;
+    auto probing_iter    = this->probing_iterator(key);
+    auto const init_idx  = *probing_iter;
+    auto const bound     = this->displacement_bound(init_idx);
+    int32_t displacement = 0;
 
     while (true) {
-      auto const bucket_slots = storage_ref_[*probing_iter];
+      auto const bucket_slots = this->probe_bucket(*probing_iter);
 
       for (auto& slot_content : bucket_slots) {
         auto const eq_res =
-          this->predicate_.operator()<is_insert::NO>(key, this->extract_key(slot_content));
+          this->predicate_.operator()<is_insert::NO>(key, this->probe_slot_key(slot_content));
 
         // Key doesn't exist, return false
         if (eq_res == detail::equal_result::EMPTY) { return false; }
         // Key exists, return true if successfully deleted
         if (eq_res == detail::equal_result::EQUAL) {
           auto const intra_bucket_index = thrust::distance(bucket_slots.begin(), &slot_content);
-          switch (attempt_insert_stable(
-            (storage_ref_.data() + *probing_iter)->data() + intra_bucket_index,
-            slot_content,
-            this->erased_slot_sentinel())) {
-            case insert_result::SUCCESS: return true;
+          switch (attempt_insert_stable(this->slot_address(*probing_iter, intra_bucket_index),
+                                        slot_content,
+                                        this->erased_slot_sentinel())) {
+            case insert_result::SUCCESS: {
+              this->record_stash_erase(*probing_iter);
+              return true;
+            }
             case insert_result::DUPLICATE: return false;
             default: continue;
           }
         }
       }
       ++probing_iter;
-      if (*probing_iter == init_idx) { return false; }
+      if (*probing_iter == init_idx or this->exceeds_bound(displacement, bound)) { return false; }
     }
   }
 
@@ -723,16 +827,20 @@ class open_addressing_ref_impl {
   __device__ bool erase(cooperative_groups::thread_block_tile<cg_size> const& group,
                         ProbeKey const& key) noexcept
   {
-    auto probing_iter   = probing_scheme_(group, key, storage_ref_.bucket_extent());
-    auto const init_idx = *probing_iter;
+    if constexpr (is_tagged) { return this->tagged_erase(group, key); }
+    auto probing_iter    = this->probing_iterator(group, key);
+    auto const init_idx  = *probing_iter;
+    auto const bound     = this->displacement_bound(this->home_bucket(group, init_idx));
+    int32_t displacement = 0;
 
     while (true) {
-      auto const bucket_slots = storage_ref_[*probing_iter];
+      auto const bucket_slots = this->probe_bucket(*probing_iter);
 
       auto const [state, intra_bucket_index] = [&]() {
         auto res = detail::equal_result::UNEQUAL;
         for (auto i = 0; i < bucket_size; ++i) {
-          res = this->predicate_.operator()<is_insert::NO>(key, this->extract_key(bucket_slots[i]));
+          res =
+            this->predicate_.operator()<is_insert::NO>(key, this->probe_slot_key(bucket_slots[i]));
           if (res != detail::equal_result::UNEQUAL) { return bucket_probing_results{res, i}; }
         }
         // returns dummy index `-1` for UNEQUAL
@@ -744,14 +852,16 @@ class open_addressing_ref_impl {
         auto const src_lane = __ffs(group_contains_equal) - 1;
         auto const status =
           (group.thread_rank() == src_lane)
-            ? attempt_insert_stable(
-                (storage_ref_.data() + *probing_iter)->data() + intra_bucket_index,
-                bucket_slots[intra_bucket_index],
-                this->erased_slot_sentinel())
+            ? attempt_insert_stable(this->slot_address(*probing_iter, intra_bucket_index),
+                                    bucket_slots[intra_bucket_index],
+                                    this->erased_slot_sentinel())
             : insert_result::CONTINUE;
 
         switch (group.shfl(status, src_lane)) {
-          case insert_result::SUCCESS: return true;
+          case insert_result::SUCCESS: {
+            if (group.thread_rank() == src_lane) { this->record_stash_erase(*probing_iter); }
+            return true;
+          }
           case insert_result::DUPLICATE: return false;
           default: continue;
         }
@@ -761,7 +871,7 @@ class open_addressing_ref_impl {
       if (group.any(state == detail::equal_result::EMPTY)) { return false; }
 
       ++probing_iter;
-      if (*probing_iter == init_idx) { return false; }
+      if (*probing_iter == init_idx or this->exceeds_bound(displacement, bound)) { return false; }
     }
   }
 
@@ -778,25 +888,29 @@ class open_addressing_ref_impl {
    * @return A boolean indicating whether the probe key is present
    */
   template <typename ProbeKey>
-  [[nodiscard]] __device__ bool contains(ProbeKey const& key) const noexcept
+  [[nodiscard]] __host__ __device__ bool contains(ProbeKey const& key) const noexcept
   {
     static_assert(cg_size == 1, "Non-CG operation is incompatible with the current probing scheme");
-    auto probing_iter   = probing_scheme_(key, storage_ref_.bucket_extent());
-    auto const init_idx = *probing_iter;
+    if constexpr (is_tagged) { return this->find(key) != this->end(); }
+    auto probing_iter    = this->probing_iterator(key);
+    auto const init_idx  = *probing_iter;
+    auto const bound     = this->displacement_bound(init_idx);
+    int32_t displacement = 0;
 
     while (true) {
       // TODO atomic_ref::load if insert operator is present
-      auto const bucket_slots = storage_ref_[*probing_iter];
+      auto const bucket_slots = this->probe_bucket(*probing_iter);
 
       for (auto& slot_content : bucket_slots) {
-        switch (this->predicate_.operator()<is_insert::NO>(key, this->extract_key(slot_content))) {
+        switch (
+          this->predicate_.operator()<is_insert::NO>(key, this->probe_slot_key(slot_content))) {
           case detail::equal_result::UNEQUAL: continue;
           case detail::equal_result::EMPTY: return false;
           case detail::equal_result::EQUAL: return true;
         }
       }
       ++probing_iter;
-      if (*probing_iter == init_idx) { return false; }
+      if (*probing_iter == init_idx or this->exceeds_bound(displacement, bound)) { return false; }
     }
   }
 
@@ -817,16 +931,19 @@ class open_addressing_ref_impl {
   [[nodiscard]] __device__ bool contains(
     cooperative_groups::thread_block_tile<cg_size> const& group, ProbeKey const& key) const noexcept
   {
-    auto probing_iter   = probing_scheme_(group, key, storage_ref_.bucket_extent());
-    auto const init_idx = *probing_iter;
+    if constexpr (is_tagged) { return this->find(group, key) != this->end(); }
+    auto probing_iter    = this->probing_iterator(group, key);
+    auto const init_idx  = *probing_iter;
+    auto const bound     = this->displacement_bound(this->home_bucket(group, init_idx));
+    int32_t displacement = 0;
 
     while (true) {
-      auto const bucket_slots = storage_ref_[*probing_iter];
+      auto const bucket_slots = this->probe_bucket(*probing_iter);
 
       auto const state = [&]() {
         auto res = detail::equal_result::UNEQUAL;
         for (auto& slot : bucket_slots) {
-          res = this->predicate_.operator()<is_insert::NO>(key, this->extract_key(slot));
+          res = this->predicate_.operator()<is_insert::NO>(key, this->probe_slot_key(slot));
           if (res != detail::equal_result::UNEQUAL) { return res; }
         }
         return res;
@@ -836,7 +953,7 @@ class open_addressing_ref_impl {
       if (group.any(state == detail::equal_result::EMPTY)) { return false; }
 
       ++probing_iter;
-      if (*probing_iter == init_idx) { return false; }
+      if (*probing_iter == init_idx or this->exceeds_bound(displacement, bound)) { return false; }
     }
   }
 
@@ -853,30 +970,35 @@ class open_addressing_ref_impl {
    * @return An iterator to the position at which the equivalent key is stored
    */
   template <typename ProbeKey>
-  [[nodiscard]] __device__ const_iterator find(ProbeKey const& key) const noexcept
+  [[nodiscard]] __host__ __device__ const_iterator find(ProbeKey const& key) const noexcept
   {
     static_assert(cg_size == 1, "Non-CG operation is incompatible with the current probing scheme");
-    auto probing_iter   = probing_scheme_(key, storage_ref_.bucket_extent());
-    auto const init_idx = *probing_iter;
+    if constexpr (is_tagged) { return this->tagged_find(key); }
+    auto probing_iter    = this->probing_iterator(key);
+    auto const init_idx  = *probing_iter;
+    auto const bound     = this->displacement_bound(init_idx);
+    int32_t displacement = 0;
 
     while (true) {
       // TODO atomic_ref::load if insert operator is present
-      auto const bucket_slots = storage_ref_[*probing_iter];
+      auto const bucket_slots = this->probe_bucket(*probing_iter);
 
       for (auto i = 0; i < bucket_size; ++i) {
         switch (
-          this->predicate_.operator()<is_insert::NO>(key, this->extract_key(bucket_slots[i]))) {
+          this->predicate_.operator()<is_insert::NO>(key, this->probe_slot_key(bucket_slots[i]))) {
           case detail::equal_result::EMPTY: {
             return this->end();
           }
           case detail::equal_result::EQUAL: {
-            return const_iterator{&(*(storage_ref_.data() + *probing_iter))[i]};
+            return const_iterator{this->slot_address(*probing_iter, i)};
           }
           default: continue;
         }
       }
       ++probing_iter;
-      if (*probing_iter == init_idx) { return this->end(); }
+      if (*probing_iter == init_idx or this->exceeds_bound(displacement, bound)) {
+        return this->end();
+      }
     }
   }
 
@@ -897,16 +1019,20 @@ class open_addressing_ref_impl {
   [[nodiscard]] __device__ const_iterator find(
     cooperative_groups::thread_block_tile<cg_size> const& group, ProbeKey const& key) const noexcept
   {
-    auto probing_iter   = probing_scheme_(group, key, storage_ref_.bucket_extent());
-    auto const init_idx = *probing_iter;
+    if constexpr (is_tagged) { return this->tagged_find(group, key); }
+    auto probing_iter    = this->probing_iterator(group, key);
+    auto const init_idx  = *probing_iter;
+    auto const bound     = this->displacement_bound(this->home_bucket(group, init_idx));
+    int32_t displacement = 0;
 
     while (true) {
-      auto const bucket_slots = storage_ref_[*probing_iter];
+      auto const bucket_slots = this->probe_bucket(*probing_iter);
 
       auto const [state, intra_bucket_index] = [&]() {
         auto res = detail::equal_result::UNEQUAL;
         for (auto i = 0; i < bucket_size; ++i) {
-          res = this->predicate_.operator()<is_insert::NO>(key, this->extract_key(bucket_slots[i]));
+          res =
+            this->predicate_.operator()<is_insert::NO>(key, this->probe_slot_key(bucket_slots[i]));
           if (res != detail::equal_result::UNEQUAL) { return bucket_probing_results{res, i}; }
         }
         // returns dummy index `-1` for UNEQUAL
@@ -917,17 +1043,26 @@ class open_addressing_ref_impl {
       auto const group_finds_match = group.ballot(state == detail::equal_result::EQUAL);
       if (group_finds_match) {
         auto const src_lane = __ffs(group_finds_match) - 1;
-        auto const res      = group.shfl(
-          reinterpret_cast<intptr_t>(&(*(storage_ref_.data() + *probing_iter))[intra_bucket_index]),
-          src_lane);
-        return const_iterator{reinterpret_cast<value_type*>(res)};
+        if constexpr (is_soa) {
+          // Probing iterators differ across the group, so broadcast the flat slot index
+          auto const res = group.shfl(
+            static_cast<size_type>(*probing_iter * bucket_size + intra_bucket_index), src_lane);
+          return storage_ref_.slot(res / bucket_size, res % bucket_size);
+        } else {
+          auto const res = group.shfl(
+            reinterpret_cast<intptr_t>(this->slot_address(*probing_iter, intra_bucket_index)),
+            src_lane);
+          return const_iterator{reinterpret_cast<value_type*>(res)};
+        }
       }
 
       // Find an empty slot, meaning that the probe key isn't present in the container
       if (group.any(state == detail::equal_result::EMPTY)) { return this->end(); }
 
       ++probing_iter;
-      if (*probing_iter == init_idx) { return this->end(); }
+      if (*probing_iter == init_idx or this->exceeds_bound(displacement, bound)) {
+        return this->end();
+      }
     }
   }
 
@@ -945,25 +1080,29 @@ class open_addressing_ref_impl {
   {
     if constexpr (not allows_duplicates) {
       return static_cast<size_type>(this->contains(key));
+    } else if constexpr (is_tagged) {
+      return this->tagged_count(key);
     } else {
-      auto probing_iter   = probing_scheme_(key, storage_ref_.bucket_extent());
-      auto const init_idx = *probing_iter;
-      size_type count     = 0;
+      auto probing_iter    = this->probing_iterator(key);
+      auto const init_idx  = *probing_iter;
+      auto const bound     = this->displacement_bound(init_idx);
+      int32_t displacement = 0;
+      size_type count      = 0;
 
       while (true) {
         // TODO atomic_ref::load if insert operator is present
-        auto const bucket_slots = storage_ref_[*probing_iter];
+        auto const bucket_slots = this->probe_bucket(*probing_iter);
 
         for (auto& slot_content : bucket_slots) {
           switch (
-            this->predicate_.operator()<is_insert::NO>(key, this->extract_key(slot_content))) {
+            this->predicate_.operator()<is_insert::NO>(key, this->probe_slot_key(slot_content))) {
             case detail::equal_result::EMPTY: return count;
             case detail::equal_result::EQUAL: ++count; break;
             default: continue;
           }
         }
         ++probing_iter;
-        if (*probing_iter == init_idx) { return count; }
+        if (*probing_iter == init_idx or this->exceeds_bound(displacement, bound)) { return count; }
       }
     }
   }
@@ -982,17 +1121,20 @@ class open_addressing_ref_impl {
   [[nodiscard]] __device__ size_type count(
     cooperative_groups::thread_block_tile<cg_size> const& group, ProbeKey const& key) const noexcept
   {
-    auto probing_iter   = probing_scheme_(group, key, storage_ref_.bucket_extent());
-    auto const init_idx = *probing_iter;
-    size_type count     = 0;
+    if constexpr (is_tagged) { return this->tagged_count(group, key); }
+    auto probing_iter    = this->probing_iterator(group, key);
+    auto const init_idx  = *probing_iter;
+    auto const bound     = this->displacement_bound(this->home_bucket(group, init_idx));
+    int32_t displacement = 0;
+    size_type count      = 0;
 
     while (true) {
-      auto const bucket_slots = storage_ref_[*probing_iter];
+      auto const bucket_slots = this->probe_bucket(*probing_iter);
 
       auto const state = [&]() {
         auto res = detail::equal_result::UNEQUAL;
         for (auto& slot : bucket_slots) {
-          res = this->predicate_.operator()<is_insert::NO>(key, this->extract_key(slot));
+          res = this->predicate_.operator()<is_insert::NO>(key, this->probe_slot_key(slot));
           if (res == detail::equal_result::EMPTY) { return res; }
           count += static_cast<size_type>(res);
         }
@@ -1001,7 +1143,7 @@ class open_addressing_ref_impl {
 
       if (group.any(state == detail::equal_result::EMPTY)) { return count; }
       ++probing_iter;
-      if (*probing_iter == init_idx) { return count; }
+      if (*probing_iter == init_idx or this->exceeds_bound(displacement, bound)) { return count; }
     }
   }
 
@@ -1199,8 +1341,7 @@ class open_addressing_ref_impl {
         // perform probing
         // make sure the flushing_tile is converged at this point to get a coalesced load
         auto const& probe_key = *(input_probe + idx);
-        auto probing_iter =
-          this->probing_scheme_(probing_tile, probe_key, this->storage_ref_.bucket_extent());
+        auto probing_iter   = this->probing_iterator(probing_tile, probe_key);
         auto const init_idx = *probing_iter;
 
         bool running                      = true;
@@ -1331,7 +1472,7 @@ class open_addressing_ref_impl {
   __device__ void for_each(ProbeKey const& key, CallbackOp&& callback_op) const noexcept
   {
     static_assert(cg_size == 1, "Non-CG operation is incompatible with the current probing scheme");
-    auto probing_iter   = this->probing_scheme_(key, this->storage_ref_.bucket_extent());
+    auto probing_iter   = this->probing_iterator(key);
     auto const init_idx = *probing_iter;
 
     while (true) {
@@ -1380,7 +1521,7 @@ class open_addressing_ref_impl {
                            ProbeKey const& key,
                            CallbackOp&& callback_op) const noexcept
   {
-    auto probing_iter   = this->probing_scheme_(group, key, this->storage_ref_.bucket_extent());
+    auto probing_iter   = this->probing_iterator(group, key);
     auto const init_idx = *probing_iter;
     bool empty          = false;
 
@@ -1444,7 +1585,7 @@ class open_addressing_ref_impl {
                            CallbackOp&& callback_op,
                            SyncOp&& sync_op) const noexcept
   {
-    auto probing_iter   = this->probing_scheme_(group, key, this->storage_ref_.bucket_extent());
+    auto probing_iter   = this->probing_iterator(group, key);
     auto const init_idx = *probing_iter;
     bool empty          = false;
 
@@ -1477,164 +1618,994 @@ class open_addressing_ref_impl {
   }
 
   /**
-   * @brief Extracts the key from a given value type.
+   * @brief Computes the tag of the given key.
    *
-   * @tparam Value Input type which is convertible to 'value_type'
+   * @note The tag consists of the 7 most significant bits of the (first) probing hash, so it is
+   * mostly independent of the bucket index which is derived from the low bits. For multi-word
+   * hash values, the tag is taken from the last word which the bucket index is not derived from.
    *
-   * @param value The input value
+   * @tparam ProbeKey Probe key type
    *
-   * @return The key
+   * @param key The key to compute the tag for
+   *
+   * @return The 7-bit tag
    */
-  template <typename Value>
-  [[nodiscard]] __host__ __device__ constexpr auto const& extract_key(
-    Value const& value) const noexcept
+  template <typename ProbeKey>
+  [[nodiscard]] __device__ constexpr std::uint8_t slot_tag(ProbeKey const& key) const noexcept
   {
-    if constexpr (this->has_payload) {
-      return thrust::raw_reference_cast(value).first;
-    } else {
-      return thrust::raw_reference_cast(value);
-    }
+    auto const hash = cuco::detail::last_hash_word([&]() {
+      if constexpr (cuco::is_double_hashing<probing_scheme_type>::value or is_cuckoo) {
+        return cuda::std::get<0>(probing_scheme_.hash_function())(key);
+      } else {
+        return probing_scheme_.hash_function()(key);
+      }
+    }());
+    using hash_type = cuda::std::make_unsigned_t<cuda::std::decay_t<decltype(hash)>>;
+    return static_cast<std::uint8_t>(static_cast<hash_type>(hash) >>
+                                     (sizeof(hash_type) * CHAR_BIT - 7));
   }
 
   /**
-   * @brief Extracts the payload from a given value type.
+   * @brief Probes a single bucket of a tagged storage.
    *
-   * @note This function is only available if `this->has_payload == true`
+   * @note Only slots whose tag equals `tag` are loaded. Insert probing stops at the first empty or
+   * erased slot while query probing stops only at the first empty slot. Busy slots are skipped by
+   * queries since their insert has not completed yet. Inserts that reject duplicates wait for the
+   * busy slots ahead of their stop slot to be published, as those may receive `key` itself.
    *
-   * @tparam Value Input type which is convertible to 'value_type'
+   * @tparam IsInsert Flag indicating whether it's an insert probing or not
+   * @tparam ProbeKey Probe key type
    *
-   * @param value The input value
+   * @param key The key to search for
+   * @param tag Tag of `key`
+   * @param bucket_index Index of the bucket to probe
    *
-   * @return The payload
+   * @return `EQUAL` and the index of the first matching slot, `EMPTY` (`AVAILABLE` for inserts)
+   * and the index of the first slot probing stops at, or `UNEQUAL` and `-1`
    */
-  template <typename Value, typename Enable = std::enable_if_t<has_payload and sizeof(Value)>>
-  [[nodiscard]] __device__ constexpr auto const& extract_payload(Value const& value) const noexcept
+  template <is_insert IsInsert, typename ProbeKey>
+  [[nodiscard]] __device__ bucket_probing_results
+  tagged_probe(ProbeKey const& key, std::uint8_t tag, size_type bucket_index) const noexcept
   {
-    return thrust::raw_reference_cast(value).second;
+    auto const stop_slot = [](auto const& tags) {
+      auto mask = storage_ref_type::match(tags, detail::empty_tag);
+      if constexpr (IsInsert == is_insert::YES) {
+        mask |= storage_ref_type::match(tags, detail::erased_tag);
+      }
+      return mask ? __ffs(mask) - 1 : bucket_size;
+    };
+    auto const ahead_of = [](int32_t slot) {
+      return static_cast<uint32_t>((uint64_t{1} << slot) - 1);
+    };
+
+    auto tags = storage_ref_.tag_bucket(bucket_index);
+    auto stop = stop_slot(tags);
+
+    if constexpr (not(IsInsert == is_insert::YES and allows_duplicates)) {
+      if constexpr (IsInsert == is_insert::YES) {
+        while (storage_ref_type::match(tags, detail::busy_tag) & ahead_of(stop)) {
+          tags = storage_ref_.load_tag_bucket(bucket_index);
+          stop = stop_slot(tags);
+        }
+      }
+
+      // Only inspect candidates ahead of the stop slot
+      auto candidates = storage_ref_type::match(tags, tag) & ahead_of(stop);
+      while (candidates) {
+        auto const i = __ffs(candidates) - 1;
+        if (this->predicate_.operator()<IsInsert>(
+              key, this->extract_key(*this->slot_address(bucket_index, i))) ==
+            detail::equal_result::EQUAL) {
+          return bucket_probing_results{detail::equal_result::EQUAL, i};
+        }
+        candidates &= candidates - 1;
+      }
+    }
+
+    if (stop < bucket_size) {
+      return bucket_probing_results{IsInsert == is_insert::YES ? detail::equal_result::AVAILABLE
+                                                               : detail::equal_result::EMPTY,
+                                    stop};
+    }
+    // returns dummy index `-1` for UNEQUAL
+    return bucket_probing_results{detail::equal_result::UNEQUAL, -1};
   }
 
   /**
-   * @brief Converts the given type to the container's native `value_type`.
+   * @brief Counts the slots of a single bucket of a tagged storage matching `key`.
    *
-   * @tparam T Input type which is convertible to 'value_type'
+   * @note As in `tagged_probe`, only slots whose tag equals `tag` are loaded and busy slots are
+   * skipped.
    *
-   * @param value The input value
+   * @tparam ProbeKey Probe key type
    *
-   * @return The converted object
+   * @param key The key to count for
+   * @param tag Tag of `key`
+   * @param bucket_index Index of the bucket to probe
+   * @param count Counter incremented for each match
+   *
+   * @return True if the bucket contains an empty slot, i.e., probing is done
    */
-  template <typename T>
-  [[nodiscard]] __device__ constexpr value_type native_value(T const& value) const noexcept
+  template <typename ProbeKey>
+  [[nodiscard]] __device__ bool tagged_count_bucket(ProbeKey const& key,
+                                                    std::uint8_t tag,
+                                                    size_type bucket_index,
+                                                    size_type& count) const noexcept
   {
-    if constexpr (this->has_payload) {
-      return {static_cast<key_type>(this->extract_key(value)), this->extract_payload(value)};
-    } else {
-      return static_cast<value_type>(value);
+    auto const tags       = storage_ref_.tag_bucket(bucket_index);
+    auto const empty_mask = storage_ref_type::match(tags, detail::empty_tag);
+    auto const stop       = empty_mask ? __ffs(empty_mask) - 1 : bucket_size;
+
+    auto candidates =
+      storage_ref_type::match(tags, tag) & static_cast<uint32_t>((uint64_t{1} << stop) - 1);
+    while (candidates) {
+      auto const i = __ffs(candidates) - 1;
+      count += static_cast<size_type>(this->predicate_.operator()<is_insert::NO>(
+                                        key, this->extract_key(*this->slot_address(
+                                               bucket_index, i))) == detail::equal_result::EQUAL);
+      candidates &= candidates - 1;
     }
+    return stop < bucket_size;
   }
 
   /**
-   * @brief Converts the given type to the container's native `value_type` while maintaining the
-   * heterogeneous key type.
+   * @brief Attempts to insert an element into an available slot of a tagged storage.
    *
-   * @tparam T Input type which is convertible to 'value_type'
+   * @note The slot is claimed by swapping its empty or erased tag to the busy tag, which excludes
+   * all other inserts. The element's tag is published only after the element has been written.
    *
-   * @param value The input value
+   * @tparam Value Input type which is convertible to 'value_type'
    *
-   * @return The converted object
+   * @param bucket_index Index of the bucket
+   * @param intra_bucket_index Index of the slot within the bucket
+   * @param value The element to insert
+   * @param tag Tag of the element's key
+   *
+   * @return Result of this operation, i.e., success/continue/duplicate
    */
-  template <typename T>
-  [[nodiscard]] __device__ constexpr auto heterogeneous_value(T const& value) const noexcept
+  template <typename Value>
+  [[nodiscard]] __device__ insert_result tagged_attempt_insert(size_type bucket_index,
+                                                               int32_t intra_bucket_index,
+                                                               Value const& value,
+                                                               std::uint8_t tag) noexcept
   {
-    if constexpr (this->has_payload and not cuda::std::is_same_v<T, value_type>) {
-      using mapped_type = decltype(this->empty_value_sentinel());
-      if constexpr (cuco::detail::is_cuda_std_pair_like<T>::value) {
-        return cuco::pair{cuda::std::get<0>(value),
-                          static_cast<mapped_type>(cuda::std::get<1>(value))};
-      } else {
-        // hail mary (convert using .first/.second members)
-        return cuco::pair{thrust::raw_reference_cast(value.first),
-                          static_cast<mapped_type>(value.second)};
-      }
-    } else {
-      return thrust::raw_reference_cast(value);
+    auto const previous = storage_ref_.claim_tag(bucket_index, intra_bucket_index);
+    // Another insert claimed the slot first, re-probe the bucket
+    if (previous != detail::empty_tag and previous != detail::erased_tag) {
+      return insert_result::CONTINUE;
     }
+
+    // The slot is owned by this thread and holds the sentinel matching its previous tag, so the
+    // CAS is uncontended and always succeeds
+    auto const expected =
+      previous == detail::empty_tag ? this->empty_slot_sentinel_ : this->erased_slot_sentinel();
+    auto const status = this->attempt_insert(
+      this->slot_address(bucket_index, intra_bucket_index), expected, value);
+    __threadfence();
+    storage_ref_.store_tag(bucket_index, intra_bucket_index, tag);
+    return status;
   }
 
   /**
-   * @brief Gets the sentinel used to represent an erased slot.
+   * @brief Inserts an element into a tagged storage.
    *
-   * @return The sentinel value used to represent an erased slot
+   * @tparam Value Input type which is convertible to 'value_type'
+   *
+   * @param value The element to insert
+   *
+   * @return True if the given element is successfully inserted
    */
-  [[nodiscard]] __device__ constexpr value_type const erased_slot_sentinel() const noexcept
+  template <typename Value>
+  __device__ bool tagged_insert(Value const& value) noexcept
   {
-    if constexpr (this->has_payload) {
-      return cuco::pair{this->erased_key_sentinel(), this->empty_value_sentinel()};
-    } else {
-      return this->erased_key_sentinel();
+    auto const val      = this->heterogeneous_value(value);
+    auto const key      = this->extract_key(val);
+    auto const tag      = this->slot_tag(key);
+    auto probing_iter   = probing_scheme_(key, storage_ref_.bucket_extent());
+    auto const init_idx = *probing_iter;
+
+    while (true) {
+      auto const [state, intra_bucket_index] =
+        this->tagged_probe<is_insert::YES>(key, tag, *probing_iter);
+
+      if constexpr (not allows_duplicates) {
+        // If the key is already in the container, return false
+        if (state == detail::equal_result::EQUAL) { return false; }
+      }
+      if (state == detail::equal_result::AVAILABLE) {
+        switch (this->tagged_attempt_insert(*probing_iter, intra_bucket_index, val, tag)) {
+          case insert_result::SUCCESS: return true;
+          case insert_result::DUPLICATE: return false;
+          // re-probe the current bucket
+          default: continue;
+        }
+      }
+      ++probing_iter;
+      if (*probing_iter == init_idx) { return false; }
     }
   }
 
   /**
-   * @brief Inserts the specified element with one single CAS operation.
+   * @brief Inserts an element into a tagged storage.
    *
    * @tparam Value Input type which is convertible to 'value_type'
    *
-   * @param address Pointer to the slot in memory
-   * @param expected Element to compare against
-   * @param desired Element to insert
+   * @param group The Cooperative Group used to perform group insert
+   * @param value The element to insert
    *
-   * @return Result of this operation, i.e., success/continue/duplicate
+   * @return True if the given element is successfully inserted
    */
   template <typename Value>
-  [[nodiscard]] __device__ constexpr insert_result packed_cas(value_type* address,
-                                                              value_type expected,
-                                                              Value desired) noexcept
+  __device__ bool tagged_insert(cooperative_groups::thread_block_tile<cg_size> const& group,
+                                Value const& value) noexcept
   {
-    using packed_type = cuda::std::conditional_t<sizeof(value_type) == 4, uint32_t, uint64_t>;
+    auto const val      = this->heterogeneous_value(value);
+    auto const key      = this->extract_key(val);
+    auto const tag      = this->slot_tag(key);
+    auto probing_iter   = probing_scheme_(group, key, storage_ref_.bucket_extent());
+    auto const init_idx = *probing_iter;
 
-    auto* slot_ptr     = reinterpret_cast<packed_type*>(address);
-    auto* expected_ptr = reinterpret_cast<packed_type*>(&expected);
-    auto* desired_ptr  = reinterpret_cast<packed_type*>(&desired);
+    while (true) {
+      auto const [state, intra_bucket_index] =
+        this->tagged_probe<is_insert::YES>(key, tag, *probing_iter);
 
-    auto slot_ref = cuda::atomic_ref<packed_type, Scope>{*slot_ptr};
+      if constexpr (not allows_duplicates) {
+        // If the key is already in the container, return false
+        if (group.any(state == detail::equal_result::EQUAL)) { return false; }
+      }
 
-    auto const success =
-      slot_ref.compare_exchange_strong(*expected_ptr, *desired_ptr, cuda::memory_order_relaxed);
+      auto const group_contains_available = group.ballot(state == detail::equal_result::AVAILABLE);
+      if (group_contains_available) {
+        auto const src_lane = __ffs(group_contains_available) - 1;
+        auto const status =
+          (group.thread_rank() == src_lane)
+            ? this->tagged_attempt_insert(*probing_iter, intra_bucket_index, val, tag)
+            : insert_result::CONTINUE;
 
-    if (success) {
-      return insert_result::SUCCESS;
-    } else {
-      return this->predicate_.equal_to(this->extract_key(desired), this->extract_key(expected)) ==
-                 detail::equal_result::EQUAL
-               ? insert_result::DUPLICATE
-               : insert_result::CONTINUE;
+        switch (group.shfl(status, src_lane)) {
+          case insert_result::SUCCESS: return true;
+          case insert_result::DUPLICATE: return false;
+          default: continue;
+        }
+      } else {
+        ++probing_iter;
+        if (*probing_iter == init_idx) { return false; }
+      }
     }
   }
 
   /**
-   * @brief Inserts the specified element with two back-to-back CAS operations.
-   *
-   * @note This CAS can be used exclusively for `cuco::op::insert` operations.
+   * @brief Erases an element from a tagged storage.
    *
-   * @tparam Value Input type which is convertible to 'value_type'
+   * @tparam ProbeKey Input type which is convertible to 'key_type'
    *
-   * @param address Pointer to the slot in memory
-   * @param expected Element to compare against
-   * @param desired Element to insert
+   * @param key The element to erase
    *
-   * @return Result of this operation, i.e., success/continue/duplicate
+   * @return True if the given element is successfully erased
    */
-  template <typename Value>
-  [[nodiscard]] __device__ constexpr insert_result back_to_back_cas(value_type* address,
-                                                                    value_type const& expected,
-                                                                    Value const& desired) noexcept
+  template <typename ProbeKey>
+  __device__ bool tagged_erase(ProbeKey const& key) noexcept
   {
-    using mapped_type = cuda::std::decay_t<decltype(this->empty_value_sentinel())>;
+    auto const tag      = this->slot_tag(key);
+    auto probing_iter   = probing_scheme_(key, storage_ref_.bucket_extent());
+    auto const init_idx = *probing_iter;
 
-    auto expected_key     = expected.first;
-    auto expected_payload = this->empty_value_sentinel();
+    while (true) {
+      auto const [state, intra_bucket_index] =
+        this->tagged_probe<is_insert::NO>(key, tag, *probing_iter);
 
-    cuda::atomic_ref<key_type, Scope> key_ref(address->first);
+      // Key doesn't exist, return false
+      if (state == detail::equal_result::EMPTY) { return false; }
+      // Key exists, return true if successfully deleted
+      if (state == detail::equal_result::EQUAL) {
+        auto* const slot_ptr = this->slot_address(*probing_iter, intra_bucket_index);
+        switch (attempt_insert_stable(slot_ptr, *slot_ptr, this->erased_slot_sentinel())) {
+          case insert_result::SUCCESS: {
+            __threadfence();
+            storage_ref_.store_tag(*probing_iter, intra_bucket_index, detail::erased_tag);
+            return true;
+          }
+          case insert_result::DUPLICATE: return false;
+          default: continue;
+        }
+      }
+      ++probing_iter;
+      if (*probing_iter == init_idx) { return false; }
+    }
+  }
+
+  /**
+   * @brief Erases an element from a tagged storage.
+   *
+   * @tparam ProbeKey Input type which is convertible to 'key_type'
+   *
+   * @param group The Cooperative Group used to perform group erase
+   * @param key The element to erase
+   *
+   * @return True if the given element is successfully erased
+   */
+  template <typename ProbeKey>
+  __device__ bool tagged_erase(cooperative_groups::thread_block_tile<cg_size> const& group,
+                               ProbeKey const& key) noexcept
+  {
+    auto const tag      = this->slot_tag(key);
+    auto probing_iter   = probing_scheme_(group, key, storage_ref_.bucket_extent());
+    auto const init_idx = *probing_iter;
+
+    while (true) {
+      auto const [state, intra_bucket_index] =
+        this->tagged_probe<is_insert::NO>(key, tag, *probing_iter);
+
+      auto const group_contains_equal = group.ballot(state == detail::equal_result::EQUAL);
+      if (group_contains_equal) {
+        auto const src_lane = __ffs(group_contains_equal) - 1;
+        auto const status   = [&, target_idx = intra_bucket_index]() {
+          if (group.thread_rank() != src_lane) { return insert_result::CONTINUE; }
+          auto* const slot_ptr = this->slot_address(*probing_iter, target_idx);
+          auto const res =
+            attempt_insert_stable(slot_ptr, *slot_ptr, this->erased_slot_sentinel());
+          if (res == insert_result::SUCCESS) {
+            __threadfence();
+            storage_ref_.store_tag(*probing_iter, target_idx, detail::erased_tag);
+          }
+          return res;
+        }();
+
+        switch (group.shfl(status, src_lane)) {
+          case insert_result::SUCCESS: return true;
+          case insert_result::DUPLICATE: return false;
+          default: continue;
+        }
+      }
+
+      // Key doesn't exist, return false
+      if (group.any(state == detail::equal_result::EMPTY)) { return false; }
+
+      ++probing_iter;
+      if (*probing_iter == init_idx) { return false; }
+    }
+  }
+
+  /**
+   * @brief Finds an element in a tagged storage with key equivalent to the probe key.
+   *
+   * @tparam ProbeKey Probe key type
+   *
+   * @param key The key to search for
+   *
+   * @return An iterator to the position at which the equivalent key is stored
+   */
+  template <typename ProbeKey>
+  [[nodiscard]] __device__ const_iterator tagged_find(ProbeKey const& key) const noexcept
+  {
+    auto const tag      = this->slot_tag(key);
+    auto probing_iter   = probing_scheme_(key, storage_ref_.bucket_extent());
+    auto const init_idx = *probing_iter;
+
+    while (true) {
+      auto const [state, intra_bucket_index] =
+        this->tagged_probe<is_insert::NO>(key, tag, *probing_iter);
+
+      switch (state) {
+        case detail::equal_result::EMPTY: return this->end();
+        case detail::equal_result::EQUAL:
+          return const_iterator{this->slot_address(*probing_iter, intra_bucket_index)};
+        default: break;
+      }
+      ++probing_iter;
+      if (*probing_iter == init_idx) { return this->end(); }
+    }
+  }
+
+  /**
+   * @brief Finds an element in a tagged storage with key equivalent to the probe key.
+   *
+   * @tparam ProbeKey Probe key type
+   *
+   * @param group The Cooperative Group used to perform this operation
+   * @param key The key to search for
+   *
+   * @return An iterator to the position at which the equivalent key is stored
+   */
+  template <typename ProbeKey>
+  [[nodiscard]] __device__ const_iterator tagged_find(
+    cooperative_groups::thread_block_tile<cg_size> const& group, ProbeKey const& key) const noexcept
+  {
+    auto const tag      = this->slot_tag(key);
+    auto probing_iter   = probing_scheme_(group, key, storage_ref_.bucket_extent());
+    auto const init_idx = *probing_iter;
+
+    while (true) {
+      auto const [state, intra_bucket_index] =
+        this->tagged_probe<is_insert::NO>(key, tag, *probing_iter);
+
+      // Find a match for the probe key, thus return an iterator to the entry
+      auto const group_finds_match = group.ballot(state == detail::equal_result::EQUAL);
+      if (group_finds_match) {
+        auto const src_lane = __ffs(group_finds_match) - 1;
+        auto const res      = group.shfl(
+          reinterpret_cast<intptr_t>(this->slot_address(*probing_iter, intra_bucket_index)),
+          src_lane);
+        return const_iterator{reinterpret_cast<value_type*>(res)};
+      }
+
+      // Find an empty slot, meaning that the probe key isn't present in the container
+      if (group.any(state == detail::equal_result::EMPTY)) { return this->end(); }
+
+      ++probing_iter;
+      if (*probing_iter == init_idx) { return this->end(); }
+    }
+  }
+
+  /**
+   * @brief Counts the occurrence of a given key contained in a tagged storage.
+   *
+   * @tparam ProbeKey Probe key type
+   *
+   * @param key The key to count for
+   *
+   * @return Number of occurrences found by the current thread
+   */
+  template <typename ProbeKey>
+  [[nodiscard]] __device__ size_type tagged_count(ProbeKey const& key) const noexcept
+  {
+    auto const tag      = this->slot_tag(key);
+    auto probing_iter   = probing_scheme_(key, storage_ref_.bucket_extent());
+    auto const init_idx = *probing_iter;
+    size_type count     = 0;
+
+    while (true) {
+      if (this->tagged_count_bucket(key, tag, *probing_iter, count)) { return count; }
+      ++probing_iter;
+      if (*probing_iter == init_idx) { return count; }
+    }
+  }
+
+  /**
+   * @brief Counts the occurrence of a given key contained in a tagged storage.
+   *
+   * @tparam ProbeKey Probe key type
+   *
+   * @param group The Cooperative Group used to perform group count
+   * @param key The key to count for
+   *
+   * @return Number of occurrences found by the current thread
+   */
+  template <typename ProbeKey>
+  [[nodiscard]] __device__ size_type tagged_count(
+    cooperative_groups::thread_block_tile<cg_size> const& group, ProbeKey const& key) const noexcept
+  {
+    auto const tag      = this->slot_tag(key);
+    auto probing_iter   = probing_scheme_(group, key, storage_ref_.bucket_extent());
+    auto const init_idx = *probing_iter;
+    size_type count     = 0;
+
+    while (true) {
+      auto const found_empty = this->tagged_count_bucket(key, tag, *probing_iter, count);
+      if (group.any(found_empty)) { return count; }
+      ++probing_iter;
+      if (*probing_iter == init_idx) { return count; }
+    }
+  }
+
+  /**
+   * @brief Inserts an element whose candidate buckets are all full by displacing resident elements
+   * along a cuckoo path.
+   *
+   * @note A path of at most `max_displacements` elements ending at a free slot is searched first by
+   * a random walk. The moves are then applied from the end of the path back to its start, each one
+   * copying an element into its new slot before its old slot is overwritten.
+   *
+   * @note The first victim is always the resident of the first slot of the key's first window, so
+   * that the last move of every path, which writes `value`, is a CAS on that slot. Concurrent
+   * inserts of the same key thus race for a single slot, and the losers find the key while
+   * searching their next path and return `false`.
+   *
+   * @note With a cooperative group, a single thread performs the displacement over windows of
+   * `cg_size` consecutive buckets, matching what the group probes.
+   *
+   * @param value The element to insert
+   *
+   * @return True if the given element is successfully inserted
+   */
+  __device__ bool cuckoo_insert(value_type const& value) noexcept
+  {
+    static_assert(not is_soa and not is_tagged and not is_stash,
+                  "Cuckoo probing requires the default bucket storage.");
+
+    constexpr auto max_depth       = probing_scheme_type::max_displacements;
+    constexpr auto window_size     = cg_size * bucket_size;
+    constexpr int32_t max_attempts = 4;
+    auto const num_buckets         = static_cast<size_type>(storage_ref_.num_buckets());
+    auto const extent              = storage_ref_.bucket_extent();
+    auto const slot_ptr            = [&](size_type window, int32_t offset) {
+      return this->slot_address((window + offset / bucket_size) % num_buckets,
+                                offset % bucket_size);
+    };
+
+    // `pos[d]` is where the `d`-th path element is written: `value` for `d == 0` and
+    // `victims[d - 1]` otherwise. All but the last position hold the next victim.
+    value_type* pos[max_depth + 1];
+    value_type victims[max_depth];
+    value_type free_slot;
+    auto const element = [&](int32_t d) -> value_type const& {
+      return d == 0 ? value : victims[d - 1];
+    };
+
+    // LCG seeded with the first candidate bucket of the key
+    auto rng         = static_cast<uint32_t>(*probing_scheme_(this->extract_key(value), extent));
+    auto next_random = [&rng]() {
+      rng = rng * 1664525u + 1013904223u;
+      return rng >> 8;
+    };
+
+    for (int32_t attempt = 0; attempt < max_attempts; ++attempt) {
+      auto depth = 0;
+      auto found = false;
+      while (not found) {
+        auto const current_key = this->extract_key(element(depth));
+
+        // Looks for a free slot in the windows of the current element, in probing order
+        size_type windows[probing_scheme_type::num_hashes];
+        auto num_windows    = 0;
+        auto probing_iter   = probing_scheme_(current_key, extent);
+        auto const init_idx = *probing_iter;
+        do {
+          windows[num_windows++] = *probing_iter;
+          for (auto offset = 0; offset < window_size and not found; ++offset) {
+            auto* const slot = slot_ptr(*probing_iter, offset);
+            free_slot        = *slot;
+            switch (this->predicate_.operator()<is_insert::YES>(current_key,
+                                                                this->extract_key(free_slot))) {
+              case detail::equal_result::AVAILABLE: {
+                pos[depth] = slot;
+                found      = true;
+                break;
+              }
+              case detail::equal_result::EQUAL: {
+                // The key has been inserted concurrently
+                if constexpr (not allows_duplicates) {
+                  if (depth == 0) { return false; }
+                }
+                break;
+              }
+              default: break;
+            }
+          }
+          ++probing_iter;
+        } while (not found and *probing_iter != init_idx);
+
+        if (found) { break; }
+        if (depth == max_depth) { break; }
+
+        // Evicts a random resident of a random window, except for the first victim which is fixed
+        // to serialize inserts of the same key. Walking back to the slot the current element comes
+        // from is a dead end, so the attempt is restarted instead.
+        auto* const slot = depth == 0
+                             ? slot_ptr(windows[0], 0)
+                             : slot_ptr(windows[next_random() % num_windows],
+                                        static_cast<int32_t>(next_random() % window_size));
+        if (depth > 0 and slot == pos[depth - 1]) { break; }
+
+        pos[depth]     = slot;
+        victims[depth] = *slot;
+        // The slot has been freed concurrently
+        if (this->predicate_.operator()<is_insert::YES>(
+              current_key, this->extract_key(victims[depth])) == detail::equal_result::AVAILABLE) {
+          free_slot = victims[depth];
+          found     = true;
+        } else {
+          ++depth;
+        }
+      }
+      if (not found) { continue; }
+
+      // Applies the moves backwards, starting with the one into the free slot
+      auto status = attempt_insert(pos[depth], free_slot, element(depth));
+      if (status != insert_result::SUCCESS) {
+        if (depth == 0 and status == insert_result::DUPLICATE) { return false; }
+        continue;
+      }
+      auto d = depth - 1;
+      for (; d >= 0; --d) {
+        if (attempt_insert_stable(pos[d], victims[d], element(d)) != insert_result::SUCCESS) {
+          // The victim has been moved or erased concurrently: drop the copy made by the previous
+          // move so that it does not show up twice
+          static_cast<void>(
+            attempt_insert_stable(pos[d + 1], victims[d], this->erased_slot_sentinel()));
+          break;
+        }
+      }
+      if (d < 0) { return true; }
+    }
+    return false;
+  }
+
+  /**
+   * @brief Gets the bucket where the probing sequence of a group starts.
+   *
+   * @note Displacement bounds of a cooperative group are tracked at the first bucket probed by its
+   * leading thread.
+   *
+   * @param group The Cooperative Group performing the operation
+   * @param init_idx Index of the first bucket probed by the current thread
+   *
+   * @return Index of the bucket holding the displacement bound of the group
+   */
+  [[nodiscard]] __device__ size_type home_bucket(
+    cooperative_groups::thread_block_tile<cg_size> const& group, size_type init_idx) const noexcept
+  {
+    if constexpr (is_bounded) {
+      return group.shfl(init_idx, 0);
+    } else {
+      return init_idx;
+    }
+  }
+
+  /**
+   * @brief Gets the largest displacement at which an element whose probing sequence starts at the
+   * given bucket can be found.
+   *
+   * @param home_idx Index of the bucket where probing starts
+   *
+   * @return The displacement bound, or the largest `int32_t` if lookups must run until an empty
+   * slot
+   */
+  [[nodiscard]] __host__ __device__ int32_t displacement_bound(size_type home_idx) const noexcept
+  {
+    if constexpr (is_bounded) {
+      auto const bound = storage_ref_.displacement_bound(home_idx);
+      if (bound != detail::unbounded_displacement) { return bound; }
+    }
+    return cuda::std::numeric_limits<int32_t>::max();
+  }
+
+  /**
+   * @brief Advances the displacement of a lookup by one step.
+   *
+   * @param displacement Number of probing steps taken so far, incremented in place
+   * @param bound Displacement bound of the lookup
+   *
+   * @return True if the lookup has probed past all elements sharing its starting bucket
+   */
+  [[nodiscard]] __host__ __device__ bool exceeds_bound(int32_t& displacement,
+                                                     int32_t bound) const noexcept
+  {
+    if constexpr (is_bounded) {
+      return ++displacement > bound;
+    } else {
+      return false;
+    }
+  }
+
+  /**
+   * @brief Records the displacement of a successful insertion.
+   *
+   * @param home_idx Index of the bucket where probing starts
+   * @param displacement Number of probing steps taken by the insertion
+   */
+  __host__ __device__ void record_displacement(size_type home_idx,
+                                               int32_t displacement) const noexcept
+  {
+    if constexpr (is_bounded) { storage_ref_.record_displacement(home_idx, displacement); }
+  }
+
+  /**
+   * @brief Creates the probing iterator of the given key.
+   *
+   * @note With stash storage, the probing sequence is cut after a bounded number of primary
+   * buckets and continues into the stash.
+   *
+   * @tparam ProbeKey Probe key type
+   *
+   * @param key The key to probe for
+   *
+   * @return Probing iterator of the key
+   */
+  template <typename ProbeKey>
+  [[nodiscard]] __host__ __device__ constexpr auto probing_iterator(
+    ProbeKey const& key) const noexcept
+  {
+    auto const primary = probing_scheme_(key, storage_ref_.bucket_extent());
+    if constexpr (is_stash) {
+      return storage_ref_.probing_iterator(primary, 0, 1);
+    } else {
+      return primary;
+    }
+  }
+
+  /**
+   * @brief Creates the probing iterator of the given key for the current thread of a group.
+   *
+   * @tparam ProbeKey Probe key type
+   *
+   * @param group The Cooperative Group performing the operation
+   * @param key The key to probe for
+   *
+   * @return Probing iterator of the key
+   */
+  template <typename ProbeKey>
+  [[nodiscard]] __device__ constexpr auto probing_iterator(
+    cooperative_groups::thread_block_tile<cg_size> const& group, ProbeKey const& key) const noexcept
+  {
+    auto const primary = probing_scheme_(group, key, storage_ref_.bucket_extent());
+    if constexpr (is_stash) {
+      static_assert(storage_ref_type::num_stash_buckets % cg_size == 0,
+                    "Stash buckets must be evenly distributed across the cooperative group.");
+      return storage_ref_.probing_iterator(primary, group.thread_rank(), cg_size);
+    } else {
+      return primary;
+    }
+  }
+
+  /**
+   * @brief Accounts for an element inserted into the given bucket in the stash usage counter.
+   *
+   * @param bucket_index Index of the bucket holding the inserted element
+   */
+  __host__ __device__ void record_stash_insert(size_type bucket_index) const noexcept
+  {
+    if constexpr (is_stash) { storage_ref_.record_insert(bucket_index); }
+  }
+
+  /**
+   * @brief Accounts for an element erased from the given bucket in the stash usage counter.
+   *
+   * @param bucket_index Index of the bucket that held the erased element
+   */
+  __host__ __device__ void record_stash_erase(size_type bucket_index) const noexcept
+  {
+    if constexpr (is_stash) { storage_ref_.record_erase(bucket_index); }
+  }
+
+  /**
+   * @brief Counts one occurrence of the given event in the device performance counters.
+   *
+   * @note This is a no-op unless the storage is `cuco::counted_storage`.
+   *
+   * @tparam Event Kind of the event to count
+   */
+  template <perf_event Event>
+  __host__ __device__ void count_event() const noexcept
+  {
+    if constexpr (is_counted) { storage_ref_.template record<Event>(); }
+  }
+
+  /**
+   * @brief Counts one occurrence of the given event on behalf of a cooperative group.
+   *
+   * @tparam Event Kind of the event to count
+   *
+   * @param group The Cooperative Group performing the operation
+   */
+  template <perf_event Event>
+  __device__ void count_event(
+    cooperative_groups::thread_block_tile<cg_size> const& group) const noexcept
+  {
+    if constexpr (is_counted) {
+      if (group.thread_rank() == 0) { storage_ref_.template record<Event>(); }
+    }
+  }
+
+  /**
+   * @brief Loads the bucket with the given index for probing.
+   *
+   * @note With struct of arrays storage, only the keys of the bucket are loaded.
+   *
+   * @param bucket_index Index of the bucket
+   *
+   * @return The slots of the bucket, or the keys thereof
+   */
+  [[nodiscard]] __host__ __device__ constexpr auto probe_bucket(
+    size_type bucket_index) const noexcept
+  {
+    if constexpr (is_soa) {
+      return storage_ref_.key_bucket(bucket_index);
+    } else {
+      return storage_ref_[bucket_index];
+    }
+  }
+
+  /**
+   * @brief Extracts the key from an element of a bucket loaded by `probe_bucket`.
+   *
+   * @tparam Slot Bucket element type
+   *
+   * @param slot The bucket element
+   *
+   * @return The key
+   */
+  template <typename Slot>
+  [[nodiscard]] __host__ __device__ constexpr auto const& probe_slot_key(
+    Slot const& slot) const noexcept
+  {
+    if constexpr (is_soa) {
+      return slot;
+    } else {
+      return this->extract_key(slot);
+    }
+  }
+
+  /**
+   * @brief Gets the address of the given slot.
+   *
+   * @param bucket_index Index of the bucket
+   * @param intra_bucket_index Index of the slot within the bucket
+   *
+   * @return Pointer to the slot, or an iterator holding pointers to the slot key and payload with
+   * struct of arrays storage
+   */
+  [[nodiscard]] __host__ __device__ constexpr auto slot_address(
+    size_type bucket_index, int32_t intra_bucket_index) const noexcept
+  {
+    if constexpr (is_soa) {
+      return storage_ref_.slot(bucket_index, intra_bucket_index);
+    } else {
+      return (storage_ref_.data() + bucket_index)->data() + intra_bucket_index;
+    }
+  }
+
+  /**
+   * @brief Extracts the key from a given value type.
+   *
+   * @tparam Value Input type which is convertible to 'value_type'
+   *
+   * @param value The input value
+   *
+   * @return The key
+   */
+  template <typename Value>
+  [[nodiscard]] __host__ __device__ constexpr auto const& extract_key(
+    Value const& value) const noexcept
+  {
+    if constexpr (this->has_payload) {
+      return thrust::raw_reference_cast(value).first;
+    } else {
+      return thrust::raw_reference_cast(value);
+    }
+  }
+
+  /**
+   * @brief Extracts the payload from a given value type.
+   *
+   * @note This function is only available if `this->has_payload == true`
+   *
+   * @tparam Value Input type which is convertible to 'value_type'
+   *
+   * @param value The input value
+   *
+   * @return The payload
+   */
+  template <typename Value, typename Enable = std::enable_if_t<has_payload and sizeof(Value)>>
+  [[nodiscard]] __host__ __device__ constexpr auto const& extract_payload(
+    Value const& value) const noexcept
+  {
+    return thrust::raw_reference_cast(value).second;
+  }
+
+  /**
+   * @brief Converts the given type to the container's native `value_type`.
+   *
+   * @tparam T Input type which is convertible to 'value_type'
+   *
+   * @param value The input value
+   *
+   * @return The converted object
+   */
+  template <typename T>
+  [[nodiscard]] __host__ __device__ constexpr value_type native_value(T const& value) const noexcept
+  {
+    if constexpr (this->has_payload) {
+      return {static_cast<key_type>(this->extract_key(value)), this->extract_payload(value)};
+    } else {
+      return static_cast<value_type>(value);
+    }
+  }
+
+  /**
+   * @brief Converts the given type to the container's native `value_type` while maintaining the
+   * heterogeneous key type.
+   *
+   * @tparam T Input type which is convertible to 'value_type'
+   *
+   * @param value The input value
+   *
+   * @return The converted object
+   */
+  template <typename T>
+  [[nodiscard]] __host__ __device__ constexpr auto heterogeneous_value(
+    T const& value) const noexcept
+  {
+    if constexpr (this->has_payload and not cuda::std::is_same_v<T, value_type>) {
+      using mapped_type = decltype(this->empty_value_sentinel());
+      if constexpr (cuco::detail::is_cuda_std_pair_like<T>::value) {
+        return cuco::pair{cuda::std::get<0>(value),
+                          static_cast<mapped_type>(cuda::std::get<1>(value))};
+      } else {
+        // hail mary (convert using .first/.second members)
+        return cuco::pair{thrust::raw_reference_cast(value.first),
+                          static_cast<mapped_type>(value.second)};
+      }
+    } else {
+      return thrust::raw_reference_cast(value);
+    }
+  }
+
+  /**
+   * @brief Gets the sentinel used to represent an erased slot.
+   *
+   * @return The sentinel value used to represent an erased slot
+   */
+  [[nodiscard]] __host__ __device__ constexpr value_type const erased_slot_sentinel() const noexcept
+  {
+    if constexpr (this->has_payload) {
+      return cuco::pair{this->erased_key_sentinel(), this->empty_value_sentinel()};
+    } else {
+      return this->erased_key_sentinel();
+    }
+  }
+
+  /**
+   * @brief Inserts the specified element with one single CAS operation.
+   *
+   * @tparam Value Input type which is convertible to 'value_type'
+   *
+   * @param address Pointer to the slot in memory
+   * @param expected Element to compare against
+   * @param desired Element to insert
+   *
+   * @return Result of this operation, i.e., success/continue/duplicate
+   */
+  template <typename Value>
+  [[nodiscard]] __host__ __device__ constexpr insert_result packed_cas(value_type* address,
+                                                                       value_type expected,
+                                                                       Value desired) noexcept
+  {
+    using packed_type = cuda::std::conditional_t<sizeof(value_type) == 4, uint32_t, uint64_t>;
+
+    auto* slot_ptr     = reinterpret_cast<packed_type*>(address);
+    auto* expected_ptr = reinterpret_cast<packed_type*>(&expected);
+    auto* desired_ptr  = reinterpret_cast<packed_type*>(&desired);
+
+    auto slot_ref = cuda::atomic_ref<packed_type, Scope>{*slot_ptr};
+
+    auto const success =
+      slot_ref.compare_exchange_strong(*expected_ptr, *desired_ptr, cuda::memory_order_relaxed);
+
+    if (success) {
+      return insert_result::SUCCESS;
+    } else {
+      this->count_event<perf_event::CAS_FAILURE>();
+      return this->predicate_.equal_to(this->extract_key(desired), this->extract_key(expected)) ==
+                 detail::equal_result::EQUAL
+               ? insert_result::DUPLICATE
+               : insert_result::CONTINUE;
+    }
+  }
+
+  /**
+   * @brief Inserts the specified element with two back-to-back CAS operations.
+   *
+   * @note This CAS can be used exclusively for `cuco::op::insert` operations.
+   *
+   * @tparam Value Input type which is convertible to 'value_type'
+   *
+   * @param address Pointer to the slot in memory
+   * @param expected Element to compare against
+   * @param desired Element to insert
+   *
+   * @return Result of this operation, i.e., success/continue/duplicate
+   */
+  template <typename Value>
+  [[nodiscard]] __host__ __device__ constexpr insert_result back_to_back_cas(
+    value_type* address, value_type const& expected, Value const& desired) noexcept
+  {
+    using mapped_type = cuda::std::decay_t<decltype(this->empty_value_sentinel())>;
+
+    auto expected_key     = expected.first;
+    auto expected_payload = this->empty_value_sentinel();
+
+    cuda::atomic_ref<key_type, Scope> key_ref(address->first);
     cuda::atomic_ref<mapped_type, Scope> payload_ref(address->second);
 
     auto const key_cas_success = key_ref.compare_exchange_strong(
@@ -1645,6 +2616,7 @@ class open_addressing_ref_impl {
     // if key success
     if (key_cas_success) {
       while (not payload_cas_success) {
+        this->count_event<perf_event::CAS_FAILURE>();
         payload_cas_success =
           payload_ref.compare_exchange_strong(expected_payload = this->empty_value_sentinel(),
                                               desired.second,
@@ -1655,6 +2627,7 @@ class open_addressing_ref_impl {
       // This is insert-specific, cannot for `erase` operations
       payload_ref.store(this->empty_value_sentinel(), cuda::memory_order_relaxed);
     }
+    this->count_event<perf_event::CAS_FAILURE>();
 
     // Our key was already present in the slot, so our key is a duplicate
     // Shouldn't use `predicate` operator directly since it includes a redundant bitwise compare
@@ -1677,7 +2650,7 @@ class open_addressing_ref_impl {
    * @return Result of this operation, i.e., success/continue/duplicate
    */
   template <typename Value>
-  [[nodiscard]] __device__ constexpr insert_result cas_dependent_write(
+  [[nodiscard]] __host__ __device__ constexpr insert_result cas_dependent_write(
     value_type* address, value_type const& expected, Value const& desired) noexcept
   {
     using mapped_type = cuda::std::decay_t<decltype(this->empty_value_sentinel())>;
@@ -1693,6 +2666,7 @@ class open_addressing_ref_impl {
       payload_ref.store(desired.second, cuda::memory_order_relaxed);
       return insert_result::SUCCESS;
     }
+    this->count_event<perf_event::CAS_FAILURE>();
 
     // Our key was already present in the slot, so our key is a duplicate
     // Shouldn't use `predicate` operator directly since it includes a redundant bitwise compare
@@ -1718,9 +2692,9 @@ class open_addressing_ref_impl {
    * @return Result of this operation, i.e., success/continue/duplicate
    */
   template <typename Value>
-  [[nodiscard]] __device__ insert_result attempt_insert(value_type* address,
-                                                        value_type const& expected,
-                                                        Value const& desired) noexcept
+  [[nodiscard]] __host__ __device__ insert_result attempt_insert(value_type* address,
+                                                                 value_type const& expected,
+                                                                 Value const& desired) noexcept
   {
     if constexpr (sizeof(value_type) <= 8) {
       return packed_cas(address, expected, desired);
@@ -1751,9 +2725,8 @@ class open_addressing_ref_impl {
    * @return Result of this operation, i.e., success/continue/duplicate
    */
   template <typename Value>
-  [[nodiscard]] __device__ insert_result attempt_insert_stable(value_type* address,
-                                                               value_type const& expected,
-                                                               Value const& desired) noexcept
+  [[nodiscard]] __host__ __device__ insert_result attempt_insert_stable(
+    value_type* address, value_type const& expected, Value const& desired) noexcept
   {
     if constexpr (sizeof(value_type) <= 8) {
       return packed_cas(address, expected, desired);
@@ -1762,6 +2735,68 @@ class open_addressing_ref_impl {
     }
   }
 
+  /**
+   * @brief Inserts the specified element into a struct of arrays slot with CAS-dependent write
+   * operations.
+   *
+   * @note The key is swapped in with a single CAS and the payload is written only if the CAS
+   * succeeds, so the same routine is used for stable and non-stable inserts as well as erasure.
+   *
+   * @tparam Value Input type which is convertible to 'value_type'
+   *
+   * @param address Iterator to the slot in memory
+   * @param expected Key to compare against
+   * @param desired Element to insert
+   *
+   * @return Result of this operation, i.e., success/continue/duplicate
+   */
+  template <typename Value>
+  [[nodiscard]] __device__ insert_result attempt_insert(iterator address,
+                                                        key_type const& expected,
+                                                        Value const& desired) noexcept
+  {
+    using mapped_type = cuda::std::decay_t<decltype(this->empty_value_sentinel())>;
+
+    cuda::atomic_ref<key_type, Scope> key_ref(*address.key());
+    auto expected_key  = expected;
+    auto const success = key_ref.compare_exchange_strong(
+      expected_key, static_cast<key_type>(desired.first), cuda::memory_order_relaxed);
+
+    // if key success
+    if (success) {
+      cuda::atomic_ref<mapped_type, Scope> payload_ref(*address.payload());
+      payload_ref.store(desired.second, cuda::memory_order_relaxed);
+      return insert_result::SUCCESS;
+    }
+
+    // Our key was already present in the slot, so our key is a duplicate
+    // Shouldn't use `predicate` operator directly since it includes a redundant bitwise compare
+    if (this->predicate_.equal_to(desired.first, expected_key) == detail::equal_result::EQUAL) {
+      return insert_result::DUPLICATE;
+    }
+
+    return insert_result::CONTINUE;
+  }
+
+  /**
+   * @brief Attempts to insert an element into a struct of arrays slot.
+   *
+   * @tparam Value Input type which is convertible to 'value_type'
+   *
+   * @param address Iterator to the slot in memory
+   * @param expected Key to compare against
+   * @param desired Element to insert
+   *
+   * @return Result of this operation, i.e., success/continue/duplicate
+   */
+  template <typename Value>
+  [[nodiscard]] __device__ insert_result attempt_insert_stable(iterator address,
+                                                               key_type const& expected,
+                                                               Value const& desired) noexcept
+  {
+    return this->attempt_insert(address, expected, desired);
+  }
+
   /**
    * @brief Waits until the slot payload has been updated
    *
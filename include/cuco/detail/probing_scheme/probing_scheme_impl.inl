@@ -19,6 +19,13 @@
 #include <cuco/detail/utils.cuh>
 #include <cuco/pair.cuh>
 
+#include <cuda/std/array>
+#include <cuda/std/tuple>
+#include <cuda/std/utility>
+
+#include <cstddef>
+#include <cstdint>
+
 namespace cuco {
 namespace detail {
 
@@ -85,6 +92,89 @@ class probing_iterator {
   size_type step_size_;
   extent_type upper_bound_;
 };
+
+/**
+ * @brief Probing iterator cycling through a fixed set of candidate buckets.
+ *
+ * @tparam Extent Type of Extent
+ * @tparam NumCandidates Maximum number of candidate buckets
+ */
+template <typename Extent, int32_t NumCandidates>
+class cuckoo_probing_iterator {
+ public:
+  using extent_type = Extent;                            ///< Extent type
+  using size_type   = typename extent_type::value_type;  ///< Size type
+
+  /**
+   * @brief Constructs a cuckoo probing iterator
+   *
+   * @note Repeated candidates are dropped so that iterating wraps around to the first candidate
+   * after each distinct candidate has been visited once.
+   *
+   * @param candidates Candidate bucket indices in probing order
+   */
+  __host__ __device__ explicit constexpr cuckoo_probing_iterator(
+    cuda::std::array<size_type, NumCandidates> const& candidates) noexcept
+    : candidates_{}, num_candidates_{0}, curr_{0}
+  {
+    for (auto const candidate : candidates) {
+      auto is_new = true;
+      for (int32_t i = 0; i < num_candidates_; ++i) {
+        is_new &= candidates_[i] != candidate;
+      }
+      if (is_new) { candidates_[num_candidates_++] = candidate; }
+    }
+  }
+
+  /**
+   * @brief Dereference operator
+   *
+   * @return Current slot index
+   */
+  __host__ __device__ constexpr auto operator*() const noexcept { return candidates_[curr_]; }
+
+  /**
+   * @brief Prefix increment operator
+   *
+   * @return Current iterator
+   */
+  __host__ __device__ constexpr auto operator++() noexcept
+  {
+    curr_ = (curr_ + 1 == num_candidates_) ? 0 : curr_ + 1;
+    return *this;
+  }
+
+  /**
+   * @brief Postfix increment operator
+   *
+   * @return Old iterator before increment
+   */
+  __host__ __device__ constexpr auto operator++(int32_t) noexcept
+  {
+    auto temp = *this;
+    ++(*this);
+    return temp;
+  }
+
+ private:
+  cuda::std::array<size_type, NumCandidates> candidates_;
+  int32_t num_candidates_;
+  int32_t curr_;
+};
+
+/**
+ * @brief Builds a tuple of hashers where the `I`-th hasher is constructed from the integer `I`.
+ *
+ * @tparam Tuple Hasher tuple type
+ * @tparam I Hasher indices
+ *
+ * @return Tuple of seeded hashers
+ */
+template <typename Tuple, std::size_t... I>
+__host__ __device__ constexpr Tuple make_seeded_hashers(cuda::std::index_sequence<I...>) noexcept
+{
+  return Tuple{cuda::std::tuple_element_t<I, Tuple>{static_cast<std::uint32_t>(I)}...};
+}
 }  // namespace detail
 
 template <int32_t CGSize, typename Hash>
@@ -168,11 +258,22 @@ __host__ __device__ constexpr auto double_hashing<CGSize, Hash1, Hash2>::operato
   ProbeKey const& probe_key, Extent upper_bound) const noexcept
 {
   using size_type = typename Extent::value_type;
-  return detail::probing_iterator<Extent>{
-    cuco::detail::sanitize_hash<size_type>(hash1_(probe_key)) % upper_bound,
-    cuco::detail::sanitize_hash<size_type>(hash2_(probe_key)) % (upper_bound - 1) +
-      1,  // step size in range [1, prime - 1]
-    upper_bound};
+  if constexpr (cuco::detail::is_multi_word_hash_v<decltype(hash1_(probe_key))>) {
+    // Start and step size are drawn from distinct words of a single hash value
+    auto const hash = hash1_(probe_key);
+    return detail::probing_iterator<Extent>{
+      cuco::detail::sanitize_hash<size_type>(hash) % upper_bound,
+      cuco::detail::sanitize_hash<size_type>(cuco::detail::hash_word<1>(hash)) %
+          (upper_bound - 1) +
+        1,  // step size in range [1, prime - 1]
+      upper_bound};
+  } else {
+    return detail::probing_iterator<Extent>{
+      cuco::detail::sanitize_hash<size_type>(hash1_(probe_key)) % upper_bound,
+      cuco::detail::sanitize_hash<size_type>(hash2_(probe_key)) % (upper_bound - 1) +
+        1,  // step size in range [1, prime - 1]
+      upper_bound};
+  }
 }
 
 template <int32_t CGSize, typename Hash1, typename Hash2>
@@ -183,13 +284,26 @@ __host__ __device__ constexpr auto double_hashing<CGSize, Hash1, Hash2>::operato
   Extent upper_bound) const noexcept
 {
   using size_type = typename Extent::value_type;
-  return detail::probing_iterator<Extent>{
-    cuco::detail::sanitize_hash<size_type>(g, hash1_(probe_key)) % upper_bound,
-    static_cast<size_type>(
-      (cuco::detail::sanitize_hash<size_type>(hash2_(probe_key)) % (upper_bound / cg_size - 1) +
-       1) *
-      cg_size),
-    upper_bound};  // TODO use fast_int operator
+  if constexpr (cuco::detail::is_multi_word_hash_v<decltype(hash1_(probe_key))>) {
+    // Start and step size are drawn from distinct words of a single hash value
+    auto const hash = hash1_(probe_key);
+    return detail::probing_iterator<Extent>{
+      cuco::detail::sanitize_hash<size_type>(g, hash) % upper_bound,
+      static_cast<size_type>(
+        (cuco::detail::sanitize_hash<size_type>(cuco::detail::hash_word<1>(hash)) %
+           (upper_bound / cg_size - 1) +
+         1) *
+        cg_size),
+      upper_bound};  // TODO use fast_int operator
+  } else {
+    return detail::probing_iterator<Extent>{
+      cuco::detail::sanitize_hash<size_type>(g, hash1_(probe_key)) % upper_bound,
+      static_cast<size_type>(
+        (cuco::detail::sanitize_hash<size_type>(hash2_(probe_key)) % (upper_bound / cg_size - 1) +
+         1) *
+        cg_size),
+      upper_bound};  // TODO use fast_int operator
+  }
 }
 
 template <int32_t CGSize, typename Hash1, typename Hash2>
@@ -199,4 +313,77 @@ double_hashing<CGSize, Hash1, Hash2>::hash_function() const noexcept
   return {hash1_, hash2_};
 }
 
+template <int32_t CGSize, typename Hash1, typename Hash2, typename... Hashes>
+__host__ __device__ constexpr cuckoo_probing<CGSize, Hash1, Hash2, Hashes...>::cuckoo_probing()
+  : hashes_{detail::make_seeded_hashers<hasher>(cuda::std::make_index_sequence<num_hashes>{})}
+{
+}
+
+template <int32_t CGSize, typename Hash1, typename Hash2, typename... Hashes>
+__host__ __device__ constexpr cuckoo_probing<CGSize, Hash1, Hash2, Hashes...>::cuckoo_probing(
+  Hash1 const& hash1, Hash2 const& hash2, Hashes const&... hashes)
+  : hashes_{hash1, hash2, hashes...}
+{
+}
+
+template <int32_t CGSize, typename Hash1, typename Hash2, typename... Hashes>
+__host__ __device__ constexpr cuckoo_probing<CGSize, Hash1, Hash2, Hashes...>::cuckoo_probing(
+  hasher const& hash)
+  : hashes_{hash}
+{
+}
+
+template <int32_t CGSize, typename Hash1, typename Hash2, typename... Hashes>
+template <typename... NewHashes>
+__host__ __device__ constexpr auto
+cuckoo_probing<CGSize, Hash1, Hash2, Hashes...>::rebind_hash_function(
+  cuda::std::tuple<NewHashes...> const& hash) const noexcept
+{
+  static_assert(sizeof...(NewHashes) >= 2, "Cuckoo probing requires at least two hashers");
+  return cuckoo_probing<cg_size, NewHashes...>{hash};
+}
+
+template <int32_t CGSize, typename Hash1, typename Hash2, typename... Hashes>
+template <typename ProbeKey, typename Extent>
+__host__ __device__ constexpr auto cuckoo_probing<CGSize, Hash1, Hash2, Hashes...>::operator()(
+  ProbeKey const& probe_key, Extent upper_bound) const noexcept
+{
+  using size_type       = typename Extent::value_type;
+  auto const candidates = cuda::std::apply(
+    [&](auto const&... hash) {
+      return cuda::std::array<size_type, num_hashes>{static_cast<size_type>(
+        cuco::detail::sanitize_hash<size_type>(hash(probe_key)) % upper_bound)...};
+    },
+    hashes_);
+  return detail::cuckoo_probing_iterator<Extent, num_hashes>{candidates};
+}
+
+template <int32_t CGSize, typename Hash1, typename Hash2, typename... Hashes>
+template <typename ProbeKey, typename Extent>
+__host__ __device__ constexpr auto cuckoo_probing<CGSize, Hash1, Hash2, Hashes...>::operator()(
+  cooperative_groups::thread_block_tile<cg_size> const& g,
+  ProbeKey const& probe_key,
+  Extent upper_bound) const noexcept
+{
+  using size_type = typename Extent::value_type;
+  // Offsets are applied after the modulo so that a window matches the scalar candidate bucket
+  // followed by its `cg_size - 1` successors, which is what displacement relies on
+  auto const rank       = static_cast<size_type>(g.thread_rank());
+  auto const candidates = cuda::std::apply(
+    [&](auto const&... hash) {
+      return cuda::std::array<size_type, num_hashes>{static_cast<size_type>(
+        (cuco::detail::sanitize_hash<size_type>(hash(probe_key)) % upper_bound + rank) %
+        upper_bound)...};
+    },
+    hashes_);
+  return detail::cuckoo_probing_iterator<Extent, num_hashes>{candidates};
+}
+
+template <int32_t CGSize, typename Hash1, typename Hash2, typename... Hashes>
+__host__ __device__ constexpr cuckoo_probing<CGSize, Hash1, Hash2, Hashes...>::hasher
+cuckoo_probing<CGSize, Hash1, Hash2, Hashes...>::hash_function() const noexcept
+{
+  return hashes_;
+}
+
 }  // namespace cuco
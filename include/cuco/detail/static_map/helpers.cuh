@@ -31,12 +31,14 @@ namespace cuco::detail::static_map_ns {
  * convertible to the `value_type` of the data structure
  * @tparam Init Type of init value convertible to payload type
  * @tparam Op Callable type used to peform `apply` operation.
+ * @tparam AtomicT Atomic counter type
  * @tparam Ref Type of non-owning device ref allowing access to storage
  *
  * @param first Beginning of the sequence of input elements
  * @param last End of the sequence of input elements
  * @param init The init value of the `op`
  * @param op Callable object to perform apply operation.
+ * @param size_counter Optional container size counter. Ignored if `nullptr`
  * @param ref Non-owning container device ref used to access the slot storage
  * @param stream CUDA stream used for insert_or_apply operation
  */
@@ -46,9 +48,15 @@ template <bool HasInit,
           typename InputIt,
           typename Init,
           typename Op,
+          typename AtomicT,
           typename Ref>
-void dispatch_insert_or_apply(
-  InputIt first, InputIt last, Init init, Op op, Ref ref, cuda::stream_ref stream)
+void dispatch_insert_or_apply(InputIt first,
+                              InputIt last,
+                              Init init,
+                              Op op,
+                              AtomicT* size_counter,
+                              Ref ref,
+                              cuda::stream_ref stream)
 {
   auto const num = cuco::detail::distance(first, last);
   if (num == 0) { return; }
@@ -85,6 +93,7 @@ void dispatch_insert_or_apply(
                                                               InputIt,
                                                               Init,
                                                               Op,
+                                                              AtomicT,
                                                               Ref>;
 
     int32_t const max_op_grid_size =
@@ -100,16 +109,16 @@ void dispatch_insert_or_apply(
     if (num_elements_per_thread > 2) {
       insert_or_apply_shmem<HasInit, CGSize, shmem_block_size, shared_map_ref_type>
         <<<shmem_grid_size, shmem_block_size, 0, stream.get()>>>(
-          first, num, init, op, ref, bucket_extent);
+          first, num, init, op, size_counter, ref, bucket_extent);
     } else {
       insert_or_apply<HasInit, CGSize, cuco::detail::default_block_size()>
         <<<default_grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
-          first, num, init, op, ref);
+          first, num, init, op, size_counter, ref);
     }
   } else {
     insert_or_apply<HasInit, CGSize, cuco::detail::default_block_size()>
       <<<default_grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
-        first, num, init, op, ref);
+        first, num, init, op, size_counter, ref);
   }
 }
 }  // namespace cuco::detail::static_map_ns
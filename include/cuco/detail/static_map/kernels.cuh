@@ -29,6 +29,32 @@
 namespace cuco::detail::static_map_ns {
 CUCO_SUPPRESS_KERNEL_WARNINGS
 
+/**
+ * @brief Adds the number of keys newly inserted by the calling block to the container size counter.
+ *
+ * @note All threads in the block must call this function. `size_counter` must be the same for all
+ * threads.
+ *
+ * @tparam BlockSize Number of threads in each block
+ * @tparam SizeType Size type
+ * @tparam AtomicT Atomic counter type
+ *
+ * @param thread_num_inserted Number of keys inserted by the calling thread
+ * @param size_counter Container size counter. Ignored if `nullptr`
+ */
+template <int32_t BlockSize, typename SizeType, typename AtomicT>
+__device__ void update_size_counter(SizeType thread_num_inserted, AtomicT* size_counter)
+{
+  if (size_counter == nullptr) { return; }
+
+  using BlockReduce = cub::BlockReduce<SizeType, BlockSize>;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+  auto const block_num_inserted = BlockReduce(temp_storage).Sum(thread_num_inserted);
+  if (threadIdx.x == 0) {
+    size_counter->fetch_add(block_num_inserted, cuda::std::memory_order_relaxed);
+  }
+}
+
 // TODO user insert_or_assign internally
 /**
  * @brief For any key-value pair `{k, v}` in the range `[first, first + n)`, if a key equivalent to
@@ -42,31 +68,42 @@ CUCO_SUPPRESS_KERNEL_WARNINGS
  * @tparam BlockSize Number of threads in each block
  * @tparam InputIt Device accessible input iterator whose `value_type` is
  * convertible to the `value_type` of the data structure
+ * @tparam AtomicT Atomic counter type
  * @tparam Ref Type of non-owning device ref allowing access to storage
  *
  * @param first Beginning of the sequence of input elements
  * @param n Number of input elements
+ * @param size_counter Optional container size counter incremented by the number of newly inserted
+ * keys. Ignored if `nullptr`
  * @param ref Non-owning container device ref used to access the slot storage
  */
-template <int32_t CGSize, int32_t BlockSize, typename InputIt, typename Ref>
+template <int32_t CGSize, int32_t BlockSize, typename InputIt, typename AtomicT, typename Ref>
 CUCO_KERNEL __launch_bounds__(BlockSize) void insert_or_assign(InputIt first,
                                                                cuco::detail::index_type n,
+                                                               AtomicT* size_counter,
                                                                Ref ref)
 {
-  auto const loop_stride = cuco::detail::grid_stride() / CGSize;
-  auto idx               = cuco::detail::global_thread_id() / CGSize;
+  using size_type = typename Ref::size_type;
+
+  auto const loop_stride        = cuco::detail::grid_stride() / CGSize;
+  auto idx                      = cuco::detail::global_thread_id() / CGSize;
+  size_type thread_num_inserted = 0;
 
   while (idx < n) {
     typename std::iterator_traits<InputIt>::value_type const& insert_pair = *(first + idx);
     if constexpr (CGSize == 1) {
-      ref.insert_or_assign(insert_pair);
+      if (ref.insert_or_assign(insert_pair)) { thread_num_inserted++; }
     } else {
       auto const tile =
         cooperative_groups::tiled_partition<CGSize>(cooperative_groups::this_thread_block());
-      ref.insert_or_assign(tile, insert_pair);
+      if (ref.insert_or_assign(tile, insert_pair) and tile.thread_rank() == 0) {
+        thread_num_inserted++;
+      }
     }
     idx += loop_stride;
   }
+
+  update_size_counter<BlockSize>(thread_num_inserted, size_counter);
 }
 
 /**
@@ -88,12 +125,15 @@ CUCO_KERNEL __launch_bounds__(BlockSize) void insert_or_assign(InputIt first,
  * convertible to the `value_type` of the data structure
  * @tparam Init Type of init value convertible to payload type
  * @tparam Op Callable type used to peform `apply` operation.
+ * @tparam AtomicT Atomic counter type
  * @tparam Ref Type of non-owning device ref allowing access to storage
  *
  * @param first Beginning of the sequence of input elements
  * @param n Number of input elements
  * @param init The init value of the op
  * @param op Callable object to perform apply operation.
+ * @param size_counter Optional container size counter incremented by the number of newly inserted
+ * keys. Ignored if `nullptr`
  * @param ref Non-owning container device ref used to access the slot storage
  */
 template <bool HasInit,
@@ -102,33 +142,46 @@ template <bool HasInit,
           typename InputIt,
           typename Init,
           typename Op,
+          typename AtomicT,
           typename Ref>
-__global__ void insert_or_apply(
-  InputIt first, cuco::detail::index_type n, [[maybe_unused]] Init init, Op op, Ref ref)
+__global__ void insert_or_apply(InputIt first,
+                                cuco::detail::index_type n,
+                                [[maybe_unused]] Init init,
+                                Op op,
+                                AtomicT* size_counter,
+                                Ref ref)
 {
-  auto const loop_stride = cuco::detail::grid_stride() / CGSize;
-  auto idx               = cuco::detail::global_thread_id() / CGSize;
+  using size_type = typename Ref::size_type;
+
+  auto const loop_stride        = cuco::detail::grid_stride() / CGSize;
+  auto idx                      = cuco::detail::global_thread_id() / CGSize;
+  size_type thread_num_inserted = 0;
 
   while (idx < n) {
     using value_type              = typename std::iterator_traits<InputIt>::value_type;
     value_type const& insert_pair = *(first + idx);
     if constexpr (CGSize == 1) {
       if constexpr (HasInit) {
-        ref.insert_or_apply(insert_pair, init, op);
+        thread_num_inserted += ref.insert_or_apply(insert_pair, init, op);
       } else {
-        ref.insert_or_apply(insert_pair, op);
+        thread_num_inserted += ref.insert_or_apply(insert_pair, op);
       }
     } else {
       auto const tile =
         cooperative_groups::tiled_partition<CGSize>(cooperative_groups::this_thread_block());
-      if constexpr (HasInit) {
-        ref.insert_or_apply(tile, insert_pair, init, op);
-      } else {
-        ref.insert_or_apply(tile, insert_pair, op);
-      }
+      auto const inserted = [&]() {
+        if constexpr (HasInit) {
+          return ref.insert_or_apply(tile, insert_pair, init, op);
+        } else {
+          return ref.insert_or_apply(tile, insert_pair, op);
+        }
+      }();
+      if (inserted and tile.thread_rank() == 0) { thread_num_inserted++; }
     }
     idx += loop_stride;
   }
+
+  update_size_counter<BlockSize>(thread_num_inserted, size_counter);
 }
 
 /**
@@ -151,12 +204,15 @@ __global__ void insert_or_apply(
  * convertible to the `value_type` of the data structure
  * @tparam Init Type of init value convertible to payload type
  * @tparam Op Callable type used to peform `apply` operation.
+ * @tparam AtomicT Atomic counter type
  * @tparam Ref Type of non-owning device ref allowing access to storage
  *
  * @param first Beginning of the sequence of input elements
  * @param n Number of input elements
  * @param init The init value of the op
  * @param op Callable object to perform apply operation.
+ * @param size_counter Optional container size counter incremented by the number of newly inserted
+ * keys. Ignored if `nullptr`
  * @param ref Non-owning container device ref used to access the slot storage
  * @param bucket_extent Bucket Extent used for shared memory map slot storage
  */
@@ -167,12 +223,14 @@ template <bool HasInit,
           class InputIt,
           class Init,
           class Op,
+          class AtomicT,
           class Ref>
 CUCO_KERNEL __launch_bounds__(BlockSize) void insert_or_apply_shmem(
   InputIt first,
   cuco::detail::index_type n,
   [[maybe_unused]] Init init,
   Op op,
+  AtomicT* size_counter,
   Ref ref,
   typename SharedMapRefType::extent_type bucket_extent)
 {
@@ -233,15 +291,18 @@ CUCO_KERNEL __launch_bounds__(BlockSize) void insert_or_apply_shmem(
     idx += loop_stride;
   }
 
+  using size_type               = typename Ref::size_type;
+  size_type thread_num_inserted = 0;
+
   // insert-or-apply from shared map to global map
   auto bucket_idx = thread_idx;
   while (bucket_idx < num_buckets) {
     auto const slot = storage[bucket_idx][0];
     if (not cuco::detail::bitwise_compare(slot.first, ref.empty_key_sentinel())) {
       if constexpr (HasInit) {
-        ref.insert_or_apply(slot, init, op);
+        thread_num_inserted += ref.insert_or_apply(slot, init, op);
       } else {
-        ref.insert_or_apply(slot, op);
+        thread_num_inserted += ref.insert_or_apply(slot, op);
       }
     }
     bucket_idx += BlockSize;
@@ -254,12 +315,14 @@ CUCO_KERNEL __launch_bounds__(BlockSize) void insert_or_apply_shmem(
     while (idx < n) {
       value_type const& insert_pair = *(first + idx);
       if constexpr (HasInit) {
-        ref.insert_or_apply(insert_pair, init, op);
+        thread_num_inserted += ref.insert_or_apply(insert_pair, init, op);
       } else {
-        ref.insert_or_apply(insert_pair, op);
+        thread_num_inserted += ref.insert_or_apply(insert_pair, op);
       }
       idx += loop_stride;
     }
   }
+
+  update_size_counter<BlockSize>(thread_num_inserted, size_counter);
 }
 }  // namespace cuco::detail::static_map_ns
@@ -145,6 +145,20 @@ void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Stora
   impl_->clear_async(stream);
 }
 
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::prefetch_async(
+  int location, cuda::stream_ref stream) const
+{
+  impl_->prefetch_async(location, stream);
+}
+
 template <class Key,
           class T,
           class Extent,
@@ -158,7 +172,29 @@ static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
 static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::insert(
   InputIt first, InputIt last, cuda::stream_ref stream)
 {
-  return impl_->insert(first, last, ref(op::insert), stream);
+  impl_->rehash_step_async(*this, stream);
+  return this->visit_ref(ref(op::insert), [&](auto const& container_ref) {
+    return impl_->insert(first, last, container_ref, stream);
+  });
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt>
+static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size_type
+static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::insert_from_host(
+  InputIt first, InputIt last, std::size_t chunk_size, int32_t num_stages, cuda::stream_ref stream)
+{
+  impl_->rehash_step_async(*this, stream);
+  return this->visit_ref(ref(op::insert), [&](auto const& container_ref) {
+    return impl_->insert_from_host(first, last, container_ref, chunk_size, num_stages, stream);
+  });
 }
 
 template <class Key,
@@ -171,9 +207,12 @@ template <class Key,
           class Storage>
 template <typename InputIt>
 void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::insert_async(
-  InputIt first, InputIt last, cuda::stream_ref stream) noexcept
+  InputIt first, InputIt last, cuda::stream_ref stream)
 {
-  impl_->insert_async(first, last, ref(op::insert), stream);
+  impl_->rehash_step_async(*this, stream);
+  this->visit_ref(ref(op::insert), [&](auto const& container_ref) {
+    impl_->insert_async(first, last, container_ref, stream);
+  });
 }
 
 template <class Key,
@@ -212,10 +251,27 @@ void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Stora
                         InsertedIt inserted_begin,
                         cuda::stream_ref stream) noexcept
 {
+  impl_->rehash_finish_async(*this, stream);
   impl_->insert_and_find_async(
     first, last, found_begin, inserted_begin, ref(op::insert_and_find), stream);
 }
 
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename OutputIt>
+OutputIt static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::try_insert(
+  InputIt first, InputIt last, OutputIt unplaced_begin, cuda::stream_ref stream)
+{
+  impl_->rehash_finish_async(*this, stream);
+  return impl_->try_insert(first, last, unplaced_begin, ref(op::insert_and_find), stream);
+}
+
 template <class Key,
           class T,
           class Extent,
@@ -229,7 +285,10 @@ static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
 static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::insert_if(
   InputIt first, InputIt last, StencilIt stencil, Predicate pred, cuda::stream_ref stream)
 {
-  return impl_->insert_if(first, last, stencil, pred, ref(op::insert), stream);
+  impl_->rehash_step_async(*this, stream);
+  return this->visit_ref(ref(op::insert), [&](auto const& container_ref) {
+    return impl_->insert_if(first, last, stencil, pred, container_ref, stream);
+  });
 }
 
 template <class Key,
@@ -246,9 +305,12 @@ void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Stora
                   InputIt last,
                   StencilIt stencil,
                   Predicate pred,
-                  cuda::stream_ref stream) noexcept
+                  cuda::stream_ref stream)
 {
-  impl_->insert_if_async(first, last, stencil, pred, ref(op::insert), stream);
+  impl_->rehash_step_async(*this, stream);
+  this->visit_ref(ref(op::insert), [&](auto const& container_ref) {
+    impl_->insert_if_async(first, last, stencil, pred, container_ref, stream);
+  });
 }
 
 template <class Key,
@@ -279,6 +341,11 @@ template <typename InputIt>
 void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
   insert_or_assign_async(InputIt first, InputIt last, cuda::stream_ref stream) noexcept
 {
+  static_assert(not impl_type::is_host_backend,
+                "insert_or_assign is not supported by the host backend.");
+
+  impl_->rehash_finish_async(*this, stream);
+
   auto const num = cuco::detail::distance(first, last);
   if (num == 0) { return; }
 
@@ -286,7 +353,7 @@ void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Stora
 
   detail::static_map_ns::insert_or_assign<cg_size, cuco::detail::default_block_size()>
     <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
-      first, num, ref(op::insert_or_assign));
+      first, num, impl_->size_counter(), ref(op::insert_or_assign));
 }
 
 template <class Key,
@@ -333,10 +400,15 @@ template <typename InputIt, typename Op>
 void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
   insert_or_apply_async(InputIt first, InputIt last, Op op, cuda::stream_ref stream) noexcept
 {
+  static_assert(not impl_type::is_host_backend,
+                "insert_or_apply is not supported by the host backend.");
+
+  impl_->rehash_finish_async(*this, stream);
+
   auto constexpr has_init = false;
   auto const init = this->empty_value_sentinel();  // use empty_sentinel as unused init value
   detail::static_map_ns::dispatch_insert_or_apply<has_init, cg_size, Allocator>(
-    first, last, init, op, ref(op::insert_or_apply), stream);
+    first, last, init, op, impl_->size_counter(), ref(op::insert_or_apply), stream);
 }
 
 template <class Key,
@@ -352,9 +424,14 @@ void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Stora
   insert_or_apply_async(
     InputIt first, InputIt last, Init init, Op op, cuda::stream_ref stream) noexcept
 {
+  static_assert(not impl_type::is_host_backend,
+                "insert_or_apply is not supported by the host backend.");
+
+  impl_->rehash_finish_async(*this, stream);
+
   auto constexpr has_init = true;
   detail::static_map_ns::dispatch_insert_or_apply<has_init, cg_size, Allocator>(
-    first, last, init, op, ref(op::insert_or_apply), stream);
+    first, last, init, op, impl_->size_counter(), ref(op::insert_or_apply), stream);
 }
 
 template <class Key,
@@ -370,7 +447,7 @@ void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Stora
   InputIt first, InputIt last, cuda::stream_ref stream)
 {
   erase_async(first, last, stream);
-  stream.wait();
+  impl_->wait(stream);
 }
 
 template <class Key,
@@ -385,7 +462,10 @@ template <typename InputIt>
 void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::erase_async(
   InputIt first, InputIt last, cuda::stream_ref stream)
 {
-  impl_->erase_async(first, last, ref(op::erase), stream);
+  impl_->rehash_step_async(*this, stream);
+  this->visit_ref(ref(op::erase), [&](auto const& container_ref) {
+    impl_->erase_async(first, last, container_ref, stream);
+  });
 }
 
 template <class Key,
@@ -401,7 +481,7 @@ void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Stora
   InputIt first, InputIt last, OutputIt output_begin, cuda::stream_ref stream) const
 {
   contains_async(first, last, output_begin, stream);
-  stream.wait();
+  impl_->wait(stream);
 }
 
 template <class Key,
@@ -414,9 +494,11 @@ template <class Key,
           class Storage>
 template <typename InputIt, typename OutputIt>
 void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::contains_async(
-  InputIt first, InputIt last, OutputIt output_begin, cuda::stream_ref stream) const noexcept
+  InputIt first, InputIt last, OutputIt output_begin, cuda::stream_ref stream) const
 {
-  impl_->contains_async(first, last, output_begin, ref(op::contains), stream);
+  this->visit_ref(ref(op::contains), [&](auto const& container_ref) {
+    impl_->contains_async(first, last, output_begin, container_ref, stream);
+  });
 }
 
 template <class Key,
@@ -437,7 +519,7 @@ void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Stora
   cuda::stream_ref stream) const
 {
   contains_if_async(first, last, stencil, pred, output_begin, stream);
-  stream.wait();
+  impl_->wait(stream);
 }
 
 template <class Key,
@@ -455,9 +537,11 @@ void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Stora
                     StencilIt stencil,
                     Predicate pred,
                     OutputIt output_begin,
-                    cuda::stream_ref stream) const noexcept
+                    cuda::stream_ref stream) const
 {
-  impl_->contains_if_async(first, last, stencil, pred, output_begin, ref(op::contains), stream);
+  this->visit_ref(ref(op::contains), [&](auto const& container_ref) {
+    impl_->contains_if_async(first, last, stencil, pred, output_begin, container_ref, stream);
+  });
 }
 
 template <class Key,
@@ -473,7 +557,7 @@ void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Stora
   InputIt first, InputIt last, OutputIt output_begin, cuda::stream_ref stream) const
 {
   find_async(first, last, output_begin, stream);
-  stream.wait();
+  impl_->wait(stream);
 }
 
 template <class Key,
@@ -488,7 +572,9 @@ template <typename InputIt, typename OutputIt>
 void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::find_async(
   InputIt first, InputIt last, OutputIt output_begin, cuda::stream_ref stream) const
 {
-  impl_->find_async(first, last, output_begin, ref(op::find), stream);
+  this->visit_ref(ref(op::find), [&](auto const& container_ref) {
+    impl_->find_async(first, last, output_begin, container_ref, stream);
+  });
 }
 
 template <class Key,
@@ -509,7 +595,7 @@ void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Stora
   cuda::stream_ref stream) const
 {
   this->find_if_async(first, last, stencil, pred, output_begin, stream);
-  stream.wait();
+  impl_->wait(stream);
 }
 
 template <class Key,
@@ -529,7 +615,9 @@ void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Stora
   OutputIt output_begin,
   cuda::stream_ref stream) const
 {
-  impl_->find_if_async(first, last, stencil, pred, output_begin, ref(op::find), stream);
+  this->visit_ref(ref(op::find), [&](auto const& container_ref) {
+    impl_->find_if_async(first, last, stencil, pred, output_begin, container_ref, stream);
+  });
 }
 
 template <class Key,
@@ -609,7 +697,45 @@ static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
 static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::count(
   InputIt first, InputIt last, cuda::stream_ref stream) const
 {
-  return impl_->count(first, last, ref(op::count), stream);
+  return this->visit_ref(ref(op::count), [&](auto const& container_ref) {
+    return impl_->count(first, last, container_ref, stream);
+  });
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt>
+void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::count_async(
+  InputIt first, InputIt last, size_type* output, cuda::stream_ref stream) const
+{
+  this->visit_ref(ref(op::count), [&](auto const& container_ref) {
+    impl_->count_async(first, last, output, container_ref, stream);
+  });
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt>
+static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::async_size_type
+static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::count_async(
+  InputIt first, InputIt last, cuda::stream_ref stream) const
+{
+  auto result = async_size_type{};
+  this->count_async(first, last, result.data(), stream);
+  result.record(stream);
+  return result;
 }
 
 template <class Key,
@@ -632,6 +758,50 @@ static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
   return impl_->retrieve(first, last, output_probe, output_match, this->ref(op::retrieve), stream);
 }
 
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename OutputProbeIt, typename OutputMatchIt>
+void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::retrieve_async(
+  InputIt first,
+  InputIt last,
+  OutputProbeIt output_probe,
+  OutputMatchIt output_match,
+  size_type* num_retrieved,
+  cuda::stream_ref stream) const
+{
+  impl_->retrieve_async(
+    first, last, output_probe, output_match, num_retrieved, this->ref(op::retrieve), stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename OutputProbeIt, typename OutputMatchIt>
+static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::async_size_type
+static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::retrieve_async(
+  InputIt first,
+  InputIt last,
+  OutputProbeIt output_probe,
+  OutputMatchIt output_match,
+  cuda::stream_ref stream) const
+{
+  auto result = async_size_type{};
+  this->retrieve_async(first, last, output_probe, output_match, result.data(), stream);
+  result.record(stream);
+  return result;
+}
+
 template <class Key,
           class T,
           class Extent,
@@ -652,6 +822,44 @@ static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
   return std::make_pair(keys_out + num, values_out + num);
 }
 
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename KeyOut, typename ValueOut>
+void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  retrieve_all_async(KeyOut keys_out,
+                     ValueOut values_out,
+                     size_type* num_out,
+                     cuda::stream_ref stream) const
+{
+  auto const zipped_out_begin = thrust::make_zip_iterator(thrust::make_tuple(keys_out, values_out));
+  impl_->retrieve_all_async(zipped_out_begin, num_out, stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename KeyOut, typename ValueOut>
+static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::async_size_type
+static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::retrieve_all_async(
+  KeyOut keys_out, ValueOut values_out, cuda::stream_ref stream) const
+{
+  auto result = async_size_type{};
+  this->retrieve_all_async(keys_out, values_out, result.data(), stream);
+  result.record(stream);
+  return result;
+}
+
 template <class Key,
           class T,
           class Extent,
@@ -710,6 +918,163 @@ void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Stora
   this->impl_->rehash_async(extent, *this, stream);
 }
 
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  rehash_incremental_async(size_type capacity, size_type buckets_per_step, cuda::stream_ref stream)
+{
+  auto const extent = make_bucket_extent<static_map>(capacity);
+  this->impl_->rehash_incremental_async(extent, buckets_per_step, *this, stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  rehash_step_async(cuda::stream_ref stream)
+{
+  this->impl_->rehash_step_async(*this, stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  rehash_finish_async(cuda::stream_ref stream)
+{
+  this->impl_->rehash_finish_async(*this, stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+bool static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::is_rehashing()
+  const noexcept
+{
+  return impl_->is_rehashing();
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  purge_tombstones(cuda::stream_ref stream)
+{
+  impl_->purge_tombstones(stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  purge_tombstones_async(cuda::stream_ref stream)
+{
+  impl_->purge_tombstones_async(stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+bool static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  purge_tombstones_if(double max_tombstone_ratio, cuda::stream_ref stream)
+{
+  return impl_->purge_tombstones_if(max_tombstone_ratio, stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size_type
+static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::tombstone_count(
+  cuda::stream_ref stream) const
+{
+  return impl_->tombstone_count(stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::statistics_type
+static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::statistics(
+  cuda::stream_ref stream) const
+{
+  return impl_->statistics(stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::save(
+  std::string const& path, cuda::stream_ref stream) const
+{
+  impl_->save(path, persisted_kind::static_map, stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::load(
+  std::string const& path, cuda::stream_ref stream)
+{
+  impl_->load(path, persisted_kind::static_map, stream);
+}
+
 template <class Key,
           class T,
           class Extent,
@@ -725,6 +1090,153 @@ static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
   return impl_->size(stream);
 }
 
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size_async(
+  size_type* output, cuda::stream_ref stream) const
+{
+  impl_->size_async(output, stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::async_size_type
+static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size_async(
+  cuda::stream_ref stream) const
+{
+  auto result = async_size_type{};
+  this->size_async(result.data(), stream);
+  result.record(stream);
+  return result;
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size_type
+static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::stash_size(
+  cuda::stream_ref stream) const
+{
+  return impl_->stash_size(stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::perf_counters_type
+static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::perf_counters(
+  cuda::stream_ref stream) const
+{
+  return impl_->perf_counters(stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  reset_perf_counters(cuda::stream_ref stream)
+{
+  impl_->reset_perf_counters_async(stream);
+  stream.wait();
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  enable_size_tracking(cuda::stream_ref stream)
+{
+  impl_->enable_size_tracking(stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  set_input_partitioning(int32_t partition_bits)
+{
+  impl_->set_input_partitioning(partition_bits);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+int32_t static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  input_partition_bits() const noexcept
+{
+  return impl_->input_partition_bits();
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  set_input_deduplication(bool enabled) noexcept
+{
+  impl_->set_input_deduplication(enabled);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+bool static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  input_deduplication() const noexcept
+{
+  return impl_->input_deduplication();
+}
+
 template <class Key,
           class T,
           class Extent,
@@ -844,4 +1356,21 @@ auto static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Stora
                                     cuda_thread_scope<Scope>{},
                                     impl_->storage_ref()};
 }
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename Ref, typename Func>
+decltype(auto) static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  visit_ref(Ref const& container_ref, Func&& func) const
+{
+  return impl_->visit_ref(container_ref,
+                          this->ref(op::contains, op::find, op::erase, op::count),
+                          std::forward<Func>(func));
+}
 }  // namespace cuco
@@ -16,9 +16,12 @@
 
 #pragma once
 
+#include <cuco/bounded_bucket_storage.cuh>
 #include <cuco/detail/bitwise_compare.cuh>
 #include <cuco/detail/equal_wrapper.cuh>
 #include <cuco/operator.hpp>
+#include <cuco/stash_bucket_storage.cuh>
+#include <cuco/tagged_bucket_storage.cuh>
 
 #include <cuda/atomic>
 #include <cuda/std/type_traits>
@@ -356,6 +359,26 @@ static_map_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>
                                       this->storage_ref()};
 }
 
+template <typename Key,
+          typename T,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+__host__ __device__ constexpr auto
+static_map_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>::
+  rebind_storage_ref(StorageRef storage_ref) const noexcept
+{
+  return static_map_ref{cuco::empty_key<Key>{this->empty_key_sentinel()},
+                        cuco::empty_value<T>{this->empty_value_sentinel()},
+                        cuco::erased_key<Key>{this->erased_key_sentinel()},
+                        this->key_eq(),
+                        this->probing_scheme(),
+                        {},
+                        storage_ref};
+}
+
 template <typename Key,
           typename T,
           cuda::thread_scope Scope,
@@ -428,7 +451,7 @@ class operator_impl<
    * @return True if the given element is successfully inserted
    */
   template <typename Value>
-  __device__ bool insert(Value const& value) noexcept
+  __host__ __device__ bool insert(Value const& value) noexcept
   {
     ref_type& ref_ = static_cast<ref_type&>(*this);
     return ref_.impl_.insert(value);
@@ -480,10 +503,19 @@ class operator_impl<
    * @tparam Value Input type which is convertible to 'value_type'
    *
    * @param value The element to insert
+   *
+   * @return Returns `true` if the given `value` is inserted and `false` if it is assigned to an
+   * existing key
    */
   template <typename Value>
-  __device__ void insert_or_assign(Value const& value) noexcept
+  __device__ bool insert_or_assign(Value const& value) noexcept
   {
+    static_assert(not cuco::detail::is_tagged_storage_ref_v<StorageRef>,
+                  "insert_or_assign is not supported with tagged storage.");
+    static_assert(not cuco::detail::is_bounded_storage_ref_v<StorageRef>,
+                  "insert_or_assign is not supported with bounded storage.");
+    static_assert(not cuco::detail::is_stash_storage_ref_v<StorageRef>,
+                  "insert_or_assign is not supported with stash storage.");
     static_assert(cg_size == 1, "Non-CG operation is incompatible with the current probing scheme");
 
     ref_type& ref_ = static_cast<ref_type&>(*this);
@@ -508,14 +540,18 @@ class operator_impl<
         if (eq_res == detail::equal_result::EQUAL) {
           cuda::atomic_ref<mapped_type, Scope> payload_ref(slot_ptr->second);
           payload_ref.store(val.second, cuda::memory_order_relaxed);
-          return;
+          return false;
         }
         if (eq_res == detail::equal_result::AVAILABLE) {
-          if (attempt_insert_or_assign(slot_ptr, val)) { return; }
+          switch (attempt_insert_or_assign(slot_ptr, val)) {
+            case insert_result::SUCCESS: return true;
+            case insert_result::DUPLICATE: return false;
+            default: continue;
+          }
         }
       }
       ++probing_iter;
-      if (*probing_iter == init_idx) { return; }
+      if (*probing_iter == init_idx) { return false; }
     }
   }
 
@@ -529,11 +565,20 @@ class operator_impl<
    *
    * @param group The Cooperative Group used to perform group insert
    * @param value The element to insert
+   *
+   * @return Returns `true` if the given `value` is inserted and `false` if it is assigned to an
+   * existing key
    */
   template <typename Value>
-  __device__ void insert_or_assign(cooperative_groups::thread_block_tile<cg_size> const& group,
+  __device__ bool insert_or_assign(cooperative_groups::thread_block_tile<cg_size> const& group,
                                    Value const& value) noexcept
   {
+    static_assert(not cuco::detail::is_tagged_storage_ref_v<StorageRef>,
+                  "insert_or_assign is not supported with tagged storage.");
+    static_assert(not cuco::detail::is_bounded_storage_ref_v<StorageRef>,
+                  "insert_or_assign is not supported with bounded storage.");
+    static_assert(not cuco::detail::is_stash_storage_ref_v<StorageRef>,
+                  "insert_or_assign is not supported with stash storage.");
     ref_type& ref_ = static_cast<ref_type&>(*this);
 
     auto const val       = ref_.impl_.heterogeneous_value(value);
@@ -568,20 +613,25 @@ class operator_impl<
           payload_ref.store(val.second, cuda::memory_order_relaxed);
         }
         group.sync();
-        return;
+        return false;
       }
 
       auto const group_contains_available = group.ballot(state == detail::equal_result::AVAILABLE);
       if (group_contains_available) {
         auto const src_lane = __ffs(group_contains_available) - 1;
-        auto const status =
-          (group.thread_rank() == src_lane) ? attempt_insert_or_assign(slot_ptr, val) : false;
+        auto const status   = (group.thread_rank() == src_lane)
+                                ? attempt_insert_or_assign(slot_ptr, val)
+                                : insert_result::CONTINUE;
 
         // Exit if inserted or assigned
-        if (group.shfl(status, src_lane)) { return; }
+        switch (group.shfl(status, src_lane)) {
+          case insert_result::SUCCESS: return true;
+          case insert_result::DUPLICATE: return false;
+          default: continue;
+        }
       } else {
         ++probing_iter;
-        if (*probing_iter == init_idx) { return; }
+        if (*probing_iter == init_idx) { return false; }
       }
     }
   }
@@ -599,10 +649,12 @@ class operator_impl<
    * @param group The Cooperative Group used to perform group insert
    * @param value The element to insert
    *
-   * @return Returns `true` if the given `value` is inserted or `value` has a match in the map.
+   * @return `SUCCESS` if the given `value` is inserted, `DUPLICATE` if `value` has a match in the
+   * map and its payload is assigned, `CONTINUE` otherwise.
    */
   template <typename Value>
-  __device__ constexpr bool attempt_insert_or_assign(value_type* slot, Value const& value) noexcept
+  __device__ constexpr insert_result attempt_insert_or_assign(value_type* slot,
+                                                              Value const& value) noexcept
   {
     ref_type& ref_    = static_cast<ref_type&>(*this);
     auto expected_key = ref_.impl_.empty_slot_sentinel().first;
@@ -612,14 +664,16 @@ class operator_impl<
       expected_key, static_cast<key_type>(value.first), cuda::memory_order_relaxed);
 
     // if key success or key was already present in the map
-    if (success or (ref_.impl_.predicate().equal_to(value.first, expected_key) ==
-                    detail::equal_result::EQUAL)) {
+    auto const duplicate =
+      not success and (ref_.impl_.predicate().equal_to(value.first, expected_key) ==
+                       detail::equal_result::EQUAL);
+    if (success or duplicate) {
       // Update payload
       cuda::atomic_ref<mapped_type, Scope> payload_ref(slot->second);
       payload_ref.store(value.second, cuda::memory_order_relaxed);
-      return true;
+      return success ? insert_result::SUCCESS : insert_result::DUPLICATE;
     }
-    return false;
+    return insert_result::CONTINUE;
   }
 };
 
@@ -852,6 +906,12 @@ class operator_impl<
   template <bool UseDirectApply, typename Value, typename Op>
   __device__ bool insert_or_apply_impl(Value const& value, Op op)
   {
+    static_assert(not cuco::detail::is_tagged_storage_ref_v<StorageRef>,
+                  "insert_or_apply is not supported with tagged storage.");
+    static_assert(not cuco::detail::is_bounded_storage_ref_v<StorageRef>,
+                  "insert_or_apply is not supported with bounded storage.");
+    static_assert(not cuco::detail::is_stash_storage_ref_v<StorageRef>,
+                  "insert_or_apply is not supported with stash storage.");
     ref_type& ref_ = static_cast<ref_type&>(*this);
 
     auto const val         = ref_.impl_.heterogeneous_value(value);
@@ -928,6 +988,12 @@ class operator_impl<
                                        Value const& value,
                                        Op op)
   {
+    static_assert(not cuco::detail::is_tagged_storage_ref_v<StorageRef>,
+                  "insert_or_apply is not supported with tagged storage.");
+    static_assert(not cuco::detail::is_bounded_storage_ref_v<StorageRef>,
+                  "insert_or_apply is not supported with bounded storage.");
+    static_assert(not cuco::detail::is_stash_storage_ref_v<StorageRef>,
+                  "insert_or_apply is not supported with stash storage.");
     ref_type& ref_ = static_cast<ref_type&>(*this);
 
     auto const val         = ref_.impl_.heterogeneous_value(value);
@@ -1155,7 +1221,7 @@ class operator_impl<
    * @return True if the given element is successfully erased
    */
   template <typename ProbeKey>
-  __device__ bool erase(ProbeKey const& key) noexcept
+  __host__ __device__ bool erase(ProbeKey const& key) noexcept
   {
     ref_type& ref_ = static_cast<ref_type&>(*this);
     return ref_.impl_.erase(key);
@@ -1212,7 +1278,7 @@ class operator_impl<
    * @return A boolean indicating whether the probe key is present
    */
   template <typename ProbeKey>
-  [[nodiscard]] __device__ bool contains(ProbeKey const& key) const noexcept
+  [[nodiscard]] __host__ __device__ bool contains(ProbeKey const& key) const noexcept
   {
     // CRTP: cast `this` to the actual ref type
     auto const& ref_ = static_cast<ref_type const&>(*this);
@@ -1275,7 +1341,7 @@ class operator_impl<
    * @return An iterator to the position at which the equivalent key is stored
    */
   template <typename ProbeKey>
-  [[nodiscard]] __device__ const_iterator find(ProbeKey const& key) const noexcept
+  [[nodiscard]] __host__ __device__ const_iterator find(ProbeKey const& key) const noexcept
   {
     // CRTP: cast `this` to the actual ref type
     auto const& ref_ = static_cast<ref_type const&>(*this);
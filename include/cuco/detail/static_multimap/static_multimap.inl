@@ -169,7 +169,7 @@ template <class Key,
           class Storage>
 template <typename InputIt>
 void static_multimap<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
-  insert_async(InputIt first, InputIt last, cuda::stream_ref stream) noexcept
+  insert_async(InputIt first, InputIt last, cuda::stream_ref stream)
 {
   impl_->insert_async(first, last, ref(op::insert), stream);
 }
@@ -204,7 +204,7 @@ void static_multimap<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator,
                   InputIt last,
                   StencilIt stencil,
                   Predicate pred,
-                  cuda::stream_ref stream) noexcept
+                  cuda::stream_ref stream)
 {
   impl_->insert_if_async(first, last, stencil, pred, ref(op::insert), stream);
 }
@@ -238,7 +238,7 @@ void static_multimap<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator,
   contains_async(InputIt first,
                  InputIt last,
                  OutputIt output_begin,
-                 cuda::stream_ref stream) const noexcept
+                 cuda::stream_ref stream) const
 {
   impl_->contains_async(first, last, output_begin, ref(op::contains), stream);
 }
@@ -279,7 +279,7 @@ void static_multimap<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator,
                     StencilIt stencil,
                     Predicate pred,
                     OutputIt output_begin,
-                    cuda::stream_ref stream) const noexcept
+                    cuda::stream_ref stream) const
 {
   impl_->contains_if_async(first, last, stencil, pred, output_begin, ref(op::contains), stream);
 }
@@ -439,6 +439,40 @@ static_multimap<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Stora
   return impl_->count(first, last, ref(op::count), stream);
 }
 
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt>
+void static_multimap<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  count_async(InputIt first, InputIt last, size_type* output, cuda::stream_ref stream) const
+{
+  impl_->count_async(first, last, output, ref(op::count), stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt>
+static_multimap<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::async_size_type
+static_multimap<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::count_async(
+  InputIt first, InputIt last, cuda::stream_ref stream) const
+{
+  auto result = async_size_type{};
+  this->count_async(first, last, result.data(), stream);
+  result.record(stream);
+  return result;
+}
+
 template <class Key,
           class T,
           class Extent,
@@ -459,6 +493,50 @@ static_multimap<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Stora
   return impl_->retrieve(first, last, output_probe, output_match, this->ref(op::retrieve), stream);
 }
 
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename OutputProbeIt, typename OutputMatchIt>
+void static_multimap<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  retrieve_async(InputIt first,
+                 InputIt last,
+                 OutputProbeIt output_probe,
+                 OutputMatchIt output_match,
+                 size_type* num_retrieved,
+                 cuda::stream_ref stream) const
+{
+  impl_->retrieve_async(
+    first, last, output_probe, output_match, num_retrieved, this->ref(op::retrieve), stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename OutputProbeIt, typename OutputMatchIt>
+static_multimap<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::async_size_type
+static_multimap<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::retrieve_async(
+  InputIt first,
+  InputIt last,
+  OutputProbeIt output_probe,
+  OutputMatchIt output_match,
+  cuda::stream_ref stream) const
+{
+  auto result = async_size_type{};
+  this->retrieve_async(first, last, output_probe, output_match, result.data(), stream);
+  result.record(stream);
+  return result;
+}
+
 template <class Key,
           class T,
           class Extent,
@@ -479,6 +557,44 @@ static_multimap<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Stora
   return std::make_pair(keys_out + num, values_out + num);
 }
 
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename KeyOut, typename ValueOut>
+void static_multimap<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  retrieve_all_async(KeyOut keys_out,
+                     ValueOut values_out,
+                     size_type* num_out,
+                     cuda::stream_ref stream) const
+{
+  auto const zipped_out_begin = thrust::make_zip_iterator(thrust::make_tuple(keys_out, values_out));
+  impl_->retrieve_all_async(zipped_out_begin, num_out, stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename KeyOut, typename ValueOut>
+static_multimap<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::async_size_type
+static_multimap<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  retrieve_all_async(KeyOut keys_out, ValueOut values_out, cuda::stream_ref stream) const
+{
+  auto result = async_size_type{};
+  this->retrieve_all_async(keys_out, values_out, result.data(), stream);
+  result.record(stream);
+  return result;
+}
+
 template <class Key,
           class T,
           class Extent,
@@ -552,6 +668,63 @@ static_multimap<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Stora
   return impl_->size(stream);
 }
 
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_multimap<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  enable_size_tracking(cuda::stream_ref stream)
+{
+  impl_->enable_size_tracking(stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+static_multimap<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::statistics_type
+static_multimap<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::statistics(
+  cuda::stream_ref stream) const
+{
+  return impl_->statistics(stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_multimap<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::save(
+  std::string const& path, cuda::stream_ref stream) const
+{
+  impl_->save(path, persisted_kind::static_multimap, stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_multimap<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::load(
+  std::string const& path, cuda::stream_ref stream)
+{
+  impl_->load(path, persisted_kind::static_multimap, stream);
+}
+
 template <class Key,
           class T,
           class Extent,
@@ -127,7 +127,7 @@ void static_multiset<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Sto
   InputIt first, InputIt last, cuda::stream_ref stream)
 {
   this->insert_async(first, last, stream);
-  stream.wait();
+  impl_->wait(stream);
 }
 
 template <class Key,
@@ -139,7 +139,7 @@ template <class Key,
           class Storage>
 template <typename InputIt>
 void static_multiset<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::insert_async(
-  InputIt first, InputIt last, cuda::stream_ref stream) noexcept
+  InputIt first, InputIt last, cuda::stream_ref stream)
 {
   impl_->insert_async(first, last, ref(op::insert), stream);
 }
@@ -172,7 +172,7 @@ void static_multiset<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Sto
                   InputIt last,
                   StencilIt stencil,
                   Predicate pred,
-                  cuda::stream_ref stream) noexcept
+                  cuda::stream_ref stream)
 {
   impl_->insert_if_async(first, last, stencil, pred, ref(op::insert), stream);
 }
@@ -189,7 +189,7 @@ void static_multiset<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Sto
   InputIt first, InputIt last, OutputIt output_begin, cuda::stream_ref stream) const
 {
   this->contains_async(first, last, output_begin, stream);
-  stream.wait();
+  impl_->wait(stream);
 }
 
 template <class Key,
@@ -204,7 +204,7 @@ void static_multiset<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Sto
   contains_async(InputIt first,
                  InputIt last,
                  OutputIt output_begin,
-                 cuda::stream_ref stream) const noexcept
+                 cuda::stream_ref stream) const
 {
   impl_->contains_async(first, last, output_begin, ref(op::contains), stream);
 }
@@ -226,7 +226,7 @@ void static_multiset<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Sto
   cuda::stream_ref stream) const
 {
   this->contains_if_async(first, last, stencil, pred, output_begin, stream);
-  stream.wait();
+  impl_->wait(stream);
 }
 
 template <class Key,
@@ -243,7 +243,7 @@ void static_multiset<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Sto
                     StencilIt stencil,
                     Predicate pred,
                     OutputIt output_begin,
-                    cuda::stream_ref stream) const noexcept
+                    cuda::stream_ref stream) const
 {
   impl_->contains_if_async(first, last, stencil, pred, output_begin, ref(op::contains), stream);
 }
@@ -260,7 +260,7 @@ void static_multiset<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Sto
   InputIt first, InputIt last, OutputIt output_begin, cuda::stream_ref stream) const
 {
   find_async(first, last, output_begin, stream);
-  stream.wait();
+  impl_->wait(stream);
 }
 
 template <class Key,
@@ -294,7 +294,7 @@ void static_multiset<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Sto
   cuda::stream_ref stream) const
 {
   this->find_if_async(first, last, stencil, pred, output_begin, stream);
-  stream.wait();
+  impl_->wait(stream);
 }
 
 template <class Key,
@@ -394,6 +394,38 @@ static_multiset<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>
   return impl_->count(first, last, ref(op::count), stream);
 }
 
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt>
+void static_multiset<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::count_async(
+  InputIt first, InputIt last, size_type* output, cuda::stream_ref stream) const
+{
+  impl_->count_async(first, last, output, ref(op::count), stream);
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt>
+static_multiset<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::async_size_type
+static_multiset<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::count_async(
+  InputIt first, InputIt last, cuda::stream_ref stream) const
+{
+  auto result = async_size_type{};
+  this->count_async(first, last, result.data(), stream);
+  result.record(stream);
+  return result;
+}
+
 template <class Key,
           class Extent,
           cuda::thread_scope Scope,
@@ -459,6 +491,48 @@ static_multiset<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>
   return impl_->retrieve(first, last, output_probe, output_match, this->ref(op::retrieve), stream);
 }
 
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <class InputProbeIt, class OutputProbeIt, class OutputMatchIt>
+void static_multiset<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  retrieve_async(InputProbeIt first,
+                 InputProbeIt last,
+                 OutputProbeIt output_probe,
+                 OutputMatchIt output_match,
+                 size_type* num_retrieved,
+                 cuda::stream_ref stream) const
+{
+  impl_->retrieve_async(
+    first, last, output_probe, output_match, num_retrieved, this->ref(op::retrieve), stream);
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <class InputProbeIt, class OutputProbeIt, class OutputMatchIt>
+static_multiset<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::async_size_type
+static_multiset<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::retrieve_async(
+  InputProbeIt first,
+  InputProbeIt last,
+  OutputProbeIt output_probe,
+  OutputMatchIt output_match,
+  cuda::stream_ref stream) const
+{
+  auto result = async_size_type{};
+  this->retrieve_async(first, last, output_probe, output_match, result.data(), stream);
+  result.record(stream);
+  return result;
+}
+
 template <class Key,
           class Extent,
           cuda::thread_scope Scope,
@@ -528,6 +602,38 @@ static_multiset<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>
   return impl_->retrieve_all(output_begin, stream);
 }
 
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename OutputIt>
+void static_multiset<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  retrieve_all_async(OutputIt output_begin, size_type* num_out, cuda::stream_ref stream) const
+{
+  impl_->retrieve_all_async(output_begin, num_out, stream);
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename OutputIt>
+static_multiset<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::async_size_type
+static_multiset<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  retrieve_all_async(OutputIt output_begin, cuda::stream_ref stream) const
+{
+  auto result = async_size_type{};
+  this->retrieve_all_async(output_begin, result.data(), stream);
+  result.record(stream);
+  return result;
+}
+
 template <class Key,
           class Extent,
           cuda::thread_scope Scope,
@@ -596,6 +702,85 @@ static_multiset<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>
   return impl_->size(stream);
 }
 
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_multiset<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  enable_size_tracking(cuda::stream_ref stream)
+{
+  impl_->enable_size_tracking(stream);
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+static_multiset<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::statistics_type
+static_multiset<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::statistics(
+  cuda::stream_ref stream) const
+{
+  return impl_->statistics(stream);
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_multiset<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::save(
+  std::string const& path, cuda::stream_ref stream) const
+{
+  impl_->save(path, persisted_kind::static_multiset, stream);
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_multiset<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::load(
+  std::string const& path, cuda::stream_ref stream)
+{
+  impl_->load(path, persisted_kind::static_multiset, stream);
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_multiset<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  set_input_deduplication(bool enabled) noexcept
+{
+  impl_->set_input_deduplication(enabled);
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+bool static_multiset<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  input_deduplication() const noexcept
+{
+  return impl_->input_deduplication();
+}
+
 template <class Key,
           class Extent,
           cuda::thread_scope Scope,
@@ -0,0 +1,281 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cuco/detail/utility/cuda.cuh>
+
+#include <cub/block/block_reduce.cuh>
+#include <cuda/atomic>
+
+#include <cooperative_groups.h>
+
+#include <iterator>
+
+namespace cuco::detail::static_payload_map_ns {
+CUCO_SUPPRESS_KERNEL_WARNINGS
+
+/**
+ * @brief Computes the flat slot index of the slot pointed to by `iter`.
+ *
+ * The flat slot index is also the index of the corresponding payload in the payload array.
+ *
+ * @tparam Ref Type of non-owning device container ref allowing access to storage
+ * @tparam Iterator Slot iterator type
+ *
+ * @param ref Non-owning container device ref used to access the slot storage
+ * @param iter Iterator to a slot
+ *
+ * @return The flat slot index
+ */
+template <typename Ref, typename Iterator>
+__device__ constexpr typename Ref::size_type slot_index(Ref const& ref, Iterator iter) noexcept
+{
+  auto const* const slots =
+    reinterpret_cast<typename Ref::value_type const*>(ref.storage_ref().data());
+  return static_cast<typename Ref::size_type>(&(*iter) - slots);
+}
+
+/**
+ * @brief Inserts all keys in the range `[first, first + n)` and stores the payloads of newly
+ * inserted keys in the payload array.
+ *
+ * @tparam CGSize Number of threads in each CG
+ * @tparam BlockSize Number of threads in each block
+ * @tparam InputIt Device accessible input iterator whose `value_type` is convertible to the
+ * container's `key_type`
+ * @tparam PayloadIt Device accessible input iterator whose `value_type` is convertible to the
+ * payload type
+ * @tparam Payload Payload type
+ * @tparam AtomicT Atomic counter type
+ * @tparam Ref Type of non-owning device container ref allowing access to storage
+ *
+ * @param first Beginning of the sequence of keys
+ * @param n Number of input keys
+ * @param payload_begin Beginning of the sequence of payloads
+ * @param payloads Payload array parallel to the slot storage
+ * @param num_successes Number of successful inserted keys. Ignored if `nullptr`
+ * @param ref Non-owning container device ref used to access the slot storage
+ */
+template <int32_t CGSize,
+          int32_t BlockSize,
+          typename InputIt,
+          typename PayloadIt,
+          typename Payload,
+          typename AtomicT,
+          typename Ref>
+CUCO_KERNEL __launch_bounds__(BlockSize) void insert(InputIt first,
+                                                     cuco::detail::index_type n,
+                                                     PayloadIt payload_begin,
+                                                     Payload* payloads,
+                                                     AtomicT* num_successes,
+                                                     Ref ref)
+{
+  using size_type   = typename Ref::size_type;
+  using BlockReduce = cub::BlockReduce<size_type, BlockSize>;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+  size_type thread_num_successes = 0;
+
+  auto const loop_stride = cuco::detail::grid_stride() / CGSize;
+  auto idx               = cuco::detail::global_thread_id() / CGSize;
+
+  while (idx < n) {
+    typename std::iterator_traits<InputIt>::value_type const& key = *(first + idx);
+    if constexpr (CGSize == 1) {
+      auto const [iter, inserted] = ref.insert_and_find(key);
+      if (inserted) {
+        payloads[slot_index(ref, iter)] = *(payload_begin + idx);
+        thread_num_successes++;
+      }
+    } else {
+      auto const tile =
+        cooperative_groups::tiled_partition<CGSize>(cooperative_groups::this_thread_block());
+      auto const [iter, inserted] = ref.insert_and_find(tile, key);
+      if (tile.thread_rank() == 0 and inserted) {
+        payloads[slot_index(ref, iter)] = *(payload_begin + idx);
+        thread_num_successes++;
+      }
+    }
+    idx += loop_stride;
+  }
+
+  if (num_successes != nullptr) {
+    // compute number of successfully inserted elements for each block
+    // and atomically add to the grand total
+    auto const block_num_successes = BlockReduce(temp_storage).Sum(thread_num_successes);
+    if (threadIdx.x == 0) {
+      num_successes->fetch_add(block_num_successes, cuda::std::memory_order_relaxed);
+    }
+  }
+}
+
+/**
+ * @brief For each key in the range `[first, first + n)`, inserts the key if absent and applies
+ * `op` to its stored payload and the corresponding input payload.
+ *
+ * @tparam CGSize Number of threads in each CG
+ * @tparam BlockSize Number of threads in each block
+ * @tparam InputIt Device accessible input iterator whose `value_type` is convertible to the
+ * container's `key_type`
+ * @tparam PayloadIt Device accessible input iterator
+ * @tparam Payload Payload type
+ * @tparam Op Callable type used to combine payloads
+ * @tparam Ref Type of non-owning device container ref allowing access to storage
+ *
+ * @param first Beginning of the sequence of keys
+ * @param n Number of input keys
+ * @param payload_begin Beginning of the sequence of payloads
+ * @param payloads Payload array parallel to the slot storage
+ * @param op Callable used to combine payloads
+ * @param ref Non-owning container device ref used to access the slot storage
+ */
+template <int32_t CGSize,
+          int32_t BlockSize,
+          typename InputIt,
+          typename PayloadIt,
+          typename Payload,
+          typename Op,
+          typename Ref>
+CUCO_KERNEL __launch_bounds__(BlockSize) void insert_or_apply(InputIt first,
+                                                              cuco::detail::index_type n,
+                                                              PayloadIt payload_begin,
+                                                              Payload* payloads,
+                                                              Op op,
+                                                              Ref ref)
+{
+  auto const loop_stride = cuco::detail::grid_stride() / CGSize;
+  auto idx               = cuco::detail::global_thread_id() / CGSize;
+
+  while (idx < n) {
+    typename std::iterator_traits<InputIt>::value_type const& key = *(first + idx);
+    if constexpr (CGSize == 1) {
+      auto const iter = ref.insert_and_find(key).first;
+      op(payloads[slot_index(ref, iter)], *(payload_begin + idx));
+    } else {
+      auto const tile =
+        cooperative_groups::tiled_partition<CGSize>(cooperative_groups::this_thread_block());
+      auto const iter = ref.insert_and_find(tile, key).first;
+      if (tile.thread_rank() == 0) { op(payloads[slot_index(ref, iter)], *(payload_begin + idx)); }
+    }
+    idx += loop_stride;
+  }
+}
+
+/**
+ * @brief Finds the payloads of all keys in the range `[first, first + n)`.
+ *
+ * @note If the key `*(first + i)` has a match in the container, copies its payload to
+ * `(output_begin + i)`. Else, copies `empty_value_sentinel`.
+ *
+ * @tparam CGSize Number of threads in each CG
+ * @tparam BlockSize Number of threads in each block
+ * @tparam InputIt Device accessible input iterator
+ * @tparam OutputIt Device accessible output iterator assignable from the payload type
+ * @tparam Payload Payload type
+ * @tparam Ref Type of non-owning device container ref allowing access to storage
+ *
+ * @param first Beginning of the sequence of keys
+ * @param n Number of input keys
+ * @param output_begin Beginning of the sequence of payloads retrieved for each key
+ * @param payloads Payload array parallel to the slot storage
+ * @param empty_value_sentinel Payload written for keys without a match
+ * @param ref Non-owning container device ref used to access the slot storage
+ */
+template <int32_t CGSize,
+          int32_t BlockSize,
+          typename InputIt,
+          typename OutputIt,
+          typename Payload,
+          typename Ref>
+CUCO_KERNEL __launch_bounds__(BlockSize) void find(InputIt first,
+                                                   cuco::detail::index_type n,
+                                                   OutputIt output_begin,
+                                                   Payload const* payloads,
+                                                   Payload empty_value_sentinel,
+                                                   Ref ref)
+{
+  auto const loop_stride = cuco::detail::grid_stride() / CGSize;
+  auto idx               = cuco::detail::global_thread_id() / CGSize;
+
+  auto const output = [&](auto found) {
+    return found == ref.end() ? empty_value_sentinel : payloads[slot_index(ref, found)];
+  };
+
+  while (idx < n) {
+    typename std::iterator_traits<InputIt>::value_type const& key = *(first + idx);
+    if constexpr (CGSize == 1) {
+      *(output_begin + idx) = output(ref.find(key));
+    } else {
+      auto const tile =
+        cooperative_groups::tiled_partition<CGSize>(cooperative_groups::this_thread_block());
+      auto const found = ref.find(tile, key);
+      if (tile.thread_rank() == 0) { *(output_begin + idx) = output(found); }
+    }
+    idx += loop_stride;
+  }
+}
+
+/**
+ * @brief Erases all keys in the range `[first, first + n)` and resets their payloads to
+ * `empty_value_sentinel`.
+ *
+ * @note Payloads are reset so that a key reinserted into the same slot by `insert_or_apply` starts
+ * from `empty_value_sentinel` again.
+ *
+ * @tparam CGSize Number of threads in each CG
+ * @tparam BlockSize Number of threads in each block
+ * @tparam InputIt Device accessible input iterator whose `value_type` is convertible to the
+ * container's `key_type`
+ * @tparam Payload Payload type
+ * @tparam Ref Type of non-owning device container ref allowing access to storage
+ *
+ * @param first Beginning of the sequence of keys
+ * @param n Number of input keys
+ * @param payloads Payload array parallel to the slot storage
+ * @param empty_value_sentinel Payload written to the slots of erased keys
+ * @param ref Non-owning container device ref used to access the slot storage
+ */
+template <int32_t CGSize, int32_t BlockSize, typename InputIt, typename Payload, typename Ref>
+CUCO_KERNEL __launch_bounds__(BlockSize) void erase(InputIt first,
+                                                    cuco::detail::index_type n,
+                                                    Payload* payloads,
+                                                    Payload empty_value_sentinel,
+                                                    Ref ref)
+{
+  auto const loop_stride = cuco::detail::grid_stride() / CGSize;
+  auto idx               = cuco::detail::global_thread_id() / CGSize;
+
+  while (idx < n) {
+    typename std::iterator_traits<InputIt>::value_type const& key = *(first + idx);
+    if constexpr (CGSize == 1) {
+      auto const found = ref.find(key);
+      if (found != ref.end()) {
+        payloads[slot_index(ref, found)] = empty_value_sentinel;
+        ref.erase(key);
+      }
+    } else {
+      auto const tile =
+        cooperative_groups::tiled_partition<CGSize>(cooperative_groups::this_thread_block());
+      auto const found = ref.find(tile, key);
+      if (found != ref.end()) {
+        if (tile.thread_rank() == 0) { payloads[slot_index(ref, found)] = empty_value_sentinel; }
+        ref.erase(tile, key);
+      }
+    }
+    idx += loop_stride;
+  }
+}
+
+}  // namespace cuco::detail::static_payload_map_ns
@@ -0,0 +1,559 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/error.hpp>
+#include <cuco/detail/open_addressing/functors.cuh>
+#include <cuco/detail/static_payload_map/kernels.cuh>
+#include <cuco/detail/storage/counter_storage.cuh>
+#include <cuco/detail/utility/cuda.hpp>
+#include <cuco/detail/utils.hpp>
+#include <cuco/operator.hpp>
+
+#include <cub/device/device_select.cuh>
+#include <cuda/atomic>
+#include <thrust/execution_policy.h>
+#include <thrust/fill.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace cuco {
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+constexpr static_payload_map<Key,
+                             T,
+                             Extent,
+                             Scope,
+                             KeyEqual,
+                             ProbingScheme,
+                             Allocator,
+                             Storage>::static_payload_map(Extent capacity,
+                                                          empty_key<Key> empty_key_sentinel,
+                                                          empty_value<T> empty_value_sentinel,
+                                                          KeyEqual const& pred,
+                                                          ProbingScheme const& probing_scheme,
+                                                          cuda_thread_scope<Scope> scope,
+                                                          Storage storage,
+                                                          Allocator const& alloc,
+                                                          cuda::stream_ref stream)
+  : keys_{capacity, empty_key_sentinel, pred, probing_scheme, scope, storage, alloc, stream},
+    empty_value_sentinel_{empty_value_sentinel},
+    payload_allocator_{alloc},
+    payloads_{payload_allocator_.allocate(keys_.capacity()),
+              payload_deleter_type{static_cast<size_type>(keys_.capacity()), payload_allocator_}}
+{
+  thrust::fill_n(thrust::cuda::par_nosync.on(stream.get()),
+                 payloads_.get(),
+                 keys_.capacity(),
+                 empty_value_sentinel_);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+constexpr static_payload_map<Key,
+                             T,
+                             Extent,
+                             Scope,
+                             KeyEqual,
+                             ProbingScheme,
+                             Allocator,
+                             Storage>::static_payload_map(Extent capacity,
+                                                          empty_key<Key> empty_key_sentinel,
+                                                          empty_value<T> empty_value_sentinel,
+                                                          erased_key<Key> erased_key_sentinel,
+                                                          KeyEqual const& pred,
+                                                          ProbingScheme const& probing_scheme,
+                                                          cuda_thread_scope<Scope> scope,
+                                                          Storage storage,
+                                                          Allocator const& alloc,
+                                                          cuda::stream_ref stream)
+  : keys_{capacity,
+          empty_key_sentinel,
+          erased_key_sentinel,
+          pred,
+          probing_scheme,
+          scope,
+          storage,
+          alloc,
+          stream},
+    empty_value_sentinel_{empty_value_sentinel},
+    payload_allocator_{alloc},
+    payloads_{payload_allocator_.allocate(keys_.capacity()),
+              payload_deleter_type{static_cast<size_type>(keys_.capacity()), payload_allocator_}}
+{
+  thrust::fill_n(thrust::cuda::par_nosync.on(stream.get()),
+                 payloads_.get(),
+                 keys_.capacity(),
+                 empty_value_sentinel_);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_payload_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::clear(
+  cuda::stream_ref stream)
+{
+  this->clear_async(stream);
+  stream.wait();
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_payload_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  clear_async(cuda::stream_ref stream) noexcept
+{
+  keys_.clear_async(stream);
+  thrust::fill_n(thrust::cuda::par_nosync.on(stream.get()),
+                 payloads_.get(),
+                 keys_.capacity(),
+                 empty_value_sentinel_);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename PayloadIt>
+static_payload_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size_type
+static_payload_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::insert(
+  InputIt first, InputIt last, PayloadIt payload_begin, cuda::stream_ref stream)
+{
+  auto const num_keys = cuco::detail::distance(first, last);
+  if (num_keys == 0) { return 0; }
+
+  auto counter = detail::counter_storage<size_type, thread_scope, payload_allocator_type>{
+    detail::with_stream(payload_allocator_, stream)};
+  counter.reset(stream);
+
+  auto const grid_size = cuco::detail::grid_size(num_keys, cg_size);
+
+  detail::static_payload_map_ns::insert<cg_size, cuco::detail::default_block_size()>
+    <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+      first,
+      num_keys,
+      payload_begin,
+      payloads_.get(),
+      counter.data(),
+      keys_.ref(op::insert_and_find));
+
+  return counter.load_to_host(stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename PayloadIt>
+void static_payload_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  insert_async(InputIt first,
+               InputIt last,
+               PayloadIt payload_begin,
+               cuda::stream_ref stream) noexcept
+{
+  auto const num_keys = cuco::detail::distance(first, last);
+  if (num_keys == 0) { return; }
+
+  auto const grid_size = cuco::detail::grid_size(num_keys, cg_size);
+
+  detail::static_payload_map_ns::insert<cg_size, cuco::detail::default_block_size()>
+    <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+      first,
+      num_keys,
+      payload_begin,
+      payloads_.get(),
+      static_cast<cuda::atomic<size_type, thread_scope>*>(nullptr),
+      keys_.ref(op::insert_and_find));
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename PayloadIt, typename Op>
+void static_payload_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  insert_or_apply(
+    InputIt first, InputIt last, PayloadIt payload_begin, Op op, cuda::stream_ref stream)
+{
+  this->insert_or_apply_async(first, last, payload_begin, op, stream);
+  stream.wait();
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename PayloadIt, typename Op>
+void static_payload_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  insert_or_apply_async(InputIt first,
+                        InputIt last,
+                        PayloadIt payload_begin,
+                        Op op,
+                        cuda::stream_ref stream) noexcept
+{
+  auto const num_keys = cuco::detail::distance(first, last);
+  if (num_keys == 0) { return; }
+
+  auto const grid_size = cuco::detail::grid_size(num_keys, cg_size);
+
+  detail::static_payload_map_ns::insert_or_apply<cg_size, cuco::detail::default_block_size()>
+    <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+      first, num_keys, payload_begin, payloads_.get(), op, keys_.ref(op::insert_and_find));
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt>
+void static_payload_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::erase(
+  InputIt first, InputIt last, cuda::stream_ref stream)
+{
+  this->erase_async(first, last, stream);
+  stream.wait();
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt>
+void static_payload_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  erase_async(InputIt first, InputIt last, cuda::stream_ref stream)
+{
+  CUCO_EXPECTS(keys_.empty_key_sentinel() != keys_.erased_key_sentinel(),
+               "The empty key sentinel and erased key sentinel cannot be the same value.",
+               std::logic_error);
+
+  auto const num_keys = cuco::detail::distance(first, last);
+  if (num_keys == 0) { return; }
+
+  auto const grid_size = cuco::detail::grid_size(num_keys, cg_size);
+
+  detail::static_payload_map_ns::erase<cg_size, cuco::detail::default_block_size()>
+    <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+      first, num_keys, payloads_.get(), empty_value_sentinel_, keys_.ref(op::find, op::erase));
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename OutputIt>
+void static_payload_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  contains(InputIt first, InputIt last, OutputIt output_begin, cuda::stream_ref stream) const
+{
+  keys_.contains(first, last, output_begin, stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename OutputIt>
+void static_payload_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  find(InputIt first, InputIt last, OutputIt output_begin, cuda::stream_ref stream) const
+{
+  this->find_async(first, last, output_begin, stream);
+  stream.wait();
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename OutputIt>
+void static_payload_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  find_async(InputIt first,
+             InputIt last,
+             OutputIt output_begin,
+             cuda::stream_ref stream) const noexcept
+{
+  auto const num_keys = cuco::detail::distance(first, last);
+  if (num_keys == 0) { return; }
+
+  auto const grid_size = cuco::detail::grid_size(num_keys, cg_size);
+
+  detail::static_payload_map_ns::find<cg_size, cuco::detail::default_block_size()>
+    <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+      first,
+      num_keys,
+      output_begin,
+      static_cast<mapped_type const*>(payloads_.get()),
+      empty_value_sentinel_,
+      keys_.ref(op::find));
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename KeyOut, typename PayloadOut>
+std::pair<KeyOut, PayloadOut>
+static_payload_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  retrieve_all(KeyOut keys_out, PayloadOut payloads_out, cuda::stream_ref stream) const
+{
+  using storage_ref_type    = typename key_set_type::storage_ref_type;
+  using temp_allocator_type =
+    typename std::allocator_traits<payload_allocator_type>::template rebind_alloc<char>;
+
+  auto const slot_keys = thrust::make_transform_iterator(
+    thrust::counting_iterator<size_type>{0},
+    detail::open_addressing_ns::get_slot<false, storage_ref_type>(
+      keys_.ref(op::find).storage_ref()));
+  auto const is_filled = detail::open_addressing_ns::slot_is_filled<true, key_type>{
+    keys_.empty_key_sentinel(), keys_.erased_key_sentinel()};
+
+  auto const zipped_in_begin =
+    thrust::make_zip_iterator(thrust::make_tuple(slot_keys, payloads_.get()));
+  auto const zipped_out_begin =
+    thrust::make_zip_iterator(thrust::make_tuple(keys_out, payloads_out));
+
+  cuco::detail::index_type constexpr stride = std::numeric_limits<int32_t>::max();
+
+  cuco::detail::index_type h_num_out{0};
+  auto temp_allocator = temp_allocator_type{detail::with_stream(payload_allocator_, stream)};
+  auto d_num_out      = reinterpret_cast<size_type*>(
+    std::allocator_traits<temp_allocator_type>::allocate(temp_allocator, sizeof(size_type)));
+
+  // TODO: PR #580 to be reverted once https://github.com/NVIDIA/cccl/issues/1422 is resolved
+  for (cuco::detail::index_type offset = 0;
+       offset < static_cast<cuco::detail::index_type>(this->capacity());
+       offset += stride) {
+    auto const num_items =
+      std::min(static_cast<cuco::detail::index_type>(this->capacity()) - offset, stride);
+
+    std::size_t temp_storage_bytes = 0;
+
+    CUCO_CUDA_TRY(cub::DeviceSelect::If(nullptr,
+                                        temp_storage_bytes,
+                                        zipped_in_begin + offset,
+                                        zipped_out_begin + h_num_out,
+                                        d_num_out,
+                                        static_cast<int32_t>(num_items),
+                                        is_filled,
+                                        stream.get()));
+
+    // Allocate temporary storage
+    auto d_temp_storage = temp_allocator.allocate(temp_storage_bytes);
+
+    CUCO_CUDA_TRY(cub::DeviceSelect::If(d_temp_storage,
+                                        temp_storage_bytes,
+                                        zipped_in_begin + offset,
+                                        zipped_out_begin + h_num_out,
+                                        d_num_out,
+                                        static_cast<int32_t>(num_items),
+                                        is_filled,
+                                        stream.get()));
+
+    size_type temp_count;
+    CUCO_CUDA_TRY(cudaMemcpyAsync(
+      &temp_count, d_num_out, sizeof(size_type), cudaMemcpyDeviceToHost, stream.get()));
+    stream.wait();
+    h_num_out += temp_count;
+    temp_allocator.deallocate(d_temp_storage, temp_storage_bytes);
+  }
+
+  std::allocator_traits<temp_allocator_type>::deallocate(
+    temp_allocator, reinterpret_cast<char*>(d_num_out), sizeof(size_type));
+
+  return std::make_pair(keys_out + h_num_out, payloads_out + h_num_out);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+static_payload_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size_type
+static_payload_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size(
+  cuda::stream_ref stream) const
+{
+  return keys_.size(stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+constexpr auto
+static_payload_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::capacity()
+  const noexcept
+{
+  return keys_.capacity();
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+constexpr static_payload_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  key_type
+  static_payload_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+    empty_key_sentinel() const noexcept
+{
+  return keys_.empty_key_sentinel();
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+constexpr static_payload_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  key_type
+  static_payload_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+    erased_key_sentinel() const noexcept
+{
+  return keys_.erased_key_sentinel();
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+constexpr static_payload_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  mapped_type
+  static_payload_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+    empty_value_sentinel() const noexcept
+{
+  return empty_value_sentinel_;
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+static_payload_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  key_set_type const&
+  static_payload_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::keys()
+    const noexcept
+{
+  return keys_;
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+static_payload_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  mapped_type*
+  static_payload_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::payloads()
+    const noexcept
+{
+  return payloads_.get();
+}
+}  // namespace cuco
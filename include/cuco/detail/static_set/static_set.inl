@@ -115,6 +115,19 @@ void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>
   impl_->clear_async(stream);
 }
 
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::prefetch_async(
+  int location, cuda::stream_ref stream) const
+{
+  impl_->prefetch_async(location, stream);
+}
+
 template <class Key,
           class Extent,
           cuda::thread_scope Scope,
@@ -127,7 +140,28 @@ static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::siz
 static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::insert(
   InputIt first, InputIt last, cuda::stream_ref stream)
 {
-  return impl_->insert(first, last, ref(op::insert), stream);
+  impl_->rehash_step_async(*this, stream);
+  return this->visit_ref(ref(op::insert), [&](auto const& container_ref) {
+    return impl_->insert(first, last, container_ref, stream);
+  });
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt>
+static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size_type
+static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::insert_from_host(
+  InputIt first, InputIt last, std::size_t chunk_size, int32_t num_stages, cuda::stream_ref stream)
+{
+  impl_->rehash_step_async(*this, stream);
+  return this->visit_ref(ref(op::insert), [&](auto const& container_ref) {
+    return impl_->insert_from_host(first, last, container_ref, chunk_size, num_stages, stream);
+  });
 }
 
 template <class Key,
@@ -139,9 +173,12 @@ template <class Key,
           class Storage>
 template <typename InputIt>
 void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::insert_async(
-  InputIt first, InputIt last, cuda::stream_ref stream) noexcept
+  InputIt first, InputIt last, cuda::stream_ref stream)
 {
-  impl_->insert_async(first, last, ref(op::insert), stream);
+  impl_->rehash_step_async(*this, stream);
+  this->visit_ref(ref(op::insert), [&](auto const& container_ref) {
+    impl_->insert_async(first, last, container_ref, stream);
+  });
 }
 
 template <class Key,
@@ -156,7 +193,10 @@ static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::siz
 static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::insert_if(
   InputIt first, InputIt last, StencilIt stencil, Predicate pred, cuda::stream_ref stream)
 {
-  return impl_->insert_if(first, last, stencil, pred, ref(op::insert), stream);
+  impl_->rehash_step_async(*this, stream);
+  return this->visit_ref(ref(op::insert), [&](auto const& container_ref) {
+    return impl_->insert_if(first, last, stencil, pred, container_ref, stream);
+  });
 }
 
 template <class Key,
@@ -168,9 +208,12 @@ template <class Key,
           class Storage>
 template <typename InputIt, typename StencilIt, typename Predicate>
 void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::insert_if_async(
-  InputIt first, InputIt last, StencilIt stencil, Predicate pred, cuda::stream_ref stream) noexcept
+  InputIt first, InputIt last, StencilIt stencil, Predicate pred, cuda::stream_ref stream)
 {
-  impl_->insert_if_async(first, last, stencil, pred, ref(op::insert), stream);
+  impl_->rehash_step_async(*this, stream);
+  this->visit_ref(ref(op::insert), [&](auto const& container_ref) {
+    impl_->insert_if_async(first, last, stencil, pred, container_ref, stream);
+  });
 }
 
 template <class Key,
@@ -207,10 +250,26 @@ void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>
                         InsertedIt inserted_begin,
                         cuda::stream_ref stream) noexcept
 {
+  impl_->rehash_finish_async(*this, stream);
   impl_->insert_and_find_async(
     first, last, found_begin, inserted_begin, ref(op::insert_and_find), stream);
 }
 
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename OutputIt>
+OutputIt static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::try_insert(
+  InputIt first, InputIt last, OutputIt unplaced_begin, cuda::stream_ref stream)
+{
+  impl_->rehash_finish_async(*this, stream);
+  return impl_->try_insert(first, last, unplaced_begin, ref(op::insert_and_find), stream);
+}
+
 template <class Key,
           class Extent,
           cuda::thread_scope Scope,
@@ -223,7 +282,7 @@ void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>
   InputIt first, InputIt last, cuda::stream_ref stream)
 {
   erase_async(first, last, stream);
-  stream.wait();
+  impl_->wait(stream);
 }
 
 template <class Key,
@@ -237,7 +296,10 @@ template <typename InputIt>
 void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::erase_async(
   InputIt first, InputIt last, cuda::stream_ref stream)
 {
-  impl_->erase_async(first, last, ref(op::erase), stream);
+  impl_->rehash_step_async(*this, stream);
+  this->visit_ref(ref(op::erase), [&](auto const& container_ref) {
+    impl_->erase_async(first, last, container_ref, stream);
+  });
 }
 
 template <class Key,
@@ -252,7 +314,7 @@ void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>
   InputIt first, InputIt last, OutputIt output_begin, cuda::stream_ref stream) const
 {
   contains_async(first, last, output_begin, stream);
-  stream.wait();
+  impl_->wait(stream);
 }
 
 template <class Key,
@@ -264,9 +326,11 @@ template <class Key,
           class Storage>
 template <typename InputIt, typename OutputIt>
 void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::contains_async(
-  InputIt first, InputIt last, OutputIt output_begin, cuda::stream_ref stream) const noexcept
+  InputIt first, InputIt last, OutputIt output_begin, cuda::stream_ref stream) const
 {
-  impl_->contains_async(first, last, output_begin, ref(op::contains), stream);
+  this->visit_ref(ref(op::contains), [&](auto const& container_ref) {
+    impl_->contains_async(first, last, output_begin, container_ref, stream);
+  });
 }
 
 template <class Key,
@@ -286,7 +350,7 @@ void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>
   cuda::stream_ref stream) const
 {
   contains_if_async(first, last, stencil, pred, output_begin, stream);
-  stream.wait();
+  impl_->wait(stream);
 }
 
 template <class Key,
@@ -303,9 +367,11 @@ void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>
   StencilIt stencil,
   Predicate pred,
   OutputIt output_begin,
-  cuda::stream_ref stream) const noexcept
+  cuda::stream_ref stream) const
 {
-  impl_->contains_if_async(first, last, stencil, pred, output_begin, ref(op::contains), stream);
+  this->visit_ref(ref(op::contains), [&](auto const& container_ref) {
+    impl_->contains_if_async(first, last, stencil, pred, output_begin, container_ref, stream);
+  });
 }
 
 template <class Key,
@@ -320,7 +386,7 @@ void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>
   InputIt first, InputIt last, OutputIt output_begin, cuda::stream_ref stream) const
 {
   find_async(first, last, output_begin, stream);
-  stream.wait();
+  impl_->wait(stream);
 }
 
 template <class Key,
@@ -334,7 +400,9 @@ template <typename InputIt, typename OutputIt>
 void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::find_async(
   InputIt first, InputIt last, OutputIt output_begin, cuda::stream_ref stream) const
 {
-  impl_->find_async(first, last, output_begin, ref(op::find), stream);
+  this->visit_ref(ref(op::find), [&](auto const& container_ref) {
+    impl_->find_async(first, last, output_begin, container_ref, stream);
+  });
 }
 
 template <class Key,
@@ -377,7 +445,7 @@ void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>
   cuda::stream_ref stream) const
 {
   this->find_if_async(first, last, stencil, pred, output_begin, stream);
-  stream.wait();
+  impl_->wait(stream);
 }
 
 template <class Key,
@@ -396,7 +464,9 @@ void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>
   OutputIt output_begin,
   cuda::stream_ref stream) const
 {
-  impl_->find_if_async(first, last, stencil, pred, output_begin, ref(op::find), stream);
+  this->visit_ref(ref(op::find), [&](auto const& container_ref) {
+    impl_->find_if_async(first, last, stencil, pred, output_begin, container_ref, stream);
+  });
 }
 
 template <class Key,
@@ -503,7 +573,43 @@ static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::siz
 static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::count(
   InputIt first, InputIt last, cuda::stream_ref stream) const
 {
-  return impl_->count(first, last, ref(op::count), stream);
+  return this->visit_ref(ref(op::count), [&](auto const& container_ref) {
+    return impl_->count(first, last, container_ref, stream);
+  });
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt>
+void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::count_async(
+  InputIt first, InputIt last, size_type* output, cuda::stream_ref stream) const
+{
+  this->visit_ref(ref(op::count), [&](auto const& container_ref) {
+    impl_->count_async(first, last, output, container_ref, stream);
+  });
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt>
+static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::async_size_type
+static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::count_async(
+  InputIt first, InputIt last, cuda::stream_ref stream) const
+{
+  auto result = async_size_type{};
+  this->count_async(first, last, result.data(), stream);
+  result.record(stream);
+  return result;
 }
 
 template <class Key,
@@ -525,6 +631,48 @@ static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::ret
   return impl_->retrieve(first, last, output_probe, output_match, this->ref(op::retrieve), stream);
 }
 
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename OutputIt1, typename OutputIt2>
+void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::retrieve_async(
+  InputIt first,
+  InputIt last,
+  OutputIt1 output_probe,
+  OutputIt2 output_match,
+  size_type* num_retrieved,
+  cuda::stream_ref stream) const
+{
+  impl_->retrieve_async(
+    first, last, output_probe, output_match, num_retrieved, this->ref(op::retrieve), stream);
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename OutputIt1, typename OutputIt2>
+static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::async_size_type
+static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::retrieve_async(
+  InputIt first,
+  InputIt last,
+  OutputIt1 output_probe,
+  OutputIt2 output_match,
+  cuda::stream_ref stream) const
+{
+  auto result = async_size_type{};
+  this->retrieve_async(first, last, output_probe, output_match, result.data(), stream);
+  result.record(stream);
+  return result;
+}
+
 template <class Key,
           class Extent,
           cuda::thread_scope Scope,
@@ -539,6 +687,38 @@ OutputIt static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Stor
   return impl_->retrieve_all(output_begin, stream);
 }
 
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename OutputIt>
+void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  retrieve_all_async(OutputIt output_begin, size_type* num_out, cuda::stream_ref stream) const
+{
+  impl_->retrieve_all_async(output_begin, num_out, stream);
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename OutputIt>
+static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::async_size_type
+static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::retrieve_all_async(
+  OutputIt output_begin, cuda::stream_ref stream) const
+{
+  auto result = async_size_type{};
+  this->retrieve_all_async(output_begin, result.data(), stream);
+  result.record(stream);
+  return result;
+}
+
 template <class Key,
           class Extent,
           cuda::thread_scope Scope,
@@ -593,6 +773,152 @@ void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>
   this->impl_->rehash_async(extent, *this, stream);
 }
 
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  rehash_incremental_async(size_type capacity, size_type buckets_per_step, cuda::stream_ref stream)
+{
+  auto const extent = make_bucket_extent<static_set>(capacity);
+  this->impl_->rehash_incremental_async(extent, buckets_per_step, *this, stream);
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  rehash_step_async(cuda::stream_ref stream)
+{
+  this->impl_->rehash_step_async(*this, stream);
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  rehash_finish_async(cuda::stream_ref stream)
+{
+  this->impl_->rehash_finish_async(*this, stream);
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+bool static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::is_rehashing()
+  const noexcept
+{
+  return impl_->is_rehashing();
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::purge_tombstones(
+  cuda::stream_ref stream)
+{
+  impl_->purge_tombstones(stream);
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  purge_tombstones_async(cuda::stream_ref stream)
+{
+  impl_->purge_tombstones_async(stream);
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+bool static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  purge_tombstones_if(double max_tombstone_ratio, cuda::stream_ref stream)
+{
+  return impl_->purge_tombstones_if(max_tombstone_ratio, stream);
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size_type
+static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::tombstone_count(
+  cuda::stream_ref stream) const
+{
+  return impl_->tombstone_count(stream);
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::statistics_type
+static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::statistics(
+  cuda::stream_ref stream) const
+{
+  return impl_->statistics(stream);
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::save(
+  std::string const& path, cuda::stream_ref stream) const
+{
+  impl_->save(path, persisted_kind::static_set, stream);
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::load(
+  std::string const& path, cuda::stream_ref stream)
+{
+  impl_->load(path, persisted_kind::static_set, stream);
+}
+
 template <class Key,
           class Extent,
           cuda::thread_scope Scope,
@@ -607,6 +933,143 @@ static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::siz
   return impl_->size(stream);
 }
 
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size_async(
+  size_type* output, cuda::stream_ref stream) const
+{
+  impl_->size_async(output, stream);
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::async_size_type
+static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size_async(
+  cuda::stream_ref stream) const
+{
+  auto result = async_size_type{};
+  this->size_async(result.data(), stream);
+  result.record(stream);
+  return result;
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size_type
+static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::stash_size(
+  cuda::stream_ref stream) const
+{
+  return impl_->stash_size(stream);
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::perf_counters_type
+static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::perf_counters(
+  cuda::stream_ref stream) const
+{
+  return impl_->perf_counters(stream);
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  reset_perf_counters(cuda::stream_ref stream)
+{
+  impl_->reset_perf_counters_async(stream);
+  stream.wait();
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  enable_size_tracking(cuda::stream_ref stream)
+{
+  impl_->enable_size_tracking(stream);
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  set_input_partitioning(int32_t partition_bits)
+{
+  impl_->set_input_partitioning(partition_bits);
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+int32_t static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  input_partition_bits() const noexcept
+{
+  return impl_->input_partition_bits();
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  set_input_deduplication(bool enabled) noexcept
+{
+  impl_->set_input_deduplication(enabled);
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+bool static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  input_deduplication() const noexcept
+{
+  return impl_->input_deduplication();
+}
+
 template <class Key,
           class Extent,
           cuda::thread_scope Scope,
@@ -701,4 +1164,20 @@ auto static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>
                                     cuda_thread_scope<Scope>{},
                                     impl_->storage_ref()};
 }
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename Ref, typename Func>
+decltype(auto) static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  visit_ref(Ref const& container_ref, Func&& func) const
+{
+  return impl_->visit_ref(container_ref,
+                          this->ref(op::contains, op::find, op::erase, op::count),
+                          std::forward<Func>(func));
+}
 }  // namespace cuco
@@ -304,6 +304,24 @@ static_set_ref<Key, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>::r
                                       this->storage_ref()};
 }
 
+template <typename Key,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+__host__ __device__ constexpr auto
+static_set_ref<Key, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>::rebind_storage_ref(
+  StorageRef storage_ref) const noexcept
+{
+  return static_set_ref{cuco::empty_key<Key>{this->empty_key_sentinel()},
+                        cuco::erased_key<Key>{this->erased_key_sentinel()},
+                        this->key_eq(),
+                        this->probing_scheme(),
+                        {},
+                        storage_ref};
+}
+
 template <typename Key,
           cuda::thread_scope Scope,
           typename KeyEqual,
@@ -370,7 +388,7 @@ class operator_impl<op::insert_tag,
    * @return True if the given element is successfully inserted
    */
   template <typename Value>
-  __device__ bool insert(Value const& value) noexcept
+  __host__ __device__ bool insert(Value const& value) noexcept
   {
     ref_type& ref_ = static_cast<ref_type&>(*this);
     return ref_.impl_.insert(value);
@@ -486,7 +504,7 @@ class operator_impl<op::erase_tag,
    * @return True if the given element is successfully erased
    */
   template <typename ProbeKey>
-  __device__ bool erase(ProbeKey const& key) noexcept
+  __host__ __device__ bool erase(ProbeKey const& key) noexcept
   {
     ref_type& ref_ = static_cast<ref_type&>(*this);
     return ref_.impl_.erase(key);
@@ -541,7 +559,7 @@ class operator_impl<op::contains_tag,
    * @return A boolean indicating whether the probe key is present
    */
   template <typename ProbeKey>
-  [[nodiscard]] __device__ bool contains(ProbeKey const& key) const noexcept
+  [[nodiscard]] __host__ __device__ bool contains(ProbeKey const& key) const noexcept
   {
     auto const& ref_ = static_cast<ref_type const&>(*this);
     return ref_.impl_.contains(key);
@@ -601,7 +619,7 @@ class operator_impl<op::find_tag,
    * @return An iterator to the position at which the equivalent key is stored
    */
   template <typename ProbeKey>
-  [[nodiscard]] __device__ const_iterator find(ProbeKey const& key) const noexcept
+  [[nodiscard]] __host__ __device__ const_iterator find(ProbeKey const& key) const noexcept
   {
     // CRTP: cast `this` to the actual ref type
     auto const& ref_ = static_cast<ref_type const&>(*this);
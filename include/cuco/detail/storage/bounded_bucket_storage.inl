@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/storage/kernels.cuh>
+#include <cuco/detail/storage/storage_base.cuh>
+#include <cuco/detail/utility/cuda.hpp>
+#include <cuco/extent.cuh>
+
+#include <cuda/atomic>
+#include <cuda/stream_ref>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace cuco {
+
+template <typename T, int32_t BucketSize, typename Extent, typename Allocator>
+constexpr bounded_bucket_storage<T, BucketSize, Extent, Allocator>::bounded_bucket_storage(
+  Extent size, Allocator const& allocator)
+  : base_type{size, allocator},
+    bound_allocator_{allocator},
+    bound_deleter_{this->num_bound_words(), bound_allocator_},
+    bounds_{bound_allocator_.allocate(this->num_bound_words()), bound_deleter_}
+{
+}
+
+template <typename T, int32_t BucketSize, typename Extent, typename Allocator>
+constexpr bounded_bucket_storage<T, BucketSize, Extent, Allocator>::bound_word_type*
+bounded_bucket_storage<T, BucketSize, Extent, Allocator>::bound_data() const noexcept
+{
+  return bounds_.get();
+}
+
+template <typename T, int32_t BucketSize, typename Extent, typename Allocator>
+constexpr bounded_bucket_storage<T, BucketSize, Extent, Allocator>::ref_type
+bounded_bucket_storage<T, BucketSize, Extent, Allocator>::ref() const noexcept
+{
+  return ref_type{this->bucket_extent(), this->data(), this->bound_data()};
+}
+
+template <typename T, int32_t BucketSize, typename Extent, typename Allocator>
+void bounded_bucket_storage<T, BucketSize, Extent, Allocator>::initialize(value_type key,
+                                                                          cuda::stream_ref stream)
+{
+  this->initialize_async(key, stream);
+  stream.wait();
+}
+
+template <typename T, int32_t BucketSize, typename Extent, typename Allocator>
+void bounded_bucket_storage<T, BucketSize, Extent, Allocator>::initialize_async(
+  value_type key, cuda::stream_ref stream) noexcept
+{
+  if (this->num_buckets() == 0) { return; }
+
+  base_type::initialize_async(key, stream);
+
+  auto constexpr cg_size = 1;
+  auto constexpr stride  = 4;
+  auto const grid_size   = cuco::detail::grid_size(this->num_bound_words(), cg_size, stride);
+
+  detail::initialize<<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+    this->bound_data(), this->num_bound_words(), std::uint32_t{0});
+}
+
+template <typename T, int32_t BucketSize, typename Extent, typename Allocator>
+constexpr bounded_bucket_storage<T, BucketSize, Extent, Allocator>::size_type
+bounded_bucket_storage<T, BucketSize, Extent, Allocator>::num_bound_words() const noexcept
+{
+  return cuco::detail::int_div_ceil(this->num_buckets(), size_type{4});
+}
+
+template <typename T, int32_t BucketSize, typename Extent>
+__host__ __device__ constexpr bounded_bucket_storage_ref<T, BucketSize, Extent>::
+  bounded_bucket_storage_ref(Extent size, bucket_type* buckets, bound_word_type* bounds) noexcept
+  : base_type{size, buckets}, bounds_{bounds}
+{
+}
+
+template <typename T, int32_t BucketSize, typename Extent>
+__host__ __device__ constexpr bounded_bucket_storage_ref<T, BucketSize, Extent>::bound_word_type*
+bounded_bucket_storage_ref<T, BucketSize, Extent>::bound_data() const noexcept
+{
+  return bounds_;
+}
+
+template <typename T, int32_t BucketSize, typename Extent>
+__device__ std::int32_t bounded_bucket_storage_ref<T, BucketSize, Extent>::displacement_bound(
+  size_type index) const noexcept
+{
+  auto const word = cuda::atomic_ref<std::uint32_t, cuda::thread_scope_device>{
+    (this->bounds_ + index / 4)->front()}.load(cuda::memory_order_relaxed);
+  return static_cast<std::int32_t>((word >> (8 * (index % 4))) & 0xFFu);
+}
+
+template <typename T, int32_t BucketSize, typename Extent>
+__device__ void bounded_bucket_storage_ref<T, BucketSize, Extent>::record_displacement(
+  size_type index, std::int32_t displacement) const noexcept
+{
+  auto const shift = static_cast<std::uint32_t>(8 * (index % 4));
+  auto const bound = static_cast<std::uint32_t>(
+    displacement < detail::unbounded_displacement ? displacement : detail::unbounded_displacement);
+
+  // Byte-wise atomic max emulated with a CAS loop on the enclosing word
+  auto word_ref = cuda::atomic_ref<std::uint32_t, cuda::thread_scope_device>{
+    (this->bounds_ + index / 4)->front()};
+  auto expected = word_ref.load(cuda::memory_order_relaxed);
+  while (((expected >> shift) & 0xFFu) < bound) {
+    auto const desired = (expected & ~(0xFFu << shift)) | (bound << shift);
+    if (word_ref.compare_exchange_weak(expected, desired, cuda::memory_order_relaxed)) { return; }
+  }
+}
+
+}  // namespace cuco
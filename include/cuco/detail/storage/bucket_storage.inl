@@ -19,7 +19,9 @@
 #include <cuco/detail/storage/kernels.cuh>
 #include <cuco/detail/storage/storage_base.cuh>
 #include <cuco/detail/utility/cuda.hpp>
+#include <cuco/detail/utility/host_parallel.hpp>
 #include <cuco/extent.cuh>
+#include <cuco/utility/allocator.hpp>
 
 #include <cuda/std/array>
 #include <cuda/stream_ref>
@@ -67,7 +69,7 @@ void bucket_storage<T, BucketSize, Extent, Allocator>::initialize(value_type key
                                                                   cuda::stream_ref stream)
 {
   this->initialize_async(key, stream);
-  stream.wait();
+  if constexpr (not cuco::detail::is_host_allocator_v<Allocator>) { stream.wait(); }
 }
 
 template <typename T, int32_t BucketSize, typename Extent, typename Allocator>
@@ -76,12 +78,18 @@ void bucket_storage<T, BucketSize, Extent, Allocator>::initialize_async(
 {
   if (this->num_buckets() == 0) { return; }
 
-  auto constexpr cg_size = 1;
-  auto constexpr stride  = 4;
-  auto const grid_size   = cuco::detail::grid_size(this->num_buckets(), cg_size, stride);
-
-  detail::initialize<<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
-    this->data(), this->num_buckets(), key);
+  if constexpr (cuco::detail::is_host_allocator_v<Allocator>) {
+    auto* const buckets = this->data();
+    cuco::detail::host_parallel_for(this->num_buckets(),
+                                    [buckets, key](auto idx) { buckets[idx].fill(key); });
+  } else {
+    auto constexpr cg_size = 1;
+    auto constexpr stride  = 4;
+    auto const grid_size   = cuco::detail::grid_size(this->num_buckets(), cg_size, stride);
+
+    detail::initialize<<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+      this->data(), this->num_buckets(), key);
+  }
 }
 
 template <typename T, int32_t BucketSize, typename Extent>
@@ -102,7 +110,10 @@ struct bucket_storage_ref<T, BucketSize, Extent>::iterator {
    *
    * @param current The slot pointer
    */
-  __device__ constexpr explicit iterator(value_type* current) noexcept : current_{current} {}
+  __host__ __device__ constexpr explicit iterator(value_type* current) noexcept
+    : current_{current}
+  {
+  }
 
   /**
    * @brief Prefix increment operator
@@ -111,7 +122,7 @@ struct bucket_storage_ref<T, BucketSize, Extent>::iterator {
    *
    * @return Current iterator
    */
-  __device__ constexpr iterator& operator++() noexcept
+  __host__ __device__ constexpr iterator& operator++() noexcept
   {
     static_assert("Un-incrementable input iterator");
   }
@@ -123,7 +134,7 @@ struct bucket_storage_ref<T, BucketSize, Extent>::iterator {
    *
    * @return Current iterator
    */
-  __device__ constexpr iterator operator++(int32_t) noexcept
+  __host__ __device__ constexpr iterator operator++(int32_t) noexcept
   {
     static_assert("Un-incrementable input iterator");
   }
@@ -133,21 +144,22 @@ struct bucket_storage_ref<T, BucketSize, Extent>::iterator {
    *
    * @return Reference to the current slot
    */
-  __device__ constexpr reference operator*() const { return *current_; }
+  __host__ __device__ constexpr reference operator*() const { return *current_; }
 
   /**
    * @brief Access operator
    *
    * @return Pointer to the current slot
    */
-  __device__ constexpr value_type* operator->() const { return current_; }
+  __host__ __device__ constexpr value_type* operator->() const { return current_; }
 
   /**
    * Equality operator
    *
    * @return True if two iterators are identical
    */
-  friend __device__ constexpr bool operator==(iterator const& lhs, iterator const& rhs) noexcept
+  friend __host__ __device__ constexpr bool operator==(iterator const& lhs,
+                                                       iterator const& rhs) noexcept
   {
     return lhs.current_ == rhs.current_;
   }
@@ -157,7 +169,8 @@ struct bucket_storage_ref<T, BucketSize, Extent>::iterator {
    *
    * @return True if two iterators are not identical
    */
-  friend __device__ constexpr bool operator!=(iterator const& lhs, iterator const& rhs) noexcept
+  friend __host__ __device__ constexpr bool operator!=(iterator const& lhs,
+                                                       iterator const& rhs) noexcept
   {
     return not(lhs == rhs);
   }
@@ -167,35 +180,35 @@ struct bucket_storage_ref<T, BucketSize, Extent>::iterator {
 };
 
 template <typename T, int32_t BucketSize, typename Extent>
-__device__ constexpr bucket_storage_ref<T, BucketSize, Extent>::iterator
+__host__ __device__ constexpr bucket_storage_ref<T, BucketSize, Extent>::iterator
 bucket_storage_ref<T, BucketSize, Extent>::end() noexcept
 {
   return iterator{reinterpret_cast<value_type*>(this->data() + this->capacity())};
 }
 
 template <typename T, int32_t BucketSize, typename Extent>
-__device__ constexpr bucket_storage_ref<T, BucketSize, Extent>::const_iterator
+__host__ __device__ constexpr bucket_storage_ref<T, BucketSize, Extent>::const_iterator
 bucket_storage_ref<T, BucketSize, Extent>::end() const noexcept
 {
   return const_iterator{reinterpret_cast<value_type*>(this->data() + this->capacity())};
 }
 
 template <typename T, int32_t BucketSize, typename Extent>
-__device__ constexpr bucket_storage_ref<T, BucketSize, Extent>::bucket_type*
+__host__ __device__ constexpr bucket_storage_ref<T, BucketSize, Extent>::bucket_type*
 bucket_storage_ref<T, BucketSize, Extent>::data() noexcept
 {
   return buckets_;
 }
 
 template <typename T, int32_t BucketSize, typename Extent>
-__device__ constexpr bucket_storage_ref<T, BucketSize, Extent>::bucket_type*
+__host__ __device__ constexpr bucket_storage_ref<T, BucketSize, Extent>::bucket_type*
 bucket_storage_ref<T, BucketSize, Extent>::data() const noexcept
 {
   return buckets_;
 }
 
 template <typename T, int32_t BucketSize, typename Extent>
-__device__ constexpr bucket_storage_ref<T, BucketSize, Extent>::bucket_type
+__host__ __device__ constexpr bucket_storage_ref<T, BucketSize, Extent>::bucket_type
 bucket_storage_ref<T, BucketSize, Extent>::operator[](size_type index) const noexcept
 {
   return *reinterpret_cast<bucket_type*>(
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/error.hpp>
+#include <cuco/detail/storage/storage_base.cuh>
+#include <cuco/extent.cuh>
+
+#include <cuda/atomic>
+#include <cuda/stream_ref>
+
+#include <cooperative_groups.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace cuco {
+
+template <typename T, int32_t BucketSize, typename Extent, typename Allocator>
+constexpr counted_bucket_storage<T, BucketSize, Extent, Allocator>::counted_bucket_storage(
+  Extent size, Allocator const& allocator)
+  : base_type{size, allocator},
+    counter_allocator_{allocator},
+    counter_deleter_{detail::num_perf_events, counter_allocator_},
+    counters_{counter_allocator_.allocate(detail::num_perf_events), counter_deleter_}
+{
+}
+
+template <typename T, int32_t BucketSize, typename Extent, typename Allocator>
+constexpr counted_bucket_storage<T, BucketSize, Extent, Allocator>::counter_type*
+counted_bucket_storage<T, BucketSize, Extent, Allocator>::counters() const noexcept
+{
+  return counters_.get();
+}
+
+template <typename T, int32_t BucketSize, typename Extent, typename Allocator>
+constexpr counted_bucket_storage<T, BucketSize, Extent, Allocator>::ref_type
+counted_bucket_storage<T, BucketSize, Extent, Allocator>::ref() const noexcept
+{
+  return ref_type{this->bucket_extent(), this->data(), this->counters()};
+}
+
+template <typename T, int32_t BucketSize, typename Extent, typename Allocator>
+void counted_bucket_storage<T, BucketSize, Extent, Allocator>::initialize(value_type key,
+                                                                          cuda::stream_ref stream)
+{
+  this->initialize_async(key, stream);
+  stream.wait();
+}
+
+template <typename T, int32_t BucketSize, typename Extent, typename Allocator>
+void counted_bucket_storage<T, BucketSize, Extent, Allocator>::initialize_async(
+  value_type key, cuda::stream_ref stream) noexcept
+{
+  CUCO_CUDA_TRY(cudaMemsetAsync(
+    this->counters(), 0, sizeof(counter_type) * detail::num_perf_events, stream.get()));
+  base_type::initialize_async(key, stream);
+}
+
+template <typename T, int32_t BucketSize, typename Extent>
+__host__ __device__ constexpr counted_bucket_storage_ref<T, BucketSize, Extent>::
+  counted_bucket_storage_ref(Extent size, bucket_type* buckets, counter_type* counters) noexcept
+  : base_type{size, buckets}, counters_{counters}
+{
+}
+
+template <typename T, int32_t BucketSize, typename Extent>
+__host__ __device__ constexpr counted_bucket_storage_ref<T, BucketSize, Extent>::counter_type*
+counted_bucket_storage_ref<T, BucketSize, Extent>::counters() const noexcept
+{
+  return counters_;
+}
+
+template <typename T, int32_t BucketSize, typename Extent>
+template <detail::perf_event Event>
+__device__ void counted_bucket_storage_ref<T, BucketSize, Extent>::record() const noexcept
+{
+  // All converged threads count the same event, so the warp leader adds them up at once
+  auto const active = cooperative_groups::coalesced_threads();
+  if (active.thread_rank() == 0) {
+    cuda::atomic_ref<counter_type, cuda::thread_scope_device>{
+      this->counters_[static_cast<std::int32_t>(Event)]}
+      .fetch_add(active.size(), cuda::memory_order_relaxed);
+  }
+}
+
+}  // namespace cuco
@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/storage/kernels.cuh>
+#include <cuco/detail/storage/storage_base.cuh>
+#include <cuco/detail/utility/cuda.hpp>
+#include <cuco/extent.cuh>
+
+#include <cuda/std/array>
+#include <cuda/stream_ref>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+
+namespace cuco {
+
+template <typename T, int32_t BucketSize, typename Extent, typename Allocator>
+constexpr soa_bucket_storage<T, BucketSize, Extent, Allocator>::soa_bucket_storage(
+  Extent size, Allocator const& allocator)
+  : detail::bucket_storage_base<T, BucketSize, Extent>{size},
+    allocator_{allocator},
+    payload_allocator_{allocator},
+    key_deleter_{num_buckets(), allocator_},
+    payload_deleter_{num_buckets(), payload_allocator_},
+    keys_{allocator_.allocate(num_buckets()), key_deleter_},
+    payloads_{payload_allocator_.allocate(num_buckets()), payload_deleter_}
+{
+}
+
+template <typename T, int32_t BucketSize, typename Extent, typename Allocator>
+constexpr soa_bucket_storage<T, BucketSize, Extent, Allocator>::bucket_type*
+soa_bucket_storage<T, BucketSize, Extent, Allocator>::data() const noexcept
+{
+  static_assert(cuco::dependent_false<T, Allocator>,
+                "SoA storage has no contiguous slot array. Use `key_data()` and `payload_data()`.");
+  return nullptr;
+}
+
+template <typename T, int32_t BucketSize, typename Extent, typename Allocator>
+constexpr soa_bucket_storage<T, BucketSize, Extent, Allocator>::key_bucket_type*
+soa_bucket_storage<T, BucketSize, Extent, Allocator>::key_data() const noexcept
+{
+  return keys_.get();
+}
+
+template <typename T, int32_t BucketSize, typename Extent, typename Allocator>
+constexpr soa_bucket_storage<T, BucketSize, Extent, Allocator>::mapped_bucket_type*
+soa_bucket_storage<T, BucketSize, Extent, Allocator>::payload_data() const noexcept
+{
+  return payloads_.get();
+}
+
+template <typename T, int32_t BucketSize, typename Extent, typename Allocator>
+constexpr soa_bucket_storage<T, BucketSize, Extent, Allocator>::allocator_type
+soa_bucket_storage<T, BucketSize, Extent, Allocator>::allocator() const noexcept
+{
+  return allocator_;
+}
+
+template <typename T, int32_t BucketSize, typename Extent, typename Allocator>
+constexpr soa_bucket_storage<T, BucketSize, Extent, Allocator>::ref_type
+soa_bucket_storage<T, BucketSize, Extent, Allocator>::ref() const noexcept
+{
+  return ref_type{this->bucket_extent(), this->key_data(), this->payload_data()};
+}
+
+template <typename T, int32_t BucketSize, typename Extent, typename Allocator>
+void soa_bucket_storage<T, BucketSize, Extent, Allocator>::initialize(value_type value,
+                                                                      cuda::stream_ref stream)
+{
+  this->initialize_async(value, stream);
+  stream.wait();
+}
+
+template <typename T, int32_t BucketSize, typename Extent, typename Allocator>
+void soa_bucket_storage<T, BucketSize, Extent, Allocator>::initialize_async(
+  value_type value, cuda::stream_ref stream) noexcept
+{
+  if (this->num_buckets() == 0) { return; }
+
+  auto constexpr cg_size = 1;
+  auto constexpr stride  = 4;
+  auto const grid_size   = cuco::detail::grid_size(this->num_buckets(), cg_size, stride);
+
+  detail::initialize<<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+    this->key_data(), this->num_buckets(), value.first);
+  detail::initialize<<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+    this->payload_data(), this->num_buckets(), value.second);
+}
+
+template <typename T, int32_t BucketSize, typename Extent>
+__host__ __device__ constexpr soa_bucket_storage_ref<T, BucketSize, Extent>::soa_bucket_storage_ref(
+  Extent size, key_bucket_type* keys, mapped_bucket_type* payloads) noexcept
+  : detail::bucket_storage_base<T, BucketSize, Extent>{size}, keys_{keys}, payloads_{payloads}
+{
+}
+
+template <typename T, int32_t BucketSize, typename Extent>
+struct soa_bucket_storage_ref<T, BucketSize, Extent>::reference {
+  key_type& first;      ///< Reference to the slot key
+  mapped_type& second;  ///< Reference to the slot payload
+};
+
+template <typename T, int32_t BucketSize, typename Extent>
+struct soa_bucket_storage_ref<T, BucketSize, Extent>::iterator {
+ public:
+  using iterator_category = std::input_iterator_tag;  ///< iterator category
+  using reference = typename soa_bucket_storage_ref::reference;  ///< iterator reference type
+
+  /**
+   * @brief Arrow proxy holding a slot reference by value.
+   */
+  struct pointer {
+    reference ref;  ///< Proxied slot reference
+
+    /**
+     * @brief Access operator
+     *
+     * @return Pointer to the proxied slot reference
+     */
+    __device__ constexpr reference const* operator->() const noexcept { return &ref; }
+  };
+
+  /**
+   * @brief Constructs a device side input iterator of the given slot.
+   *
+   * @param key Pointer to the slot key
+   * @param payload Pointer to the slot payload
+   */
+  __device__ constexpr explicit iterator(key_type* key, mapped_type* payload) noexcept
+    : key_{key}, payload_{payload}
+  {
+  }
+
+  /**
+   * @brief Prefix increment operator
+   *
+   * @throw This code path should never be chosen.
+   *
+   * @return Current iterator
+   */
+  __device__ constexpr iterator& operator++() noexcept
+  {
+    static_assert("Un-incrementable input iterator");
+  }
+
+  /**
+   * @brief Postfix increment operator
+   *
+   * @throw This code path should never be chosen.
+   *
+   * @return Current iterator
+   */
+  __device__ constexpr iterator operator++(int32_t) noexcept
+  {
+    static_assert("Un-incrementable input iterator");
+  }
+
+  /**
+   * @brief Dereference operator
+   *
+   * @return Proxy reference to the current slot
+   */
+  __device__ constexpr reference operator*() const { return reference{*key_, *payload_}; }
+
+  /**
+   * @brief Access operator
+   *
+   * @return Arrow proxy of the current slot
+   */
+  __device__ constexpr pointer operator->() const { return pointer{**this}; }
+
+  /**
+   * @brief Gets the pointer to the slot key.
+   *
+   * @return Pointer to the slot key
+   */
+  [[nodiscard]] __device__ constexpr key_type* key() const noexcept { return key_; }
+
+  /**
+   * @brief Gets the pointer to the slot payload.
+   *
+   * @return Pointer to the slot payload
+   */
+  [[nodiscard]] __device__ constexpr mapped_type* payload() const noexcept { return payload_; }
+
+  /**
+   * Equality operator
+   *
+   * @return True if two iterators are identical
+   */
+  friend __device__ constexpr bool operator==(iterator const& lhs, iterator const& rhs) noexcept
+  {
+    return lhs.key_ == rhs.key_;
+  }
+
+  /**
+   * Inequality operator
+   *
+   * @return True if two iterators are not identical
+   */
+  friend __device__ constexpr bool operator!=(iterator const& lhs, iterator const& rhs) noexcept
+  {
+    return not(lhs == rhs);
+  }
+
+ private:
+  key_type* key_{};         ///< Pointer to the current slot key
+  mapped_type* payload_{};  ///< Pointer to the current slot payload
+};
+
+template <typename T, int32_t BucketSize, typename Extent>
+__device__ constexpr soa_bucket_storage_ref<T, BucketSize, Extent>::iterator
+soa_bucket_storage_ref<T, BucketSize, Extent>::end() noexcept
+{
+  return iterator{reinterpret_cast<key_type*>(this->keys_) + this->capacity(),
+                  reinterpret_cast<mapped_type*>(this->payloads_) + this->capacity()};
+}
+
+template <typename T, int32_t BucketSize, typename Extent>
+__device__ constexpr soa_bucket_storage_ref<T, BucketSize, Extent>::const_iterator
+soa_bucket_storage_ref<T, BucketSize, Extent>::end() const noexcept
+{
+  return const_iterator{reinterpret_cast<key_type*>(this->keys_) + this->capacity(),
+                        reinterpret_cast<mapped_type*>(this->payloads_) + this->capacity()};
+}
+
+template <typename T, int32_t BucketSize, typename Extent>
+__host__ __device__ constexpr soa_bucket_storage_ref<T, BucketSize, Extent>::key_bucket_type*
+soa_bucket_storage_ref<T, BucketSize, Extent>::key_data() const noexcept
+{
+  return keys_;
+}
+
+template <typename T, int32_t BucketSize, typename Extent>
+__host__ __device__ constexpr soa_bucket_storage_ref<T, BucketSize, Extent>::mapped_bucket_type*
+soa_bucket_storage_ref<T, BucketSize, Extent>::payload_data() const noexcept
+{
+  return payloads_;
+}
+
+template <typename T, int32_t BucketSize, typename Extent>
+__device__ constexpr soa_bucket_storage_ref<T, BucketSize, Extent>::iterator
+soa_bucket_storage_ref<T, BucketSize, Extent>::slot(size_type index,
+                                                    int32_t intra_bucket_index) const noexcept
+{
+  return iterator{(this->keys_ + index)->data() + intra_bucket_index,
+                  (this->payloads_ + index)->data() + intra_bucket_index};
+}
+
+template <typename T, int32_t BucketSize, typename Extent>
+__device__ constexpr soa_bucket_storage_ref<T, BucketSize, Extent>::bucket_type
+soa_bucket_storage_ref<T, BucketSize, Extent>::operator[](size_type index) const noexcept
+{
+  auto const keys     = this->key_bucket(index);
+  auto const payloads = *reinterpret_cast<mapped_bucket_type*>(
+    __builtin_assume_aligned(this->payloads_ + index, sizeof(mapped_type) * bucket_size));
+
+  bucket_type slots;
+#pragma unroll
+  for (int32_t i = 0; i < bucket_size; ++i) {
+    slots[i] = value_type{keys[i], payloads[i]};
+  }
+  return slots;
+}
+
+template <typename T, int32_t BucketSize, typename Extent>
+__device__ constexpr soa_bucket_storage_ref<T, BucketSize, Extent>::key_bucket_type
+soa_bucket_storage_ref<T, BucketSize, Extent>::key_bucket(size_type index) const noexcept
+{
+  return *reinterpret_cast<key_bucket_type*>(
+    __builtin_assume_aligned(this->keys_ + index, sizeof(key_type) * bucket_size));
+}
+
+}  // namespace cuco
@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/storage/kernels.cuh>
+#include <cuco/detail/storage/storage_base.cuh>
+#include <cuco/detail/utility/cuda.hpp>
+#include <cuco/extent.cuh>
+
+#include <cuda/atomic>
+#include <cuda/stream_ref>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace cuco {
+
+template <typename T,
+          int32_t BucketSize,
+          int32_t StashSize,
+          int32_t MaxProbeSteps,
+          typename Extent,
+          typename Allocator>
+constexpr stash_bucket_storage<T, BucketSize, StashSize, MaxProbeSteps, Extent, Allocator>::
+  stash_bucket_storage(Extent size, Allocator const& allocator)
+  : detail::bucket_storage_base<T, BucketSize, Extent>{size},
+    allocator_{allocator},
+    bucket_deleter_{num_buckets(), allocator_},
+    buckets_{allocator_.allocate(num_buckets()), bucket_deleter_},
+    stash_counter_{allocator}
+{
+}
+
+template <typename T,
+          int32_t BucketSize,
+          int32_t StashSize,
+          int32_t MaxProbeSteps,
+          typename Extent,
+          typename Allocator>
+constexpr stash_bucket_storage<T, BucketSize, StashSize, MaxProbeSteps, Extent, Allocator>::
+  size_type
+  stash_bucket_storage<T, BucketSize, StashSize, MaxProbeSteps, Extent, Allocator>::num_buckets()
+    const noexcept
+{
+  return base_type::num_buckets() + ref_type::num_stash_buckets;
+}
+
+template <typename T,
+          int32_t BucketSize,
+          int32_t StashSize,
+          int32_t MaxProbeSteps,
+          typename Extent,
+          typename Allocator>
+constexpr stash_bucket_storage<T, BucketSize, StashSize, MaxProbeSteps, Extent, Allocator>::
+  size_type
+  stash_bucket_storage<T, BucketSize, StashSize, MaxProbeSteps, Extent, Allocator>::capacity()
+    const noexcept
+{
+  return this->num_buckets() * bucket_size;
+}
+
+template <typename T,
+          int32_t BucketSize,
+          int32_t StashSize,
+          int32_t MaxProbeSteps,
+          typename Extent,
+          typename Allocator>
+constexpr stash_bucket_storage<T, BucketSize, StashSize, MaxProbeSteps, Extent, Allocator>::
+  bucket_type*
+  stash_bucket_storage<T, BucketSize, StashSize, MaxProbeSteps, Extent, Allocator>::data()
+    const noexcept
+{
+  return buckets_.get();
+}
+
+template <typename T,
+          int32_t BucketSize,
+          int32_t StashSize,
+          int32_t MaxProbeSteps,
+          typename Extent,
+          typename Allocator>
+constexpr stash_bucket_storage<T, BucketSize, StashSize, MaxProbeSteps, Extent, Allocator>::
+  allocator_type
+  stash_bucket_storage<T, BucketSize, StashSize, MaxProbeSteps, Extent, Allocator>::allocator()
+    const noexcept
+{
+  return allocator_;
+}
+
+template <typename T,
+          int32_t BucketSize,
+          int32_t StashSize,
+          int32_t MaxProbeSteps,
+          typename Extent,
+          typename Allocator>
+constexpr stash_bucket_storage<T, BucketSize, StashSize, MaxProbeSteps, Extent, Allocator>::
+  ref_type
+  stash_bucket_storage<T, BucketSize, StashSize, MaxProbeSteps, Extent, Allocator>::ref()
+    const noexcept
+{
+  return ref_type{this->bucket_extent(), this->data(), this->stash_counter_.data()};
+}
+
+template <typename T,
+          int32_t BucketSize,
+          int32_t StashSize,
+          int32_t MaxProbeSteps,
+          typename Extent,
+          typename Allocator>
+void stash_bucket_storage<T, BucketSize, StashSize, MaxProbeSteps, Extent, Allocator>::initialize(
+  value_type key, cuda::stream_ref stream)
+{
+  this->initialize_async(key, stream);
+  stream.wait();
+}
+
+template <typename T,
+          int32_t BucketSize,
+          int32_t StashSize,
+          int32_t MaxProbeSteps,
+          typename Extent,
+          typename Allocator>
+void stash_bucket_storage<T, BucketSize, StashSize, MaxProbeSteps, Extent, Allocator>::
+  initialize_async(value_type key, cuda::stream_ref stream) noexcept
+{
+  this->stash_counter_.reset(stream);
+  if (this->num_buckets() == 0) { return; }
+
+  auto constexpr cg_size = 1;
+  auto constexpr stride  = 4;
+  auto const grid_size   = cuco::detail::grid_size(this->num_buckets(), cg_size, stride);
+
+  detail::initialize<<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+    this->data(), this->num_buckets(), key);
+}
+
+template <typename T, int32_t BucketSize, int32_t StashSize, int32_t MaxProbeSteps, typename Extent>
+__host__ __device__ constexpr stash_bucket_storage_ref<T,
+                                                       BucketSize,
+                                                       StashSize,
+                                                       MaxProbeSteps,
+                                                       Extent>::
+  stash_bucket_storage_ref(Extent size,
+                           bucket_type* buckets,
+                           stash_counter_type* stash_counter) noexcept
+  : base_type{size, buckets}, stash_counter_{stash_counter}
+{
+}
+
+template <typename T, int32_t BucketSize, int32_t StashSize, int32_t MaxProbeSteps, typename Extent>
+__host__ __device__ constexpr stash_bucket_storage_ref<T,
+                                                       BucketSize,
+                                                       StashSize,
+                                                       MaxProbeSteps,
+                                                       Extent>::size_type
+stash_bucket_storage_ref<T, BucketSize, StashSize, MaxProbeSteps, Extent>::num_buckets()
+  const noexcept
+{
+  return base_type::num_buckets() + num_stash_buckets;
+}
+
+template <typename T, int32_t BucketSize, int32_t StashSize, int32_t MaxProbeSteps, typename Extent>
+__host__ __device__ constexpr stash_bucket_storage_ref<T,
+                                                       BucketSize,
+                                                       StashSize,
+                                                       MaxProbeSteps,
+                                                       Extent>::size_type
+stash_bucket_storage_ref<T, BucketSize, StashSize, MaxProbeSteps, Extent>::capacity()
+  const noexcept
+{
+  return this->num_buckets() * bucket_size;
+}
+
+template <typename T, int32_t BucketSize, int32_t StashSize, int32_t MaxProbeSteps, typename Extent>
+__device__ constexpr stash_bucket_storage_ref<T, BucketSize, StashSize, MaxProbeSteps, Extent>::
+  iterator
+  stash_bucket_storage_ref<T, BucketSize, StashSize, MaxProbeSteps, Extent>::end() noexcept
+{
+  return iterator{reinterpret_cast<value_type*>(this->data() + this->num_buckets())};
+}
+
+template <typename T, int32_t BucketSize, int32_t StashSize, int32_t MaxProbeSteps, typename Extent>
+__device__ constexpr stash_bucket_storage_ref<T, BucketSize, StashSize, MaxProbeSteps, Extent>::
+  const_iterator
+  stash_bucket_storage_ref<T, BucketSize, StashSize, MaxProbeSteps, Extent>::end() const noexcept
+{
+  return const_iterator{reinterpret_cast<value_type*>(this->data() + this->num_buckets())};
+}
+
+template <typename T, int32_t BucketSize, int32_t StashSize, int32_t MaxProbeSteps, typename Extent>
+__host__ __device__ constexpr stash_bucket_storage_ref<T,
+                                                       BucketSize,
+                                                       StashSize,
+                                                       MaxProbeSteps,
+                                                       Extent>::stash_counter_type*
+stash_bucket_storage_ref<T, BucketSize, StashSize, MaxProbeSteps, Extent>::stash_counter()
+  const noexcept
+{
+  return stash_counter_;
+}
+
+template <typename T, int32_t BucketSize, int32_t StashSize, int32_t MaxProbeSteps, typename Extent>
+template <typename Iterator>
+__device__ constexpr detail::stash_probing_iterator<Iterator>
+stash_bucket_storage_ref<T, BucketSize, StashSize, MaxProbeSteps, Extent>::probing_iterator(
+  Iterator primary, size_type rank, size_type stride) const noexcept
+{
+  auto const stash_begin = base_type::num_buckets();
+  return detail::stash_probing_iterator<Iterator>{
+    primary, max_probe_steps, stash_begin + rank, this->num_buckets(), stride};
+}
+
+template <typename T, int32_t BucketSize, int32_t StashSize, int32_t MaxProbeSteps, typename Extent>
+__device__ void stash_bucket_storage_ref<T, BucketSize, StashSize, MaxProbeSteps, Extent>::
+  record_insert(size_type index) const noexcept
+{
+  if (index >= base_type::num_buckets()) {
+    this->stash_counter_->fetch_add(size_type{1}, cuda::memory_order_relaxed);
+  }
+}
+
+template <typename T, int32_t BucketSize, int32_t StashSize, int32_t MaxProbeSteps, typename Extent>
+__device__ void stash_bucket_storage_ref<T, BucketSize, StashSize, MaxProbeSteps, Extent>::
+  record_erase(size_type index) const noexcept
+{
+  if (index >= base_type::num_buckets()) {
+    this->stash_counter_->fetch_sub(size_type{1}, cuda::memory_order_relaxed);
+  }
+}
+
+}  // namespace cuco
@@ -16,7 +16,12 @@
 
 #pragma once
 
+#include <cuco/bounded_bucket_storage.cuh>
 #include <cuco/bucket_storage.cuh>
+#include <cuco/counted_bucket_storage.cuh>
+#include <cuco/soa_bucket_storage.cuh>
+#include <cuco/stash_bucket_storage.cuh>
+#include <cuco/tagged_bucket_storage.cuh>
 
 namespace cuco {
 namespace detail {
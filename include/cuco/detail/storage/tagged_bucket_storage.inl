@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/storage/kernels.cuh>
+#include <cuco/detail/storage/storage_base.cuh>
+#include <cuco/detail/utility/cuda.hpp>
+#include <cuco/extent.cuh>
+
+#include <cuda/stream_ref>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+namespace cuco {
+
+template <typename T, int32_t BucketSize, typename Extent, typename Allocator>
+constexpr tagged_bucket_storage<T, BucketSize, Extent, Allocator>::tagged_bucket_storage(
+  Extent size, Allocator const& allocator)
+  : base_type{size, allocator},
+    tag_allocator_{allocator},
+    tag_deleter_{this->num_buckets() + tag_padding, tag_allocator_},
+    tags_{tag_allocator_.allocate(this->num_buckets() + tag_padding), tag_deleter_}
+{
+}
+
+template <typename T, int32_t BucketSize, typename Extent, typename Allocator>
+constexpr tagged_bucket_storage<T, BucketSize, Extent, Allocator>::tag_bucket_type*
+tagged_bucket_storage<T, BucketSize, Extent, Allocator>::tag_data() const noexcept
+{
+  return tags_.get();
+}
+
+template <typename T, int32_t BucketSize, typename Extent, typename Allocator>
+constexpr tagged_bucket_storage<T, BucketSize, Extent, Allocator>::ref_type
+tagged_bucket_storage<T, BucketSize, Extent, Allocator>::ref() const noexcept
+{
+  return ref_type{this->bucket_extent(), this->data(), this->tag_data()};
+}
+
+template <typename T, int32_t BucketSize, typename Extent, typename Allocator>
+void tagged_bucket_storage<T, BucketSize, Extent, Allocator>::initialize(value_type key,
+                                                                         cuda::stream_ref stream)
+{
+  this->initialize_async(key, stream);
+  stream.wait();
+}
+
+template <typename T, int32_t BucketSize, typename Extent, typename Allocator>
+void tagged_bucket_storage<T, BucketSize, Extent, Allocator>::initialize_async(
+  value_type key, cuda::stream_ref stream) noexcept
+{
+  if (this->num_buckets() == 0) { return; }
+
+  base_type::initialize_async(key, stream);
+
+  auto constexpr cg_size = 1;
+  auto constexpr stride  = 4;
+  auto const grid_size   = cuco::detail::grid_size(this->num_buckets(), cg_size, stride);
+
+  detail::initialize<<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+    this->tag_data(), this->num_buckets(), detail::empty_tag);
+}
+
+template <typename T, int32_t BucketSize, typename Extent>
+__host__ __device__ constexpr tagged_bucket_storage_ref<T, BucketSize, Extent>::
+  tagged_bucket_storage_ref(Extent size, bucket_type* buckets, tag_bucket_type* tags) noexcept
+  : base_type{size, buckets}, tags_{tags}
+{
+}
+
+template <typename T, int32_t BucketSize, typename Extent>
+__host__ __device__ constexpr tagged_bucket_storage_ref<T, BucketSize, Extent>::tag_bucket_type*
+tagged_bucket_storage_ref<T, BucketSize, Extent>::tag_data() const noexcept
+{
+  return tags_;
+}
+
+template <typename T, int32_t BucketSize, typename Extent>
+__device__ constexpr tagged_bucket_storage_ref<T, BucketSize, Extent>::tag_bucket_type
+tagged_bucket_storage_ref<T, BucketSize, Extent>::tag_bucket(size_type index) const noexcept
+{
+  return *reinterpret_cast<tag_bucket_type*>(
+    __builtin_assume_aligned(this->tags_ + index, sizeof(tag_type) * bucket_size));
+}
+
+template <typename T, int32_t BucketSize, typename Extent>
+__device__ tagged_bucket_storage_ref<T, BucketSize, Extent>::tag_bucket_type
+tagged_bucket_storage_ref<T, BucketSize, Extent>::load_tag_bucket(size_type index) const noexcept
+{
+  auto const* const src = reinterpret_cast<tag_type const volatile*>((this->tags_ + index)->data());
+  tag_bucket_type tags;
+#pragma unroll
+  for (int32_t i = 0; i < bucket_size; ++i) {
+    tags[i] = src[i];
+  }
+  return tags;
+}
+
+template <typename T, int32_t BucketSize, typename Extent>
+__device__ tagged_bucket_storage_ref<T, BucketSize, Extent>::tag_type
+tagged_bucket_storage_ref<T, BucketSize, Extent>::claim_tag(
+  size_type index, int32_t intra_bucket_index) const noexcept
+{
+  // Tags are swapped through the aligned 32-bit word containing them
+  auto const address = reinterpret_cast<std::uintptr_t>((this->tags_ + index)->data() +
+                                                        intra_bucket_index);
+  auto* const word   = reinterpret_cast<unsigned int*>(address & ~std::uintptr_t{3});
+  auto const shift   = static_cast<unsigned int>(8 * (address & 3));
+
+  auto old = *reinterpret_cast<unsigned int volatile*>(word);
+  while (true) {
+    auto const current = static_cast<tag_type>(old >> shift);
+    if (current != detail::empty_tag and current != detail::erased_tag) { return current; }
+    auto const desired = (old & ~(0xFFu << shift)) | (unsigned int{detail::busy_tag} << shift);
+    auto const assumed = old;
+    old                = atomicCAS(word, assumed, desired);
+    if (old == assumed) { return current; }
+  }
+}
+
+template <typename T, int32_t BucketSize, typename Extent>
+__device__ void tagged_bucket_storage_ref<T, BucketSize, Extent>::store_tag(
+  size_type index, int32_t intra_bucket_index, tag_type tag) const noexcept
+{
+  (this->tags_ + index)->data()[intra_bucket_index] = tag;
+}
+
+template <typename T, int32_t BucketSize, typename Extent>
+__device__ uint32_t tagged_bucket_storage_ref<T, BucketSize, Extent>::match(
+  tag_bucket_type const& tags, tag_type tag) noexcept
+{
+  uint32_t mask = 0;
+  if constexpr (bucket_size % 4 == 0) {
+    // Byte-parallel compare of four tags at a time
+    auto const pattern = 0x0101'0101u * tag;
+#pragma unroll
+    for (int32_t word = 0; word < bucket_size / 4; ++word) {
+      uint32_t packed;
+      std::memcpy(&packed, tags.data() + 4 * word, sizeof(packed));
+      auto const equal = __vcmpeq4(packed, pattern);
+#pragma unroll
+      for (int32_t byte = 0; byte < 4; ++byte) {
+        mask |= ((equal >> (8 * byte)) & 1u) << (4 * word + byte);
+      }
+    }
+  } else {
+#pragma unroll
+    for (int32_t i = 0; i < bucket_size; ++i) {
+      mask |= static_cast<uint32_t>(tags[i] == tag) << i;
+    }
+  }
+  return mask;
+}
+
+}  // namespace cuco
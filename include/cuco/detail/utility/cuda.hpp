@@ -18,6 +18,8 @@
 #include <cuco/detail/error.hpp>
 #include <cuco/detail/utility/math.cuh>
 
+#include <cuda/stream_ref>
+
 namespace cuco {
 namespace detail {
 
@@ -76,5 +78,19 @@ constexpr auto max_occupancy_grid_size(int32_t block_size,
   return max_active_blocks_per_multiprocessor * num_multiprocessors;
 }
 
+/**
+ * @brief Indicates whether `stream` is being captured into a CUDA graph.
+ *
+ * @param stream CUDA stream to query
+ *
+ * @return `true` if a stream capture is active on `stream`
+ */
+inline bool is_capturing(cuda::stream_ref stream)
+{
+  auto status = cudaStreamCaptureStatusNone;
+  CUCO_CUDA_TRY(cudaStreamIsCapturing(stream.get(), &status));
+  return status == cudaStreamCaptureStatusActive;
+}
+
 }  // namespace detail
 }  // namespace cuco
@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/utility/cuda.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace cuco {
+namespace detail {
+
+/// Minimum number of elements processed by each host worker thread
+constexpr index_type host_grain_size() noexcept { return 1 << 14; }
+
+/**
+ * @brief Computes the number of host worker threads used to process `n` elements.
+ *
+ * @param n Number of elements
+ *
+ * @return The number of worker threads, at least one
+ */
+inline index_type num_host_workers(index_type n) noexcept
+{
+  auto const max_workers =
+    static_cast<index_type>(std::max(1u, std::thread::hardware_concurrency()));
+  return std::clamp(int_div_ceil(n, host_grain_size()), index_type{1}, max_workers);
+}
+
+/**
+ * @brief Process-wide pool of persistent host worker threads.
+ *
+ * The threads are created on first use and block on a condition variable between bulk operations,
+ * so that small operations do not pay for thread creation.
+ */
+class host_thread_pool {
+ public:
+  /**
+   * @brief Gets the process-wide pool, with one thread less than the number of hardware threads.
+   *
+   * @return Reference to the pool
+   */
+  static host_thread_pool& instance()
+  {
+    static host_thread_pool pool{
+      static_cast<index_type>(std::max(1u, std::thread::hardware_concurrency())) - 1};
+    return pool;
+  }
+
+  host_thread_pool(host_thread_pool const&)            = delete;
+  host_thread_pool& operator=(host_thread_pool const&) = delete;
+
+  ~host_thread_pool()
+  {
+    {
+      std::lock_guard<std::mutex> lock{mutex_};
+      stop_ = true;
+    }
+    work_cv_.notify_all();
+    for (auto& thread : threads_) {
+      thread.join();
+    }
+  }
+
+  /**
+   * @brief Invokes `task(w)` for every `w` in `[0, num_tasks)`, the last one on the calling thread.
+   *
+   * @note Returns `false` without invoking `task` if the pool is busy, e.g., when called from
+   * another host thread or from within a task, or if `num_tasks` exceeds the number of pool threads
+   * plus one.
+   *
+   * @throw Rethrows the first exception thrown by a task once all tasks are completed, so that no
+   * worker still refers to `task`
+   *
+   * @param num_tasks Number of tasks
+   * @param task Callable invoked with each task index
+   *
+   * @return `true` once all tasks are completed
+   */
+  bool try_run(index_type num_tasks, std::function<void(index_type)> const& task)
+  {
+    if (num_tasks - 1 > static_cast<index_type>(threads_.size())) { return false; }
+    std::unique_lock<std::mutex> submit_lock{submit_mutex_, std::try_to_lock};
+    if (not submit_lock.owns_lock()) { return false; }
+
+    {
+      std::lock_guard<std::mutex> lock{mutex_};
+      task_      = &task;
+      num_tasks_ = num_tasks;
+      pending_   = num_tasks - 1;
+      ++generation_;
+    }
+    work_cv_.notify_all();
+
+    std::exception_ptr error;
+    try {
+      task(num_tasks - 1);
+    } catch (...) {
+      error = std::current_exception();
+    }
+
+    std::unique_lock<std::mutex> lock{mutex_};
+    done_cv_.wait(lock, [this]() { return pending_ == 0; });
+    task_ = nullptr;
+    auto worker_error = std::exchange(worker_error_, nullptr);
+    if (not error) { error = worker_error; }
+    if (error) { std::rethrow_exception(error); }
+    return true;
+  }
+
+ private:
+  explicit host_thread_pool(index_type num_threads)
+  {
+    threads_.reserve(num_threads);
+    for (index_type id = 0; id < num_threads; ++id) {
+      threads_.emplace_back([this, id]() { this->worker_loop(id); });
+    }
+  }
+
+  void worker_loop(index_type id)
+  {
+    std::uint64_t seen_generation = 0;
+    while (true) {
+      std::function<void(index_type)> const* task = nullptr;
+      {
+        std::unique_lock<std::mutex> lock{mutex_};
+        work_cv_.wait(lock, [&]() { return stop_ or generation_ != seen_generation; });
+        if (stop_) { return; }
+        seen_generation = generation_;
+        if (id >= num_tasks_ - 1) { continue; }
+        task = task_;
+      }
+
+      std::exception_ptr error;
+      try {
+        (*task)(id);
+      } catch (...) {
+        error = std::current_exception();
+      }
+
+      std::lock_guard<std::mutex> lock{mutex_};
+      if (error and not worker_error_) { worker_error_ = error; }
+      if (--pending_ == 0) { done_cv_.notify_one(); }
+    }
+  }
+
+  std::vector<std::thread> threads_;  ///< Worker threads
+  std::mutex submit_mutex_;           ///< Held for the duration of a `try_run`
+  std::mutex mutex_;                  ///< Protects the state below
+  std::condition_variable work_cv_;   ///< Signals new work or shutdown to the workers
+  std::condition_variable done_cv_;   ///< Signals the completion of all worker tasks
+  std::function<void(index_type)> const* task_{nullptr};  ///< Task of the current generation
+  index_type num_tasks_{0};                               ///< Number of tasks of the generation
+  index_type pending_{0};            ///< Number of worker tasks not completed yet
+  std::exception_ptr worker_error_;  ///< First exception thrown by a worker task
+  std::uint64_t generation_{0};      ///< Incremented for every `try_run`
+  bool stop_{false};                 ///< Whether the workers shall exit
+};
+
+/**
+ * @brief Splits `[0, n)` into contiguous chunks and invokes `f(worker, begin, end)` for each chunk.
+ *
+ * @note Chunks hold at least `host_grain_size()` elements, so smaller inputs are processed by the
+ * calling thread alone. Otherwise, the chunks are processed by the persistent `host_thread_pool`,
+ * the last one by the calling thread. If the pool is busy, e.g., in nested or concurrent calls,
+ * all chunks are processed by the calling thread. This function returns once all chunks are
+ * processed.
+ *
+ * @tparam Func Host callable type
+ *
+ * @param n Number of elements
+ * @param f Callable invoked with the worker index and the element range of each chunk
+ */
+template <typename Func>
+void host_parallel_chunks(index_type n, Func const& f)
+{
+  if (n <= 0) { return; }
+
+  auto const num_workers = num_host_workers(n);
+  auto const chunk_size  = int_div_ceil(n, num_workers);
+
+  std::function<void(index_type)> const run_chunk = [&f, chunk_size, n](index_type w) {
+    f(w, w * chunk_size, std::min(n, (w + 1) * chunk_size));
+  };
+
+  if (num_workers > 1 and host_thread_pool::instance().try_run(num_workers, run_chunk)) { return; }
+  for (index_type w = 0; w < num_workers; ++w) {
+    run_chunk(w);
+  }
+}
+
+/**
+ * @brief Invokes `f(i)` for every `i` in `[0, n)` using all hardware threads of the host.
+ *
+ * @tparam Func Host callable type
+ *
+ * @param n Number of elements
+ * @param f Callable invoked with each element index
+ */
+template <typename Func>
+void host_parallel_for(index_type n, Func const& f)
+{
+  host_parallel_chunks(n, [&f](index_type, index_type begin, index_type end) {
+    for (auto i = begin; i < end; ++i) {
+      f(i);
+    }
+  });
+}
+
+/**
+ * @brief Computes the sum of `f(i)` over all `i` in `[0, n)` using all hardware threads of the
+ * host.
+ *
+ * @tparam Func Host callable type whose return type is convertible to `index_type`
+ *
+ * @param n Number of elements
+ * @param f Callable invoked with each element index
+ *
+ * @return The sum of all invocation results
+ */
+template <typename Func>
+index_type host_parallel_sum(index_type n, Func const& f)
+{
+  std::vector<index_type> sums(num_host_workers(n), 0);
+  host_parallel_chunks(n, [&](index_type worker, index_type begin, index_type end) {
+    index_type sum = 0;
+    for (auto i = begin; i < end; ++i) {
+      sum += static_cast<index_type>(f(i));
+    }
+    sums[worker] = sum;
+  });
+  return std::accumulate(sums.begin(), sums.end(), index_type{0});
+}
+
+}  // namespace detail
+}  // namespace cuco
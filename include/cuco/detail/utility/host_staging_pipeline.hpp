@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/error.hpp>
+#include <cuco/detail/utility/cuda.hpp>
+#include <cuco/utility/allocator.hpp>
+
+#include <cuda/stream_ref>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace cuco {
+namespace detail {
+
+/// Default number of elements copied to the device per pipeline stage
+constexpr std::size_t default_host_chunk_size() noexcept { return std::size_t{1} << 22; }
+/// Default number of pipeline stages
+constexpr int32_t default_host_num_stages() noexcept { return 3; }
+
+/**
+ * @brief Streams host memory ranges to the device in chunks and processes each chunk on the device
+ * while the next one is being copied.
+ *
+ * Each stage owns a pinned host buffer, a device buffer and a CUDA stream. Chunk `i` is handled by
+ * stage `i % num_stages`: the host thread copies it into the stage's pinned buffer, an asynchronous
+ * host-to-device copy moves it to the stage's device buffer and the chunk kernel is launched right
+ * behind the copy in the stage's stream. Since consecutive chunks use different streams, the copy
+ * of chunk `i + 1` overlaps the kernel of chunk `i`, and the host copy overlaps both. The host
+ * waits for a stage only before reusing its pinned buffer, i.e., once its previous copy is done.
+ *
+ * Inputs given as pointers to page-locked host memory are copied to the device directly, skipping
+ * the pinned buffers.
+ *
+ * The buffers are sized in bytes, so that one pipeline can be kept alive and reused by subsequent
+ * runs over inputs of any element type instead of reallocating pinned memory for each of them.
+ *
+ * @tparam Allocator Type of allocator used for the device buffers
+ */
+template <typename Allocator>
+class host_staging_pipeline {
+ public:
+  using allocator_type =
+    typename std::allocator_traits<Allocator>::template rebind_alloc<std::byte>;  ///< Allocator
+
+  /**
+   * @brief Allocates the buffers and streams of all stages.
+   *
+   * @throw If `chunk_bytes` is zero or `num_stages` is not positive
+   *
+   * @param chunk_bytes Number of bytes per chunk
+   * @param num_stages Number of pipeline stages
+   * @param allocator Allocator used for the device buffers
+   */
+  host_staging_pipeline(std::size_t chunk_bytes, int32_t num_stages, Allocator const& allocator)
+    : chunk_bytes_{chunk_bytes}, allocator_{allocator}
+  {
+    CUCO_EXPECTS(chunk_bytes > 0, "Chunk size must be positive.", std::invalid_argument);
+    CUCO_EXPECTS(num_stages > 0, "Number of stages must be positive.", std::invalid_argument);
+
+    stages_.resize(num_stages);
+    for (auto& stage : stages_) {
+      stage.device_buffer = allocator_.allocate(chunk_bytes_);
+      CUCO_CUDA_TRY(cudaStreamCreateWithFlags(&stage.stream, cudaStreamNonBlocking));
+      CUCO_CUDA_TRY(cudaEventCreateWithFlags(&stage.copied, cudaEventDisableTiming));
+    }
+    CUCO_CUDA_TRY(cudaEventCreateWithFlags(&joined_, cudaEventDisableTiming));
+
+    // The stage streams are not ordered after the stream the device buffers are allocated in
+    if constexpr (is_stream_ordered_allocator_v<allocator_type>) { allocator_.stream().wait(); }
+  }
+
+  host_staging_pipeline(host_staging_pipeline const&)            = delete;
+  host_staging_pipeline& operator=(host_staging_pipeline const&) = delete;
+
+  /**
+   * @brief Waits for all stages and releases their resources.
+   */
+  ~host_staging_pipeline()
+  {
+    for (auto& stage : stages_) {
+      if (stage.stream != nullptr) {
+        CUCO_ASSERT_CUDA_SUCCESS(cudaStreamSynchronize(stage.stream));
+        CUCO_ASSERT_CUDA_SUCCESS(cudaStreamDestroy(stage.stream));
+      }
+      if (stage.copied != nullptr) { CUCO_ASSERT_CUDA_SUCCESS(cudaEventDestroy(stage.copied)); }
+      if (stage.host_buffer != nullptr) {
+        CUCO_ASSERT_CUDA_SUCCESS(cudaFreeHost(stage.host_buffer));
+      }
+      if (stage.device_buffer != nullptr) {
+        allocator_.deallocate(stage.device_buffer, chunk_bytes_);
+      }
+    }
+    if (joined_ != nullptr) { CUCO_ASSERT_CUDA_SUCCESS(cudaEventDestroy(joined_)); }
+  }
+
+  /**
+   * @brief Checks whether this pipeline has the given shape and can thus be reused.
+   *
+   * @param chunk_bytes Number of bytes per chunk
+   * @param num_stages Number of pipeline stages
+   *
+   * @return `true` if both the chunk size and the number of stages match
+   */
+  [[nodiscard]] bool matches(std::size_t chunk_bytes, int32_t num_stages) const noexcept
+  {
+    return chunk_bytes_ == chunk_bytes and static_cast<int32_t>(stages_.size()) == num_stages;
+  }
+
+  /**
+   * @brief Streams `[first, first + n)` to the device and calls `launch` for each chunk.
+   *
+   * All chunk work is ordered after the work submitted to `stream` so far, and the work submitted
+   * to `stream` afterwards is ordered after all chunk work.
+   *
+   * @throw If a chunk cannot hold a single element
+   *
+   * @tparam InputIt Host accessible random access iterator of trivially copyable elements
+   * @tparam Launch Host callable launching the device work of a chunk
+   *
+   * @param first Beginning of the host input range
+   * @param n Number of input elements
+   * @param launch Callable invoked as `launch(device_chunk, chunk_size, chunk_stream)`
+   * @param stream CUDA stream to order the pipeline with
+   */
+  template <typename InputIt, typename Launch>
+  void run(InputIt first, index_type n, Launch&& launch, cuda::stream_ref stream)
+  {
+    using value_type = typename std::iterator_traits<InputIt>::value_type;
+    static_assert(std::is_trivially_copyable_v<value_type>,
+                  "Host staging requires trivially copyable input elements.");
+
+    auto const chunk_size = static_cast<index_type>(chunk_bytes_ / sizeof(value_type));
+    CUCO_EXPECTS(chunk_size > 0, "Chunk size must be positive.", std::invalid_argument);
+
+    auto const* const pinned_input = page_locked_data(first);
+
+    this->fork(stream);
+    auto const num_stages = static_cast<index_type>(stages_.size());
+    for (index_type offset = 0, i = 0; offset < n; offset += chunk_size, ++i) {
+      auto& stage       = stages_[i % num_stages];
+      auto const count  = std::min(n - offset, chunk_size);
+      auto const nbytes = sizeof(value_type) * count;
+
+      void const* source = nullptr;
+      if (pinned_input != nullptr) {
+        source = pinned_input + offset;
+      } else {
+        // The pinned buffer is still read by the copy of the previous chunk of this stage
+        CUCO_CUDA_TRY(cudaEventSynchronize(stage.copied));
+        if (stage.host_buffer == nullptr) {
+          CUCO_CUDA_TRY(cudaMallocHost(&stage.host_buffer, chunk_bytes_));
+        }
+        std::copy(
+          first + offset, first + offset + count, reinterpret_cast<value_type*>(stage.host_buffer));
+        source = stage.host_buffer;
+      }
+
+      CUCO_CUDA_TRY(cudaMemcpyAsync(
+        stage.device_buffer, source, nbytes, cudaMemcpyHostToDevice, stage.stream));
+      CUCO_CUDA_TRY(cudaEventRecord(stage.copied, stage.stream));
+
+      auto const* const chunk = reinterpret_cast<value_type const*>(stage.device_buffer);
+      launch(chunk, count, cuda::stream_ref{stage.stream});
+    }
+    this->join(stream);
+  }
+
+ private:
+  /**
+   * @brief Orders all stage streams after the work submitted to `stream` so far.
+   *
+   * @param stream CUDA stream to fork from
+   */
+  void fork(cuda::stream_ref stream)
+  {
+    CUCO_CUDA_TRY(cudaEventRecord(joined_, stream.get()));
+    for (auto const& stage : stages_) {
+      CUCO_CUDA_TRY(cudaStreamWaitEvent(stage.stream, joined_, 0));
+    }
+  }
+
+  /**
+   * @brief Orders the work submitted to `stream` afterwards after all stage streams.
+   *
+   * @param stream CUDA stream to join into
+   */
+  void join(cuda::stream_ref stream)
+  {
+    for (auto const& stage : stages_) {
+      CUCO_CUDA_TRY(cudaEventRecord(joined_, stage.stream));
+      CUCO_CUDA_TRY(cudaStreamWaitEvent(stream.get(), joined_, 0));
+    }
+  }
+
+  /**
+   * @brief Gets the input as a pointer if it lives in page-locked host memory.
+   *
+   * @tparam InputIt Host accessible random access iterator
+   *
+   * @param first Beginning of the host input range
+   *
+   * @return `first` if it points to pinned or registered host memory, `nullptr` otherwise
+   */
+  template <typename InputIt>
+  [[nodiscard]] static auto page_locked_data(InputIt first)
+  {
+    using value_type = typename std::iterator_traits<InputIt>::value_type;
+    if constexpr (std::is_pointer_v<InputIt>) {
+      cudaPointerAttributes attributes{};
+      CUCO_CUDA_TRY(cudaPointerGetAttributes(&attributes, first));
+      if (attributes.type == cudaMemoryTypeHost) { return static_cast<value_type const*>(first); }
+    }
+    return static_cast<value_type const*>(nullptr);
+  }
+
+  /// Resources of a pipeline stage
+  struct stage_type {
+    std::byte* host_buffer{nullptr};    ///< Pinned host buffer, allocated on first use
+    std::byte* device_buffer{nullptr};  ///< Device buffer
+    cudaStream_t stream{nullptr};       ///< Stream the copy and the chunk kernel run in
+    cudaEvent_t copied{nullptr};        ///< Recorded once the host buffer has been copied
+  };
+
+  std::size_t chunk_bytes_;         ///< Number of bytes per chunk
+  allocator_type allocator_;        ///< Allocator used for the device buffers
+  std::vector<stage_type> stages_;  ///< Pipeline stages
+  cudaEvent_t joined_{nullptr};     ///< Event used to fork and join the stage streams
+};
+
+}  // namespace detail
+}  // namespace cuco
@@ -0,0 +1,511 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/error.hpp>
+#include <cuco/detail/utility/cuda.hpp>
+
+#include <cuda/std/tuple>
+#include <cuda/stream_ref>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+
+namespace cuco {
+namespace detail {
+
+/// Number of bytes staged through pinned host memory by each chunk of a save or load
+constexpr std::size_t persistence_chunk_bytes() noexcept { return std::size_t{64} << 20; }
+
+/**
+ * @brief Computes a fingerprint of the type `T`, stable across builds made with the same compiler.
+ *
+ * @tparam T Type to fingerprint
+ *
+ * @return The 64-bit FNV-1a hash of the mangled name of `T`
+ */
+template <class T>
+[[nodiscard]] std::uint64_t type_fingerprint() noexcept
+{
+  auto hash = std::uint64_t{0xcbf29ce484222325ull};
+  for (auto const* c = typeid(T).name(); *c != '\0'; ++c) {
+    hash = (hash ^ static_cast<unsigned char>(*c)) * std::uint64_t{0x100000001b3ull};
+  }
+  return hash;
+}
+
+/**
+ * @brief Appends the object representation of `value` to a configuration blob.
+ *
+ * @note Stateless types contribute no bytes. Aggregates with padding must be appended member by
+ * member since their padding bytes are indeterminate.
+ *
+ * @tparam T Trivially copyable type of the value
+ *
+ * @param config Configuration blob
+ * @param value Value to append
+ */
+template <class T>
+void append_persisted_config(std::vector<std::byte>& config, T const& value)
+{
+  static_assert(std::is_trivially_copyable_v<T>,
+                "Only trivially copyable configurations can be persisted.");
+  if constexpr (not std::is_empty_v<T>) {
+    auto const* first = reinterpret_cast<std::byte const*>(&value);
+    config.insert(config.end(), first, first + sizeof(T));
+  }
+}
+
+/**
+ * @brief Appends each element of `value` to a configuration blob.
+ *
+ * @tparam Ts Trivially copyable element types
+ *
+ * @param config Configuration blob
+ * @param value Tuple of values to append
+ */
+template <class... Ts>
+void append_persisted_config(std::vector<std::byte>& config, cuda::std::tuple<Ts...> const& value)
+{
+  cuda::std::apply(
+    [&config](auto const&... elements) { (append_persisted_config(config, elements), ...); },
+    value);
+}
+
+/**
+ * @brief RAII wrapper of a POSIX file descriptor.
+ */
+class file_descriptor {
+ public:
+  /**
+   * @brief Opens the file at `path`.
+   *
+   * @throw cuco::logic_error If the file cannot be opened
+   *
+   * @param path Path of the file
+   * @param flags Flags passed to `open`
+   */
+  file_descriptor(std::string const& path, int flags) : fd_{::open(path.c_str(), flags, 0644)}
+  {
+    CUCO_EXPECTS(fd_ >= 0, "Cannot open persisted file.");
+  }
+
+  file_descriptor(file_descriptor const&)            = delete;
+  file_descriptor& operator=(file_descriptor const&) = delete;
+
+  ~file_descriptor() { ::close(fd_); }
+
+  /**
+   * @brief Gets the underlying file descriptor.
+   *
+   * @return The file descriptor
+   */
+  [[nodiscard]] int get() const noexcept { return fd_; }
+
+  /**
+   * @brief Gets the size of the file.
+   *
+   * @return The file size in bytes
+   */
+  [[nodiscard]] std::uint64_t size() const
+  {
+    struct stat status {};
+    CUCO_EXPECTS(::fstat(fd_, &status) == 0, "Cannot stat persisted file.");
+    return static_cast<std::uint64_t>(status.st_size);
+  }
+
+  /**
+   * @brief Writes `num_bytes` bytes at the current file position, retrying partial writes.
+   *
+   * @throw cuco::logic_error If the write fails
+   *
+   * @param data Host pointer to the bytes to write
+   * @param num_bytes Number of bytes to write
+   */
+  void write(void const* data, std::size_t num_bytes) const
+  {
+    auto const* first = static_cast<char const*>(data);
+    while (num_bytes > 0) {
+      auto const written = ::write(fd_, first, num_bytes);
+      CUCO_EXPECTS(written > 0, "Cannot write persisted file.");
+      first += written;
+      num_bytes -= static_cast<std::size_t>(written);
+    }
+  }
+
+ private:
+  int fd_;  ///< POSIX file descriptor
+};
+
+/**
+ * @brief Read-only memory mapping of a whole file.
+ */
+class mapped_file {
+ public:
+  /**
+   * @brief Maps the file opened as `file` into the host address space.
+   *
+   * @param file Opened file
+   */
+  explicit mapped_file(file_descriptor const& file) : size_{file.size()}
+  {
+    if (size_ == 0) { return; }
+    auto* const addr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, file.get(), 0);
+    CUCO_EXPECTS(addr != MAP_FAILED, "Cannot map persisted file.");
+    data_ = static_cast<std::byte const*>(addr);
+    // the payload is streamed front to back exactly once
+    ::madvise(addr, size_, MADV_SEQUENTIAL);
+  }
+
+  mapped_file(mapped_file const&)            = delete;
+  mapped_file& operator=(mapped_file const&) = delete;
+
+  ~mapped_file()
+  {
+    if (data_ != nullptr) { ::munmap(const_cast<std::byte*>(data_), size_); }
+  }
+
+  /**
+   * @brief Gets the mapped bytes.
+   *
+   * @return Pointer to the first byte of the file
+   */
+  [[nodiscard]] std::byte const* data() const noexcept { return data_; }
+
+  /**
+   * @brief Gets the size of the mapping.
+   *
+   * @return The file size in bytes
+   */
+  [[nodiscard]] std::uint64_t size() const noexcept { return size_; }
+
+ private:
+  std::byte const* data_{nullptr};  ///< First mapped byte
+  std::uint64_t size_;              ///< Number of mapped bytes
+};
+
+/**
+ * @brief Two pinned host buffers and CUDA events used to double-buffer chunked transfers.
+ */
+class pinned_staging_buffers {
+ public:
+  /**
+   * @brief Allocates both buffers of `chunk_bytes` bytes each.
+   *
+   * @param chunk_bytes Size of each buffer in bytes
+   */
+  explicit pinned_staging_buffers(std::size_t chunk_bytes)
+  {
+    // Every resource is owned as soon as it is created, so a failure releases the previous ones
+    for (int i = 0; i < 2; ++i) {
+      void* buffer = nullptr;
+      CUCO_CUDA_TRY(cudaMallocHost(&buffer, chunk_bytes));
+      buffers_[i].reset(static_cast<std::byte*>(buffer));
+
+      cudaEvent_t event = nullptr;
+      CUCO_CUDA_TRY(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+      events_[i].reset(event);
+    }
+  }
+
+  pinned_staging_buffers(pinned_staging_buffers const&)            = delete;
+  pinned_staging_buffers& operator=(pinned_staging_buffers const&) = delete;
+
+  /**
+   * @brief Gets the pinned buffer used by the given chunk.
+   *
+   * @param chunk Chunk index
+   *
+   * @return Pointer to the pinned buffer
+   */
+  [[nodiscard]] std::byte* buffer(std::size_t chunk) const noexcept
+  {
+    return buffers_[chunk % 2].get();
+  }
+
+  /**
+   * @brief Gets the event marking the completion of the transfer of the given chunk.
+   *
+   * @param chunk Chunk index
+   *
+   * @return The CUDA event
+   */
+  [[nodiscard]] cudaEvent_t event(std::size_t chunk) const noexcept
+  {
+    return events_[chunk % 2].get();
+  }
+
+ private:
+  /// Deleter of a pinned host buffer
+  struct pinned_deleter {
+    void operator()(std::byte* ptr) const noexcept
+    {
+      CUCO_ASSERT_CUDA_SUCCESS(cudaFreeHost(ptr));
+    }
+  };
+
+  /// Deleter of a CUDA event
+  struct event_deleter {
+    void operator()(cudaEvent_t event) const noexcept
+    {
+      CUCO_ASSERT_CUDA_SUCCESS(cudaEventDestroy(event));
+    }
+  };
+
+  std::unique_ptr<std::byte, pinned_deleter> buffers_[2];  ///< Pinned host buffers
+  /// Completion events of the buffered transfers
+  std::unique_ptr<std::remove_pointer_t<cudaEvent_t>, event_deleter> events_[2];
+};
+
+/**
+ * @brief Reads and validates the header at the beginning of an opened persisted file.
+ *
+ * @throw cuco::logic_error If the header is missing, invalid or the file is truncated
+ *
+ * @param file Opened file
+ *
+ * @return The validated header
+ */
+inline persisted_header read_persisted_header(file_descriptor const& file)
+{
+  persisted_header header{};
+  CUCO_EXPECTS(::pread(file.get(), &header, sizeof(header), 0) ==
+                 static_cast<ssize_t>(sizeof(header)),
+               "Persisted file is too small to hold a header.");
+  CUCO_EXPECTS(header.magic == persisted_header::expected_magic,
+               "File is not a persisted cuco container.");
+  CUCO_EXPECTS(header.version == persisted_header::current_version,
+               "Unsupported persisted file version.");
+  CUCO_EXPECTS(header.payload_offset % persisted_header::payload_alignment == 0 and
+                 header.payload_offset >= sizeof(header) + header.config_bytes,
+               "Invalid payload offset in persisted file.");
+  CUCO_EXPECTS(file.size() >= header.payload_offset + header.payload_bytes,
+               "Persisted file is truncated.");
+  return header;
+}
+
+/**
+ * @brief Writes a persisted file holding the given header, configuration blob and storage.
+ *
+ * The storage is copied to the host in chunks of `persistence_chunk_bytes()` bytes through two
+ * pinned buffers, so that the device-to-host copy of a chunk overlaps with the file write of the
+ * previous one.
+ *
+ * @note `config_bytes`, `payload_offset` and `payload_bytes` of `header` are filled in by this
+ * function.
+ * @note This function synchronizes the given stream.
+ *
+ * @param path Path of the file to write
+ * @param header Header describing the persisted container
+ * @param config Configuration blob
+ * @param payload Pointer to the raw container storage
+ * @param payload_bytes Size of the raw container storage in bytes
+ * @param is_host_payload Flag indicating whether `payload` is a host pointer
+ * @param stream CUDA stream the container storage is accessed in
+ */
+inline void write_persisted_file(std::string const& path,
+                                 persisted_header header,
+                                 std::vector<std::byte> const& config,
+                                 void const* payload,
+                                 std::uint64_t payload_bytes,
+                                 bool is_host_payload,
+                                 cuda::stream_ref stream)
+{
+  auto constexpr alignment = persisted_header::payload_alignment;
+
+  header.magic          = persisted_header::expected_magic;
+  header.version        = persisted_header::current_version;
+  header.config_bytes   = config.size();
+  header.payload_offset = int_div_ceil(sizeof(header) + config.size(), alignment) * alignment;
+  header.payload_bytes  = payload_bytes;
+
+  auto const file = file_descriptor{path, O_WRONLY | O_CREAT | O_TRUNC};
+  file.write(&header, sizeof(header));
+  file.write(config.data(), config.size());
+  auto const padding =
+    std::vector<std::byte>(header.payload_offset - sizeof(header) - config.size());
+  file.write(padding.data(), padding.size());
+
+  auto const* src = static_cast<std::byte const*>(payload);
+  if (is_host_payload) {
+    file.write(src, payload_bytes);
+    return;
+  }
+  if (payload_bytes == 0) { return; }
+
+  auto const chunk_bytes = std::min<std::uint64_t>(persistence_chunk_bytes(), payload_bytes);
+  auto const num_chunks  = int_div_ceil(payload_bytes, chunk_bytes);
+  auto const staging     = pinned_staging_buffers{chunk_bytes};
+
+  auto const chunk_size = [&](std::uint64_t chunk) {
+    return std::min(chunk_bytes, payload_bytes - chunk * chunk_bytes);
+  };
+  auto const copy_chunk = [&](std::uint64_t chunk) {
+    CUCO_CUDA_TRY(cudaMemcpyAsync(staging.buffer(chunk),
+                                  src + chunk * chunk_bytes,
+                                  chunk_size(chunk),
+                                  cudaMemcpyDefault,
+                                  stream.get()));
+    CUCO_CUDA_TRY(cudaEventRecord(staging.event(chunk), stream.get()));
+  };
+
+  copy_chunk(0);
+  for (std::uint64_t chunk = 0; chunk < num_chunks; ++chunk) {
+    // the other buffer has been written out by the previous iteration
+    if (chunk + 1 < num_chunks) { copy_chunk(chunk + 1); }
+    CUCO_CUDA_TRY(cudaEventSynchronize(staging.event(chunk)));
+    file.write(staging.buffer(chunk), chunk_size(chunk));
+  }
+}
+
+/**
+ * @brief Validated persisted file whose payload can be loaded into a container storage.
+ *
+ * All checks are done on construction, before any container storage is touched, so that a caller
+ * only discards container state once the file is known to be loadable.
+ */
+class persisted_file_reader {
+ public:
+  /**
+   * @brief Opens the persisted file at `path` and validates it against the loading container.
+   *
+   * @throw cuco::logic_error If the file is invalid or was written by an incompatible container
+   *
+   * @param path Path of the file to read
+   * @param expected Header the container would write, with all container-describing fields set
+   * @param config Configuration blob of the container
+   * @param payload_bytes Size of the raw container storage in bytes
+   */
+  persisted_file_reader(std::string const& path,
+                        persisted_header const& expected,
+                        std::vector<std::byte> const& config,
+                        std::uint64_t payload_bytes)
+    : file_{path, O_RDONLY}, header_{read_persisted_header(file_)}, mapping_{file_}
+  {
+    CUCO_EXPECTS(
+      header_.kind == expected.kind and header_.type_fingerprint == expected.type_fingerprint,
+      "Persisted file was written by a different container type.");
+    CUCO_EXPECTS(header_.key_bytes == expected.key_bytes and
+                   header_.slot_bytes == expected.slot_bytes and
+                   header_.bucket_size == expected.bucket_size and
+                   header_.cg_size == expected.cg_size,
+                 "Persisted file has an incompatible storage layout.");
+    CUCO_EXPECTS(header_.capacity == expected.capacity and
+                   header_.num_buckets == expected.num_buckets and
+                   header_.payload_bytes == payload_bytes,
+                 "Persisted file capacity does not match the container capacity.");
+    CUCO_EXPECTS(
+      header_.config_bytes == config.size() and
+        std::memcmp(mapping_.data() + sizeof(header_), config.data(), config.size()) == 0,
+      "Persisted file hash function, probing scheme or sentinels do not match the container.");
+  }
+
+  /**
+   * @brief Copies the payload of the file into the container storage.
+   *
+   * The payload is copied in chunks of `persistence_chunk_bytes()` bytes through two pinned
+   * buffers, so that staging a chunk overlaps with the host-to-device copy of the previous one.
+   *
+   * @note This function synchronizes the given stream.
+   *
+   * @param payload Pointer to the raw container storage to overwrite
+   * @param is_host_payload Flag indicating whether `payload` is a host pointer
+   * @param stream CUDA stream the container storage is accessed in
+   */
+  void read_payload(void* payload, bool is_host_payload, cuda::stream_ref stream) const
+  {
+    auto const payload_bytes = header_.payload_bytes;
+    auto const* src          = mapping_.data() + header_.payload_offset;
+    auto* dst                = static_cast<std::byte*>(payload);
+    if (is_host_payload) {
+      std::memcpy(dst, src, payload_bytes);
+      return;
+    }
+    if (payload_bytes == 0) { return; }
+
+    auto const chunk_bytes = std::min<std::uint64_t>(persistence_chunk_bytes(), payload_bytes);
+    auto const num_chunks  = int_div_ceil(payload_bytes, chunk_bytes);
+    auto const staging     = pinned_staging_buffers{chunk_bytes};
+
+    for (std::uint64_t chunk = 0; chunk < num_chunks; ++chunk) {
+      auto const offset = chunk * chunk_bytes;
+      auto const size   = std::min(chunk_bytes, payload_bytes - offset);
+      // wait for the copy issued two chunks ago from the same buffer
+      if (chunk >= 2) { CUCO_CUDA_TRY(cudaEventSynchronize(staging.event(chunk))); }
+      std::memcpy(staging.buffer(chunk), src + offset, size);
+      CUCO_CUDA_TRY(cudaMemcpyAsync(
+        dst + offset, staging.buffer(chunk), size, cudaMemcpyDefault, stream.get()));
+      CUCO_CUDA_TRY(cudaEventRecord(staging.event(chunk), stream.get()));
+    }
+    stream.wait();
+  }
+
+ private:
+  file_descriptor file_;     ///< Opened persisted file
+  persisted_header header_;  ///< Validated header of the file
+  mapped_file mapping_;      ///< Read-only mapping of the whole file
+};
+
+/**
+ * @brief Loads the storage of a persisted file after validating it against the loading container.
+ *
+ * No element is rehashed.
+ *
+ * @note This function synchronizes the given stream.
+ *
+ * @throw cuco::logic_error If the file is invalid or was written by an incompatible container
+ *
+ * @param path Path of the file to read
+ * @param expected Header the container would write, with all container-describing fields set
+ * @param config Configuration blob of the container
+ * @param payload Pointer to the raw container storage to overwrite
+ * @param payload_bytes Size of the raw container storage in bytes
+ * @param is_host_payload Flag indicating whether `payload` is a host pointer
+ * @param stream CUDA stream the container storage is accessed in
+ */
+inline void read_persisted_file(std::string const& path,
+                                persisted_header const& expected,
+                                std::vector<std::byte> const& config,
+                                void* payload,
+                                std::uint64_t payload_bytes,
+                                bool is_host_payload,
+                                cuda::stream_ref stream)
+{
+  persisted_file_reader{path, expected, config, payload_bytes}.read_payload(
+    payload, is_host_payload, stream);
+}
+
+}  // namespace detail
+
+inline persisted_header read_persisted_header(std::string const& path)
+{
+  return detail::read_persisted_header(detail::file_descriptor{path, O_RDONLY});
+}
+
+}  // namespace cuco
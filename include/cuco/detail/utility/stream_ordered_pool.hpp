@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/error.hpp>
+#include <cuco/detail/utility/cuda.hpp>
+
+#include <cuda/stream_ref>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace cuco {
+namespace detail {
+
+/**
+ * @brief A `cudaMallocAsync` memory pool with a host-side cache of released blocks.
+ *
+ * Blocks are rounded up to power-of-two size classes. A released block is kept in a per-stream
+ * free list of its size class, together with an event recorded in the releasing stream, and handed
+ * out again by the next allocation of the same class in the same stream. Since a destroyed stream's
+ * handle may be reused by a new stream, the allocating stream waits on that event unless it has
+ * already completed, so a block is never handed out before its release. Other allocations are
+ * served by `cudaMallocFromPoolAsync` from a dedicated pool whose release threshold keeps freed
+ * memory reserved across stream synchronizations.
+ *
+ * While `stream` is being captured into a CUDA graph, the host cache is bypassed: allocations and
+ * releases become memory nodes of the graph, whose replays must not share blocks with eager work.
+ *
+ * @note This class is thread-safe.
+ */
+class stream_ordered_pool {
+ public:
+  /// Smallest size class in bytes, matching the alignment of `cudaMalloc`
+  static constexpr std::size_t min_block_bytes = 256;
+  /// Largest size class in bytes; larger blocks bypass the host cache
+  static constexpr std::size_t max_cached_block_bytes = std::size_t{1} << 30;
+
+  /**
+   * @brief Creates a memory pool on the current device.
+   *
+   * @param max_cached_bytes Maximum number of bytes held by the host cache
+   */
+  explicit stream_ordered_pool(std::size_t max_cached_bytes) : max_cached_bytes_{max_cached_bytes}
+  {
+    int device;
+    CUCO_CUDA_TRY(cudaGetDevice(&device));
+
+    cudaMemPoolProps props{};
+    props.allocType     = cudaMemAllocationTypePinned;
+    props.location.type = cudaMemLocationTypeDevice;
+    props.location.id   = device;
+    CUCO_CUDA_TRY(cudaMemPoolCreate(&pool_, &props));
+
+    auto threshold = std::numeric_limits<std::uint64_t>::max();
+    CUCO_CUDA_TRY(cudaMemPoolSetAttribute(pool_, cudaMemPoolAttrReleaseThreshold, &threshold));
+  }
+
+  stream_ordered_pool(stream_ordered_pool const&)            = delete;
+  stream_ordered_pool& operator=(stream_ordered_pool const&) = delete;
+
+  /**
+   * @brief Releases all cached blocks and destroys the pool.
+   *
+   * @note Cached blocks are freed with `cudaFree`, which waits for all pending work using them.
+   */
+  ~stream_ordered_pool()
+  {
+    for (auto const& [key, blocks] : free_blocks_) {
+      for (auto const& [block, event] : blocks) {
+        CUCO_ASSERT_CUDA_SUCCESS(cudaFree(block));
+        CUCO_ASSERT_CUDA_SUCCESS(cudaEventDestroy(event));
+      }
+    }
+    for (auto const event : spare_events_) {
+      CUCO_ASSERT_CUDA_SUCCESS(cudaEventDestroy(event));
+    }
+    CUCO_ASSERT_CUDA_SUCCESS(cudaMemPoolDestroy(pool_));
+  }
+
+  /**
+   * @brief Allocates at least `bytes` bytes in the order of `stream`.
+   *
+   * @param bytes Number of bytes to allocate
+   * @param stream CUDA stream the allocation is ordered in
+   *
+   * @return Pointer to the allocated memory
+   */
+  [[nodiscard]] void* allocate(std::size_t bytes, cuda::stream_ref stream)
+  {
+    auto const block_bytes = size_class(bytes);
+    if (block_bytes <= max_cached_block_bytes and not cuco::detail::is_capturing(stream)) {
+      std::lock_guard<std::mutex> lock{mutex_};
+      auto const it = free_blocks_.find({stream.get(), block_bytes});
+      if (it != free_blocks_.end() and not it->second.empty()) {
+        auto const [block, event] = it->second.back();
+        it->second.pop_back();
+        cached_bytes_ -= block_bytes;
+        spare_events_.push_back(event);
+
+        auto const status = cudaEventQuery(event);
+        if (status == cudaErrorNotReady) {
+          CUCO_CUDA_TRY(cudaStreamWaitEvent(stream.get(), event, 0));
+        } else {
+          CUCO_CUDA_TRY(status);
+        }
+        return block;
+      }
+    }
+
+    void* block;
+    CUCO_CUDA_TRY(cudaMallocFromPoolAsync(&block, block_bytes, pool_, stream.get()));
+    return block;
+  }
+
+  /**
+   * @brief Releases a block allocated with `allocate` in the order of `stream`.
+   *
+   * @param block Pointer to the block to release
+   * @param bytes Number of bytes passed to `allocate`
+   * @param stream CUDA stream the release is ordered in
+   */
+  void deallocate(void* block, std::size_t bytes, cuda::stream_ref stream)
+  {
+    auto const block_bytes = size_class(bytes);
+    if (block_bytes <= max_cached_block_bytes and not cuco::detail::is_capturing(stream)) {
+      std::lock_guard<std::mutex> lock{mutex_};
+      if (cached_bytes_ + block_bytes <= max_cached_bytes_) {
+        cudaEvent_t event;
+        if (spare_events_.empty()) {
+          CUCO_CUDA_TRY(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+        } else {
+          event = spare_events_.back();
+          spare_events_.pop_back();
+        }
+        CUCO_CUDA_TRY(cudaEventRecord(event, stream.get()));
+        free_blocks_[{stream.get(), block_bytes}].emplace_back(block, event);
+        cached_bytes_ += block_bytes;
+        return;
+      }
+    }
+    CUCO_CUDA_TRY(cudaFreeAsync(block, stream.get()));
+  }
+
+  /**
+   * @brief Gets the underlying CUDA memory pool.
+   *
+   * @return The memory pool handle
+   */
+  [[nodiscard]] cudaMemPool_t handle() const noexcept { return pool_; }
+
+ private:
+  /**
+   * @brief Computes the size class of an allocation.
+   *
+   * @param bytes Number of requested bytes
+   *
+   * @return The smallest power of two not less than `bytes` and `min_block_bytes`
+   */
+  [[nodiscard]] static constexpr std::size_t size_class(std::size_t bytes) noexcept
+  {
+    if (bytes > max_cached_block_bytes) { return bytes; }
+    auto block_bytes = min_block_bytes;
+    while (block_bytes < bytes) {
+      block_bytes <<= 1;
+    }
+    return block_bytes;
+  }
+
+  cudaMemPool_t pool_;            ///< Stream-ordered CUDA memory pool
+  std::size_t max_cached_bytes_;  ///< Maximum number of bytes held by the host cache
+  std::size_t cached_bytes_{0};   ///< Number of bytes currently held by the host cache
+  /// Free blocks and their release events, keyed by the releasing stream and their size class
+  std::map<std::pair<cudaStream_t, std::size_t>, std::vector<std::pair<void*, cudaEvent_t>>>
+    free_blocks_;
+  std::vector<cudaEvent_t> spare_events_;  ///< Events not attached to a cached block
+  std::mutex mutex_;                       ///< Guards the host cache
+};
+
+}  // namespace detail
+}  // namespace cuco
@@ -86,6 +86,73 @@ struct slot_is_filled {
   }
 };
 
+/**
+ * @brief Determines whether a hash value consists of several independent words, e.g., the
+ * `cuda::std::array` returned by 128-bit hash functions.
+ *
+ * @tparam T The hash value type
+ */
+template <typename T>
+struct is_multi_word_hash : cuda::std::false_type {};
+
+/**
+ * @brief Specialization for `cuda::std::array` hash values of at least two unsigned words.
+ *
+ * @tparam T The hash word type
+ * @tparam N The number of hash words
+ */
+template <typename T, std::size_t N>
+struct is_multi_word_hash<cuda::std::array<T, N>>
+  : cuda::std::bool_constant<(N >= 2 and cuda::std::is_unsigned_v<T>)> {};
+
+template <typename T>
+inline constexpr bool is_multi_word_hash_v = is_multi_word_hash<cuda::std::decay_t<T>>::value;
+
+/**
+ * @brief Gets the `I`-th word of a (multi-word) hash value.
+ *
+ * @note Scalar hash values consist of a single word which is returned for every `I`.
+ *
+ * @tparam I The word index
+ * @tparam HashType The hash value type
+ *
+ * @param hash The hash value
+ *
+ * @return The `I`-th hash word
+ */
+template <std::size_t I, typename HashType>
+__host__ __device__ constexpr auto hash_word(HashType const& hash) noexcept
+{
+  if constexpr (is_multi_word_hash_v<HashType>) {
+    static_assert(I < cuda::std::tuple_size<HashType>::value, "Hash word index out of range");
+    return hash[I];
+  } else {
+    return hash;
+  }
+}
+
+/**
+ * @brief Gets the last word of a (multi-word) hash value.
+ *
+ * @note The last word is never used to compute a probing start, hence it can serve as an
+ * independent fingerprint of the key.
+ *
+ * @tparam HashType The hash value type
+ *
+ * @param hash The hash value
+ *
+ * @return The last hash word
+ */
+template <typename HashType>
+__host__ __device__ constexpr auto last_hash_word(HashType const& hash) noexcept
+{
+  if constexpr (is_multi_word_hash_v<HashType>) {
+    return hash[cuda::std::tuple_size<HashType>::value - 1];
+  } else {
+    return hash;
+  }
+}
+
 template <typename SizeType, typename HashType>
 __host__ __device__ constexpr SizeType to_positive(HashType hash)
 {
@@ -107,18 +174,8 @@ __host__ __device__ constexpr SizeType to_positive(HashType hash)
 template <typename SizeType, typename HashType>
 __host__ __device__ constexpr SizeType sanitize_hash(HashType hash) noexcept
 {
-  if constexpr (cuda::std::is_same_v<HashType, cuda::std::array<std::uint64_t, 2>>) {
-#if !defined(CUCO_HAS_INT128)
-    static_assert(false,
-                  "CUCO_HAS_INT128 undefined. Need unsigned __int128 type when sanitizing "
-                  "cuda::std::array<std::uint64_t, 2>");
-#endif
-    unsigned __int128 ret{};
-    memcpy(&ret, &hash, sizeof(unsigned __int128));
-    return to_positive<SizeType>(static_cast<SizeType>(ret));
-  } else {
-    return to_positive<SizeType>(hash);
-  }
+  // Multi-word hash values are sanitized from their first (least significant) word
+  return to_positive<SizeType>(hash_word<0>(hash));
 }
 
 /**
@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/groupby/accumulator_columns.cuh>
+#include <cuco/detail/storage/storage_base.cuh>
+#include <cuco/extent.cuh>
+#include <cuco/hash_functions.cuh>
+#include <cuco/probing_scheme.cuh>
+#include <cuco/static_set.cuh>
+#include <cuco/storage.cuh>
+#include <cuco/types.cuh>
+#include <cuco/utility/aggregations.cuh>
+#include <cuco/utility/allocator.hpp>
+
+#include <cuda/std/tuple>
+#include <cuda/stream_ref>
+#include <thrust/functional.h>
+
+#include <cstddef>
+#include <memory>
+
+namespace cuco {
+/**
+ * @brief A GPU-accelerated hash aggregation of value columns grouped by key.
+ *
+ * `groupby` computes several aggregations, e.g., the sum and the maximum, of value columns per
+ * distinct key in a single pass over the input rows. Each row of the key-value input is inserted
+ * into a `cuco::static_set` of keys and its values are applied to the accumulators of the
+ * group, which live in columns parallel to the slot storage, i.e., the accumulators of the key
+ * stored in slot `i` are located at row `i` of each accumulator column.
+ *
+ * When the input has enough rows per thread, each thread block first aggregates its rows into a
+ * block-local table in shared memory and only merges the block-local groups into the global table
+ * once done. Blocks whose rows hold more distinct keys than the shared table can hold spill
+ * the remaining rows to the global table directly. Low-cardinality workloads thus replace most
+ * global atomics with shared memory atomics.
+ *
+ * Example:
+ * @code{.cpp}
+ * using aggregations = cuda::std::tuple<cuco::aggregation::sum<int64_t>,
+ *                                       cuco::aggregation::mean<float>,
+ *                                       cuco::aggregation::count<>>;
+ * auto groups = cuco::groupby<int32_t, aggregations>{capacity, cuco::empty_key<int32_t>{-1}};
+ * groups.aggregate(keys.begin(),
+ *                  keys.end(),
+ *                  cuda::std::make_tuple(prices.begin(), weights.begin(), prices.begin()));
+ * @endcode
+ *
+ * @note Only scalar probing (`ProbingScheme::cg_size == 1`) is supported.
+ *
+ * @tparam Key Type used for keys. Requires `cuco::is_bitwise_comparable_v<Key>`
+ * @tparam Aggregations `cuda::std::tuple` of aggregation types, see
+ * `include/cuco/utility/aggregations.cuh` for choices
+ * @tparam Extent Data structure size type
+ * @tparam KeyEqual Binary callable type used to compare two keys for equality
+ * @tparam ProbingScheme Probing scheme (see `include/cuco/probing_scheme.cuh` for choices)
+ * @tparam Allocator Type of allocator used for device storage
+ */
+template <class Key,
+          class Aggregations,
+          class Extent        = cuco::extent<std::size_t>,
+          class KeyEqual      = thrust::equal_to<Key>,
+          class ProbingScheme = cuco::linear_probing<1,  // CG size
+                                                     cuco::default_hash_function<Key>>,
+          class Allocator     = cuco::cuda_allocator<Key>>
+class groupby {
+ public:
+  /// Underlying container of keys
+  using key_set_type = static_set<Key,
+                                  Extent,
+                                  cuda::thread_scope_device,
+                                  KeyEqual,
+                                  ProbingScheme,
+                                  Allocator,
+                                  cuco::storage<1>>;
+
+  static_assert(key_set_type::cg_size == 1, "groupby only supports scalar probing schemes.");
+
+  static constexpr auto thread_scope = key_set_type::thread_scope;  ///< CUDA thread scope
+  /// Number of aggregations
+  static constexpr auto num_aggregations = cuda::std::tuple_size_v<Aggregations>;
+
+  using key_type            = Key;                                         ///< Key type
+  using aggregations_type   = Aggregations;                                ///< Aggregations type
+  using extent_type         = typename key_set_type::extent_type;          ///< Extent type
+  using size_type           = typename key_set_type::size_type;            ///< Size type
+  using key_equal           = typename key_set_type::key_equal;            ///< Key equality type
+  using allocator_type      = typename key_set_type::allocator_type;       ///< Allocator type
+  using probing_scheme_type = typename key_set_type::probing_scheme_type;  ///< Probing scheme type
+  using hasher              = typename key_set_type::hasher;               ///< Hash function type
+  /// Allocator type used for the accumulator columns
+  using column_allocator_type =
+    typename std::allocator_traits<allocator_type>::template rebind_alloc<char>;
+
+  groupby(groupby const&)            = delete;
+  groupby& operator=(groupby const&) = delete;
+
+  groupby(groupby&&) = default;  ///< Move constructor
+
+  /**
+   * @brief Replaces the contents of the container with another container.
+   *
+   * @return Reference of the current groupby object
+   */
+  groupby& operator=(groupby&&) = default;
+  ~groupby()                    = default;
+
+  /**
+   * @brief Constructs a statically-sized groupby with the specified initial capacity, sentinel
+   * value and CUDA stream.
+   *
+   * The actual capacity depends on the given `capacity` and the probing scheme, and it is computed
+   * via the `make_bucket_extent` factory. Aggregate operations will not automatically grow the
+   * table. Aggregating more distinct keys than the capacity results in undefined behavior.
+   *
+   * @note The `empty_key_sentinel` is reserved and behavior is undefined when attempting to
+   * aggregate rows with this key.
+   * @note This constructor doesn't synchronize the given stream.
+   *
+   * @param capacity The requested lower-bound number of groups
+   * @param empty_key_sentinel The reserved key value for empty slots
+   * @param pred Key equality binary predicate
+   * @param probing_scheme Probing scheme
+   * @param alloc Allocator used for allocating device storage
+   * @param stream CUDA stream used to initialize the groupby
+   */
+  constexpr groupby(Extent capacity,
+                    empty_key<Key> empty_key_sentinel,
+                    KeyEqual const& pred                = {},
+                    ProbingScheme const& probing_scheme = {},
+                    Allocator const& alloc              = {},
+                    cuda::stream_ref stream             = {});
+
+  /**
+   * @brief Erases all groups. After this call, `size()` returns zero.
+   *
+   * @param stream CUDA stream this operation is executed in
+   */
+  void clear(cuda::stream_ref stream = {});
+
+  /**
+   * @brief Asynchronously erases all groups. After this call, `size()` returns zero.
+   *
+   * @param stream CUDA stream this operation is executed in
+   */
+  void clear_async(cuda::stream_ref stream = {}) noexcept;
+
+  /**
+   * @brief Aggregates the rows `[first, last)` by key.
+   *
+   * The `i`-th value column is aggregated by the `i`-th aggregation of `Aggregations`. Groups
+   * accumulate across calls until `clear` is invoked.
+   *
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `aggregate_async`.
+   *
+   * @tparam InputIt Device accessible random access input iterator whose `value_type` is
+   * convertible to the `key_type`
+   * @tparam ValueIts `cuda::std::tuple` of device accessible random access input iterators, one
+   * per aggregation
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param values Beginnings of the value columns
+   * @param stream CUDA stream used for aggregate
+   */
+  template <typename InputIt, typename ValueIts>
+  void aggregate(InputIt first, InputIt last, ValueIts values, cuda::stream_ref stream = {});
+
+  /**
+   * @brief Asynchronously aggregates the rows `[first, last)` by key.
+   *
+   * @see aggregate
+   *
+   * @tparam InputIt Device accessible random access input iterator whose `value_type` is
+   * convertible to the `key_type`
+   * @tparam ValueIts `cuda::std::tuple` of device accessible random access input iterators, one
+   * per aggregation
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param values Beginnings of the value columns
+   * @param stream CUDA stream used for aggregate
+   */
+  template <typename InputIt, typename ValueIts>
+  void aggregate_async(InputIt first,
+                       InputIt last,
+                       ValueIts values,
+                       cuda::stream_ref stream = {}) noexcept;
+
+  /**
+   * @brief Retrieves the key and the results of all groups.
+   *
+   * The `i`-th result of each group is written to the `i`-th output column.
+   *
+   * @note This API synchronizes the given stream.
+   * @note The order in which groups are returned is implementation defined and not guaranteed to
+   * be consistent between subsequent calls to `retrieve`.
+   * @note Behavior is undefined if the range beginning at `keys_out` or any output column is
+   * smaller than the return value of `size()`.
+   *
+   * @tparam KeyOut Device accessible random access output iterator whose `value_type` is
+   * convertible from `key_type`
+   * @tparam OutputIts `cuda::std::tuple` of device accessible random access output iterators, one
+   * per aggregation, whose `value_type` is convertible from the aggregation's `result_type`
+   *
+   * @param keys_out Beginning output iterator for keys
+   * @param results_out Beginnings of the output columns
+   * @param stream CUDA stream used for this operation
+   *
+   * @return Iterator indicating the end of the output keys
+   */
+  template <typename KeyOut, typename OutputIts>
+  KeyOut retrieve(KeyOut keys_out, OutputIts results_out, cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief Gets the number of groups.
+   *
+   * @note This function synchronizes the given stream.
+   *
+   * @param stream CUDA stream used to get the number of groups
+   * @return The number of groups
+   */
+  [[nodiscard]] size_type size(cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief Gets the maximum number of groups the table can hold.
+   *
+   * @return The maximum number of groups the table can hold
+   */
+  [[nodiscard]] constexpr auto capacity() const noexcept;
+
+  /**
+   * @brief Gets the sentinel value used to represent an empty key slot.
+   *
+   * @return The sentinel value used to represent an empty key slot
+   */
+  [[nodiscard]] constexpr key_type empty_key_sentinel() const noexcept;
+
+  /**
+   * @brief Gets the underlying container of keys.
+   *
+   * @return Const reference to the key set
+   */
+  [[nodiscard]] key_set_type const& keys() const noexcept;
+
+ private:
+  using columns_type        = detail::groupby_ns::accumulator_columns<Aggregations>;
+  using column_deleter_type = detail::custom_deleter<std::size_t, column_allocator_type>;
+
+  /**
+   * @brief Gets a view of the accumulator columns.
+   *
+   * @return Accumulator columns parallel to the slot storage
+   */
+  [[nodiscard]] columns_type columns() const noexcept;
+
+  key_set_type keys_;                                        ///< Keys
+  column_allocator_type column_allocator_;                   ///< Accumulator allocator
+  std::unique_ptr<char, column_deleter_type> accumulators_;  ///< Accumulator columns
+};
+}  // namespace cuco
+
+#include <cuco/detail/groupby/groupby.inl>
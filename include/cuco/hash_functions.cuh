@@ -19,7 +19,10 @@
 #include <cuco/detail/hash_functions/identity_hash.cuh>
 #include <cuco/detail/hash_functions/murmurhash3.cuh>
 #include <cuco/detail/hash_functions/xxhash.cuh>
+#include <cuco/detail/hash_functions/xxhash3.cuh>
 
+#include <cuda/std/cstddef>
+#include <cuda/stream_ref>
 #include <thrust/functional.h>
 
 namespace cuco {
@@ -96,6 +99,24 @@ using xxhash_32 = detail::XXHash_32<Key>;
 template <typename Key>
 using xxhash_64 = detail::XXHash_64<Key>;
 
+/**
+ * @brief A 64-bit `XXH3` hash function to hash the given argument on host and device.
+ *
+ * @note Faster than `xxhash_64` for keys of up to 16 bytes, which are hashed without any loop.
+ *
+ * @tparam Key The type of the values to hash
+ */
+template <typename Key>
+using xxhash3_64 = detail::XXHash3_64<Key>;
+
+/**
+ * @brief A 128-bit `XXH3` hash function to hash the given argument on host and device.
+ *
+ * @tparam Key The type of the values to hash
+ */
+template <typename Key>
+using xxhash3_128 = detail::XXHash3_128<Key>;
+
 /**
  * @brief Default hash function.
  *
@@ -104,4 +125,124 @@ using xxhash_64 = detail::XXHash_64<Key>;
 template <typename Key>
 using default_hash_function = xxhash_32<Key>;
 
+/**
+ * @brief Asynchronously hashes all keys in the range `[first, last)` and writes the hash values to
+ * the output starting at `output_begin`.
+ *
+ * Keys in suitably aligned contiguous device memory whose size divides 16 bytes are loaded with
+ * 16-byte vector loads. If the input or the output refers to host memory that the device cannot
+ * access, i.e., a host iterator or a pointer to pageable host memory, the keys are hashed on the
+ * host using all hardware threads and this function returns once the output is written.
+ *
+ * @throw std::invalid_argument If one range is in host-only memory and the other in device-only
+ * memory
+ *
+ * @tparam InputIt Random access input iterator
+ * @tparam OutputIt Random access output iterator whose `value_type` is constructible from the
+ * hash value type
+ * @tparam Hash Hash function type invocable on the input `value_type`
+ *
+ * @param first Beginning of the sequence of keys
+ * @param last End of the sequence of keys
+ * @param output_begin Beginning of the sequence of hash values
+ * @param hash Hash function
+ * @param stream CUDA stream used for hashing
+ */
+template <typename InputIt, typename OutputIt, typename Hash>
+void hash_bulk_async(InputIt first,
+                     InputIt last,
+                     OutputIt output_begin,
+                     Hash const& hash,
+                     cuda::stream_ref stream = {});
+
+/**
+ * @brief Hashes all keys in the range `[first, last)` and writes the hash values to the output
+ * starting at `output_begin`.
+ *
+ * @note This function synchronizes the given stream. For asynchronous execution use
+ * `hash_bulk_async`.
+ *
+ * @tparam InputIt Random access input iterator
+ * @tparam OutputIt Random access output iterator whose `value_type` is constructible from the
+ * hash value type
+ * @tparam Hash Hash function type invocable on the input `value_type`
+ *
+ * @param first Beginning of the sequence of keys
+ * @param last End of the sequence of keys
+ * @param output_begin Beginning of the sequence of hash values
+ * @param hash Hash function
+ * @param stream CUDA stream used for hashing
+ */
+template <typename InputIt, typename OutputIt, typename Hash>
+void hash_bulk(InputIt first,
+               InputIt last,
+               OutputIt output_begin,
+               Hash const& hash,
+               cuda::stream_ref stream = {});
+
+/**
+ * @brief Asynchronously hashes a column of strings and writes the hash values to the output
+ * starting at `output_begin`.
+ *
+ * String `i` consists of the bytes `[chars + offsets[i], chars + offsets[i + 1])`. Each string is
+ * hashed by one thread; long strings are first staged in shared memory by a whole warp with
+ * coalesced loads. If the offsets, the characters or the output refer to host memory that the
+ * device cannot access, the strings are hashed on the host using all hardware threads and this
+ * function returns once the output is written.
+ *
+ * @throw If `[offsets_first, offsets_last)` is empty
+ * @throw std::invalid_argument If some ranges are in host-only memory and others in device-only
+ * memory
+ *
+ * @tparam OffsetIt Random access iterator of integral offsets
+ * @tparam OutputIt Random access output iterator whose `value_type` is constructible from the
+ * hash value type
+ * @tparam Hash Hash function type providing `compute_hash(cuda::std::byte const*, size)`
+ *
+ * @param offsets_first Beginning of the `num_strings + 1` string offsets
+ * @param offsets_last End of the string offsets
+ * @param chars Characters of all strings
+ * @param output_begin Beginning of the sequence of hash values
+ * @param hash Hash function
+ * @param stream CUDA stream used for hashing
+ */
+template <typename OffsetIt, typename OutputIt, typename Hash>
+void hash_strings_bulk_async(OffsetIt offsets_first,
+                             OffsetIt offsets_last,
+                             cuda::std::byte const* chars,
+                             OutputIt output_begin,
+                             Hash const& hash,
+                             cuda::stream_ref stream = {});
+
+/**
+ * @brief Hashes a column of strings and writes the hash values to the output starting at
+ * `output_begin`.
+ *
+ * @note This function synchronizes the given stream. For asynchronous execution use
+ * `hash_strings_bulk_async`.
+ *
+ * @throw If `[offsets_first, offsets_last)` is empty
+ *
+ * @tparam OffsetIt Random access iterator of integral offsets
+ * @tparam OutputIt Random access output iterator whose `value_type` is constructible from the
+ * hash value type
+ * @tparam Hash Hash function type providing `compute_hash(cuda::std::byte const*, size)`
+ *
+ * @param offsets_first Beginning of the `num_strings + 1` string offsets
+ * @param offsets_last End of the string offsets
+ * @param chars Characters of all strings
+ * @param output_begin Beginning of the sequence of hash values
+ * @param hash Hash function
+ * @param stream CUDA stream used for hashing
+ */
+template <typename OffsetIt, typename OutputIt, typename Hash>
+void hash_strings_bulk(OffsetIt offsets_first,
+                       OffsetIt offsets_last,
+                       cuda::std::byte const* chars,
+                       OutputIt output_begin,
+                       Hash const& hash,
+                       cuda::stream_ref stream = {});
+
 }  // namespace cuco
+
+#include <cuco/detail/hash_functions/hash_bulk.inl>
@@ -21,12 +21,14 @@
 #include <cuco/types.cuh>
 #include <cuco/utility/allocator.hpp>
 #include <cuco/utility/cuda_thread_scope.cuh>
+#include <cuco/utility/persistence.hpp>
 
 #include <cuda/std/cstddef>
 #include <cuda/stream_ref>
 
 #include <iterator>
 #include <memory>
+#include <string>
 
 namespace cuco {
 /**
@@ -34,6 +36,8 @@ namespace cuco {
  *
  * @note This implementation is based on the HyperLogLog++ algorithm:
  * https://static.googleusercontent.com/media/research.google.com/de//pubs/archive/40671.pdf.
+ * @note All `_async` APIs, including `estimate_async`, only enqueue kernels and can be captured
+ * into a CUDA graph.
  *
  * @tparam T Type of items to count
  * @tparam Scope The scope in which operations will be performed by individual threads
@@ -213,6 +217,16 @@ class hyperloglog {
   template <cuda::thread_scope OtherScope>
   constexpr void merge(ref_type<OtherScope> const& other_ref, cuda::stream_ref stream = {});
 
+  /**
+   * @brief Asynchronously computes the estimated distinct items count.
+   *
+   * @note Since the estimate is computed on the device, the call can be captured into a CUDA graph.
+   *
+   * @param output Device location the approximate distinct items count is written to
+   * @param stream CUDA stream this operation is executed in
+   */
+  constexpr void estimate_async(std::size_t* output, cuda::stream_ref stream = {}) const;
+
   /**
    * @brief Compute the estimated distinct items count.
    *
@@ -279,7 +293,43 @@ class hyperloglog {
    */
   [[nodiscard]] static constexpr std::size_t sketch_alignment() noexcept;
 
+  /**
+   * @brief Writes the sketch to a file at `path`.
+   *
+   * The file holds a versioned header, the hash function including its seed, and the raw sketch
+   * registers. See `cuco::persisted_header` for the layout.
+   *
+   * @note This function synchronizes the given stream.
+   *
+   * @throw cuco::logic_error If the file cannot be written
+   *
+   * @param path Path of the file to write
+   * @param stream CUDA stream used for this operation
+   */
+  void save(std::string const& path, cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief Replaces the content of the sketch by the content of a file written by `save`.
+   *
+   * The sketch must have the same type, size and hash function as the sketch that wrote the file.
+   *
+   * @note This function synchronizes the given stream.
+   *
+   * @throw cuco::logic_error If the file is invalid or was written by an incompatible sketch
+   *
+   * @param path Path of the file to read
+   * @param stream CUDA stream used for this operation
+   */
+  void load(std::string const& path, cuda::stream_ref stream = {});
+
  private:
+  /**
+   * @brief Builds the header describing this sketch in a persisted file.
+   *
+   * @return The persisted file header
+   */
+  [[nodiscard]] persisted_header persisted_header_for() const noexcept;
+
   allocator_type allocator_;  ///< Allocator used to allocate device-accessible storage
   std::unique_ptr<register_type, detail::custom_deleter<std::size_t, allocator_type>>
     sketch_;        ///< Storage of the current `hyperloglog` object
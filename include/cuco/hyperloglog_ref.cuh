@@ -188,6 +188,16 @@ class hyperloglog_ref {
   [[nodiscard]] __device__ std::size_t estimate(
     cooperative_groups::thread_block const& group) const noexcept;
 
+  /**
+   * @brief Asynchronously computes the estimated distinct items count.
+   *
+   * @note Since the estimate is computed on the device, the call can be captured into a CUDA graph.
+   *
+   * @param output Device location the approximate distinct items count is written to
+   * @param stream CUDA stream this operation is executed in
+   */
+  __host__ constexpr void estimate_async(std::size_t* output, cuda::stream_ref stream = {}) const;
+
   /**
    * @brief Compute the estimated distinct items count.
    *
@@ -0,0 +1,342 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/hash_functions.cuh>
+
+#include <cuda/std/cstddef>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <cstdint>
+#include <type_traits>
+
+namespace cuco {
+
+/**
+ * @brief Fixed-size slot key referring to a variable-length key stored out-of-line in a key arena.
+ *
+ * An `arena_key` is 8 bytes wide and thus satisfies the slot size requirement of all open
+ * addressing containers. The `fingerprint` is a 32-bit hash of the referenced key bytes and is
+ * compared before the arena is accessed, so a non-matching probe never touches the arena.
+ *
+ * @note Indices `0xFFFFFFFF` and `0xFFFFFFFE` are reserved for the empty and erased sentinels, so
+ * an arena can hold at most `2^32 - 2` keys.
+ */
+struct arena_key {
+  std::uint32_t fingerprint;  ///< 32-bit hash of the referenced key bytes
+  std::uint32_t index;        ///< Row index of the referenced key in the arena
+
+  /**
+   * @brief Returns a key that can be used as the empty key sentinel.
+   *
+   * @return The empty key sentinel
+   */
+  __host__ __device__ static constexpr arena_key empty_sentinel() noexcept
+  {
+    return arena_key{~std::uint32_t{0}, ~std::uint32_t{0}};
+  }
+
+  /**
+   * @brief Returns a key that can be used as the erased key sentinel.
+   *
+   * @return The erased key sentinel
+   */
+  __host__ __device__ static constexpr arena_key erased_sentinel() noexcept
+  {
+    return arena_key{~std::uint32_t{0}, ~std::uint32_t{0} - 1};
+  }
+};
+
+static_assert(sizeof(arena_key) == 8 and std::has_unique_object_representations_v<arena_key>,
+              "arena_key must be a padding-free 8-byte type");
+
+/**
+ * @brief Probe key referring to a variable-length key stored in an arbitrary memory location.
+ *
+ * Probe keys are used for heterogeneous lookups, e.g., probing a container built from one arena
+ * with keys from another arena.
+ *
+ * @tparam Char Character type of the key bytes
+ */
+template <typename Char = char>
+struct arena_probe_key {
+  std::uint32_t fingerprint;  ///< 32-bit hash of the referenced key bytes
+  Char const* data;           ///< Pointer to the first character of the key
+  std::size_t size;           ///< Number of characters in the key
+};
+
+/**
+ * @brief Non-owning device view over an Arrow-style key arena.
+ *
+ * The arena consists of `num_keys + 1` monotonically increasing offsets and a character buffer
+ * such that the `i`-th key spans `chars[offsets[i], offsets[i + 1])`. Both buffers must be
+ * device-accessible and must outlive every container referencing the arena.
+ *
+ * @tparam Offset Offset type
+ * @tparam Char Character type of the key bytes
+ * @tparam Hash Byte hasher used to compute fingerprints; must provide `compute_hash`
+ */
+template <typename Offset = std::int32_t,
+          typename Char   = char,
+          typename Hash   = cuco::xxhash_32<Char>>
+class key_arena_ref {
+  static_assert(std::is_integral_v<Offset>, "Offset must be an integral type");
+  static_assert(sizeof(typename Hash::result_type) == 4, "Fingerprints must be 32-bit wide");
+
+ public:
+  using offset_type = Offset;  ///< Offset type
+  using char_type   = Char;    ///< Character type
+  using hasher      = Hash;    ///< Fingerprint hasher type
+
+  /**
+   * @brief Constructs a view over the given offsets and characters.
+   *
+   * @param offsets Pointer to `num_keys + 1` offsets
+   * @param chars Pointer to the character buffer
+   * @param hash Fingerprint hasher
+   */
+  __host__ __device__ constexpr key_arena_ref(offset_type const* offsets,
+                                              char_type const* chars,
+                                              hasher const& hash = {}) noexcept
+    : offsets_{offsets}, chars_{chars}, hash_{hash}
+  {
+  }
+
+  /**
+   * @brief Returns a pointer to the first character of the `index`-th key.
+   *
+   * @param index Row index
+   * @return Pointer to the key characters
+   */
+  [[nodiscard]] __device__ constexpr char_type const* data(std::uint32_t index) const noexcept
+  {
+    return chars_ + offsets_[index];
+  }
+
+  /**
+   * @brief Returns the number of characters of the `index`-th key.
+   *
+   * @param index Row index
+   * @return Key length
+   */
+  [[nodiscard]] __device__ constexpr std::size_t size(std::uint32_t index) const noexcept
+  {
+    return static_cast<std::size_t>(offsets_[index + 1] - offsets_[index]);
+  }
+
+  /**
+   * @brief Computes the fingerprint of the given key bytes.
+   *
+   * @param data Pointer to the key characters
+   * @param size Number of characters
+   * @return 32-bit fingerprint
+   */
+  [[nodiscard]] __device__ constexpr std::uint32_t fingerprint(char_type const* data,
+                                                               std::size_t size) const noexcept
+  {
+    return static_cast<std::uint32_t>(hash_.compute_hash(
+      reinterpret_cast<cuda::std::byte const*>(data), size * sizeof(char_type)));
+  }
+
+  /**
+   * @brief Builds the slot key of the `index`-th key.
+   *
+   * @param index Row index
+   * @return The slot key
+   */
+  [[nodiscard]] __device__ constexpr arena_key key(std::uint32_t index) const noexcept
+  {
+    return arena_key{this->fingerprint(this->data(index), this->size(index)), index};
+  }
+
+  /**
+   * @brief Builds the probe key of the `index`-th key.
+   *
+   * @param index Row index
+   * @return The probe key
+   */
+  [[nodiscard]] __device__ constexpr arena_probe_key<char_type> probe_key(
+    std::uint32_t index) const noexcept
+  {
+    auto const ptr = this->data(index);
+    auto const len = this->size(index);
+    return arena_probe_key<char_type>{this->fingerprint(ptr, len), ptr, len};
+  }
+
+  /**
+   * @brief Returns an iterator producing the slot keys of rows `0, 1, ...`.
+   *
+   * @return Slot key iterator
+   */
+  [[nodiscard]] auto keys_begin() const noexcept
+  {
+    return thrust::make_transform_iterator(thrust::counting_iterator<std::uint32_t>{0},
+                                           key_fn{*this});
+  }
+
+  /**
+   * @brief Returns an iterator producing the probe keys of rows `0, 1, ...`.
+   *
+   * @return Probe key iterator
+   */
+  [[nodiscard]] auto probe_keys_begin() const noexcept
+  {
+    return thrust::make_transform_iterator(thrust::counting_iterator<std::uint32_t>{0},
+                                           probe_key_fn{*this});
+  }
+
+ private:
+  struct key_fn {
+    key_arena_ref arena;
+
+    __device__ constexpr arena_key operator()(std::uint32_t index) const noexcept
+    {
+      return arena.key(index);
+    }
+  };
+
+  struct probe_key_fn {
+    key_arena_ref arena;
+
+    __device__ constexpr arena_probe_key<char_type> operator()(std::uint32_t index) const noexcept
+    {
+      return arena.probe_key(index);
+    }
+  };
+
+  offset_type const* offsets_;
+  char_type const* chars_;
+  hasher hash_;
+};
+
+/**
+ * @brief Hasher for `arena_key` and `arena_probe_key`.
+ *
+ * Only the precomputed fingerprint is consumed, thus hashing never accesses the arena. The
+ * fingerprint is remixed with a seed so that schemes requiring two independent hashers, e.g.,
+ * `cuco::double_hashing`, can be instantiated with two different seeds.
+ */
+class arena_key_hash {
+ public:
+  using result_type = std::uint32_t;  ///< The type of the hash values produced
+
+  /**
+   * @brief Constructs an arena key hasher with the given `seed`.
+   *
+   * @param seed A custom number to randomize the resulting hash value
+   */
+  __host__ __device__ constexpr arena_key_hash(std::uint32_t seed = 0) noexcept : mix_{seed} {}
+
+  /**
+   * @brief Returns a hash value for the given slot key.
+   *
+   * @param key The slot key
+   * @return The resulting hash value
+   */
+  __host__ __device__ constexpr result_type operator()(arena_key const& key) const noexcept
+  {
+    return mix_(key.fingerprint);
+  }
+
+  /**
+   * @brief Returns a hash value for the given probe key.
+   *
+   * @tparam Char Character type of the probe key
+   *
+   * @param key The probe key
+   * @return The resulting hash value
+   */
+  template <typename Char>
+  __host__ __device__ constexpr result_type operator()(
+    arena_probe_key<Char> const& key) const noexcept
+  {
+    return mix_(key.fingerprint);
+  }
+
+ private:
+  cuco::murmurhash3_fmix_32<std::uint32_t> mix_;
+};
+
+/**
+ * @brief Key equality for `arena_key` slots.
+ *
+ * Fingerprints are compared first; the key bytes in the arena are only compared on a fingerprint
+ * match. The slot key is always the right-hand side argument.
+ *
+ * @tparam ArenaRef Type of the key arena the slot keys refer to
+ */
+template <typename ArenaRef>
+class arena_key_equal {
+  using char_type = typename ArenaRef::char_type;
+
+ public:
+  /**
+   * @brief Constructs the equality functor for keys stored in `arena`.
+   *
+   * @param arena View of the arena the slot keys refer to
+   */
+  __host__ __device__ constexpr arena_key_equal(ArenaRef const& arena) noexcept : arena_{arena} {}
+
+  /**
+   * @brief Compares two slot keys referring to the same arena.
+   *
+   * @param lhs Input key
+   * @param rhs Slot key
+   * @return `true` if the referenced key bytes are equal
+   */
+  __device__ constexpr bool operator()(arena_key const& lhs, arena_key const& rhs) const noexcept
+  {
+    if (lhs.fingerprint != rhs.fingerprint) { return false; }
+    if (lhs.index == rhs.index) { return true; }
+    return bytes_equal(arena_.data(lhs.index),
+                       arena_.size(lhs.index),
+                       arena_.data(rhs.index),
+                       arena_.size(rhs.index));
+  }
+
+  /**
+   * @brief Compares a probe key against a slot key.
+   *
+   * @param lhs Probe key
+   * @param rhs Slot key
+   * @return `true` if the referenced key bytes are equal
+   */
+  __device__ constexpr bool operator()(arena_probe_key<char_type> const& lhs,
+                                       arena_key const& rhs) const noexcept
+  {
+    if (lhs.fingerprint != rhs.fingerprint) { return false; }
+    return bytes_equal(lhs.data, lhs.size, arena_.data(rhs.index), arena_.size(rhs.index));
+  }
+
+ private:
+  __device__ static constexpr bool bytes_equal(char_type const* lhs,
+                                               std::size_t lhs_size,
+                                               char_type const* rhs,
+                                               std::size_t rhs_size) noexcept
+  {
+    if (lhs_size != rhs_size) { return false; }
+    for (std::size_t i = 0; i < lhs_size; ++i) {
+      if (lhs[i] != rhs[i]) { return false; }
+    }
+    return true;
+  }
+
+  ArenaRef arena_;
+};
+
+}  // namespace cuco
@@ -33,6 +33,9 @@ namespace cuco {
  *
  * @note `Hash` should be callable object type.
  *
+ * @note `Hash` may return a multi-word hash value such as the `cuda::std::array` of a 128-bit hash
+ * function. The probing start is then taken from the first word.
+ *
  * @tparam CGSize Size of CUDA Cooperative Groups
  * @tparam Hash Unary callable type
  */
@@ -117,6 +120,11 @@ class linear_probing : private detail::probing_scheme_base<CGSize> {
  *
  * @note `Hash2` needs to be able to construct from an integer value to avoid secondary clustering.
  *
+ * @note If `Hash1` returns a multi-word hash value such as the `cuda::std::array` of a 128-bit hash
+ * function, the probing start and step size are taken from its first and second word, so each
+ * probe sequence costs a single hash evaluation and `Hash2` is never invoked, e.g.,
+ * `cuco::double_hashing<CGSize, cuco::xxhash3_128<Key>>`.
+ *
  * @tparam CGSize Size of CUDA Cooperative Groups
  * @tparam Hash1 Unary callable type
  * @tparam Hash2 Unary callable type
@@ -203,6 +211,149 @@ class double_hashing : private detail::probing_scheme_base<CGSize> {
   Hash2 hash2_;
 };
 
+/**
+ * @brief Public cuckoo probing scheme class.
+ *
+ * @note Every key has one candidate bucket per hash function and lookups probe nothing else, so a
+ * query touches at most `num_hashes` buckets (or `num_hashes` windows of `cg_size` buckets with a
+ * cooperative group) regardless of the occupancy. When all candidate buckets of a key are full,
+ * insertion moves resident elements to one of their alternate buckets to make room, which keeps
+ * inserts succeeding at occupancies well above 90% with a bucket size of 4 or more.
+ *
+ * @note Displacement only ever overwrites occupied slots and moves an element by copying it to its
+ * new slot before its old slot is overwritten. Displacement is therefore not atomic with respect to
+ * concurrent operations: a lookup that probes the new slot before the copy lands and the old slot
+ * after it has been overwritten misses the element, and an erase that removes only one of the two
+ * copies during a move lets the element reappear. Avoid mixing inserts that may displace with
+ * lookups or erases in the same kernel if that matters. Concurrent inserts of the same key are
+ * serialized on the first slot of the key's first candidate bucket and never create duplicates. An
+ * insertion fails, i.e., returns `false` without modifying the container, when no free slot is
+ * reachable within `max_displacements` moves.
+ *
+ * @note `Hash1`, `Hash2` and `Hashes` should be callable object types. When default constructed,
+ * the `i`-th hasher is constructed from the integer `i` to make them independent.
+ *
+ * @note Cuckoo probing requires the default bucket storage.
+ *
+ * @tparam CGSize Size of CUDA Cooperative Groups
+ * @tparam Hash1 Unary callable type
+ * @tparam Hash2 Unary callable type
+ * @tparam Hashes Optional additional unary callable types
+ */
+template <int32_t CGSize, typename Hash1, typename Hash2 = Hash1, typename... Hashes>
+class cuckoo_probing : private detail::probing_scheme_base<CGSize> {
+  using probing_scheme_base_type =
+    detail::probing_scheme_base<CGSize>;  ///< The base probe scheme type
+
+ public:
+  using probing_scheme_base_type::cg_size;
+  using hasher = cuda::std::tuple<Hash1, Hash2, Hashes...>;  ///< Hash function type
+
+  /// Number of hash functions, i.e., maximum number of buckets (or windows) probed per key
+  static constexpr int32_t num_hashes = 2 + sizeof...(Hashes);
+  /// Maximum number of elements moved by a single insertion
+  static constexpr int32_t max_displacements = 16;
+
+  /**
+   *@brief Constructs cuckoo probing scheme with default constructed hashers, seeding the `i`-th
+   * hasher with `i`.
+   */
+  __host__ __device__ constexpr cuckoo_probing();
+
+  /**
+   *@brief Constructs cuckoo probing scheme with the given hasher callables.
+   *
+   * @param hash1 First hasher
+   * @param hash2 Second hasher
+   * @param hashes Additional hashers
+   */
+  __host__ __device__ constexpr cuckoo_probing(Hash1 const& hash1,
+                                               Hash2 const& hash2,
+                                               Hashes const&... hashes);
+
+  /**
+   *@brief Constructs cuckoo probing scheme with the hasher tuple
+   *
+   * @param hash Hasher tuple
+   */
+  __host__ __device__ constexpr cuckoo_probing(hasher const& hash);
+
+  /**
+   *@brief Makes a copy of the current probing method with the given hashers
+   *
+   * @tparam NewHashes New hasher types
+   *
+   * @param hash Tuple of new hashers, one per hash function
+   *
+   * @return Copy of the current probing method
+   */
+  template <typename... NewHashes>
+  [[nodiscard]] __host__ __device__ constexpr auto rebind_hash_function(
+    cuda::std::tuple<NewHashes...> const& hash) const noexcept;
+
+  /**
+   * @brief Operator to return a probing iterator
+   *
+   * @note The iterator cycles through the distinct candidate buckets of `probe_key`.
+   *
+   * @tparam ProbeKey Type of probing key
+   * @tparam Extent Type of extent
+   *
+   * @param probe_key The probing key
+   * @param upper_bound Upper bound of the iteration
+   * @return An iterator whose value_type is convertible to slot index type
+   */
+  template <typename ProbeKey, typename Extent>
+  __host__ __device__ constexpr auto operator()(ProbeKey const& probe_key,
+                                                Extent upper_bound) const noexcept;
+
+  /**
+   * @brief Operator to return a CG-based probing iterator
+   *
+   * @note The `i`-th thread of `g` probes the `i`-th bucket of every candidate window.
+   *
+   * @tparam ProbeKey Type of probing key
+   * @tparam Extent Type of extent
+   *
+   * @param g the Cooperative Group to generate probing iterator
+   * @param probe_key The probing key
+   * @param upper_bound Upper bound of the iteration
+   * @return An iterator whose value_type is convertible to slot index type
+   */
+  template <typename ProbeKey, typename Extent>
+  __host__ __device__ constexpr auto operator()(
+    cooperative_groups::thread_block_tile<cg_size> const& g,
+    ProbeKey const& probe_key,
+    Extent upper_bound) const noexcept;
+
+  /**
+   * @brief Gets the functions used to hash keys
+   *
+   * @return The functions used to hash keys
+   */
+  __host__ __device__ constexpr hasher hash_function() const noexcept;
+
+ private:
+  hasher hashes_;
+};
+
+/**
+ * @brief Trait indicating whether the given probing scheme is of `linear_probing` type or not
+ *
+ * @tparam T Input probing scheme type
+ */
+template <typename T>
+struct is_linear_probing : cuda::std::false_type {};
+
+/**
+ * @brief Trait indicating whether the given probing scheme is of `linear_probing` type or not
+ *
+ * @tparam CGSize Size of CUDA Cooperative Groups
+ * @tparam Hash Unary callable type
+ */
+template <int32_t CGSize, typename Hash>
+struct is_linear_probing<cuco::linear_probing<CGSize, Hash>> : cuda::std::true_type {};
+
 /**
  * @brief Trait indicating whether the given probing scheme is of `double_hashing` type or not
  *
@@ -221,6 +372,26 @@ struct is_double_hashing : cuda::std::false_type {};
 template <int32_t CGSize, typename Hash1, typename Hash2>
 struct is_double_hashing<cuco::double_hashing<CGSize, Hash1, Hash2>> : cuda::std::true_type {};
 
+/**
+ * @brief Trait indicating whether the given probing scheme is of `cuckoo_probing` type or not
+ *
+ * @tparam T Input probing scheme type
+ */
+template <typename T>
+struct is_cuckoo_probing : cuda::std::false_type {};
+
+/**
+ * @brief Trait indicating whether the given probing scheme is of `cuckoo_probing` type or not
+ *
+ * @tparam CGSize Size of CUDA Cooperative Groups
+ * @tparam Hash1 Unary callable type
+ * @tparam Hash2 Unary callable type
+ * @tparam Hashes Optional additional unary callable types
+ */
+template <int32_t CGSize, typename Hash1, typename Hash2, typename... Hashes>
+struct is_cuckoo_probing<cuco::cuckoo_probing<CGSize, Hash1, Hash2, Hashes...>>
+  : cuda::std::true_type {};
+
 }  // namespace cuco
 
 #include <cuco/detail/probing_scheme/probing_scheme_impl.inl>
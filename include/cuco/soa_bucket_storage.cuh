@@ -0,0 +1,308 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/storage/bucket_storage_base.cuh>
+#include <cuco/extent.cuh>
+#include <cuco/pair.cuh>
+#include <cuco/utility/allocator.hpp>
+#include <cuco/utility/traits.hpp>
+
+#include <cuda/std/array>
+#include <cuda/stream_ref>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+namespace cuco {
+
+/**
+ * @brief Non-owning struct of arrays storage reference type.
+ *
+ * Keys and payloads are kept in two separate arrays of buckets, so key-only operations, e.g.,
+ * `contains`, only load the key array.
+ *
+ * @tparam T Storage element type, must be a `cuco::pair`
+ * @tparam BucketSize Number of slots in each bucket
+ * @tparam Extent Type of extent denoting storage capacity
+ */
+template <typename T, int32_t BucketSize, typename Extent = cuco::extent<std::size_t>>
+class soa_bucket_storage_ref : public detail::bucket_storage_base<T, BucketSize, Extent> {
+  static_assert(cuco::detail::is_cuco_pair<T>::value,
+                "Struct of arrays storage requires a cuco::pair slot type.");
+
+ public:
+  /// Array of buckets base class type
+  using base_type = detail::bucket_storage_base<T, BucketSize, Extent>;
+
+  using base_type::bucket_size;  ///< Number of elements processed per bucket
+
+  using extent_type = typename base_type::extent_type;  ///< Storage extent type
+  using size_type   = typename base_type::size_type;    ///< Storage size type
+  using value_type  = typename base_type::value_type;   ///< Slot type
+  using bucket_type = typename base_type::bucket_type;  ///< Slot bucket type
+
+  using key_type           = typename value_type::first_type;          ///< Slot key type
+  using mapped_type        = typename value_type::second_type;         ///< Slot payload type
+  using key_bucket_type    = detail::bucket<key_type, bucket_size>;     ///< Key bucket type
+  using mapped_bucket_type = detail::bucket<mapped_type, bucket_size>;  ///< Payload bucket type
+
+  using base_type::capacity;
+  using base_type::num_buckets;
+
+  /**
+   * @brief Constructor of SoA storage ref.
+   *
+   * @param size Number of buckets
+   * @param keys Pointer to the key buckets array
+   * @param payloads Pointer to the payload buckets array
+   */
+  __host__ __device__ explicit constexpr soa_bucket_storage_ref(
+    Extent size, key_bucket_type* keys, mapped_bucket_type* payloads) noexcept;
+
+  /**
+   * @brief Proxy reference to a slot whose key and payload live in different arrays.
+   */
+  struct reference;
+
+  /**
+   * @brief Custom un-incrementable input iterator for the convenience of `find` operations.
+   *
+   * @note This iterator is for read only and NOT incrementable.
+   */
+  struct iterator;
+  using const_iterator = iterator const;  ///< Const forward iterator type
+
+  /**
+   * @brief Returns an iterator to one past the last slot.
+   *
+   * @return An iterator to one past the last slot
+   */
+  [[nodiscard]] __device__ constexpr iterator end() noexcept;
+
+  /**
+   * @brief Returns a const_iterator to one past the last slot.
+   *
+   * @return A const_iterator to one past the last slot
+   */
+  [[nodiscard]] __device__ constexpr const_iterator end() const noexcept;
+
+  /**
+   * @brief Gets key buckets array.
+   *
+   * @return Pointer to the first key bucket
+   */
+  [[nodiscard]] __host__ __device__ constexpr key_bucket_type* key_data() const noexcept;
+
+  /**
+   * @brief Gets payload buckets array.
+   *
+   * @return Pointer to the first payload bucket
+   */
+  [[nodiscard]] __host__ __device__ constexpr mapped_bucket_type* payload_data() const noexcept;
+
+  /**
+   * @brief Returns an iterator to the given slot.
+   *
+   * @param index Index of the bucket
+   * @param intra_bucket_index Index of the slot within the bucket
+   * @return An iterator to the slot
+   */
+  [[nodiscard]] __device__ constexpr iterator slot(size_type index,
+                                                   int32_t intra_bucket_index) const noexcept;
+
+  /**
+   * @brief Returns an array of slots (or a bucket) for a given index.
+   *
+   * @note This loads both the keys and the payloads of the bucket. Use `key_bucket` for key-only
+   * accesses.
+   *
+   * @param index Index of the bucket
+   * @return An array of slots
+   */
+  [[nodiscard]] __device__ constexpr bucket_type operator[](size_type index) const noexcept;
+
+  /**
+   * @brief Returns the keys of the bucket with the given index.
+   *
+   * @param index Index of the bucket
+   * @return An array of keys
+   */
+  [[nodiscard]] __device__ constexpr key_bucket_type key_bucket(size_type index) const noexcept;
+
+ private:
+  key_bucket_type* keys_;         ///< Pointer to the key buckets array
+  mapped_bucket_type* payloads_;  ///< Pointer to the payload buckets array
+};
+
+/**
+ * @brief Struct of arrays open addressing storage class.
+ *
+ * @tparam T Slot type, must be a `cuco::pair`
+ * @tparam BucketSize Number of slots in each bucket
+ * @tparam Extent Type of extent denoting number of buckets
+ * @tparam Allocator Type of allocator used for device storage (de)allocation
+ */
+template <typename T,
+          int32_t BucketSize,
+          typename Extent    = cuco::extent<std::size_t>,
+          typename Allocator = cuco::cuda_allocator<T>>
+class soa_bucket_storage : public detail::bucket_storage_base<T, BucketSize, Extent> {
+ public:
+  /// Array of buckets base class type
+  using base_type = detail::bucket_storage_base<T, BucketSize, Extent>;
+
+  using base_type::bucket_size;  ///< Number of elements processed per bucket
+
+  using extent_type = typename base_type::extent_type;  ///< Storage extent type
+  using size_type   = typename base_type::size_type;    ///< Storage size type
+  using value_type  = typename base_type::value_type;   ///< Slot type
+  using bucket_type = typename base_type::bucket_type;  ///< Slot bucket type
+
+  /// Storage ref type
+  using ref_type           = soa_bucket_storage_ref<value_type, bucket_size, extent_type>;
+  using key_bucket_type    = typename ref_type::key_bucket_type;     ///< Key bucket type
+  using mapped_bucket_type = typename ref_type::mapped_bucket_type;  ///< Payload bucket type
+
+  using base_type::capacity;
+  using base_type::num_buckets;
+
+  /// Type of the allocator to (de)allocate key buckets
+  using allocator_type =
+    typename std::allocator_traits<Allocator>::template rebind_alloc<key_bucket_type>;
+  /// Type of the allocator to (de)allocate payload buckets
+  using payload_allocator_type =
+    typename std::allocator_traits<Allocator>::template rebind_alloc<mapped_bucket_type>;
+  using key_deleter_type =
+    detail::custom_deleter<size_type, allocator_type>;  ///< Type of key bucket deleter
+  using payload_deleter_type =
+    detail::custom_deleter<size_type, payload_allocator_type>;  ///< Type of payload bucket deleter
+
+  /**
+   * @brief Constructor of SoA storage.
+   *
+   * @note The input `size` should be exclusively determined by the return value of
+   * `make_bucket_extent` since it depends on the requested low-bound value, the probing scheme, and
+   * the storage.
+   *
+   * @param size Number of buckets to (de)allocate
+   * @param allocator Allocator used for (de)allocating device storage
+   */
+  explicit constexpr soa_bucket_storage(Extent size, Allocator const& allocator = {});
+
+  soa_bucket_storage(soa_bucket_storage&&) = default;  ///< Move constructor
+  /**
+   * @brief Replaces the contents of the storage with another storage.
+   *
+   * @return Reference of the current storage object
+   */
+  soa_bucket_storage& operator=(soa_bucket_storage&&) = default;
+  ~soa_bucket_storage()                               = default;  ///< Destructor
+
+  soa_bucket_storage(soa_bucket_storage const&)            = delete;
+  soa_bucket_storage& operator=(soa_bucket_storage const&) = delete;
+
+  /**
+   * @brief Gets buckets array.
+   *
+   * @note Only declared to match the interface of the other storage types. SoA storage has no
+   * contiguous array of slot buckets, so calling this function is a compile-time error. Use
+   * `key_data()` and `payload_data()` instead.
+   *
+   * @return Pointer to the first bucket
+   */
+  [[nodiscard]] constexpr bucket_type* data() const noexcept;
+
+  /**
+   * @brief Gets key buckets array.
+   *
+   * @return Pointer to the first key bucket
+   */
+  [[nodiscard]] constexpr key_bucket_type* key_data() const noexcept;
+
+  /**
+   * @brief Gets payload buckets array.
+   *
+   * @return Pointer to the first payload bucket
+   */
+  [[nodiscard]] constexpr mapped_bucket_type* payload_data() const noexcept;
+
+  /**
+   * @brief Gets the storage allocator.
+   *
+   * @return The storage allocator
+   */
+  [[nodiscard]] constexpr allocator_type allocator() const noexcept;
+
+  /**
+   * @brief Gets SoA storage reference.
+   *
+   * @return Reference of SoA storage
+   */
+  [[nodiscard]] constexpr ref_type ref() const noexcept;
+
+  /**
+   * @brief Initializes each slot in the storage to contain `value`.
+   *
+   * @param value Value to which all slots are initialized
+   * @param stream Stream used for executing the kernel
+   */
+  void initialize(value_type value, cuda::stream_ref stream = {});
+
+  /**
+   * @brief Asynchronously initializes each slot in the storage to contain `value`.
+   *
+   * @param value Value to which all slots are initialized
+   * @param stream Stream used for executing the kernel
+   */
+  void initialize_async(value_type value, cuda::stream_ref stream = {}) noexcept;
+
+ private:
+  allocator_type allocator_;                  ///< Allocator used to (de)allocate key buckets
+  payload_allocator_type payload_allocator_;  ///< Allocator used to (de)allocate payload buckets
+  key_deleter_type key_deleter_;              ///< Custom key buckets deleter
+  payload_deleter_type payload_deleter_;      ///< Custom payload buckets deleter
+  /// Pointer to the key bucket storage
+  std::unique_ptr<key_bucket_type, key_deleter_type> keys_;
+  /// Pointer to the payload bucket storage
+  std::unique_ptr<mapped_bucket_type, payload_deleter_type> payloads_;
+};
+
+namespace detail {
+/**
+ * @brief Trait indicating whether a storage ref keeps keys and payloads in separate arrays.
+ *
+ * @tparam StorageRef Storage ref type
+ */
+template <typename StorageRef>
+struct is_soa_storage_ref : std::false_type {};
+
+/// Specialization for `cuco::soa_bucket_storage_ref`
+template <typename T, int32_t BucketSize, typename Extent>
+struct is_soa_storage_ref<soa_bucket_storage_ref<T, BucketSize, Extent>> : std::true_type {};
+
+/// Helper variable template for `is_soa_storage_ref`
+template <typename StorageRef>
+inline constexpr bool is_soa_storage_ref_v = is_soa_storage_ref<StorageRef>::value;
+}  // namespace detail
+
+}  // namespace cuco
+
+#include <cuco/detail/storage/soa_bucket_storage.inl>
@@ -0,0 +1,399 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/bucket_storage.cuh>
+#include <cuco/detail/storage/bucket_storage_base.cuh>
+#include <cuco/detail/storage/counter_storage.cuh>
+#include <cuco/extent.cuh>
+#include <cuco/utility/allocator.hpp>
+
+#include <cuda/atomic>
+#include <cuda/stream_ref>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace cuco {
+namespace detail {
+/**
+ * @brief Probing iterator visiting a bounded prefix of a primary probing sequence followed by the
+ * buckets of an overflow stash.
+ *
+ * Once both the primary prefix and the stash are exhausted, the iterator returns to the first
+ * bucket of the primary sequence so that probing loops terminate as if the sequence had wrapped.
+ *
+ * @tparam Iterator Type of the primary probing iterator
+ */
+template <typename Iterator>
+class stash_probing_iterator {
+ public:
+  using size_type = typename Iterator::size_type;  ///< Size type
+
+  /**
+   * @brief Constructs a stash probing iterator
+   *
+   * @param primary Probing iterator over the primary buckets
+   * @param max_probe_steps Maximum number of primary buckets to visit
+   * @param stash_begin Index of the first stash bucket visited by the current thread
+   * @param stash_end Index one past the last stash bucket
+   * @param stash_stride Distance between two stash buckets visited by the current thread
+   */
+  __host__ __device__ constexpr stash_probing_iterator(Iterator primary,
+                                                       int32_t max_probe_steps,
+                                                       size_type stash_begin,
+                                                       size_type stash_end,
+                                                       size_type stash_stride) noexcept
+    : primary_{primary},
+      init_idx_{*primary},
+      curr_idx_{*primary},
+      next_stash_{stash_begin},
+      stash_end_{stash_end},
+      stash_stride_{stash_stride},
+      remaining_steps_{max_probe_steps}
+  {
+  }
+
+  /**
+   * @brief Dereference operator
+   *
+   * @return Current bucket index
+   */
+  __host__ __device__ constexpr auto operator*() const noexcept { return curr_idx_; }
+
+  /**
+   * @brief Prefix increment operator
+   *
+   * @return Current iterator
+   */
+  __host__ __device__ constexpr auto operator++() noexcept
+  {
+    if (remaining_steps_ > 0) {
+      ++primary_;
+      if (--remaining_steps_ > 0 and *primary_ != init_idx_) {
+        curr_idx_ = *primary_;
+        return *this;
+      }
+      remaining_steps_ = 0;
+    }
+    if (next_stash_ < stash_end_) {
+      curr_idx_ = next_stash_;
+      next_stash_ += stash_stride_;
+    } else {
+      curr_idx_ = init_idx_;
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Postfix increment operator
+   *
+   * @return Old iterator before increment
+   */
+  __host__ __device__ constexpr auto operator++(int32_t) noexcept
+  {
+    auto temp = *this;
+    ++(*this);
+    return temp;
+  }
+
+ private:
+  Iterator primary_;
+  size_type init_idx_;
+  size_type curr_idx_;
+  size_type next_stash_;
+  size_type stash_end_;
+  size_type stash_stride_;
+  int32_t remaining_steps_;
+};
+}  // namespace detail
+
+/**
+ * @brief Non-owning array of buckets storage reference type with an overflow stash.
+ *
+ * The stash is a fixed number of buckets laid out right after the primary buckets. Probing visits
+ * at most `MaxProbeSteps` primary buckets before falling back to the stash, so an insertion into
+ * a nearly full table fails after a bounded number of steps instead of walking the whole table.
+ * A device counter reports how many elements currently live in the stash.
+ *
+ * @tparam T Storage element type
+ * @tparam BucketSize Number of slots in each bucket
+ * @tparam StashSize Number of slots in the stash
+ * @tparam MaxProbeSteps Maximum number of primary buckets probed before falling back to the stash
+ * @tparam Extent Type of extent denoting the number of primary buckets
+ */
+template <typename T,
+          int32_t BucketSize,
+          int32_t StashSize,
+          int32_t MaxProbeSteps,
+          typename Extent = cuco::extent<std::size_t>>
+class stash_bucket_storage_ref : public bucket_storage_ref<T, BucketSize, Extent> {
+  static_assert(StashSize % BucketSize == 0, "Stash size must be a multiple of the bucket size.");
+  static_assert(MaxProbeSteps > 0, "At least one primary bucket must be probed.");
+
+ public:
+  /// Array of buckets storage ref base class type
+  using base_type = bucket_storage_ref<T, BucketSize, Extent>;
+
+  using base_type::bucket_size;  ///< Number of elements processed per bucket
+
+  using extent_type = typename base_type::extent_type;  ///< Storage extent type
+  using size_type   = typename base_type::size_type;    ///< Storage size type
+  using value_type  = typename base_type::value_type;   ///< Slot type
+  using bucket_type = typename base_type::bucket_type;  ///< Slot bucket type
+
+  using iterator       = typename base_type::iterator;        ///< Slot iterator type
+  using const_iterator = typename base_type::const_iterator;  ///< Const slot iterator type
+
+  /// Type of the device counter holding the number of stashed elements
+  using stash_counter_type = cuda::atomic<size_type, cuda::thread_scope_device>;
+
+  /// Number of buckets in the stash
+  static constexpr int32_t num_stash_buckets = StashSize / BucketSize;
+  /// Maximum number of primary buckets probed before falling back to the stash
+  static constexpr int32_t max_probe_steps = MaxProbeSteps;
+
+  /**
+   * @brief Constructor of stash storage ref.
+   *
+   * @param size Number of primary buckets
+   * @param buckets Pointer to the buckets array, followed by the stash buckets
+   * @param stash_counter Pointer to the device counter of stashed elements
+   */
+  __host__ __device__ explicit constexpr stash_bucket_storage_ref(
+    Extent size, bucket_type* buckets, stash_counter_type* stash_counter) noexcept;
+
+  /**
+   * @brief Gets the total number of buckets, including the stash.
+   *
+   * @return The total number of buckets
+   */
+  [[nodiscard]] __host__ __device__ constexpr size_type num_buckets() const noexcept;
+
+  /**
+   * @brief Gets the total number of slots, including the stash.
+   *
+   * @return The total number of slots
+   */
+  [[nodiscard]] __host__ __device__ constexpr size_type capacity() const noexcept;
+
+  /**
+   * @brief Returns an iterator to one past the last slot.
+   *
+   * @return An iterator to one past the last slot
+   */
+  [[nodiscard]] __device__ constexpr iterator end() noexcept;
+
+  /**
+   * @brief Returns a const_iterator to one past the last slot.
+   *
+   * @return A const_iterator to one past the last slot
+   */
+  [[nodiscard]] __device__ constexpr const_iterator end() const noexcept;
+
+  /**
+   * @brief Gets the device counter of stashed elements.
+   *
+   * @return Pointer to the stash counter
+   */
+  [[nodiscard]] __host__ __device__ constexpr stash_counter_type* stash_counter() const noexcept;
+
+  /**
+   * @brief Wraps a primary probing iterator so that it falls back to the stash.
+   *
+   * @note Each member of a cooperative group of `stride` threads visits every `stride`-th stash
+   * bucket starting at its own `rank`.
+   *
+   * @tparam Iterator Type of the primary probing iterator
+   *
+   * @param primary Probing iterator over the primary buckets
+   * @param rank Rank of the current thread within its cooperative group
+   * @param stride Size of the cooperative group
+   * @return A probing iterator over the primary buckets and then the stash
+   */
+  template <typename Iterator>
+  [[nodiscard]] __device__ constexpr detail::stash_probing_iterator<Iterator> probing_iterator(
+    Iterator primary, size_type rank, size_type stride) const noexcept;
+
+  /**
+   * @brief Accounts for an element inserted into the given bucket.
+   *
+   * @param index Index of the bucket
+   */
+  __device__ void record_insert(size_type index) const noexcept;
+
+  /**
+   * @brief Accounts for an element erased from the given bucket.
+   *
+   * @param index Index of the bucket
+   */
+  __device__ void record_erase(size_type index) const noexcept;
+
+ private:
+  stash_counter_type* stash_counter_;  ///< Pointer to the stash counter
+};
+
+/**
+ * @brief Array of buckets open addressing storage class with an overflow stash.
+ *
+ * @tparam T Slot type
+ * @tparam BucketSize Number of slots in each bucket
+ * @tparam StashSize Number of slots in the stash
+ * @tparam MaxProbeSteps Maximum number of primary buckets probed before falling back to the stash
+ * @tparam Extent Type of extent denoting the number of primary buckets
+ * @tparam Allocator Type of allocator used for device storage (de)allocation
+ */
+template <typename T,
+          int32_t BucketSize,
+          int32_t StashSize,
+          int32_t MaxProbeSteps,
+          typename Extent    = cuco::extent<std::size_t>,
+          typename Allocator = cuco::cuda_allocator<cuco::bucket<T, BucketSize>>>
+class stash_bucket_storage : public detail::bucket_storage_base<T, BucketSize, Extent> {
+ public:
+  /// Array of buckets base class type
+  using base_type = detail::bucket_storage_base<T, BucketSize, Extent>;
+
+  using base_type::bucket_size;  ///< Number of elements processed per bucket
+
+  using extent_type = typename base_type::extent_type;  ///< Storage extent type
+  using size_type   = typename base_type::size_type;    ///< Storage size type
+  using value_type  = typename base_type::value_type;   ///< Slot type
+  using bucket_type = typename base_type::bucket_type;  ///< Slot bucket type
+
+  /// Storage ref type
+  using ref_type =
+    stash_bucket_storage_ref<value_type, bucket_size, StashSize, MaxProbeSteps, extent_type>;
+
+  /// Type of the allocator to (de)allocate buckets
+  using allocator_type =
+    typename std::allocator_traits<Allocator>::template rebind_alloc<bucket_type>;
+  using bucket_deleter_type =
+    detail::custom_deleter<size_type, allocator_type>;  ///< Type of bucket deleter
+  /// Type of the storage of the stash counter
+  using stash_counter_storage_type =
+    detail::counter_storage<size_type, cuda::thread_scope_device, Allocator>;
+
+  /**
+   * @brief Constructor of stash storage.
+   *
+   * @note The input `size` should be exclusively determined by the return value of
+   * `make_bucket_extent` since it depends on the requested low-bound value, the probing scheme, and
+   * the storage. The stash is allocated on top of `size` buckets.
+   *
+   * @param size Number of primary buckets to (de)allocate
+   * @param allocator Allocator used for (de)allocating device storage
+   */
+  explicit constexpr stash_bucket_storage(Extent size, Allocator const& allocator = {});
+
+  stash_bucket_storage(stash_bucket_storage&&) = default;  ///< Move constructor
+  /**
+   * @brief Replaces the contents of the storage with another storage.
+   *
+   * @return Reference of the current storage object
+   */
+  stash_bucket_storage& operator=(stash_bucket_storage&&) = default;
+  ~stash_bucket_storage()                                 = default;  ///< Destructor
+
+  stash_bucket_storage(stash_bucket_storage const&)            = delete;
+  stash_bucket_storage& operator=(stash_bucket_storage const&) = delete;
+
+  /**
+   * @brief Gets the total number of buckets, including the stash.
+   *
+   * @return The total number of buckets
+   */
+  [[nodiscard]] constexpr size_type num_buckets() const noexcept;
+
+  /**
+   * @brief Gets the total number of slots, including the stash.
+   *
+   * @return The total number of slots
+   */
+  [[nodiscard]] constexpr size_type capacity() const noexcept;
+
+  /**
+   * @brief Gets buckets array.
+   *
+   * @return Pointer to the first bucket
+   */
+  [[nodiscard]] constexpr bucket_type* data() const noexcept;
+
+  /**
+   * @brief Gets the storage allocator.
+   *
+   * @return The storage allocator
+   */
+  [[nodiscard]] constexpr allocator_type allocator() const noexcept;
+
+  /**
+   * @brief Gets stash storage reference.
+   *
+   * @return Reference of stash storage
+   */
+  [[nodiscard]] constexpr ref_type ref() const noexcept;
+
+  /**
+   * @brief Initializes each slot in the storage, including the stash, to contain `key` and resets
+   * the stash counter.
+   *
+   * @param key Key to which all keys in `slots` are initialized
+   * @param stream Stream used for executing the kernel
+   */
+  void initialize(value_type key, cuda::stream_ref stream = {});
+
+  /**
+   * @brief Asynchronously initializes each slot in the storage, including the stash, to contain
+   * `key` and resets the stash counter.
+   *
+   * @param key Key to which all keys in `slots` are initialized
+   * @param stream Stream used for executing the kernel
+   */
+  void initialize_async(value_type key, cuda::stream_ref stream = {}) noexcept;
+
+ private:
+  allocator_type allocator_;            ///< Allocator used to (de)allocate buckets
+  bucket_deleter_type bucket_deleter_;  ///< Custom buckets deleter
+  /// Pointer to the bucket storage
+  std::unique_ptr<bucket_type, bucket_deleter_type> buckets_;
+  stash_counter_storage_type stash_counter_;  ///< Number of stashed elements
+};
+
+namespace detail {
+/**
+ * @brief Trait indicating whether a storage ref falls back to an overflow stash.
+ *
+ * @tparam StorageRef Storage ref type
+ */
+template <typename StorageRef>
+struct is_stash_storage_ref : std::false_type {};
+
+/// Specialization for `cuco::stash_bucket_storage_ref`
+template <typename T, int32_t BucketSize, int32_t StashSize, int32_t MaxProbeSteps, typename Extent>
+struct is_stash_storage_ref<
+  stash_bucket_storage_ref<T, BucketSize, StashSize, MaxProbeSteps, Extent>> : std::true_type {};
+
+/// Helper variable template for `is_stash_storage_ref`
+template <typename StorageRef>
+inline constexpr bool is_stash_storage_ref_v = is_stash_storage_ref<StorageRef>::value;
+}  // namespace detail
+
+}  // namespace cuco
+
+#include <cuco/detail/storage/stash_bucket_storage.inl>
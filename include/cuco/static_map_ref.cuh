@@ -67,9 +67,11 @@ class static_map_ref
   : public detail::operator_impl<
       Operators,
       static_map_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>>... {
+ public:
   /// Flag indicating whether duplicate keys are allowed or not
   static constexpr auto allows_duplicates = false;
 
+ private:
   /// Implementation type
   using impl_type = detail::
     open_addressing_ref_impl<Key, Scope, KeyEqual, ProbingScheme, StorageRef, allows_duplicates>;
@@ -264,6 +266,18 @@ class static_map_ref
   template <typename NewHash>
   [[nodiscard]] __host__ __device__ constexpr auto rebind_hash_function(NewHash const& hash) const;
 
+  /**
+   * @brief Makes a copy of the current device reference accessing the given storage
+   *
+   * @note The given storage must have been set up with the same sentinels as the current one.
+   *
+   * @param storage_ref Non-owning ref of the new slot storage
+   *
+   * @return Copy of the current device ref
+   */
+  [[nodiscard]] __host__ __device__ constexpr auto rebind_storage_ref(
+    StorageRef storage_ref) const noexcept;
+
   /**
    * @brief Makes a copy of the current device reference using non-owned memory
    *
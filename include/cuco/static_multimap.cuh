@@ -24,6 +24,9 @@
 #include <cuco/static_multimap_ref.cuh>
 #include <cuco/types.cuh>
 #include <cuco/utility/allocator.hpp>
+#include <cuco/utility/async_result.hpp>
+#include <cuco/utility/container_statistics.hpp>
+#include <cuco/utility/persistence.hpp>
 #include <cuco/utility/traits.hpp>
 
 #include <cuda/std/atomic>
@@ -38,6 +41,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <string>
 #include <type_traits>
 #include <utility>
 
@@ -69,6 +73,10 @@ namespace experimental {
  * `KeyEqual` should be used with caution.
  * @note `ProbingScheme::cg_size` indicates how many threads are used to handle one independent
  * device operation. `cg_size == 1` uses the scalar (or non-CG) code paths.
+ * @note The `_async` bulk APIs writing to caller-provided memory can be captured into a CUDA
+ * graph. Capturing `retrieve_all_async` requires a stream-ordered allocator such as
+ * `cuco::stream_ordered_allocator` for its temporary storage. `rehash_async` and the handle
+ * returning overloads cannot be captured.
  *
  * @throw If the size of the given key type is larger than 8 bytes
  * @throw If the size of the given payload type is larger than 8 bytes
@@ -131,6 +139,10 @@ class static_multimap {
   using storage_ref_type    = typename impl_type::storage_ref_type;
   using probing_scheme_type = typename impl_type::probing_scheme_type;  ///< Probing scheme type
   using hasher              = typename probing_scheme_type::hasher;     ///< Hash function type
+  /// Probe length and occupancy statistics type
+  using statistics_type = container_statistics<size_type>;
+  /// Handle to a size asynchronously computed on the device
+  using async_size_type = cuco::async_result<size_type>;
 
   using mapped_type = T;  ///< Payload type
   template <typename... Operators>
@@ -313,7 +325,7 @@ class static_multimap {
    * @param stream CUDA stream used for insert
    */
   template <typename InputIt>
-  void insert_async(InputIt first, InputIt last, cuda::stream_ref stream = {}) noexcept;
+  void insert_async(InputIt first, InputIt last, cuda::stream_ref stream = {});
 
   /**
    * @brief Inserts keys in the range `[first, last)` if `pred` of the corresponding stencil returns
@@ -368,7 +380,7 @@ class static_multimap {
                        InputIt last,
                        StencilIt stencil,
                        Predicate pred,
-                       cuda::stream_ref stream = {}) noexcept;
+                       cuda::stream_ref stream = {});
 
   /**
    * @brief Indicates whether the keys in the range `[first, last)` are contained in the map.
@@ -406,7 +418,7 @@ class static_multimap {
   void contains_async(InputIt first,
                       InputIt last,
                       OutputIt output_begin,
-                      cuda::stream_ref stream = {}) const noexcept;
+                      cuda::stream_ref stream = {}) const;
 
   /**
    * @brief Indicates whether the keys in the range `[first, last)` are contained in the map if
@@ -470,7 +482,7 @@ class static_multimap {
                          StencilIt stencil,
                          Predicate pred,
                          OutputIt output_begin,
-                         cuda::stream_ref stream = {}) const noexcept;
+                         cuda::stream_ref stream = {}) const;
 
   /**
    * @brief For all keys in the range `[first, last)`, finds a payload with its key equivalent to
@@ -666,6 +678,49 @@ class static_multimap {
   template <typename InputIt>
   size_type count(InputIt first, InputIt last, cuda::stream_ref stream = {}) const;
 
+  /**
+   * @brief Asynchronously counts the occurrences of keys in `[first, last)` contained in the
+   * multimap and writes the sum to `output`.
+   *
+   * @note This function does not synchronize the given stream.
+   * @note `output` must be device accessible, e.g., device or pinned host memory. It is accumulated
+   * into directly, so no temporary memory is allocated and the call can be captured into a CUDA
+   * graph.
+   *
+   * @tparam Input Device accessible input iterator
+   *
+   * @param first Beginning of the sequence of keys to count
+   * @param last End of the sequence of keys to count
+   * @param output Location the sum of total occurrences of all keys in `[first, last)` is
+   * written to
+   * @param stream CUDA stream used for count
+   */
+  template <typename InputIt>
+  void count_async(InputIt first,
+                   InputIt last,
+                   size_type* output,
+                   cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief Asynchronously counts the occurrences of keys in `[first, last)` contained in the
+   * multimap.
+   *
+   * @note This function does not synchronize the given stream. Only `get()` on the returned handle
+   * waits for the result.
+   *
+   * @tparam Input Device accessible input iterator
+   *
+   * @param first Beginning of the sequence of keys to count
+   * @param last End of the sequence of keys to count
+   * @param stream CUDA stream used for count
+   *
+   * @return Handle to the sum of total occurrences of all keys in `[first, last)`
+   */
+  template <typename InputIt>
+  [[nodiscard]] async_size_type count_async(InputIt first,
+                                            InputIt last,
+                                            cuda::stream_ref stream = {}) const;
+
   /**
    * @brief Retrieves the matched key-value pair in the multimap corresponding to all probe keys in
    * the range
@@ -700,6 +755,67 @@ class static_multimap {
                                                    OutputMatchIt output_match,
                                                    cuda::stream_ref stream = {}) const;
 
+  /**
+   * @brief Asynchronously retrieves the matches in the multimap of all probe keys in the range
+   * `[first, last)` and writes their number to `num_retrieved`.
+   *
+   * Same as `retrieve` except that the output size is written to `num_retrieved` instead of being
+   * returned, so that retrieval can be chained with later work without a host round trip.
+   *
+   * @note This function does not synchronize the given stream.
+   * @note `num_retrieved` must be device accessible, e.g., device or pinned host memory. It is
+   * accumulated into directly, so no temporary memory is allocated and the call can be captured
+   * into a CUDA graph.
+   *
+   * @tparam InputIt Device accessible input iterator
+   * @tparam OutputProbeIt Device accessible output iterator whose `value_type` can be constructed
+   * from the probe key type
+   * @tparam OutputMatchIt Device accessible output iterator whose `value_type` can be constructed
+   * from the multimap's `value_type`
+   *
+   * @param first Beginning of the sequence of probe keys
+   * @param last End of the sequence of probe keys
+   * @param output_probe Beginning of the sequence of the probe keys that have a match
+   * @param output_match Beginning of the sequence of the matched key-value pairs
+   * @param num_retrieved Location the number of retrieved matches is written to
+   * @param stream CUDA stream used for retrieve
+   */
+  template <typename InputIt, typename OutputProbeIt, typename OutputMatchIt>
+  void retrieve_async(InputIt first,
+                      InputIt last,
+                      OutputProbeIt output_probe,
+                      OutputMatchIt output_match,
+                      size_type* num_retrieved,
+                      cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief Asynchronously retrieves the matches in the multimap of all probe keys in the range
+   * `[first, last)`.
+   *
+   * @note This function does not synchronize the given stream. Only `get()` on the returned handle
+   * waits for the result.
+   *
+   * @tparam InputIt Device accessible input iterator
+   * @tparam OutputProbeIt Device accessible output iterator whose `value_type` can be constructed
+   * from the probe key type
+   * @tparam OutputMatchIt Device accessible output iterator whose `value_type` can be constructed
+   * from the multimap's `value_type`
+   *
+   * @param first Beginning of the sequence of probe keys
+   * @param last End of the sequence of probe keys
+   * @param output_probe Beginning of the sequence of the probe keys that have a match
+   * @param output_match Beginning of the sequence of the matched key-value pairs
+   * @param stream CUDA stream used for retrieve
+   *
+   * @return Handle to the number of retrieved matches
+   */
+  template <typename InputIt, typename OutputProbeIt, typename OutputMatchIt>
+  [[nodiscard]] async_size_type retrieve_async(InputIt first,
+                                               InputIt last,
+                                               OutputProbeIt output_probe,
+                                               OutputMatchIt output_match,
+                                               cuda::stream_ref stream = {}) const;
+
   /**
    * @brief Retrieves all of the keys and their associated values contained in the multimap
    *
@@ -725,6 +841,61 @@ class static_multimap {
                                            ValueOut values_out,
                                            cuda::stream_ref stream = {}) const;
 
+  /**
+   * @brief Asynchronously retrieves all of the keys and their associated values contained in the
+   * multimap and writes their number to `num_out`.
+   *
+   * @note This function does not synchronize the given stream.
+   * @note Temporary device memory is released in stream order only with a stream-ordered allocator
+   * such as `cuco::stream_ordered_allocator`, which is also required to capture the call into a
+   * CUDA graph.
+   * @note `num_out` must be device accessible, e.g., device or pinned host memory.
+   * @note The multimap capacity must not exceed `std::numeric_limits<int32_t>::max()`.
+   *
+   * @throw std::invalid_argument if the capacity exceeds `std::numeric_limits<int32_t>::max()`
+   *
+   * @tparam KeyOut Device accessible random access output iterator whose `value_type` is
+   * convertible from `key_type`.
+   * @tparam ValueOut Device accesible random access output iterator whose `value_type` is
+   * convertible from `mapped_type`.
+   *
+   * @param keys_out Beginning output iterator for keys
+   * @param values_out Beginning output iterator for associated values
+   * @param num_out Location the number of retrieved elements is written to
+   * @param stream CUDA stream used for this operation
+   */
+  template <typename KeyOut, typename ValueOut>
+  void retrieve_all_async(KeyOut keys_out,
+                          ValueOut values_out,
+                          size_type* num_out,
+                          cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief Asynchronously retrieves all of the keys and their associated values contained in the
+   * multimap.
+   *
+   * @note This function does not synchronize the given stream. Only `get()` on the returned handle
+   * waits for the result.
+   * @note The multimap capacity must not exceed `std::numeric_limits<int32_t>::max()`.
+   *
+   * @throw std::invalid_argument if the capacity exceeds `std::numeric_limits<int32_t>::max()`
+   *
+   * @tparam KeyOut Device accessible random access output iterator whose `value_type` is
+   * convertible from `key_type`.
+   * @tparam ValueOut Device accesible random access output iterator whose `value_type` is
+   * convertible from `mapped_type`.
+   *
+   * @param keys_out Beginning output iterator for keys
+   * @param values_out Beginning output iterator for associated values
+   * @param stream CUDA stream used for this operation
+   *
+   * @return Handle to the number of retrieved elements
+   */
+  template <typename KeyOut, typename ValueOut>
+  [[nodiscard]] async_size_type retrieve_all_async(KeyOut keys_out,
+                                                   ValueOut values_out,
+                                                   cuda::stream_ref stream = {}) const;
+
   /**
    * @brief Regenerates the container.
    *
@@ -784,12 +955,77 @@ class static_multimap {
    * @brief Gets the number of elements in the container.
    *
    * @note This function synchronizes the given stream.
+   * @note This is a constant-time operation if size tracking is enabled via
+   * `enable_size_tracking`. Otherwise, the whole storage is scanned.
    *
    * @param stream CUDA stream used to get the number of inserted elements
    * @return The number of elements in the container
    */
   [[nodiscard]] size_type size(cuda::stream_ref stream = {}) const;
 
+  /**
+   * @brief Enables tracking of the number of elements so that `size()` becomes a constant-time
+   * operation.
+   *
+   * @note Once enabled, all host bulk modifying APIs keep an internal device counter up to date.
+   * The counter is initialized with the current number of elements.
+   * @note Modifications performed through device-side refs in user kernels are not tracked. Call
+   * this function again afterwards to resynchronize the counter.
+   * @note This function does not synchronize the given stream.
+   *
+   * @param stream CUDA stream used to initialize the counter
+   */
+  void enable_size_tracking(cuda::stream_ref stream = {});
+
+  /**
+   * @brief Gathers probe length and occupancy statistics of the container.
+   *
+   * The statistics include a histogram of the probe lengths of all elements, the longest probe
+   * length, the number of erased slots, and a histogram of the number of filled slots per bucket.
+   *
+   * @note This function synchronizes the given stream.
+   *
+   * @param stream CUDA stream used for this operation
+   * @return The container statistics
+   */
+  [[nodiscard]] statistics_type statistics(cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief Writes the container to a file at `path`.
+   *
+   * The file holds a versioned header, the probing scheme including the hash function seed, the
+   * sentinels, and the raw slot storage. See `cuco::persisted_header` for the layout.
+   *
+   * @note This function synchronizes the given stream.
+   * @note Only available with `cuco::storage` and `cuco::counted_storage`.
+   *
+   * @throw cuco::logic_error If the file cannot be written or an incremental rehash is pending
+   *
+   * @param path Path of the file to write
+   * @param stream CUDA stream used for this operation
+   */
+  void save(std::string const& path, cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief Replaces the content of the container by the content of a file written by `save`.
+   *
+   * The file is memory-mapped and its slot storage is copied into the container in chunks through
+   * pinned host memory. No element is rehashed, so the container must have the same type,
+   * capacity, hash function, probing scheme and sentinels as the container that wrote the file.
+   * `cuco::read_persisted_header` returns the capacity to construct it with.
+   *
+   * @note This function synchronizes the given stream.
+   * @note Only available with `cuco::storage` and `cuco::counted_storage`.
+   * @note The file is validated before the container is modified. If validation fails, the
+   * container is left unchanged.
+   *
+   * @throw cuco::logic_error If the file is invalid or was written by an incompatible container
+   *
+   * @param path Path of the file to read
+   * @param stream CUDA stream used for this operation
+   */
+  void load(std::string const& path, cuda::stream_ref stream = {});
+
   /**
    * @brief Gets the maximum number of elements the hash map can hold.
    *
@@ -67,9 +67,11 @@ class static_multimap_ref
   : public detail::operator_impl<
       Operators,
       static_multimap_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>>... {
+ public:
   /// Flag indicating whether duplicate keys are allowed or not
   static constexpr auto allows_duplicates = true;
 
+ private:
   /// Implementation type
   using impl_type = detail::
     open_addressing_ref_impl<Key, Scope, KeyEqual, ProbingScheme, StorageRef, allows_duplicates>;
@@ -64,9 +64,11 @@ class static_multiset_ref
   : public detail::operator_impl<
       Operators,
       static_multiset_ref<Key, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>>... {
+ public:
   /// Flag indicating whether duplicate keys are allowed or not
   static constexpr auto allows_duplicates = true;
 
+ private:
   /// Implementation type
   using impl_type = detail::
     open_addressing_ref_impl<Key, Scope, KeyEqual, ProbingScheme, StorageRef, allows_duplicates>;
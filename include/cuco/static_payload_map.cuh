@@ -0,0 +1,484 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/storage/storage_base.cuh>
+#include <cuco/extent.cuh>
+#include <cuco/hash_functions.cuh>
+#include <cuco/probing_scheme.cuh>
+#include <cuco/static_set.cuh>
+#include <cuco/storage.cuh>
+#include <cuco/types.cuh>
+#include <cuco/utility/allocator.hpp>
+#include <cuco/utility/cuda_thread_scope.cuh>
+
+#include <cuda/stream_ref>
+#include <thrust/functional.h>
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace cuco {
+/**
+ * @brief A GPU-accelerated, unordered, associative container of key-value pairs with unique keys,
+ * storing keys and payloads in separate arrays.
+ *
+ * Unlike `cuco::static_map`, whose slots hold the full key-value pair and are thus limited to
+ * payloads of at most 8 bytes, `static_payload_map` keeps only keys in the probed bucket array.
+ * The payload of the key stored in slot `i` lives at index `i` of a parallel payload array, so
+ * probing stays as narrow as in a `cuco::static_set` and the payload array is accessed exactly once
+ * per successful operation. This makes the container suitable for wide rows, e.g., aggregation
+ * states of tens of bytes.
+ *
+ * @note Payloads of not-yet-inserted slots are initialized to `empty_value_sentinel`, which also
+ * serves as the initial value of newly inserted keys in `insert_or_apply`.
+ * @note Erasing keys requires an erased key sentinel distinct from the empty key sentinel. The
+ * payloads of erased keys are reset to `empty_value_sentinel`.
+ *
+ * @tparam Key Type used for keys. Requires `cuco::is_bitwise_comparable_v<Key>`
+ * @tparam T Type of the mapped values. Must be trivially copyable; no size limit applies
+ * @tparam Extent Data structure size type
+ * @tparam Scope The scope in which operations will be performed by individual threads.
+ * @tparam KeyEqual Binary callable type used to compare two keys for equality
+ * @tparam ProbingScheme Probing scheme (see `include/cuco/probing_scheme.cuh` for choices)
+ * @tparam Allocator Type of allocator used for device storage
+ * @tparam Storage Slot bucket storage type
+ */
+template <class Key,
+          class T,
+          class Extent             = cuco::extent<std::size_t>,
+          cuda::thread_scope Scope = cuda::thread_scope_device,
+          class KeyEqual           = thrust::equal_to<Key>,
+          class ProbingScheme      = cuco::linear_probing<4,  // CG size
+                                                          cuco::default_hash_function<Key>>,
+          class Allocator          = cuco::cuda_allocator<Key>,
+          class Storage            = cuco::storage<1>>
+class static_payload_map {
+  static_assert(std::is_trivially_copyable_v<T>, "Payload type must be trivially copyable.");
+
+ public:
+  /// Underlying container of keys
+  using key_set_type = static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>;
+
+  static constexpr auto cg_size      = key_set_type::cg_size;       ///< CG size for probing
+  static constexpr auto bucket_size  = key_set_type::bucket_size;   ///< Bucket size for probing
+  static constexpr auto thread_scope = key_set_type::thread_scope;  ///< CUDA thread scope
+
+  using key_type            = Key;                                         ///< Key type
+  using mapped_type         = T;                                           ///< Payload type
+  using extent_type         = typename key_set_type::extent_type;          ///< Extent type
+  using size_type           = typename key_set_type::size_type;            ///< Size type
+  using key_equal           = typename key_set_type::key_equal;            ///< Key equality type
+  using allocator_type      = typename key_set_type::allocator_type;       ///< Allocator type
+  using probing_scheme_type = typename key_set_type::probing_scheme_type;  ///< Probing scheme type
+  using hasher              = typename key_set_type::hasher;               ///< Hash function type
+  /// Allocator type used for the payload array
+  using payload_allocator_type =
+    typename std::allocator_traits<allocator_type>::template rebind_alloc<mapped_type>;
+
+  static_payload_map(static_payload_map const&)            = delete;
+  static_payload_map& operator=(static_payload_map const&) = delete;
+
+  static_payload_map(static_payload_map&&) = default;  ///< Move constructor
+
+  /**
+   * @brief Replaces the contents of the container with another container.
+   *
+   * @return Reference of the current map object
+   */
+  static_payload_map& operator=(static_payload_map&&) = default;
+  ~static_payload_map()                               = default;
+
+  /**
+   * @brief Constructs a statically-sized map with the specified initial capacity, sentinel values
+   * and CUDA stream.
+   *
+   * The actual map capacity depends on the given `capacity`, the probing scheme, CG size, and the
+   * bucket size and it is computed via the `make_bucket_extent` factory. Insert operations will not
+   * automatically grow the map. Attempting to insert more unique keys than the capacity of the map
+   * results in undefined behavior.
+   *
+   * @note Any `*_sentinel`s are reserved and behavior is undefined when attempting to insert
+   * this sentinel value.
+   * @note This constructor doesn't synchronize the given stream.
+   *
+   * @param capacity The requested lower-bound map size
+   * @param empty_key_sentinel The reserved key value for empty slots
+   * @param empty_value_sentinel The payload of empty slots and the initial payload of new keys
+   * @param pred Key equality binary predicate
+   * @param probing_scheme Probing scheme
+   * @param scope The scope in which operations will be performed
+   * @param storage Kind of storage to use
+   * @param alloc Allocator used for allocating device storage
+   * @param stream CUDA stream used to initialize the map
+   */
+  constexpr static_payload_map(Extent capacity,
+                               empty_key<Key> empty_key_sentinel,
+                               empty_value<T> empty_value_sentinel,
+                               KeyEqual const& pred                = {},
+                               ProbingScheme const& probing_scheme = {},
+                               cuda_thread_scope<Scope> scope      = {},
+                               Storage storage                     = {},
+                               Allocator const& alloc              = {},
+                               cuda::stream_ref stream             = {});
+
+  /**
+   * @brief Constructs a statically-sized map with the specified initial capacity, sentinel values
+   * and CUDA stream.
+   *
+   * The actual map capacity depends on the given `capacity`, the probing scheme, CG size, and the
+   * bucket size and it is computed via the `make_bucket_extent` factory. Insert operations will not
+   * automatically grow the map. Attempting to insert more unique keys than the capacity of the map
+   * results in undefined behavior.
+   *
+   * @note Any `*_sentinel`s are reserved and behavior is undefined when attempting to insert
+   * this sentinel value.
+   * @note This constructor doesn't synchronize the given stream.
+   *
+   * @param capacity The requested lower-bound map size
+   * @param empty_key_sentinel The reserved key value for empty slots
+   * @param empty_value_sentinel The payload of empty slots and the initial payload of new keys
+   * @param erased_key_sentinel The reserved key to denote erased slots
+   * @param pred Key equality binary predicate
+   * @param probing_scheme Probing scheme
+   * @param scope The scope in which operations will be performed
+   * @param storage Kind of storage to use
+   * @param alloc Allocator used for allocating device storage
+   * @param stream CUDA stream used to initialize the map
+   */
+  constexpr static_payload_map(Extent capacity,
+                               empty_key<Key> empty_key_sentinel,
+                               empty_value<T> empty_value_sentinel,
+                               erased_key<Key> erased_key_sentinel,
+                               KeyEqual const& pred                = {},
+                               ProbingScheme const& probing_scheme = {},
+                               cuda_thread_scope<Scope> scope      = {},
+                               Storage storage                     = {},
+                               Allocator const& alloc              = {},
+                               cuda::stream_ref stream             = {});
+
+  /**
+   * @brief Erases all elements from the container. After this call, `size()` returns zero.
+   *
+   * @param stream CUDA stream this operation is executed in
+   */
+  void clear(cuda::stream_ref stream = {});
+
+  /**
+   * @brief Asynchronously erases all elements from the container. After this call, `size()`
+   * returns zero.
+   *
+   * @param stream CUDA stream this operation is executed in
+   */
+  void clear_async(cuda::stream_ref stream = {}) noexcept;
+
+  /**
+   * @brief Inserts all keys in the range `[first, last)` with their corresponding payloads and
+   * returns the number of successful insertions.
+   *
+   * @note If multiple keys in `[first, last)` compare equal, it is unspecified which payload is
+   * stored.
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `insert_async`.
+   *
+   * @tparam InputIt Device accessible random access input iterator whose `value_type` is
+   * convertible to the map's `key_type`
+   * @tparam PayloadIt Device accessible random access input iterator whose `value_type` is
+   * convertible to the map's `mapped_type`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param payload_begin Beginning of the sequence of payloads
+   * @param stream CUDA stream used for insert
+   *
+   * @return Number of successful insertions
+   */
+  template <typename InputIt, typename PayloadIt>
+  size_type insert(InputIt first,
+                   InputIt last,
+                   PayloadIt payload_begin,
+                   cuda::stream_ref stream = {});
+
+  /**
+   * @brief Asynchronously inserts all keys in the range `[first, last)` with their corresponding
+   * payloads.
+   *
+   * @tparam InputIt Device accessible random access input iterator whose `value_type` is
+   * convertible to the map's `key_type`
+   * @tparam PayloadIt Device accessible random access input iterator whose `value_type` is
+   * convertible to the map's `mapped_type`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param payload_begin Beginning of the sequence of payloads
+   * @param stream CUDA stream used for insert
+   */
+  template <typename InputIt, typename PayloadIt>
+  void insert_async(InputIt first,
+                    InputIt last,
+                    PayloadIt payload_begin,
+                    cuda::stream_ref stream = {}) noexcept;
+
+  /**
+   * @brief For each key in `[first, last)`, inserts the key if it is not yet present and applies
+   * `op` to its stored payload and the corresponding input payload.
+   *
+   * Newly inserted keys start from `empty_value_sentinel`, which should therefore be the identity
+   * of `op`, e.g., zero for a sum.
+   *
+   * @note `op` is invoked as `op(mapped_type& stored, V const& input)` where `V` is the
+   * `value_type` of `PayloadIt`. It is invoked concurrently for equal keys and must update
+   * `stored` atomically, e.g., via `cuda::atomic_ref` on each field of a wide payload.
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `insert_or_apply_async`.
+   *
+   * @tparam InputIt Device accessible random access input iterator whose `value_type` is
+   * convertible to the map's `key_type`
+   * @tparam PayloadIt Device accessible random access input iterator
+   * @tparam Op Callable type used to combine payloads
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param payload_begin Beginning of the sequence of payloads
+   * @param op Callable used to combine payloads
+   * @param stream CUDA stream used for insert
+   */
+  template <typename InputIt, typename PayloadIt, typename Op>
+  void insert_or_apply(InputIt first,
+                       InputIt last,
+                       PayloadIt payload_begin,
+                       Op op,
+                       cuda::stream_ref stream = {});
+
+  /**
+   * @brief Asynchronously inserts keys or applies `op` to the payloads of existing keys.
+   *
+   * @see insert_or_apply
+   *
+   * @tparam InputIt Device accessible random access input iterator whose `value_type` is
+   * convertible to the map's `key_type`
+   * @tparam PayloadIt Device accessible random access input iterator
+   * @tparam Op Callable type used to combine payloads
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param payload_begin Beginning of the sequence of payloads
+   * @param op Callable used to combine payloads
+   * @param stream CUDA stream used for insert
+   */
+  template <typename InputIt, typename PayloadIt, typename Op>
+  void insert_or_apply_async(InputIt first,
+                             InputIt last,
+                             PayloadIt payload_begin,
+                             Op op,
+                             cuda::stream_ref stream = {}) noexcept;
+
+  /**
+   * @brief Erases keys in the range `[first, last)`.
+   *
+   * @note For each key `k` in `[first, last)`, if contains(k) returns true, removes `k` and resets
+   * its payload to `empty_value_sentinel`. Else, no effect.
+   * @note This function synchronizes `stream`.
+   *
+   * @note Side-effects:
+   *  - `contains(k) == false`
+   *  - `size()` is reduced by the total number of erased keys
+   *  - a later `insert_or_apply` of `k` starts from `empty_value_sentinel`
+   *
+   * @tparam InputIt Device accessible input iterator whose `value_type` is
+   * convertible to the map's `key_type`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param stream Stream used for executing the kernels
+   *
+   * @throw std::logic_error if a unique erased key sentinel value was not provided at construction
+   */
+  template <typename InputIt>
+  void erase(InputIt first, InputIt last, cuda::stream_ref stream = {});
+
+  /**
+   * @brief Asynchronously erases keys in the range `[first, last)`.
+   *
+   * @see erase
+   *
+   * @tparam InputIt Device accessible input iterator whose `value_type` is
+   * convertible to the map's `key_type`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param stream Stream used for executing the kernels
+   *
+   * @throw std::logic_error if a unique erased key sentinel value was not provided at construction
+   */
+  template <typename InputIt>
+  void erase_async(InputIt first, InputIt last, cuda::stream_ref stream = {});
+
+  /**
+   * @brief Indicates whether the keys in the range `[first, last)` are contained in the map.
+   *
+   * @note This function synchronizes the given stream.
+   *
+   * @tparam InputIt Device accessible input iterator
+   * @tparam OutputIt Device accessible output iterator assignable from `bool`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param output_begin Beginning of the sequence of booleans for the presence of each key
+   * @param stream Stream used for executing the kernels
+   */
+  template <typename InputIt, typename OutputIt>
+  void contains(InputIt first,
+                InputIt last,
+                OutputIt output_begin,
+                cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief For all keys in the range `[first, last)`, finds a payload with its key equivalent to
+   * the query key.
+   *
+   * @note If the key `*(first + i)` has a match in the map, copies its payload to
+   * `(output_begin + i)`. Else, copies the empty value sentinel.
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `find_async`.
+   *
+   * @tparam InputIt Device accessible input iterator
+   * @tparam OutputIt Device accessible output iterator assignable from the map's `mapped_type`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param output_begin Beginning of the sequence of payloads retrieved for each key
+   * @param stream Stream used for executing the kernels
+   */
+  template <typename InputIt, typename OutputIt>
+  void find(InputIt first,
+            InputIt last,
+            OutputIt output_begin,
+            cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief Asynchronously finds the payloads of all keys in the range `[first, last)`.
+   *
+   * @see find
+   *
+   * @tparam InputIt Device accessible input iterator
+   * @tparam OutputIt Device accessible output iterator assignable from the map's `mapped_type`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param output_begin Beginning of the sequence of payloads retrieved for each key
+   * @param stream Stream used for executing the kernels
+   */
+  template <typename InputIt, typename OutputIt>
+  void find_async(InputIt first,
+                  InputIt last,
+                  OutputIt output_begin,
+                  cuda::stream_ref stream = {}) const noexcept;
+
+  /**
+   * @brief Retrieves all keys contained in the map with their payloads.
+   *
+   * @note This API synchronizes the given stream.
+   * @note The order in which keys are returned is implementation defined and not guaranteed to be
+   * consistent between subsequent calls to `retrieve_all`.
+   * @note Behavior is undefined if the range beginning at `keys_out` or `payloads_out` is smaller
+   * than the return value of `size()`.
+   * @note Temporary device memory is obtained from the map's allocator.
+   *
+   * @tparam KeyOut Device accessible random access output iterator whose `value_type` is
+   * convertible from `key_type`.
+   * @tparam PayloadOut Device accessible random access output iterator whose `value_type` is
+   * convertible from `mapped_type`.
+   *
+   * @param keys_out Beginning output iterator for keys
+   * @param payloads_out Beginning output iterator for associated payloads
+   * @param stream CUDA stream used for this operation
+   *
+   * @return Pair of iterators indicating the last elements in the output
+   */
+  template <typename KeyOut, typename PayloadOut>
+  std::pair<KeyOut, PayloadOut> retrieve_all(KeyOut keys_out,
+                                             PayloadOut payloads_out,
+                                             cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief Gets the number of elements in the container.
+   *
+   * @note This function synchronizes the given stream.
+   *
+   * @param stream CUDA stream used to get the number of inserted elements
+   * @return The number of elements in the container
+   */
+  [[nodiscard]] size_type size(cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief Gets the maximum number of elements the map can hold.
+   *
+   * @return The maximum number of elements the map can hold
+   */
+  [[nodiscard]] constexpr auto capacity() const noexcept;
+
+  /**
+   * @brief Gets the sentinel value used to represent an empty key slot.
+   *
+   * @return The sentinel value used to represent an empty key slot
+   */
+  [[nodiscard]] constexpr key_type empty_key_sentinel() const noexcept;
+
+  /**
+   * @brief Gets the sentinel value used to represent an erased key slot.
+   *
+   * @return The sentinel value used to represent an erased key slot
+   */
+  [[nodiscard]] constexpr key_type erased_key_sentinel() const noexcept;
+
+  /**
+   * @brief Gets the sentinel value used to represent an empty payload.
+   *
+   * @return The sentinel value used to represent an empty payload
+   */
+  [[nodiscard]] constexpr mapped_type empty_value_sentinel() const noexcept;
+
+  /**
+   * @brief Gets the underlying container of keys.
+   *
+   * @return Const reference to the key set
+   */
+  [[nodiscard]] key_set_type const& keys() const noexcept;
+
+  /**
+   * @brief Gets a pointer to the payload array.
+   *
+   * The payload of the key stored in slot `i` of `keys()` is located at `payloads()[i]`.
+   *
+   * @return Pointer to the first payload
+   */
+  [[nodiscard]] mapped_type* payloads() const noexcept;
+
+ private:
+  using payload_deleter_type = detail::custom_deleter<size_type, payload_allocator_type>;
+
+  key_set_type keys_;                                            ///< Keys
+  mapped_type empty_value_sentinel_;                             ///< Empty payload sentinel
+  payload_allocator_type payload_allocator_;                     ///< Payload allocator
+  std::unique_ptr<mapped_type, payload_deleter_type> payloads_;  ///< Payload array
+};
+}  // namespace cuco
+
+#include <cuco/detail/static_payload_map/static_payload_map.inl>
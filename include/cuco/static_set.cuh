@@ -24,6 +24,10 @@
 #include <cuco/storage.cuh>
 #include <cuco/types.cuh>
 #include <cuco/utility/allocator.hpp>
+#include <cuco/utility/async_result.hpp>
+#include <cuco/utility/container_statistics.hpp>
+#include <cuco/utility/perf_counters.hpp>
+#include <cuco/utility/persistence.hpp>
 #include <cuco/utility/cuda_thread_scope.cuh>
 #include <cuco/utility/traits.hpp>
 
@@ -36,6 +40,7 @@
 #endif
 
 #include <cstddef>
+#include <string>
 #include <type_traits>
 #include <utility>
 
@@ -65,6 +70,17 @@ namespace cuco {
  * `KeyEqual` should be used with caution.
  * @note `ProbingScheme::cg_size` indicates how many threads are used to handle one independent
  * device operation. `cg_size == 1` uses the scalar (or non-CG) code paths.
+ * @note The `_async` bulk APIs that write their results to caller-provided memory only enqueue
+ * kernels and can be captured into a CUDA graph. APIs that need temporary storage, i.e.,
+ * `retrieve_all_async` and any API with partitioning enabled, are capturable only with a
+ * stream-ordered allocator such as `cuco::stream_ordered_allocator`. `rehash_async` and handle
+ * returning overloads allocate outside of stream order and cannot be captured.
+ * @note With `cuco::host_allocator`, the slot storage lives in host memory and the bulk `insert`,
+ * `insert_if`, `erase`, `contains`, `contains_if`, `find`, `find_if`, `rehash`, `clear` and `size`
+ * APIs run the scalar device code paths on all host threads instead of launching CUDA kernels.
+ * Iterators passed to these APIs must be host accessible and no CUDA device is required. The slot
+ * layout is identical to the one of device storage. Other bulk APIs are not supported and the
+ * host backend requires `cg_size == 1` and the default `cuco::storage`.
  *
  * @throw If the size of the given key type is larger than 8 bytes
  * @throw If the given key type doesn't have unique object representations, i.e.,
@@ -106,6 +122,12 @@ class static_set {
   using storage_ref_type    = typename impl_type::storage_ref_type;
   using probing_scheme_type = typename impl_type::probing_scheme_type;  ///< Probing scheme type
   using hasher              = typename probing_scheme_type::hasher;     ///< Hash function type
+  /// Probe length and occupancy statistics type
+  using statistics_type = container_statistics<size_type>;
+  /// Handle to a size asynchronously computed on the device
+  using async_size_type = cuco::async_result<size_type>;
+  /// Device performance counters type
+  using perf_counters_type = cuco::perf_counters;
 
   template <typename... Operators>
   using ref_type = cuco::static_set_ref<key_type,
@@ -251,6 +273,19 @@ class static_set {
    */
   void clear_async(cuda::stream_ref stream = {}) noexcept;
 
+  /**
+   * @brief Asynchronously migrates the slot storage to the given location.
+   *
+   * @note Only available with `cuco::managed_allocator`. Prefetching the storage to the device
+   * before a batch of operations avoids the page faults of the first accesses when the table fits
+   * in the device memory, while prefetching it to the host frees the device memory it occupies.
+   * @note Requires contiguous slot storage, i.e., `cuco::storage` or `cuco::counted_storage`.
+   *
+   * @param location Device ordinal, or `cudaCpuDeviceId` for the host
+   * @param stream CUDA stream this operation is executed in
+   */
+  void prefetch_async(int location, cuda::stream_ref stream = {}) const;
+
   /**
    * @brief Inserts all keys in the range `[first, last)` and returns the number of successful
    * insertions.
@@ -271,6 +306,43 @@ class static_set {
   template <typename InputIt>
   size_type insert(InputIt first, InputIt last, cuda::stream_ref stream = {});
 
+  /**
+   * @brief Inserts all keys in the host range `[first, last)` and returns the number of successful
+   * insertions.
+   *
+   * Keys are streamed to the device in chunks of `chunk_size` keys. Each chunk is staged in a
+   * pinned buffer, copied on one of `num_stages` internal streams and inserted while the next
+   * chunks are being copied, so copies and inserts overlap and at most `num_stages * chunk_size`
+   * keys reside in device memory at any time. This allows building tables from host inputs larger
+   * than the free device memory without copying them to the device first.
+   *
+   * @note Inputs given as pointers to pinned or registered host memory are copied to the device
+   * directly, without staging.
+   * @note The staging buffers and streams are kept by the container and reused by subsequent calls
+   * with the same chunk size and number of stages.
+   * @note This function synchronizes the given stream.
+   *
+   * @throw If `chunk_size` is zero or `num_stages` is not positive
+   *
+   * @tparam InputIt Host accessible random access input iterator where
+   * <tt>std::is_convertible<std::iterator_traits<InputIt>::value_type,
+   * static_set<K>::value_type></tt> is `true`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param chunk_size Number of keys copied to the device per chunk
+   * @param num_stages Number of chunks in flight
+   * @param stream CUDA stream used for insert
+   *
+   * @return Number of successfully inserted keys
+   */
+  template <typename InputIt>
+  size_type insert_from_host(InputIt first,
+                             InputIt last,
+                             std::size_t chunk_size  = cuco::detail::default_host_chunk_size(),
+                             int32_t num_stages      = cuco::detail::default_host_num_stages(),
+                             cuda::stream_ref stream = {});
+
   /**
    * @brief Asynchronously inserts all keys in the range `[first, last)`.
    *
@@ -283,7 +355,7 @@ class static_set {
    * @param stream CUDA stream used for insert
    */
   template <typename InputIt>
-  void insert_async(InputIt first, InputIt last, cuda::stream_ref stream = {}) noexcept;
+  void insert_async(InputIt first, InputIt last, cuda::stream_ref stream = {});
 
   /**
    * @brief Inserts keys in the range `[first, last)` if `pred` of the corresponding stencil returns
@@ -338,7 +410,7 @@ class static_set {
                        InputIt last,
                        StencilIt stencil,
                        Predicate pred,
-                       cuda::stream_ref stream = {}) noexcept;
+                       cuda::stream_ref stream = {});
 
   /**
    * @brief Asynchronously inserts all elements in the range `[first, last)`.
@@ -396,6 +468,35 @@ class static_set {
                        InsertedIt inserted_begin,
                        cuda::stream_ref stream = {});
 
+  /**
+   * @brief Inserts all elements in the range `[first, last)` and copies the elements that could not
+   * be placed to `unplaced_begin`.
+   *
+   * @note An element is unplaced if its probing sequence is exhausted before an empty slot or an
+   * equivalent key is found. Combined with `cuco::stash_storage`, this bounds the work spent on
+   * each element so that a table running at very high load reports its overflow instead of
+   * probing the whole table.
+   * @note Not available with struct of arrays or tagged storage, which do not support
+   * `insert_and_find`.
+   * @note This function synchronizes the given stream.
+   *
+   * @tparam InputIt Device accessible random access input iterator
+   * @tparam OutputIt Device accessible random access output iterator whose `value_type` is
+   * constructible from `std::iterator_traits<InputIt>::value_type`
+   *
+   * @param first Beginning of the sequence of elements
+   * @param last End of the sequence of elements
+   * @param unplaced_begin Beginning of the sequence of unplaced elements
+   * @param stream CUDA stream used for insert
+   *
+   * @return Iterator indicating the end of the sequence of unplaced elements
+   */
+  template <typename InputIt, typename OutputIt>
+  OutputIt try_insert(InputIt first,
+                      InputIt last,
+                      OutputIt unplaced_begin,
+                      cuda::stream_ref stream = {});
+
   /**
    * @brief Erases keys in the range `[first, last)`.
    *
@@ -484,7 +585,7 @@ class static_set {
   void contains_async(InputIt first,
                       InputIt last,
                       OutputIt output_begin,
-                      cuda::stream_ref stream = {}) const noexcept;
+                      cuda::stream_ref stream = {}) const;
 
   /**
    * @brief Indicates whether the keys in the range `[first, last)` are contained in the set if
@@ -548,7 +649,7 @@ class static_set {
                          StencilIt stencil,
                          Predicate pred,
                          OutputIt output_begin,
-                         cuda::stream_ref stream = {}) const noexcept;
+                         cuda::stream_ref stream = {}) const;
 
   /**
    * @brief For all keys in the range `[first, last)`, finds an element with key equivalent to the
@@ -809,6 +910,48 @@ class static_set {
   template <typename InputIt>
   size_type count(InputIt first, InputIt last, cuda::stream_ref stream = {}) const;
 
+  /**
+   * @brief Asynchronously counts the occurrences of keys in `[first, last)` contained in the set
+   * and writes the sum to `output`.
+   *
+   * @note This function does not synchronize the given stream.
+   * @note `output` must be device accessible, e.g., device or pinned host memory. It is accumulated
+   * into directly, so no temporary memory is allocated and the call can be captured into a CUDA
+   * graph.
+   *
+   * @tparam Input Device accessible input iterator
+   *
+   * @param first Beginning of the sequence of keys to count
+   * @param last End of the sequence of keys to count
+   * @param output Location the sum of total occurrences of all keys in `[first, last)` is
+   * written to
+   * @param stream CUDA stream used for count
+   */
+  template <typename InputIt>
+  void count_async(InputIt first,
+                   InputIt last,
+                   size_type* output,
+                   cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief Asynchronously counts the occurrences of keys in `[first, last)` contained in the set.
+   *
+   * @note This function does not synchronize the given stream. Only `get()` on the returned handle
+   * waits for the result.
+   *
+   * @tparam Input Device accessible input iterator
+   *
+   * @param first Beginning of the sequence of keys to count
+   * @param last End of the sequence of keys to count
+   * @param stream CUDA stream used for count
+   *
+   * @return Handle to the sum of total occurrences of all keys in `[first, last)`
+   */
+  template <typename InputIt>
+  [[nodiscard]] async_size_type count_async(InputIt first,
+                                            InputIt last,
+                                            cuda::stream_ref stream = {}) const;
+
   /**
    * @brief Retrieves the matched key in the set corresponding to all probe keys in the range
    * `[first, last)`
@@ -842,6 +985,67 @@ class static_set {
                                            OutputIt2 output_match,
                                            cuda::stream_ref stream = {}) const;
 
+  /**
+   * @brief Asynchronously retrieves the matches in the set of all probe keys in the range
+   * `[first, last)` and writes their number to `num_retrieved`.
+   *
+   * Same as `retrieve` except that the output size is written to `num_retrieved` instead of being
+   * returned, so that retrieval can be chained with later work without a host round trip.
+   *
+   * @note This function does not synchronize the given stream.
+   * @note `num_retrieved` must be device accessible, e.g., device or pinned host memory. It is
+   * accumulated into directly, so no temporary memory is allocated and the call can be captured
+   * into a CUDA graph.
+   *
+   * @tparam InputIt Device accessible input iterator
+   * @tparam OutputIt1 Device accessible output iterator whose `value_type` can be constructed from
+   * the probe key type
+   * @tparam OutputIt2 Device accessible output iterator whose `value_type` can be constructed from
+   * the set's `value_type`
+   *
+   * @param first Beginning of the sequence of probe keys
+   * @param last End of the sequence of probe keys
+   * @param output_probe Beginning of the sequence of the probe keys that have a match
+   * @param output_match Beginning of the sequence of the matched keys
+   * @param num_retrieved Location the number of retrieved matches is written to
+   * @param stream CUDA stream used for retrieve
+   */
+  template <typename InputIt, typename OutputIt1, typename OutputIt2>
+  void retrieve_async(InputIt first,
+                      InputIt last,
+                      OutputIt1 output_probe,
+                      OutputIt2 output_match,
+                      size_type* num_retrieved,
+                      cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief Asynchronously retrieves the matches in the set of all probe keys in the range
+   * `[first, last)`.
+   *
+   * @note This function does not synchronize the given stream. Only `get()` on the returned handle
+   * waits for the result.
+   *
+   * @tparam InputIt Device accessible input iterator
+   * @tparam OutputIt1 Device accessible output iterator whose `value_type` can be constructed from
+   * the probe key type
+   * @tparam OutputIt2 Device accessible output iterator whose `value_type` can be constructed from
+   * the set's `value_type`
+   *
+   * @param first Beginning of the sequence of probe keys
+   * @param last End of the sequence of probe keys
+   * @param output_probe Beginning of the sequence of the probe keys that have a match
+   * @param output_match Beginning of the sequence of the matched keys
+   * @param stream CUDA stream used for retrieve
+   *
+   * @return Handle to the number of retrieved matches
+   */
+  template <typename InputIt, typename OutputIt1, typename OutputIt2>
+  [[nodiscard]] async_size_type retrieve_async(InputIt first,
+                                               InputIt last,
+                                               OutputIt1 output_probe,
+                                               OutputIt2 output_match,
+                                               cuda::stream_ref stream = {}) const;
+
   /**
    * @brief Retrieves all keys contained in the set.
    *
@@ -862,6 +1066,52 @@ class static_set {
   template <typename OutputIt>
   OutputIt retrieve_all(OutputIt output_begin, cuda::stream_ref stream = {}) const;
 
+  /**
+   * @brief Asynchronously retrieves all keys contained in the set and writes their number to
+   * `num_out`.
+   *
+   * @note This function does not synchronize the given stream.
+   * @note Temporary device memory is released in stream order only with a stream-ordered allocator
+   * such as `cuco::stream_ordered_allocator`, which is also required to capture the call into a
+   * CUDA graph.
+   * @note `num_out` must be device accessible, e.g., device or pinned host memory.
+   * @note The set capacity must not exceed `std::numeric_limits<int32_t>::max()`.
+   *
+   * @throw std::invalid_argument if the capacity exceeds `std::numeric_limits<int32_t>::max()`
+   *
+   * @tparam OutputIt Device accessible random access output iterator whose `value_type` is
+   * convertible from the container's `key_type`.
+   *
+   * @param output_begin Beginning output iterator for keys
+   * @param num_out Location the number of retrieved keys is written to
+   * @param stream CUDA stream used for this operation
+   */
+  template <typename OutputIt>
+  void retrieve_all_async(OutputIt output_begin,
+                          size_type* num_out,
+                          cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief Asynchronously retrieves all keys contained in the set.
+   *
+   * @note This function does not synchronize the given stream. Only `get()` on the returned handle
+   * waits for the result.
+   * @note The set capacity must not exceed `std::numeric_limits<int32_t>::max()`.
+   *
+   * @throw std::invalid_argument if the capacity exceeds `std::numeric_limits<int32_t>::max()`
+   *
+   * @tparam OutputIt Device accessible random access output iterator whose `value_type` is
+   * convertible from the container's `key_type`.
+   *
+   * @param output_begin Beginning output iterator for keys
+   * @param stream CUDA stream used for this operation
+   *
+   * @return Handle to the number of retrieved keys
+   */
+  template <typename OutputIt>
+  [[nodiscard]] async_size_type retrieve_all_async(OutputIt output_begin,
+                                                   cuda::stream_ref stream = {}) const;
+
   /**
    * @brief Regenerates the container.
    *
@@ -917,16 +1167,302 @@ class static_set {
    */
   void rehash_async(size_type capacity, cuda::stream_ref stream = {});
 
+  /**
+   * @brief Asynchronously starts growing the container to at least `capacity` slots without
+   * migrating all elements at once.
+   *
+   * @note The current storage is kept alive next to the new one, and every subsequent bulk
+   * `insert`, `insert_if` and `erase` first migrates `buckets_per_step` of its buckets. This
+   * spreads the cost of rehashing across batches instead of stalling a single one. Until the
+   * migration completes, bulk `contains`, `find` and `count` look up both storages and `size`
+   * counts the elements of both.
+   * @note `insert_and_find`, `try_insert`, `rehash` and `rehash_async` complete the migration
+   * before doing their own work. `retrieve`, `for_each`, `retrieve_all`, heterogeneous lookups and
+   * device refs obtained through `ref()` only access the new storage and must not be used while
+   * `is_rehashing()` is `true`.
+   * @note A pending incremental rehash is completed first.
+   * @note This function is not available if the conatiner's `extent_type` is static.
+   *
+   * @param capacity New capacity of the container
+   * @param buckets_per_step Number of old buckets migrated by each subsequent bulk operation
+   * @param stream CUDA stream used for this operation
+   *
+   * @throw std::logic_error if a unique erased key sentinel value was not provided at
+   * construction
+   */
+  void rehash_incremental_async(size_type capacity,
+                                size_type buckets_per_step,
+                                cuda::stream_ref stream = {});
+
+  /**
+   * @brief Asynchronously migrates the next `buckets_per_step` buckets of a pending incremental
+   * rehash.
+   *
+   * @note No effect if no incremental rehash is pending.
+   *
+   * @param stream CUDA stream used for this operation
+   */
+  void rehash_step_async(cuda::stream_ref stream = {});
+
+  /**
+   * @brief Asynchronously migrates all remaining buckets of a pending incremental rehash.
+   *
+   * @note No effect if no incremental rehash is pending.
+   *
+   * @param stream CUDA stream used for this operation
+   */
+  void rehash_finish_async(cuda::stream_ref stream = {});
+
+  /**
+   * @brief Indicates whether an incremental rehash is pending.
+   *
+   * @return `true` if some elements have not been migrated to the new storage yet
+   */
+  [[nodiscard]] bool is_rehashing() const noexcept;
+
+  /**
+   * @brief Removes all tombstones left behind by `erase` without reallocating the storage.
+   *
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `purge_tombstones_async`.
+   * @note Only available with `cuco::linear_probing` and the default `cuco::storage`.
+   * @note Each cluster, i.e., maximal run of occupied or erased slots, is compacted serially by a
+   * single GPU thread, so the running time is bounded by the longest cluster rather than by the
+   * capacity: O(L) for a cluster of length L, up to O(L^2) if elements sit far from their home
+   * slots. At load factors close to one, clusters can span most of the storage and `rehash` is
+   * usually faster.
+   *
+   * @param stream CUDA stream used for this operation
+   */
+  void purge_tombstones(cuda::stream_ref stream = {});
+
+  /**
+   * @brief Asynchronously removes all tombstones left behind by `erase` without reallocating the
+   * storage.
+   *
+   * @note Live elements are moved backwards into erased slots of their own probing sequences, then
+   * all erased slots become empty again. Unlike `rehash`, this requires no additional memory.
+   * @note If the container has no empty slot at all, tombstones are left in place.
+   * @note Only available with `cuco::linear_probing` and the default `cuco::storage`.
+   * @note Each cluster is compacted serially by a single GPU thread: O(L) for a cluster of length
+   * L, up to O(L^2) if elements sit far from their home slots. At load factors close to one,
+   * `rehash_async` is usually faster.
+   *
+   * @param stream CUDA stream used for this operation
+   */
+  void purge_tombstones_async(cuda::stream_ref stream = {});
+
+  /**
+   * @brief Purges tombstones if they occupy more than `max_tombstone_ratio` of the capacity.
+   *
+   * @note This function synchronizes the given stream.
+   *
+   * @param max_tombstone_ratio Largest tolerated ratio of erased slots to `capacity()`
+   * @param stream CUDA stream used for this operation
+   * @return `true` if tombstones have been purged
+   */
+  bool purge_tombstones_if(double max_tombstone_ratio, cuda::stream_ref stream = {});
+
+  /**
+   * @brief Gets the number of erased slots (tombstones) in the container.
+   *
+   * @note This function synchronizes the given stream.
+   * @note Always 0 if the container was constructed without a distinct erased key sentinel.
+   *
+   * @param stream CUDA stream used to count erased slots
+   * @return The number of erased slots
+   */
+  [[nodiscard]] size_type tombstone_count(cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief Gathers probe length and occupancy statistics of the container.
+   *
+   * The statistics include a histogram of the probe lengths of all elements, the longest probe
+   * length, the number of erased slots, and a histogram of the number of filled slots per bucket.
+   *
+   * @note This function synchronizes the given stream.
+   *
+   * @param stream CUDA stream used for this operation
+   * @return The container statistics
+   */
+  [[nodiscard]] statistics_type statistics(cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief Writes the container to a file at `path`.
+   *
+   * The file holds a versioned header, the probing scheme including the hash function seed, the
+   * sentinels, and the raw slot storage. See `cuco::persisted_header` for the layout.
+   *
+   * @note This function synchronizes the given stream.
+   * @note Only available with `cuco::storage` and `cuco::counted_storage`.
+   *
+   * @throw cuco::logic_error If the file cannot be written or an incremental rehash is pending
+   *
+   * @param path Path of the file to write
+   * @param stream CUDA stream used for this operation
+   */
+  void save(std::string const& path, cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief Replaces the content of the container by the content of a file written by `save`.
+   *
+   * The file is memory-mapped and its slot storage is copied into the container in chunks through
+   * pinned host memory. No element is rehashed, so the container must have the same type,
+   * capacity, hash function, probing scheme and sentinels as the container that wrote the file.
+   * `cuco::read_persisted_header` returns the capacity to construct it with.
+   *
+   * @note This function synchronizes the given stream.
+   * @note Only available with `cuco::storage` and `cuco::counted_storage`.
+   * @note The file is validated before the container is modified. If validation fails, the
+   * container, including a pending incremental rehash, is left unchanged.
+   *
+   * @throw cuco::logic_error If the file is invalid or was written by an incompatible container
+   *
+   * @param path Path of the file to read
+   * @param stream CUDA stream used for this operation
+   */
+  void load(std::string const& path, cuda::stream_ref stream = {});
+
   /**
    * @brief Gets the number of elements in the container.
    *
    * @note This function synchronizes the given stream.
+   * @note This is a constant-time operation if size tracking is enabled via
+   * `enable_size_tracking`. Otherwise, the whole storage is scanned.
    *
    * @param stream CUDA stream used to get the number of inserted elements
    * @return The number of elements in the container
    */
   [[nodiscard]] size_type size(cuda::stream_ref stream = {}) const;
 
+  /**
+   * @brief Asynchronously writes the number of elements in the container to `output`.
+   *
+   * @note The value is available once all work previously submitted to `stream` has completed,
+   * so that a subsequent kernel in `stream` can consume the container size without a host round
+   * trip.
+   * @note `output` must be device accessible, e.g., device or pinned host memory. No temporary
+   * memory is allocated, so the call can be captured into a CUDA graph.
+   *
+   * @param output Pointer to the location where the number of elements is written
+   * @param stream CUDA stream used for this operation
+   */
+  void size_async(size_type* output, cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief Asynchronously gets the number of elements in the container.
+   *
+   * @note This function does not synchronize the given stream. Only `get()` on the returned handle
+   * waits for the result.
+   *
+   * @param stream CUDA stream used to get the number of inserted elements
+   *
+   * @return Handle to the number of elements in the container
+   */
+  [[nodiscard]] async_size_type size_async(cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief Gets the number of elements currently held in the overflow stash.
+   *
+   * @note This function synchronizes the given stream.
+   * @note Only available with `cuco::stash_storage`.
+   *
+   * @param stream CUDA stream used to get the number of stashed elements
+   * @return The number of stashed elements
+   */
+  [[nodiscard]] size_type stash_size(cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief Gets the device performance counters, i.e., the number of probing steps, failed CAS
+   * operations, duplicate hits and full buckets encountered by insert operations since the
+   * container was last cleared or its counters were reset.
+   *
+   * @note This function synchronizes the given stream.
+   * @note Only available with `cuco::counted_storage`.
+   *
+   * @param stream CUDA stream used to get the counters
+   * @return The performance counters
+   */
+  [[nodiscard]] perf_counters_type perf_counters(cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief Resets all device performance counters to zero, e.g., to measure a single bulk
+   * operation.
+   *
+   * @note This function synchronizes the given stream.
+   * @note Only available with `cuco::counted_storage`.
+   *
+   * @param stream CUDA stream used to reset the counters
+   */
+  void reset_perf_counters(cuda::stream_ref stream = {});
+
+  /**
+   * @brief Enables tracking of the number of elements so that `size()` becomes a constant-time
+   * operation.
+   *
+   * @note Once enabled, all host bulk modifying APIs keep an internal device counter up to date.
+   * The counter is initialized with the current number of elements.
+   * @note Modifications performed through device-side refs in user kernels are not tracked. Call
+   * this function again afterwards to resynchronize the counter.
+   * @note This function does not synchronize the given stream.
+   *
+   * @param stream CUDA stream used to initialize the counter
+   */
+  void enable_size_tracking(cuda::stream_ref stream = {});
+
+  /**
+   * @brief Radix-partitions the input of bulk inserts and lookups to keep table accesses
+   * L2-resident.
+   *
+   * When enabled, the host bulk `insert`, `insert_if`, `contains`, `contains_if`, `find` and
+   * `find_if` APIs sort the input by the high `partition_bits` bits of each key's initial probing
+   * position before processing it, so that concurrently running threads probe the same contiguous
+   * slice of the table. This pays off for tables several times larger than the L2 cache, with
+   * `partition_bits` chosen such that `capacity() * sizeof(value_type) / 2^partition_bits` fits
+   * in L2. Results are identical to unpartitioned execution.
+   *
+   * @note The partitioned path allocates `O(n)` temporary device memory per bulk call.
+   *
+   * @throw If `partition_bits` is larger than 16 or negative
+   *
+   * @param partition_bits Number of partition bits. `0` disables partitioning
+   */
+  void set_input_partitioning(int32_t partition_bits);
+
+  /**
+   * @brief Gets the number of radix partition bits of bulk inserts and lookups.
+   *
+   * @return Number of partition bits, `0` if partitioning is disabled
+   */
+  [[nodiscard]] int32_t input_partition_bits() const noexcept;
+
+  /**
+   * @brief Enables or disables the warp-level deduplication of the input of bulk inserts and
+   * counts.
+   *
+   * When enabled, the threads of a warp match their keys against each other before accessing the
+   * table, and only one representative per distinct key probes it: the bulk `insert` and
+   * `insert_if` APIs skip the other copies, which would fail to insert anyway, and `count` scales
+   * the result of the representative by the number of copies. This avoids most of the contention
+   * on hot slots for heavily skewed (e.g., Zipfian) inputs, but adds a few warp-wide operations per
+   * key otherwise.
+   *
+   * @note Keys are matched bitwise, on GPUs of compute capability 7.0 or newer.
+   * @note Has no effect unless `KeyEqual` is `cuda::std::equal_to<Key>` or `thrust::equal_to<Key>`
+   * and `Key` has unique object representations, since other keys may compare unequal despite
+   * being bitwise equal.
+   *
+   * @param enabled Flag indicating whether inputs are deduplicated
+   */
+  void set_input_deduplication(bool enabled) noexcept;
+
+  /**
+   * @brief Indicates whether the input of bulk inserts and counts is deduplicated within warps.
+   *
+   * @return `true` if input deduplication is enabled
+   */
+  [[nodiscard]] bool input_deduplication() const noexcept;
+
   /**
    * @brief Gets the maximum number of elements the hash set can hold.
    *
@@ -975,6 +1511,21 @@ class static_set {
   [[nodiscard]] auto ref(Operators... ops) const noexcept;
 
  private:
+  /**
+   * @brief Invokes `func` with `container_ref`, extended to the elements not migrated yet if an
+   * incremental rehash is pending.
+   *
+   * @tparam Ref Type of non-owning device container ref
+   * @tparam Func Type of callable accepting a non-owning device container ref
+   *
+   * @param container_ref Non-owning device container ref to the current storage
+   * @param func Callable to invoke
+   *
+   * @return The result of `func`
+   */
+  template <typename Ref, typename Func>
+  decltype(auto) visit_ref(Ref const& container_ref, Func&& func) const;
+
   std::unique_ptr<impl_type> impl_;
 };
 }  // namespace cuco
@@ -64,9 +64,11 @@ class static_set_ref
   : public detail::operator_impl<
       Operators,
       static_set_ref<Key, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>>... {
+ public:
   /// Flag indicating whether duplicate keys are allowed or not
   static constexpr auto allows_duplicates = false;
 
+ private:
   /// Implementation type
   using impl_type = detail::
     open_addressing_ref_impl<Key, Scope, KeyEqual, ProbingScheme, StorageRef, allows_duplicates>;
@@ -241,6 +243,18 @@ class static_set_ref
   template <typename NewHash>
   [[nodiscard]] __host__ __device__ constexpr auto rebind_hash_function(NewHash const& hash) const;
 
+  /**
+   * @brief Makes a copy of the current device reference accessing the given storage
+   *
+   * @note The given storage must have been set up with the same sentinels as the current one.
+   *
+   * @param storage_ref Non-owning ref of the new slot storage
+   *
+   * @return Copy of the current device ref
+   */
+  [[nodiscard]] __host__ __device__ constexpr auto rebind_storage_ref(
+    StorageRef storage_ref) const noexcept;
+
   /**
    * @brief Makes a copy of the current device reference using non-owned memory
    *
@@ -45,4 +45,121 @@ class storage {
   using impl = bucket_storage<T, bucket_size, Extent, Allocator>;
 };
 
+/**
+ * @brief Public struct of arrays storage class.
+ *
+ * @note This is a drop-in alternative to `cuco::storage` for key-value containers. Keys and
+ * payloads are stored in two separate arrays of buckets so that probing in `insert`, `contains`,
+ * `count`, `find` and `erase` never loads payload bytes. Operations that require in-place access
+ * to whole slots, i.e., `insert_and_find`, `insert_or_assign`, `insert_or_apply`,
+ * `for_each_async` and shared memory copies, are not supported with this storage.
+ *
+ * @tparam BucketSize Number of elements per bucket storage
+ */
+template <int32_t BucketSize>
+class soa_storage {
+ public:
+  /// Number of slots per bucket storage
+  static constexpr int32_t bucket_size = BucketSize;
+
+  /// Type of implementation details
+  template <class T, class Extent, class Allocator>
+  using impl = soa_bucket_storage<T, bucket_size, Extent, Allocator>;
+};
+
+/**
+ * @brief Public tagged storage class.
+ *
+ * @note This is a drop-in alternative to `cuco::storage` that shadows every slot with a 1-byte
+ * tag holding 7 bits of the key hash or an empty/erased marker. `insert`, `erase`, `contains`,
+ * `count` and `find` scan the tags of a bucket with byte-parallel compares and only load slots
+ * whose tag matches, which mostly benefits lookups that miss. Operations that write slots without
+ * maintaining tags, i.e., `insert_and_find`, `insert_or_assign`, `insert_or_apply` and shared
+ * memory copies, are not supported with this storage.
+ *
+ * @tparam BucketSize Number of elements per bucket storage, at most 32
+ */
+template <int32_t BucketSize>
+class tagged_storage {
+ public:
+  /// Number of slots per bucket storage
+  static constexpr int32_t bucket_size = BucketSize;
+
+  /// Type of implementation details
+  template <class T, class Extent, class Allocator>
+  using impl = tagged_bucket_storage<T, bucket_size, Extent, Allocator>;
+};
+
+/**
+ * @brief Public bounded storage class.
+ *
+ * @note This is a drop-in alternative to `cuco::storage` that records, for every bucket, the
+ * largest number of probing steps taken by an insertion whose probing sequence starts there.
+ * `contains`, `find`, `count` and `erase` give up as soon as they probe past that bound instead of
+ * running until an empty slot, which bounds negative lookups at high occupancy. Operations that
+ * insert without recording displacements, i.e., `insert_or_assign`, `insert_or_apply` and shared
+ * memory copies, are not supported with this storage.
+ *
+ * @tparam BucketSize Number of elements per bucket storage
+ */
+template <int32_t BucketSize>
+class bounded_storage {
+ public:
+  /// Number of slots per bucket storage
+  static constexpr int32_t bucket_size = BucketSize;
+
+  /// Type of implementation details
+  template <class T, class Extent, class Allocator>
+  using impl = bounded_bucket_storage<T, bucket_size, Extent, Allocator>;
+};
+
+/**
+ * @brief Public counted storage class.
+ *
+ * @note This is a drop-in alternative to `cuco::storage` that additionally counts, on the device,
+ * probing steps, failed CAS operations, duplicate hits and full buckets encountered by insert
+ * operations (see `cuco::perf_counters`). The counters are read back with the containers'
+ * `perf_counters`. Instrumentation is selected by the container type, so containers using any
+ * other storage compile without it. Operations that copy the storage, i.e., shared memory copies,
+ * are not supported with this storage.
+ *
+ * @tparam BucketSize Number of elements per bucket storage
+ */
+template <int32_t BucketSize>
+class counted_storage {
+ public:
+  /// Number of slots per bucket storage
+  static constexpr int32_t bucket_size = BucketSize;
+
+  /// Type of implementation details
+  template <class T, class Extent, class Allocator>
+  using impl = counted_bucket_storage<T, bucket_size, Extent, Allocator>;
+};
+
+/**
+ * @brief Public stash storage class.
+ *
+ * @note This is a drop-in alternative to `cuco::storage` that appends a fixed-size overflow stash
+ * to the bucket array. Every probing sequence visits at most `MaxProbeSteps` primary buckets and
+ * then the stash, so inserts into a table running at very high load either land in the stash or
+ * fail after a bounded number of steps instead of scanning the entire table. The number of stashed
+ * elements is reported by the containers' `stash_size`. Operations that probe without the stash,
+ * i.e., `insert_or_assign`, `insert_or_apply` and shared memory copies, are not supported with
+ * this storage.
+ *
+ * @tparam BucketSize Number of elements per bucket storage
+ * @tparam StashSize Number of slots in the stash, a multiple of `BucketSize * cg_size`
+ * @tparam MaxProbeSteps Maximum number of primary buckets probed before falling back to the stash
+ */
+template <int32_t BucketSize, int32_t StashSize = 128, int32_t MaxProbeSteps = 32>
+class stash_storage {
+ public:
+  /// Number of slots per bucket storage
+  static constexpr int32_t bucket_size = BucketSize;
+
+  /// Type of implementation details
+  template <class T, class Extent, class Allocator>
+  using impl = stash_bucket_storage<T, bucket_size, StashSize, MaxProbeSteps, Extent, Allocator>;
+};
+
 }  // namespace cuco
@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/bucket_storage.cuh>
+#include <cuco/detail/storage/bucket_storage_base.cuh>
+#include <cuco/detail/utility/math.cuh>
+#include <cuco/extent.cuh>
+#include <cuco/utility/allocator.hpp>
+
+#include <cuda/stream_ref>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace cuco {
+namespace detail {
+/// Tag of a slot that has never been filled
+inline constexpr std::uint8_t empty_tag = 0b1000'0000;
+/// Tag of a slot whose key has been erased
+inline constexpr std::uint8_t erased_tag = 0b1111'1110;
+/// Tag of a slot claimed by an insert whose element is not published yet
+inline constexpr std::uint8_t busy_tag = 0b1111'1111;
+}  // namespace detail
+
+/**
+ * @brief Non-owning array of buckets storage reference type with a per-slot tag array.
+ *
+ * Each slot is shadowed by a 1-byte tag holding either 7 bits of the slot key's hash, or one of
+ * the empty/erased states. Probing scans the tags of a bucket first and only loads the slots whose
+ * tag matches the probe key's, which saves most slot loads for lookups that miss.
+ *
+ * An insert first claims an empty or erased slot by swapping its tag to a reserved busy state, then
+ * writes the element and publishes the element's tag last. Empty and erased tags can thus be
+ * trusted without loading the slot, and a slot is never loaded before its element is complete.
+ *
+ * @note Tags are compared four at a time only if `BucketSize` is a multiple of 4. Any other
+ * bucket size is supported but compares its tags one by one.
+ *
+ * @tparam T Storage element type
+ * @tparam BucketSize Number of slots in each bucket
+ * @tparam Extent Type of extent denoting storage capacity
+ */
+template <typename T, int32_t BucketSize, typename Extent = cuco::extent<std::size_t>>
+class tagged_bucket_storage_ref : public bucket_storage_ref<T, BucketSize, Extent> {
+  static_assert(BucketSize <= 32, "Tagged storage supports up to 32 slots per bucket.");
+
+ public:
+  /// Array of buckets storage ref base class type
+  using base_type = bucket_storage_ref<T, BucketSize, Extent>;
+
+  using base_type::bucket_size;  ///< Number of elements processed per bucket
+
+  using extent_type = typename base_type::extent_type;  ///< Storage extent type
+  using size_type   = typename base_type::size_type;    ///< Storage size type
+  using value_type  = typename base_type::value_type;   ///< Slot type
+  using bucket_type = typename base_type::bucket_type;  ///< Slot bucket type
+
+  using tag_type        = std::uint8_t;                          ///< Slot tag type
+  using tag_bucket_type = detail::bucket<tag_type, bucket_size>;  ///< Tag bucket type
+
+  /**
+   * @brief Constructor of tagged storage ref.
+   *
+   * @param size Number of buckets
+   * @param buckets Pointer to the buckets array
+   * @param tags Pointer to the tag buckets array
+   */
+  __host__ __device__ explicit constexpr tagged_bucket_storage_ref(Extent size,
+                                                                   bucket_type* buckets,
+                                                                   tag_bucket_type* tags) noexcept;
+
+  /**
+   * @brief Gets tag buckets array.
+   *
+   * @return Pointer to the first tag bucket
+   */
+  [[nodiscard]] __host__ __device__ constexpr tag_bucket_type* tag_data() const noexcept;
+
+  /**
+   * @brief Returns the tags of the bucket with the given index.
+   *
+   * @param index Index of the bucket
+   * @return An array of tags
+   */
+  [[nodiscard]] __device__ constexpr tag_bucket_type tag_bucket(size_type index) const noexcept;
+
+  /**
+   * @brief Reloads the tags of the bucket with the given index from memory.
+   *
+   * @note Unlike `tag_bucket`, every call reads the tags anew, so that tags published by other
+   * threads in the meantime become visible.
+   *
+   * @param index Index of the bucket
+   * @return An array of tags
+   */
+  [[nodiscard]] __device__ tag_bucket_type load_tag_bucket(size_type index) const noexcept;
+
+  /**
+   * @brief Atomically marks an empty or erased slot as busy.
+   *
+   * @param index Index of the bucket
+   * @param intra_bucket_index Index of the slot within the bucket
+   * @return The tag of the slot before the call. The slot is owned by the calling thread iff this
+   * is the empty or erased tag.
+   */
+  [[nodiscard]] __device__ tag_type claim_tag(size_type index,
+                                              int32_t intra_bucket_index) const noexcept;
+
+  /**
+   * @brief Stores the tag of the given slot.
+   *
+   * @param index Index of the bucket
+   * @param intra_bucket_index Index of the slot within the bucket
+   * @param tag Tag to store
+   */
+  __device__ void store_tag(size_type index,
+                            int32_t intra_bucket_index,
+                            tag_type tag) const noexcept;
+
+  /**
+   * @brief Compares all tags of a bucket against `tag` at once.
+   *
+   * @note Uses byte-parallel comparisons of four tags at a time if `bucket_size` is a multiple of 4
+   * and falls back to comparing the tags one by one otherwise.
+   *
+   * @param tags Tags of a bucket
+   * @param tag Tag to search for
+   * @return Bitmask whose `i`-th bit is set iff `tags[i] == tag`
+   */
+  [[nodiscard]] __device__ static uint32_t match(tag_bucket_type const& tags,
+                                                 tag_type tag) noexcept;
+
+ private:
+  tag_bucket_type* tags_;  ///< Pointer to the tag buckets array
+};
+
+/**
+ * @brief Array of buckets open addressing storage class with a per-slot tag array.
+ *
+ * @tparam T Slot type
+ * @tparam BucketSize Number of slots in each bucket
+ * @tparam Extent Type of extent denoting number of buckets
+ * @tparam Allocator Type of allocator used for device storage (de)allocation
+ */
+template <typename T,
+          int32_t BucketSize,
+          typename Extent    = cuco::extent<std::size_t>,
+          typename Allocator = cuco::cuda_allocator<cuco::bucket<T, BucketSize>>>
+class tagged_bucket_storage : public bucket_storage<T, BucketSize, Extent, Allocator> {
+ public:
+  /// Array of buckets storage base class type
+  using base_type = bucket_storage<T, BucketSize, Extent, Allocator>;
+
+  using base_type::bucket_size;  ///< Number of elements processed per bucket
+
+  using extent_type = typename base_type::extent_type;  ///< Storage extent type
+  using size_type   = typename base_type::size_type;    ///< Storage size type
+  using value_type  = typename base_type::value_type;   ///< Slot type
+  using bucket_type = typename base_type::bucket_type;  ///< Slot bucket type
+
+  /// Storage ref type
+  using ref_type        = tagged_bucket_storage_ref<value_type, bucket_size, extent_type>;
+  using tag_type        = typename ref_type::tag_type;         ///< Slot tag type
+  using tag_bucket_type = typename ref_type::tag_bucket_type;  ///< Tag bucket type
+
+  /// Number of tag buckets allocated past the end so that word-wide tag atomics stay in bounds
+  static constexpr size_type tag_padding =
+    (sizeof(tag_bucket_type) % 4 == 0)
+      ? 0
+      : static_cast<size_type>(cuco::detail::int_div_ceil(3, bucket_size));
+
+  /// Type of the allocator to (de)allocate tag buckets
+  using tag_allocator_type =
+    typename std::allocator_traits<Allocator>::template rebind_alloc<tag_bucket_type>;
+  using tag_deleter_type =
+    detail::custom_deleter<size_type, tag_allocator_type>;  ///< Type of tag bucket deleter
+
+  /**
+   * @brief Constructor of tagged storage.
+   *
+   * @note The input `size` should be exclusively determined by the return value of
+   * `make_bucket_extent` since it depends on the requested low-bound value, the probing scheme, and
+   * the storage.
+   *
+   * @param size Number of buckets to (de)allocate
+   * @param allocator Allocator used for (de)allocating device storage
+   */
+  explicit constexpr tagged_bucket_storage(Extent size, Allocator const& allocator = {});
+
+  tagged_bucket_storage(tagged_bucket_storage&&) = default;  ///< Move constructor
+  /**
+   * @brief Replaces the contents of the storage with another storage.
+   *
+   * @return Reference of the current storage object
+   */
+  tagged_bucket_storage& operator=(tagged_bucket_storage&&) = default;
+  ~tagged_bucket_storage()                                  = default;  ///< Destructor
+
+  tagged_bucket_storage(tagged_bucket_storage const&)            = delete;
+  tagged_bucket_storage& operator=(tagged_bucket_storage const&) = delete;
+
+  /**
+   * @brief Gets tag buckets array.
+   *
+   * @return Pointer to the first tag bucket
+   */
+  [[nodiscard]] constexpr tag_bucket_type* tag_data() const noexcept;
+
+  /**
+   * @brief Gets tagged storage reference.
+   *
+   * @return Reference of tagged storage
+   */
+  [[nodiscard]] constexpr ref_type ref() const noexcept;
+
+  /**
+   * @brief Initializes each slot in the storage to contain `key` and marks all slots as empty.
+   *
+   * @param key Key to which all keys in `slots` are initialized
+   * @param stream Stream used for executing the kernel
+   */
+  void initialize(value_type key, cuda::stream_ref stream = {});
+
+  /**
+   * @brief Asynchronously initializes each slot in the storage to contain `key` and marks all
+   * slots as empty.
+   *
+   * @param key Key to which all keys in `slots` are initialized
+   * @param stream Stream used for executing the kernel
+   */
+  void initialize_async(value_type key, cuda::stream_ref stream = {}) noexcept;
+
+ private:
+  tag_allocator_type tag_allocator_;  ///< Allocator used to (de)allocate tag buckets
+  tag_deleter_type tag_deleter_;      ///< Custom tag buckets deleter
+  /// Pointer to the tag bucket storage
+  std::unique_ptr<tag_bucket_type, tag_deleter_type> tags_;
+};
+
+namespace detail {
+/**
+ * @brief Trait indicating whether a storage ref keeps a per-slot tag array.
+ *
+ * @tparam StorageRef Storage ref type
+ */
+template <typename StorageRef>
+struct is_tagged_storage_ref : std::false_type {};
+
+/// Specialization for `cuco::tagged_bucket_storage_ref`
+template <typename T, int32_t BucketSize, typename Extent>
+struct is_tagged_storage_ref<tagged_bucket_storage_ref<T, BucketSize, Extent>> : std::true_type {};
+
+/// Helper variable template for `is_tagged_storage_ref`
+template <typename StorageRef>
+inline constexpr bool is_tagged_storage_ref_v = is_tagged_storage_ref<StorageRef>::value;
+}  // namespace detail
+
+}  // namespace cuco
+
+#include <cuco/detail/storage/tagged_bucket_storage.inl>
@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cuco/utility/reduction_functors.cuh>
+
+#include <cuda/std/cstdint>
+#include <cuda/std/limits>
+
+namespace cuco::aggregation {
+
+/**
+ * @brief Sum of the values of each group, used with `cuco::groupby`
+ *
+ * @tparam T Value and result type
+ */
+template <typename T>
+struct sum {
+  using value_type       = T;             ///< Input value type
+  using accumulator_type = T;             ///< Per-group accumulator type
+  using result_type      = T;             ///< Result type
+  using reduction_op     = reduce::plus;  ///< Reduction applied to the accumulator
+
+  /**
+   * @brief Gets the value of an accumulator before any value is applied.
+   *
+   * @return Zero
+   */
+  __host__ __device__ static constexpr accumulator_type identity() noexcept
+  {
+    return accumulator_type{0};
+  }
+
+  /**
+   * @brief Converts an input value into the operand of `reduction_op`.
+   *
+   * @param value Input value
+   * @return `value`
+   */
+  __host__ __device__ static constexpr accumulator_type lift(value_type const& value) noexcept
+  {
+    return value;
+  }
+
+  /**
+   * @brief Computes the result of a group from its accumulator.
+   *
+   * @param acc Accumulator of the group
+   * @return `acc`
+   */
+  __host__ __device__ static constexpr result_type finalize(accumulator_type acc,
+                                                            cuda::std::uint64_t) noexcept
+  {
+    return acc;
+  }
+};
+
+/**
+ * @brief Minimum of the values of each group, used with `cuco::groupby`
+ *
+ * @tparam T Value and result type
+ */
+template <typename T>
+struct min {
+  using value_type       = T;            ///< Input value type
+  using accumulator_type = T;            ///< Per-group accumulator type
+  using result_type      = T;            ///< Result type
+  using reduction_op     = reduce::min;  ///< Reduction applied to the accumulator
+
+  /**
+   * @brief Gets the value of an accumulator before any value is applied.
+   *
+   * @return The largest finite value of `T`
+   */
+  __host__ __device__ static constexpr accumulator_type identity() noexcept
+  {
+    return cuda::std::numeric_limits<accumulator_type>::max();
+  }
+
+  /**
+   * @brief Converts an input value into the operand of `reduction_op`.
+   *
+   * @param value Input value
+   * @return `value`
+   */
+  __host__ __device__ static constexpr accumulator_type lift(value_type const& value) noexcept
+  {
+    return value;
+  }
+
+  /**
+   * @brief Computes the result of a group from its accumulator.
+   *
+   * @param acc Accumulator of the group
+   * @return `acc`
+   */
+  __host__ __device__ static constexpr result_type finalize(accumulator_type acc,
+                                                            cuda::std::uint64_t) noexcept
+  {
+    return acc;
+  }
+};
+
+/**
+ * @brief Maximum of the values of each group, used with `cuco::groupby`
+ *
+ * @tparam T Value and result type
+ */
+template <typename T>
+struct max {
+  using value_type       = T;            ///< Input value type
+  using accumulator_type = T;            ///< Per-group accumulator type
+  using result_type      = T;            ///< Result type
+  using reduction_op     = reduce::max;  ///< Reduction applied to the accumulator
+
+  /**
+   * @brief Gets the value of an accumulator before any value is applied.
+   *
+   * @return The lowest finite value of `T`
+   */
+  __host__ __device__ static constexpr accumulator_type identity() noexcept
+  {
+    return cuda::std::numeric_limits<accumulator_type>::lowest();
+  }
+
+  /**
+   * @brief Converts an input value into the operand of `reduction_op`.
+   *
+   * @param value Input value
+   * @return `value`
+   */
+  __host__ __device__ static constexpr accumulator_type lift(value_type const& value) noexcept
+  {
+    return value;
+  }
+
+  /**
+   * @brief Computes the result of a group from its accumulator.
+   *
+   * @param acc Accumulator of the group
+   * @return `acc`
+   */
+  __host__ __device__ static constexpr result_type finalize(accumulator_type acc,
+                                                            cuda::std::uint64_t) noexcept
+  {
+    return acc;
+  }
+};
+
+/**
+ * @brief Number of rows of each group, used with `cuco::groupby`
+ *
+ * @note The input values of a `count` column are ignored; any device accessible iterator, e.g., a
+ * `thrust::constant_iterator`, can be passed for it.
+ *
+ * @tparam T Result type
+ */
+template <typename T = cuda::std::uint64_t>
+struct count {
+  using value_type       = T;                    ///< Input value type (ignored)
+  using accumulator_type = cuda::std::uint64_t;  ///< Per-group accumulator type
+  using result_type      = T;                    ///< Result type
+  using reduction_op     = reduce::plus;         ///< Reduction applied to the accumulator
+
+  /**
+   * @brief Gets the value of an accumulator before any value is applied.
+   *
+   * @return Zero
+   */
+  __host__ __device__ static constexpr accumulator_type identity() noexcept { return 0; }
+
+  /**
+   * @brief Converts an input value into the operand of `reduction_op`.
+   *
+   * @return One
+   */
+  template <typename Value>
+  __host__ __device__ static constexpr accumulator_type lift(Value const&) noexcept
+  {
+    return 1;
+  }
+
+  /**
+   * @brief Computes the result of a group from its accumulator.
+   *
+   * @param acc Accumulator of the group
+   * @return `acc` converted to `T`
+   */
+  __host__ __device__ static constexpr result_type finalize(accumulator_type acc,
+                                                            cuda::std::uint64_t) noexcept
+  {
+    return static_cast<result_type>(acc);
+  }
+};
+
+/**
+ * @brief Arithmetic mean of the values of each group, used with `cuco::groupby`
+ *
+ * The values are summed up in `R` and the sum is divided by the number of rows of the group when
+ * results are retrieved.
+ *
+ * @tparam T Value type
+ * @tparam R Accumulator and result type
+ */
+template <typename T, typename R = double>
+struct mean {
+  using value_type       = T;             ///< Input value type
+  using accumulator_type = R;             ///< Per-group accumulator type
+  using result_type      = R;             ///< Result type
+  using reduction_op     = reduce::plus;  ///< Reduction applied to the accumulator
+
+  /**
+   * @brief Gets the value of an accumulator before any value is applied.
+   *
+   * @return Zero
+   */
+  __host__ __device__ static constexpr accumulator_type identity() noexcept
+  {
+    return accumulator_type{0};
+  }
+
+  /**
+   * @brief Converts an input value into the operand of `reduction_op`.
+   *
+   * @param value Input value
+   * @return `value` converted to `R`
+   */
+  __host__ __device__ static constexpr accumulator_type lift(value_type const& value) noexcept
+  {
+    return static_cast<accumulator_type>(value);
+  }
+
+  /**
+   * @brief Computes the result of a group from its accumulator.
+   *
+   * @param acc Sum of the values of the group
+   * @param num_rows Number of rows of the group
+   * @return The mean of the values of the group
+   */
+  __host__ __device__ static constexpr result_type finalize(accumulator_type acc,
+                                                            cuda::std::uint64_t num_rows) noexcept
+  {
+    return acc / static_cast<result_type>(num_rows);
+  }
+};
+
+}  // namespace cuco::aggregation
@@ -17,6 +17,14 @@
 #pragma once
 
 #include <cuco/detail/error.hpp>
+#include <cuco/detail/utility/stream_ordered_pool.hpp>
+
+#include <cuda/stream_ref>
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
 
 namespace cuco {
 /**
@@ -91,4 +99,521 @@ bool operator!=(cuda_allocator<T> const& lhs, cuda_allocator<U> const& rhs) noex
   return not(lhs == rhs);
 }
 
+/**
+ * @brief A host allocator using aligned `operator new`/`operator delete` to satisfy
+ * (de)allocations.
+ *
+ * Containers using this allocator run their bulk operations on the host instead of launching CUDA
+ * kernels, i.e., all iterators passed to bulk operations must be host accessible and the given
+ * CUDA streams are ignored. Allocations are aligned to 256 bytes like the ones of `cudaMalloc`, so
+ * the slot storage has the same layout as the device storage and can be copied to a device
+ * container with `cudaMemcpy`.
+ *
+ * @tparam T The allocator's value type
+ */
+template <typename T>
+class host_allocator {
+ public:
+  using value_type = T;  ///< Allocator's value type
+
+  /// Alignment of all allocations in bytes
+  static constexpr std::size_t alignment = alignof(T) > 256 ? alignof(T) : 256;
+
+  host_allocator() = default;
+
+  /**
+   * @brief Copy constructor.
+   */
+  template <class U>
+  host_allocator(host_allocator<U> const&) noexcept
+  {
+  }
+
+  /**
+   * @brief Allocates storage for `n` objects of type `T` using aligned `operator new`.
+   *
+   * @param n The number of objects to allocate storage for
+   * @return Pointer to the allocated storage
+   */
+  value_type* allocate(std::size_t n)
+  {
+    return static_cast<value_type*>(
+      ::operator new(sizeof(value_type) * n, std::align_val_t{alignment}));
+  }
+
+  /**
+   * @brief Deallocates storage pointed to by `p`.
+   *
+   * @param p Pointer to memory to deallocate
+   */
+  void deallocate(value_type* p, std::size_t) { ::operator delete(p, std::align_val_t{alignment}); }
+};
+
+/**
+ * @brief Equality comparison operator.
+ *
+ * @tparam T Value type of LHS object
+ * @tparam U Value type of RHS object
+ *
+ * @return `true` iff given arguments are equal
+ */
+template <typename T, typename U>
+bool operator==(host_allocator<T> const&, host_allocator<U> const&) noexcept
+{
+  return true;
+}
+
+/**
+ * @brief Inequality comparison operator.
+ *
+ * @tparam T Value type of LHS object
+ * @tparam U Value type of RHS object
+ *
+ * @param lhs Left-hand side object to compare
+ * @param rhs Right-hand side object to compare
+ *
+ * @return `true` iff given arguments are not equal
+ */
+template <typename T, typename U>
+bool operator!=(host_allocator<T> const& lhs, host_allocator<U> const& rhs) noexcept
+{
+  return not(lhs == rhs);
+}
+
+/**
+ * @brief A pinned host allocator using `cudaMallocHost`/`cudaFreeHost` to satisfy (de)allocations.
+ *
+ * Unlike `host_allocator`, containers using this allocator keep running their bulk operations on
+ * the device: pinned host memory is mapped into the device address space, so kernels access the
+ * slot storage directly over the interconnect. This allows tables larger than the device memory at
+ * the cost of every probe being a remote access.
+ *
+ * @note Remote accesses are served at the granularity of interconnect transactions rather than
+ * single slots. Probing schemes with larger cooperative groups, e.g., `cuco::linear_probing<8,
+ * Hash>`, read consecutive slots of a probing window in one coalesced access and perform
+ * considerably better than the scalar (`cg_size == 1`) code paths on such storage.
+ *
+ * @tparam T The allocator's value type
+ */
+template <typename T>
+class pinned_allocator {
+ public:
+  using value_type = T;  ///< Allocator's value type
+
+  pinned_allocator() = default;
+
+  /**
+   * @brief Copy constructor.
+   */
+  template <class U>
+  pinned_allocator(pinned_allocator<U> const&) noexcept
+  {
+  }
+
+  /**
+   * @brief Allocates storage for `n` objects of type `T` using `cudaMallocHost`.
+   *
+   * @param n The number of objects to allocate storage for
+   * @return Pointer to the allocated storage
+   */
+  value_type* allocate(std::size_t n)
+  {
+    value_type* p;
+    CUCO_CUDA_TRY(cudaMallocHost(&p, sizeof(value_type) * n));
+    return p;
+  }
+
+  /**
+   * @brief Deallocates storage pointed to by `p`.
+   *
+   * @param p Pointer to memory to deallocate
+   */
+  void deallocate(value_type* p, std::size_t) { CUCO_CUDA_TRY(cudaFreeHost(p)); }
+};
+
+/**
+ * @brief Equality comparison operator.
+ *
+ * @tparam T Value type of LHS object
+ * @tparam U Value type of RHS object
+ *
+ * @return `true` iff given arguments are equal
+ */
+template <typename T, typename U>
+bool operator==(pinned_allocator<T> const&, pinned_allocator<U> const&) noexcept
+{
+  return true;
+}
+
+/**
+ * @brief Inequality comparison operator.
+ *
+ * @tparam T Value type of LHS object
+ * @tparam U Value type of RHS object
+ *
+ * @param lhs Left-hand side object to compare
+ * @param rhs Right-hand side object to compare
+ *
+ * @return `true` iff given arguments are not equal
+ */
+template <typename T, typename U>
+bool operator!=(pinned_allocator<T> const& lhs, pinned_allocator<U> const& rhs) noexcept
+{
+  return not(lhs == rhs);
+}
+
+/**
+ * @brief A managed memory allocator using `cudaMallocManaged`/`cudaFree` to satisfy
+ * (de)allocations.
+ *
+ * Every allocation is advised to reside at the given preferred location and to stay mapped on the
+ * current device. With the default preferred location, the host, device accesses are served
+ * remotely instead of migrating pages, which avoids thrashing when random probes touch a table
+ * larger than the device memory. With a device as preferred location, pages migrate to it on
+ * first touch and are evicted to the host under memory pressure, which suits tables only slightly
+ * larger than the device memory or workloads with locality. Containers can move their storage
+ * explicitly with `prefetch_async`.
+ *
+ * @note As for `pinned_allocator`, larger cooperative groups coalesce the remote accesses of a
+ * probing window and should be preferred.
+ *
+ * @tparam T The allocator's value type
+ */
+template <typename T>
+class managed_allocator {
+ public:
+  using value_type = T;  ///< Allocator's value type
+
+  managed_allocator() = default;
+
+  /**
+   * @brief Creates an allocator advising allocations to reside at `preferred_location`.
+   *
+   * @param preferred_location Device ordinal, or `cudaCpuDeviceId` for the host
+   */
+  explicit managed_allocator(int preferred_location) noexcept
+    : preferred_location_{preferred_location}
+  {
+  }
+
+  /**
+   * @brief Copy constructor.
+   *
+   * @param other Allocator whose preferred location is used
+   */
+  template <class U>
+  managed_allocator(managed_allocator<U> const& other) noexcept
+    : preferred_location_{other.preferred_location()}
+  {
+  }
+
+  /**
+   * @brief Allocates storage for `n` objects of type `T` using `cudaMallocManaged`.
+   *
+   * @param n The number of objects to allocate storage for
+   * @return Pointer to the allocated storage
+   */
+  value_type* allocate(std::size_t n)
+  {
+    auto const bytes = sizeof(value_type) * n;
+    value_type* p;
+    CUCO_CUDA_TRY(cudaMallocManaged(&p, bytes, cudaMemAttachGlobal));
+
+    int device;
+    CUCO_CUDA_TRY(cudaGetDevice(&device));
+    CUCO_CUDA_TRY(cudaMemAdvise(p, bytes, cudaMemAdviseSetPreferredLocation, preferred_location_));
+    CUCO_CUDA_TRY(cudaMemAdvise(p, bytes, cudaMemAdviseSetAccessedBy, device));
+    return p;
+  }
+
+  /**
+   * @brief Deallocates storage pointed to by `p`.
+   *
+   * @param p Pointer to memory to deallocate
+   */
+  void deallocate(value_type* p, std::size_t) { CUCO_CUDA_TRY(cudaFree(p)); }
+
+  /**
+   * @brief Gets the location allocations are advised to reside at.
+   *
+   * @return Device ordinal, or `cudaCpuDeviceId` for the host
+   */
+  [[nodiscard]] int preferred_location() const noexcept { return preferred_location_; }
+
+ private:
+  int preferred_location_{cudaCpuDeviceId};  ///< Device ordinal or `cudaCpuDeviceId`
+};
+
+/**
+ * @brief Equality comparison operator.
+ *
+ * @tparam T Value type of LHS object
+ * @tparam U Value type of RHS object
+ *
+ * @return `true` iff given arguments are equal
+ */
+template <typename T, typename U>
+bool operator==(managed_allocator<T> const&, managed_allocator<U> const&) noexcept
+{
+  return true;
+}
+
+/**
+ * @brief Inequality comparison operator.
+ *
+ * @tparam T Value type of LHS object
+ * @tparam U Value type of RHS object
+ *
+ * @param lhs Left-hand side object to compare
+ * @param rhs Right-hand side object to compare
+ *
+ * @return `true` iff given arguments are not equal
+ */
+template <typename T, typename U>
+bool operator!=(managed_allocator<T> const& lhs, managed_allocator<U> const& rhs) noexcept
+{
+  return not(lhs == rhs);
+}
+
+/**
+ * @brief A stream-ordered device allocator drawing from a `cudaMallocAsync` memory pool.
+ *
+ * Unlike `cuda_allocator`, (de)allocations neither synchronize the device nor each other: memory is
+ * allocated and released in the order of the stream the allocator is bound to. Released blocks are
+ * first kept in a host-side cache and reused by subsequent allocations of the same size class in
+ * the same stream without any driver call, so back-to-back bulk operations never block on the
+ * allocator.
+ *
+ * Containers rebind this allocator to the stream of each bulk operation for the temporaries of that
+ * operation, e.g., the counters of `size` and `count` or the scratch storage of `retrieve_all`.
+ *
+ * @note Copies and rebound copies share the same pool, which is destroyed with the last copy.
+ * @note Memory released in one stream must not be used by pending work in other streams unless
+ * that work is ordered before the release, e.g., via events. The container storage is allocated
+ * and released in the stream the allocator is bound to at construction.
+ *
+ * @tparam T The allocator's value type
+ */
+template <typename T>
+class stream_ordered_allocator {
+ public:
+  using value_type = T;  ///< Allocator's value type
+
+  /// Default maximum number of bytes kept by the host-side cache
+  static constexpr std::size_t default_max_cached_bytes = std::size_t{1} << 30;
+
+  /**
+   * @brief Creates an allocator with a new memory pool on the current device.
+   *
+   * @param stream CUDA stream (de)allocations are ordered in
+   * @param max_cached_bytes Maximum number of released bytes kept by the host-side cache
+   */
+  explicit stream_ordered_allocator(cuda::stream_ref stream      = {},
+                                    std::size_t max_cached_bytes = default_max_cached_bytes)
+    : pool_{std::make_shared<detail::stream_ordered_pool>(max_cached_bytes)}, stream_{stream}
+  {
+  }
+
+  /**
+   * @brief Copy constructor.
+   *
+   * @param other Allocator whose pool and stream are shared
+   */
+  template <class U>
+  stream_ordered_allocator(stream_ordered_allocator<U> const& other) noexcept
+    : pool_{other.pool_}, stream_{other.stream_}
+  {
+  }
+
+  /**
+   * @brief Allocates storage for `n` objects of type `T` in the order of the bound stream.
+   *
+   * @param n The number of objects to allocate storage for
+   * @return Pointer to the allocated storage
+   */
+  value_type* allocate(std::size_t n)
+  {
+    return static_cast<value_type*>(pool_->allocate(sizeof(value_type) * n, stream_));
+  }
+
+  /**
+   * @brief Deallocates storage pointed to by `p` in the order of the bound stream.
+   *
+   * @param p Pointer to memory to deallocate
+   * @param n The number of objects passed to `allocate`
+   */
+  void deallocate(value_type* p, std::size_t n)
+  {
+    pool_->deallocate(p, sizeof(value_type) * n, stream_);
+  }
+
+  /**
+   * @brief Gets the stream (de)allocations are ordered in.
+   *
+   * @return The bound CUDA stream
+   */
+  [[nodiscard]] cuda::stream_ref stream() const noexcept { return stream_; }
+
+  /**
+   * @brief Creates a copy of this allocator sharing its pool but bound to another stream.
+   *
+   * @param stream CUDA stream (de)allocations of the copy are ordered in
+   * @return The rebound allocator
+   */
+  [[nodiscard]] stream_ordered_allocator rebind_stream(cuda::stream_ref stream) const noexcept
+  {
+    auto other    = *this;
+    other.stream_ = stream;
+    return other;
+  }
+
+ private:
+  std::shared_ptr<detail::stream_ordered_pool> pool_;  ///< Shared memory pool
+  cuda::stream_ref stream_;                            ///< Stream (de)allocations are ordered in
+
+  template <typename U>
+  friend class stream_ordered_allocator;
+
+  template <typename U, typename V>
+  friend bool operator==(stream_ordered_allocator<U> const&,
+                         stream_ordered_allocator<V> const&) noexcept;
+};
+
+/**
+ * @brief Equality comparison operator.
+ *
+ * @tparam T Value type of LHS object
+ * @tparam U Value type of RHS object
+ *
+ * @param lhs Left-hand side object to compare
+ * @param rhs Right-hand side object to compare
+ *
+ * @return `true` iff both allocators share the same pool
+ */
+template <typename T, typename U>
+bool operator==(stream_ordered_allocator<T> const& lhs,
+                stream_ordered_allocator<U> const& rhs) noexcept
+{
+  return lhs.pool_ == rhs.pool_;
+}
+
+/**
+ * @brief Inequality comparison operator.
+ *
+ * @tparam T Value type of LHS object
+ * @tparam U Value type of RHS object
+ *
+ * @param lhs Left-hand side object to compare
+ * @param rhs Right-hand side object to compare
+ *
+ * @return `true` iff given arguments are not equal
+ */
+template <typename T, typename U>
+bool operator!=(stream_ordered_allocator<T> const& lhs,
+                stream_ordered_allocator<U> const& rhs) noexcept
+{
+  return not(lhs == rhs);
+}
+
+namespace detail {
+/**
+ * @brief Indicates whether the given allocator type is a `cuco::host_allocator`.
+ *
+ * @tparam Allocator Allocator type
+ */
+template <typename Allocator>
+struct is_host_allocator : std::false_type {};
+
+template <typename T>
+struct is_host_allocator<host_allocator<T>> : std::true_type {};
+
+template <typename Allocator>
+inline constexpr bool is_host_allocator_v = is_host_allocator<Allocator>::value;
+
+/**
+ * @brief Indicates whether the given allocator type is a `cuco::pinned_allocator`.
+ *
+ * @tparam Allocator Allocator type
+ */
+template <typename Allocator>
+struct is_pinned_allocator : std::false_type {};
+
+template <typename T>
+struct is_pinned_allocator<pinned_allocator<T>> : std::true_type {};
+
+template <typename Allocator>
+inline constexpr bool is_pinned_allocator_v = is_pinned_allocator<Allocator>::value;
+
+/**
+ * @brief Indicates whether the given allocator type is a `cuco::managed_allocator`.
+ *
+ * @tparam Allocator Allocator type
+ */
+template <typename Allocator>
+struct is_managed_allocator : std::false_type {};
+
+template <typename T>
+struct is_managed_allocator<managed_allocator<T>> : std::true_type {};
+
+template <typename Allocator>
+inline constexpr bool is_managed_allocator_v = is_managed_allocator<Allocator>::value;
+
+/**
+ * @brief Indicates whether the given allocator type is a `cuco::stream_ordered_allocator`.
+ *
+ * @tparam Allocator Allocator type
+ */
+template <typename Allocator>
+struct is_stream_ordered_allocator : std::false_type {};
+
+template <typename T>
+struct is_stream_ordered_allocator<stream_ordered_allocator<T>> : std::true_type {};
+
+template <typename Allocator>
+inline constexpr bool is_stream_ordered_allocator_v = is_stream_ordered_allocator<Allocator>::value;
+
+/**
+ * @brief Gets an allocator for the temporaries of an operation running in `stream`.
+ *
+ * @tparam Allocator Allocator type
+ *
+ * @param alloc Container allocator
+ * @param stream CUDA stream of the operation
+ *
+ * @return `alloc` rebound to `stream` if it is stream-ordered, `alloc` otherwise
+ */
+template <typename Allocator>
+[[nodiscard]] Allocator with_stream(Allocator const& alloc, cuda::stream_ref stream) noexcept
+{
+  if constexpr (is_stream_ordered_allocator_v<Allocator>) {
+    return alloc.rebind_stream(stream);
+  } else {
+    return alloc;
+  }
+}
+
+/**
+ * @brief Orders the releases performed by `alloc` after all work submitted to `stream` so far.
+ *
+ * @note No effect unless `alloc` is stream-ordered and bound to a stream other than `stream`.
+ *
+ * @tparam Allocator Allocator type
+ *
+ * @param alloc Allocator that will release memory used by `stream`
+ * @param stream CUDA stream using the memory
+ */
+template <typename Allocator>
+void release_after(Allocator const& alloc, cuda::stream_ref stream)
+{
+  if constexpr (is_stream_ordered_allocator_v<Allocator>) {
+    if (alloc.stream() == stream) { return; }
+    cudaEvent_t event;
+    CUCO_CUDA_TRY(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+    CUCO_CUDA_TRY(cudaEventRecord(event, stream.get()));
+    CUCO_CUDA_TRY(cudaStreamWaitEvent(alloc.stream().get(), event, 0));
+    CUCO_CUDA_TRY(cudaEventDestroy(event));
+  }
+}
+}  // namespace detail
+
 }  // namespace cuco
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/error.hpp>
+
+#include <cuda/stream_ref>
+
+#include <type_traits>
+#include <utility>
+
+namespace cuco {
+
+/**
+ * @brief Handle to a value produced asynchronously by device work.
+ *
+ * The value lives in pinned host memory, which device work can write to directly (see `data()`).
+ * Once the producing work has been submitted, `record` marks its completion point in the stream.
+ * `get` then waits for that point only, leaving any later work in the stream running.
+ *
+ * Example:
+ * @code{.cpp}
+ * auto num_matches = set.count_async(probes.begin(), probes.end(), stream);
+ * // ... submit more work or do host work ...
+ * auto const n = num_matches.get();  // synchronizes here only
+ * @endcode
+ *
+ * @note The destructor waits for the recorded work to complete since it still writes to the
+ * value's storage.
+ * @note Creating a handle allocates memory and an event. Code captured into CUDA graphs should pass
+ * preallocated device accessible memory to the pointer overloads of the `_async` APIs instead.
+ *
+ * @tparam T Trivially copyable type of the value
+ */
+template <typename T>
+class async_result {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "async_result requires a trivially copyable value type.");
+
+ public:
+  using value_type = T;  ///< Type of the value
+
+  /**
+   * @brief Allocates the storage of the value and its completion event.
+   */
+  async_result()
+  {
+    CUCO_CUDA_TRY(cudaMallocHost(&value_, sizeof(value_type)));
+    CUCO_CUDA_TRY(cudaEventCreateWithFlags(&event_, cudaEventDisableTiming));
+  }
+
+  async_result(async_result const&)            = delete;
+  async_result& operator=(async_result const&) = delete;
+
+  /**
+   * @brief Move constructor.
+   *
+   * @param other Handle to take over
+   */
+  async_result(async_result&& other) noexcept
+    : value_{std::exchange(other.value_, nullptr)}, event_{std::exchange(other.event_, nullptr)}
+  {
+  }
+
+  /**
+   * @brief Move assignment operator.
+   *
+   * @param other Handle to take over
+   *
+   * @return Reference to this handle
+   */
+  async_result& operator=(async_result&& other) noexcept
+  {
+    if (this != &other) {
+      this->release();
+      value_ = std::exchange(other.value_, nullptr);
+      event_ = std::exchange(other.event_, nullptr);
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Waits for the recorded work and releases the storage of the value.
+   */
+  ~async_result() { this->release(); }
+
+  /**
+   * @brief Gets the location of the value.
+   *
+   * @note The pointer is accessible from both host and device.
+   *
+   * @return Pointer to the value
+   */
+  [[nodiscard]] value_type* data() noexcept { return value_; }
+
+  /**
+   * @brief Marks the value as complete once all work submitted to `stream` so far has finished.
+   *
+   * @param stream CUDA stream producing the value
+   */
+  void record(cuda::stream_ref stream) { CUCO_CUDA_TRY(cudaEventRecord(event_, stream.get())); }
+
+  /**
+   * @brief Checks whether the value is complete, without blocking.
+   *
+   * @return `true` if the recorded work has finished
+   */
+  [[nodiscard]] bool ready() const
+  {
+    auto const status = cudaEventQuery(event_);
+    if (status == cudaErrorNotReady) { return false; }
+    CUCO_CUDA_TRY(status);
+    return true;
+  }
+
+  /**
+   * @brief Waits until the value is complete.
+   */
+  void wait() const { CUCO_CUDA_TRY(cudaEventSynchronize(event_)); }
+
+  /**
+   * @brief Waits until the value is complete and returns it.
+   *
+   * @return The value
+   */
+  [[nodiscard]] value_type get() const
+  {
+    this->wait();
+    return *value_;
+  }
+
+ private:
+  /**
+   * @brief Waits for the recorded work and frees the owned resources, if any.
+   */
+  void release() noexcept
+  {
+    if (event_ != nullptr) {
+      CUCO_ASSERT_CUDA_SUCCESS(cudaEventSynchronize(event_));
+      CUCO_ASSERT_CUDA_SUCCESS(cudaEventDestroy(event_));
+      event_ = nullptr;
+    }
+    if (value_ != nullptr) {
+      CUCO_ASSERT_CUDA_SUCCESS(cudaFreeHost(value_));
+      value_ = nullptr;
+    }
+  }
+
+  value_type* value_{nullptr};  ///< Pinned host storage of the value
+  cudaEvent_t event_{nullptr};  ///< Event recorded after the work producing the value
+};
+
+}  // namespace cuco
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace cuco {
+
+/**
+ * @brief Probe length and occupancy statistics of an open addressing container.
+ *
+ * The probe length of an element is the number of probing steps taken from its home bucket, i.e.,
+ * the first bucket (or the first window of `cg_size` buckets) of its probing sequence, until the
+ * bucket holding the element is reached. An element located in its home bucket has probe length
+ * zero.
+ *
+ * @note Elements held in an overflow stash (see `cuco::stash_storage`) are outside of any probing
+ * sequence and are accounted with the length of a full probing cycle.
+ *
+ * @tparam SizeType Size type of the container
+ */
+template <typename SizeType>
+struct container_statistics {
+  using size_type = SizeType;  ///< Size type
+
+  /// Number of bins of `probe_length_histogram`
+  static constexpr int32_t num_probe_length_bins = 64;
+
+  size_type capacity;          ///< Total number of slots
+  size_type num_buckets;       ///< Total number of buckets
+  size_type num_elements;      ///< Number of filled slots
+  size_type num_tombstones;    ///< Number of erased slots
+  size_type max_probe_length;  ///< Longest probe length of any element
+
+  /// Number of elements per probe length. The last bin also counts all longer probe lengths.
+  std::vector<size_type> probe_length_histogram;
+  /// Number of buckets per number of filled slots, from zero to the bucket size
+  std::vector<size_type> bucket_fill_histogram;
+
+  /**
+   * @brief Gets the fraction of elements located in their home bucket.
+   *
+   * @return Fraction of elements with probe length zero, or one for an empty container
+   */
+  [[nodiscard]] double home_bucket_fraction() const noexcept
+  {
+    if (num_elements == 0) { return 1.0; }
+    return static_cast<double>(probe_length_histogram.front()) /
+           static_cast<double>(num_elements);
+  }
+
+  /**
+   * @brief Gets the mean probe length of all elements.
+   *
+   * @note Probe lengths beyond the last histogram bin are accounted with the last bin's length.
+   *
+   * @return Mean probe length, or zero for an empty container
+   */
+  [[nodiscard]] double mean_probe_length() const noexcept
+  {
+    if (num_elements == 0) { return 0.0; }
+    double total = 0.0;
+    for (std::size_t i = 0; i < probe_length_histogram.size(); ++i) {
+      total += static_cast<double>(i) * static_cast<double>(probe_length_histogram[i]);
+    }
+    return total / static_cast<double>(num_elements);
+  }
+
+  /**
+   * @brief Gets the ratio of filled slots to the capacity.
+   *
+   * @return The load factor
+   */
+  [[nodiscard]] double load_factor() const noexcept
+  {
+    if (capacity == 0) { return 0.0; }
+    return static_cast<double>(num_elements) / static_cast<double>(capacity);
+  }
+};
+
+}  // namespace cuco
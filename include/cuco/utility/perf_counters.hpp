@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace cuco {
+
+/**
+ * @brief Device performance counters of an open addressing container.
+ *
+ * Counters are only collected by containers using `cuco::counted_storage` and accumulate over all
+ * operations issued since the storage was last initialized, cleared or reset.
+ *
+ * @note The member order matches the device-side layout of the counters.
+ */
+struct perf_counters {
+  std::uint64_t probe_steps;     ///< Number of buckets probed by insert operations
+  std::uint64_t cas_failures;    ///< Number of slot CAS operations that failed
+  std::uint64_t duplicate_hits;  ///< Number of insertions that found an equivalent key
+  std::uint64_t bucket_full;     ///< Number of insert probing steps finding no available slot
+};
+
+namespace detail {
+/// Kinds of events counted by `cuco::counted_storage`, indexing the fields of `perf_counters`
+enum class perf_event : std::int32_t {
+  PROBE_STEP    = 0,
+  CAS_FAILURE   = 1,
+  DUPLICATE_HIT = 2,
+  BUCKET_FULL   = 3
+};
+
+/// Number of event kinds counted by `cuco::counted_storage`
+inline constexpr std::int32_t num_perf_events = 4;
+
+static_assert(sizeof(perf_counters) == num_perf_events * sizeof(std::uint64_t),
+              "perf_counters must hold exactly one counter per event kind.");
+}  // namespace detail
+
+}  // namespace cuco
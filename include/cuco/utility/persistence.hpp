@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace cuco {
+
+/**
+ * @brief Kind of container stored in a persisted file.
+ */
+enum class persisted_kind : std::uint32_t {
+  static_set      = 1,
+  static_map      = 2,
+  static_multiset = 3,
+  static_multimap = 4,
+  bloom_filter    = 5,
+  hyperloglog     = 6
+};
+
+/**
+ * @brief Fixed-size header at the beginning of every file written by a container's `save`.
+ *
+ * A persisted file consists of this header, followed by a configuration blob of `config_bytes`
+ * bytes holding the hash functions (including their seeds) and the sentinels field by field,
+ * followed by the raw container storage of `payload_bytes` bytes starting at the page-aligned
+ * `payload_offset`.
+ *
+ * @note The storage is written verbatim, so a file can only be loaded by a container of the same
+ * kind built for the same architecture. `type_fingerprint` guards against loading it into a
+ * container of different key, value, hash, probing or storage types. Hash tables ignore the
+ * allocator type, so a table can be loaded into one that allocates its storage differently.
+ */
+struct persisted_header {
+  static constexpr std::uint64_t expected_magic    = 0x50414e5350435543ull;  ///< "CUCPSNAP"
+  static constexpr std::uint32_t current_version   = 1;     ///< Version written by `save`
+  static constexpr std::uint64_t payload_alignment = 4096;  ///< Alignment of `payload_offset`
+
+  std::uint64_t magic;             ///< Must be `expected_magic`
+  std::uint32_t version;           ///< File format version
+  persisted_kind kind;             ///< Kind of the persisted container
+  std::uint64_t type_fingerprint;  ///< Fingerprint of the types defining the storage layout
+  std::uint32_t key_bytes;         ///< Size of the key type in bytes
+  std::uint32_t slot_bytes;        ///< Size of a slot, filter word or sketch register in bytes
+  std::uint32_t bucket_size;       ///< Number of slots per bucket or of words per filter block
+  std::uint32_t cg_size;           ///< CG size used for probing
+  std::uint64_t capacity;          ///< Total number of slots, filter words or sketch registers
+  std::uint64_t num_buckets;       ///< Number of buckets or filter blocks
+  std::uint64_t config_bytes;      ///< Size of the configuration blob in bytes
+  std::uint64_t payload_offset;    ///< Offset of the raw storage from the beginning of the file
+  std::uint64_t payload_bytes;     ///< Size of the raw storage in bytes
+};
+
+/**
+ * @brief Reads and validates the header of a file written by a container's `save`.
+ *
+ * @note This is a host-only function that neither requires a GPU nor touches the payload. It can
+ * be used to inspect persisted files, e.g., to construct a container of matching capacity before
+ * calling `load`.
+ *
+ * @throw cuco::logic_error If the file cannot be read, is not a persisted cuco container, has an
+ * unsupported version or is truncated
+ *
+ * @param path Path of the persisted file
+ *
+ * @return The validated file header
+ */
+persisted_header read_persisted_header(std::string const& path);
+
+}  // namespace cuco
+
+#include <cuco/detail/utility/persistence.hpp>
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/bloom_filter.cuh>
+
+#include <thrust/device_vector.h>
+#include <thrust/fill.h>
+#include <thrust/functional.h>
+#include <thrust/sequence.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+TEST_CASE("bloom_filter CUDA graph capture tests", "")
+{
+  using Key         = int32_t;
+  using filter_type = cuco::bloom_filter<Key>;
+
+  constexpr std::size_t num_keys{10'000};
+
+  cudaStream_t stream;
+  CUCO_CUDA_TRY(cudaStreamCreate(&stream));
+
+  {
+    auto filter = filter_type{1000, {}, {}, {}, stream};
+
+    thrust::device_vector<Key> keys(num_keys);
+    thrust::sequence(keys.begin(), keys.end());
+    thrust::device_vector<bool> contained(num_keys, false);
+    CUCO_CUDA_TRY(cudaDeviceSynchronize());
+
+    cudaGraph_t graph;
+    CUCO_CUDA_TRY(cudaStreamBeginCapture(stream, cudaStreamCaptureModeGlobal));
+    filter.clear_async(stream);
+    filter.add_async(keys.begin(), keys.end(), stream);
+    filter.contains_async(keys.begin(), keys.end(), contained.begin(), stream);
+    CUCO_CUDA_TRY(cudaStreamEndCapture(stream, &graph));
+
+    cudaGraphExec_t graph_exec;
+    CUCO_CUDA_TRY(cudaGraphInstantiate(&graph_exec, graph, 0));
+
+    for (int i = 0; i < 2; ++i) {
+      thrust::fill(contained.begin(), contained.end(), false);
+      CUCO_CUDA_TRY(cudaDeviceSynchronize());
+      CUCO_CUDA_TRY(cudaGraphLaunch(graph_exec, stream));
+      CUCO_CUDA_TRY(cudaStreamSynchronize(stream));
+
+      REQUIRE(cuco::test::all_of(contained.begin(), contained.end(), thrust::identity{}));
+    }
+
+    CUCO_CUDA_TRY(cudaGraphExecDestroy(graph_exec));
+    CUCO_CUDA_TRY(cudaGraphDestroy(graph));
+  }
+
+  CUCO_CUDA_TRY(cudaStreamDestroy(stream));
+}
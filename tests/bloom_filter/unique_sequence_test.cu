@@ -91,7 +91,9 @@ TEMPLATE_TEST_CASE_SIG(
   (int32_t, cuco::default_filter_policy<cuco::xxhash_64<int32_t>, uint32_t, 1>),
   (int32_t, cuco::default_filter_policy<cuco::xxhash_64<int32_t>, uint32_t, 8>),
   (int32_t, cuco::default_filter_policy<cuco::xxhash_64<int32_t>, uint64_t, 1>),
-  (int32_t, cuco::default_filter_policy<cuco::xxhash_64<int32_t>, uint64_t, 8>))
+  (int32_t, cuco::default_filter_policy<cuco::xxhash_64<int32_t>, uint64_t, 8>),
+  (int32_t, cuco::default_filter_policy<cuco::xxhash3_128<int32_t>, uint64_t, 8>),
+  (int32_t, cuco::default_filter_policy<cuco::murmurhash3_x86_128<int32_t>, uint32_t, 1>))
 {
   using filter_type =
     cuco::bloom_filter<Key, cuco::extent<size_t>, cuda::thread_scope_device, Policy>;
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/groupby.cuh>
+
+#include <cuda/functional>
+#include <cuda/std/tuple>
+#include <thrust/device_vector.h>
+#include <thrust/host_vector.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <cstdint>
+#include <iterator>
+
+using size_type = int64_t;
+
+TEMPLATE_TEST_CASE_SIG("groupby aggregate tests", "", ((typename Key), Key), (int32_t), (int64_t))
+{
+  using aggregations = cuda::std::tuple<cuco::aggregation::sum<int64_t>,
+                                        cuco::aggregation::min<int64_t>,
+                                        cuco::aggregation::max<int64_t>,
+                                        cuco::aggregation::count<int32_t>,
+                                        cuco::aggregation::mean<int64_t>>;
+
+  // Few rows take the global path, many rows the shared memory path, which spills to the global
+  // table for many groups
+  auto const num_rows   = GENERATE(size_type{1'000}, size_type{4'000'000});
+  auto const num_groups = GENERATE(size_type{10}, size_type{1'000}, size_type{100'000});
+  if (num_groups > num_rows) { return; }
+  INFO("num_rows=" << num_rows);
+  INFO("num_groups=" << num_groups);
+
+  auto groups = cuco::groupby<Key, aggregations>{num_groups * 2, cuco::empty_key<Key>{-1}};
+
+  // row `i` belongs to group `i % num_groups` and has value `i`
+  auto const keys_begin = thrust::make_transform_iterator(
+    thrust::counting_iterator<size_type>{0},
+    cuda::proclaim_return_type<Key>(
+      [num_groups] __device__(size_type i) { return static_cast<Key>(i % num_groups); }));
+  auto const values_begin = thrust::counting_iterator<int64_t>{0};
+  auto const values       = cuda::std::make_tuple(
+    values_begin, values_begin, values_begin, thrust::constant_iterator<int64_t>{0}, values_begin);
+
+  auto const verify = [&](int64_t num_passes) {
+    REQUIRE(groups.size() == num_groups);
+
+    thrust::device_vector<Key> keys(num_groups);
+    thrust::device_vector<int64_t> sums(num_groups);
+    thrust::device_vector<int64_t> mins(num_groups);
+    thrust::device_vector<int64_t> maxs(num_groups);
+    thrust::device_vector<int32_t> counts(num_groups);
+    thrust::device_vector<double> means(num_groups);
+    auto const keys_end = groups.retrieve(
+      keys.begin(),
+      cuda::std::make_tuple(
+        sums.begin(), mins.begin(), maxs.begin(), counts.begin(), means.begin()));
+    REQUIRE(std::distance(keys.begin(), keys_end) == num_groups);
+
+    thrust::host_vector<Key> const h_keys       = keys;
+    thrust::host_vector<int64_t> const h_sums   = sums;
+    thrust::host_vector<int64_t> const h_mins   = mins;
+    thrust::host_vector<int64_t> const h_maxs   = maxs;
+    thrust::host_vector<int32_t> const h_counts = counts;
+    thrust::host_vector<double> const h_means   = means;
+
+    auto const rows_per_group = num_rows / num_groups;
+    auto const half_triangle  = rows_per_group * (rows_per_group - 1) / 2;
+    for (size_type i = 0; i < num_groups; ++i) {
+      auto const g        = static_cast<int64_t>(h_keys[i]);
+      auto const expected = rows_per_group * g + num_groups * half_triangle;
+      REQUIRE(h_sums[i] == num_passes * expected);
+      REQUIRE(h_mins[i] == g);
+      REQUIRE(h_maxs[i] == g + (rows_per_group - 1) * num_groups);
+      REQUIRE(h_counts[i] == num_passes * rows_per_group);
+      REQUIRE(h_means[i] == static_cast<double>(expected) / rows_per_group);
+    }
+  };
+
+  SECTION("Each group holds the aggregates of its rows")
+  {
+    groups.aggregate(keys_begin, keys_begin + num_rows, values);
+    verify(1);
+  }
+
+  SECTION("Groups accumulate across calls")
+  {
+    groups.aggregate(keys_begin, keys_begin + num_rows, values);
+    groups.aggregate(keys_begin, keys_begin + num_rows, values);
+    verify(2);
+  }
+
+  SECTION("Clear resets all groups")
+  {
+    groups.aggregate(keys_begin, keys_begin + num_rows, values);
+    groups.clear();
+    REQUIRE(groups.size() == 0);
+
+    groups.aggregate(keys_begin, keys_begin + num_rows, values);
+    verify(1);
+  }
+}
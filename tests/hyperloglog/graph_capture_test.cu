@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/hyperloglog.cuh>
+
+#include <thrust/device_vector.h>
+#include <thrust/sequence.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+TEST_CASE("hyperloglog CUDA graph capture tests", "")
+{
+  using T              = int32_t;
+  using estimator_type = cuco::hyperloglog<T>;
+
+  constexpr std::size_t num_items{100'000};
+
+  cudaStream_t stream;
+  CUCO_CUDA_TRY(cudaStreamCreate(&stream));
+
+  {
+    auto estimator = estimator_type{cuco::sketch_size_kb{32}, {}, {}, stream};
+    auto other     = estimator_type{cuco::sketch_size_kb{32}, {}, {}, stream};
+
+    thrust::device_vector<T> items(num_items);
+    thrust::sequence(items.begin(), items.end());
+    thrust::device_vector<std::size_t> d_estimate(1);
+    CUCO_CUDA_TRY(cudaDeviceSynchronize());
+
+    cudaGraph_t graph;
+    CUCO_CUDA_TRY(cudaStreamBeginCapture(stream, cudaStreamCaptureModeGlobal));
+    estimator.clear_async(stream);
+    other.clear_async(stream);
+    estimator.add_async(items.begin(), items.begin() + num_items / 2, stream);
+    other.add_async(items.begin() + num_items / 2, items.end(), stream);
+    estimator.merge_async(other, stream);
+    estimator.estimate_async(d_estimate.data().get(), stream);
+    CUCO_CUDA_TRY(cudaStreamEndCapture(stream, &graph));
+
+    cudaGraphExec_t graph_exec;
+    CUCO_CUDA_TRY(cudaGraphInstantiate(&graph_exec, graph, 0));
+
+    for (int i = 0; i < 2; ++i) {
+      CUCO_CUDA_TRY(cudaGraphLaunch(graph_exec, stream));
+      CUCO_CUDA_TRY(cudaStreamSynchronize(stream));
+
+      // The device-side estimate matches the host-side one for the same sketch
+      REQUIRE(d_estimate[0] == estimator.estimate(stream));
+    }
+
+    CUCO_CUDA_TRY(cudaGraphExecDestroy(graph_exec));
+    CUCO_CUDA_TRY(cudaGraphDestroy(graph));
+  }
+
+  CUCO_CUDA_TRY(cudaStreamDestroy(stream));
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_map.cuh>
+#include <cuco/utility/reduction_functors.cuh>
+
+#include <cuda/functional>
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+TEST_CASE("static_map CUDA graph capture tests", "")
+{
+  using Key      = int32_t;
+  using Value    = int32_t;
+  using map_type = cuco::static_map<Key, Value>;
+
+  constexpr std::size_t num_keys{10'000};
+  constexpr std::size_t multiplicity{4};
+
+  cudaStream_t stream;
+  CUCO_CUDA_TRY(cudaStreamCreate(&stream));
+
+  {
+    auto map = map_type{num_keys * 2,
+                        cuco::empty_key<Key>{-1},
+                        cuco::empty_value<Value>{0},
+                        {},
+                        {},
+                        {},
+                        {},
+                        {},
+                        stream};
+
+    auto const keys_begin  = thrust::counting_iterator<Key>{0};
+    auto const pairs_begin = thrust::make_transform_iterator(
+      thrust::counting_iterator<std::size_t>{0},
+      cuda::proclaim_return_type<cuco::pair<Key, Value>>(
+        [] __device__(auto i) { return cuco::pair<Key, Value>{i % num_keys, 1}; }));
+
+    thrust::device_vector<map_type::size_type> d_results(2);
+    thrust::device_vector<Value> found(num_keys);
+    CUCO_CUDA_TRY(cudaDeviceSynchronize());
+
+    cudaGraph_t graph;
+    CUCO_CUDA_TRY(cudaStreamBeginCapture(stream, cudaStreamCaptureModeGlobal));
+    map.clear_async(stream);
+    map.insert_or_apply_async(
+      pairs_begin, pairs_begin + num_keys * multiplicity, cuco::reduce::plus{}, stream);
+    map.size_async(d_results.data().get(), stream);
+    map.count_async(keys_begin, keys_begin + 2 * num_keys, d_results.data().get() + 1, stream);
+    map.find_async(keys_begin, keys_begin + num_keys, found.begin(), stream);
+    CUCO_CUDA_TRY(cudaStreamEndCapture(stream, &graph));
+
+    cudaGraphExec_t graph_exec;
+    CUCO_CUDA_TRY(cudaGraphInstantiate(&graph_exec, graph, 0));
+
+    for (int i = 0; i < 3; ++i) {
+      CUCO_CUDA_TRY(cudaGraphLaunch(graph_exec, stream));
+      CUCO_CUDA_TRY(cudaStreamSynchronize(stream));
+
+      REQUIRE(d_results[0] == num_keys);
+      REQUIRE(d_results[1] == num_keys);
+      REQUIRE(cuco::test::equal(found.begin(),
+                                found.end(),
+                                thrust::make_constant_iterator<Value>(multiplicity),
+                                thrust::equal_to<Value>{}));
+    }
+
+    CUCO_CUDA_TRY(cudaGraphExecDestroy(graph_exec));
+    CUCO_CUDA_TRY(cudaGraphDestroy(graph));
+  }
+
+  CUCO_CUDA_TRY(cudaStreamDestroy(stream));
+}
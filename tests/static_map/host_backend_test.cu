@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_map.cuh>
+
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/host_vector.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+using size_type = int32_t;
+
+TEMPLATE_TEST_CASE_SIG("static_map host backend tests",
+                       "",
+                       ((typename Key, typename Value, int BucketSize), Key, Value, BucketSize),
+                       (int32_t, int32_t, 1),
+                       (int32_t, int64_t, 2),
+                       (int64_t, int64_t, 1),
+                       (int64_t, int32_t, 2))
+{
+  constexpr size_type num_keys{100'000};
+
+  using probe = cuco::linear_probing<1, cuco::default_hash_function<Key>>;
+
+  auto map = cuco::static_map<Key,
+                              Value,
+                              cuco::extent<size_type>,
+                              cuda::thread_scope_device,
+                              thrust::equal_to<Key>,
+                              probe,
+                              cuco::host_allocator<cuco::pair<Key, Value>>,
+                              cuco::storage<BucketSize>>{num_keys * 2,
+                                                         cuco::empty_key<Key>{-1},
+                                                         cuco::empty_value<Value>{-1},
+                                                         cuco::erased_key<Key>{-2}};
+
+  std::vector<Key> keys(num_keys);
+  std::vector<cuco::pair<Key, Value>> pairs(num_keys);
+  for (size_type i = 0; i < num_keys; ++i) {
+    keys[i]  = static_cast<Key>(i);
+    pairs[i] = cuco::pair<Key, Value>{static_cast<Key>(i), static_cast<Value>(i * 2)};
+  }
+
+  REQUIRE(map.size() == 0);
+  REQUIRE(map.insert(pairs.begin(), pairs.end()) == num_keys);
+
+  SECTION("All inserted keys are found with their payloads")
+  {
+    REQUIRE(map.size() == num_keys);
+
+    thrust::host_vector<bool> contained(num_keys);
+    map.contains(keys.begin(), keys.end(), contained.begin());
+    REQUIRE(std::all_of(contained.begin(), contained.end(), thrust::identity{}));
+
+    std::vector<Value> found(num_keys);
+    map.find(keys.begin(), keys.end(), found.begin());
+    for (size_type i = 0; i < num_keys; ++i) {
+      REQUIRE(found[i] == static_cast<Value>(i * 2));
+    }
+  }
+
+  SECTION("Reinserting contained keys does not insert anything")
+  {
+    REQUIRE(map.insert(pairs.begin(), pairs.end()) == 0);
+    REQUIRE(map.size() == num_keys);
+  }
+
+  SECTION("Erased keys are no longer contained")
+  {
+    map.erase(keys.begin(), keys.begin() + num_keys / 2);
+    REQUIRE(map.size() == num_keys / 2);
+
+    thrust::host_vector<bool> contained(num_keys);
+    map.contains(keys.begin(), keys.end(), contained.begin());
+    REQUIRE(std::none_of(contained.begin(), contained.begin() + num_keys / 2, thrust::identity{}));
+    REQUIRE(std::all_of(contained.begin() + num_keys / 2, contained.end(), thrust::identity{}));
+
+    std::vector<Value> found(num_keys);
+    map.find(keys.begin(), keys.end(), found.begin());
+    REQUIRE(found.front() == map.empty_value_sentinel());
+    REQUIRE(found.back() == static_cast<Value>((num_keys - 1) * 2));
+  }
+
+  SECTION("Clear removes all elements")
+  {
+    map.clear();
+    REQUIRE(map.size() == 0);
+  }
+
+  SECTION("A host table can be copied to a device table of the same capacity")
+  {
+    auto device_map = cuco::static_map<Key,
+                                       Value,
+                                       cuco::extent<size_type>,
+                                       cuda::thread_scope_device,
+                                       thrust::equal_to<Key>,
+                                       probe,
+                                       cuco::cuda_allocator<cuco::pair<Key, Value>>,
+                                       cuco::storage<BucketSize>>{num_keys * 2,
+                                                                  cuco::empty_key<Key>{-1},
+                                                                  cuco::empty_value<Value>{-1},
+                                                                  cuco::erased_key<Key>{-2}};
+    REQUIRE(device_map.capacity() == map.capacity());
+
+    auto const host_storage   = map.ref(cuco::find).storage_ref();
+    auto const device_storage = device_map.ref(cuco::find).storage_ref();
+    CUCO_CUDA_TRY(cudaMemcpy(device_storage.data(),
+                             host_storage.data(),
+                             sizeof(cuco::pair<Key, Value>) * map.capacity(),
+                             cudaMemcpyHostToDevice));
+
+    REQUIRE(device_map.size() == num_keys);
+
+    auto const keys_begin = thrust::counting_iterator<Key>{0};
+    thrust::device_vector<Value> found(num_keys);
+    device_map.find(keys_begin, keys_begin + num_keys, found.begin());
+
+    thrust::host_vector<Value> const h_found = found;
+    for (size_type i = 0; i < num_keys; ++i) {
+      REQUIRE(h_found[i] == static_cast<Value>(i * 2));
+    }
+  }
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_map.cuh>
+
+#include <cuda/functional>
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+using size_type = int32_t;
+
+TEMPLATE_TEST_CASE_SIG(
+  "static_map incremental rehash tests",
+  "",
+  ((typename Key, typename Value, int CGSize), Key, Value, CGSize),
+  (int32_t, int32_t, 1),
+  (int32_t, int64_t, 2),
+  (int64_t, int32_t, 1),
+  (int64_t, int64_t, 2))
+{
+  constexpr size_type num_keys{10'000};
+  constexpr size_type buckets_per_step{1'000};
+
+  using probe = cuco::linear_probing<CGSize, cuco::default_hash_function<Key>>;
+
+  auto map = cuco::static_map<Key,
+                              Value,
+                              cuco::extent<size_type>,
+                              cuda::thread_scope_device,
+                              thrust::equal_to<Key>,
+                              probe,
+                              cuco::cuda_allocator<cuda::std::byte>,
+                              cuco::storage<1>>{num_keys,
+                                                cuco::empty_key<Key>{-1},
+                                                cuco::empty_value<Value>{-1},
+                                                cuco::erased_key<Key>{-2}};
+
+  auto const keys_begin  = thrust::counting_iterator<Key>{0};
+  auto const pairs_begin = thrust::make_transform_iterator(
+    keys_begin, cuda::proclaim_return_type<cuco::pair<Key, Value>>([] __device__(Key key) {
+      return cuco::pair<Key, Value>{key, static_cast<Value>(key * 2)};
+    }));
+  auto const value_matches_key = cuda::proclaim_return_type<bool>(
+    [] __device__(Value value, Key key) { return value == static_cast<Value>(key * 2); });
+
+  map.insert(pairs_begin, pairs_begin + num_keys / 2);
+  map.rehash_incremental_async(num_keys * 4, buckets_per_step);
+  REQUIRE(map.is_rehashing());
+
+  SECTION("Lookups find the elements of both storages during the migration")
+  {
+    map.insert(pairs_begin + num_keys / 2, pairs_begin + num_keys);
+    REQUIRE(map.is_rehashing());
+    REQUIRE(map.size() == num_keys);
+    REQUIRE(map.count(keys_begin, keys_begin + num_keys * 2) == num_keys);
+
+    thrust::device_vector<bool> contained(num_keys * 2);
+    map.contains(keys_begin, keys_begin + num_keys * 2, contained.begin());
+    REQUIRE(cuco::test::all_of(
+      contained.begin(), contained.begin() + num_keys, thrust::identity<bool>{}));
+    REQUIRE(
+      cuco::test::none_of(contained.begin() + num_keys, contained.end(), thrust::identity<bool>{}));
+
+    thrust::device_vector<Value> found(num_keys);
+    map.find(keys_begin, keys_begin + num_keys, found.begin());
+    REQUIRE(cuco::test::equal(found.begin(), found.end(), keys_begin, value_matches_key));
+  }
+
+  SECTION("Keys held by the old storage are neither reinserted nor resurrected")
+  {
+    REQUIRE(map.insert(pairs_begin, pairs_begin + num_keys) == num_keys / 2);
+    REQUIRE(map.size() == num_keys);
+
+    map.erase(keys_begin, keys_begin + num_keys / 4);
+    REQUIRE(map.size() == num_keys - num_keys / 4);
+
+    map.rehash_finish_async();
+    REQUIRE_FALSE(map.is_rehashing());
+    REQUIRE(map.size() == num_keys - num_keys / 4);
+
+    thrust::device_vector<bool> contained(num_keys);
+    map.contains(keys_begin, keys_begin + num_keys, contained.begin());
+    REQUIRE(cuco::test::none_of(
+      contained.begin(), contained.begin() + num_keys / 4, thrust::identity<bool>{}));
+    REQUIRE(cuco::test::all_of(
+      contained.begin() + num_keys / 4, contained.end(), thrust::identity<bool>{}));
+  }
+
+  SECTION("Rehash steps eventually complete the migration")
+  {
+    while (map.is_rehashing()) {
+      map.rehash_step_async();
+    }
+    REQUIRE(map.size() == num_keys / 2);
+
+    thrust::device_vector<Value> found(num_keys / 2);
+    map.find(keys_begin, keys_begin + num_keys / 2, found.begin());
+    REQUIRE(cuco::test::equal(found.begin(), found.end(), keys_begin, value_matches_key));
+  }
+}
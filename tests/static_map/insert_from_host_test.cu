@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_map.cuh>
+
+#include <cuda/functional>
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+TEST_CASE("static_map insert from host tests", "")
+{
+  using Key      = int32_t;
+  using Value    = int32_t;
+  using map_type = cuco::static_map<Key, Value>;
+  using pair     = cuco::pair<Key, Value>;
+
+  constexpr std::size_t num_keys{100'000};
+
+  auto const chunk_size = GENERATE(std::size_t{1'000}, std::size_t{30'000}, num_keys * 2);
+  auto const num_stages = GENERATE(1, 3);
+  INFO("chunk_size=" << chunk_size);
+  INFO("num_stages=" << num_stages);
+
+  cudaStream_t stream;
+  CUCO_CUDA_TRY(cudaStreamCreate(&stream));
+
+  {
+    auto map = map_type{num_keys * 2,
+                        cuco::empty_key<Key>{-1},
+                        cuco::empty_value<Value>{-1},
+                        {},
+                        {},
+                        {},
+                        {},
+                        {},
+                        stream};
+
+    std::vector<pair> pairs(num_keys);
+    for (std::size_t i = 0; i < num_keys; ++i) {
+      pairs[i] = pair{static_cast<Key>(i), static_cast<Value>(i * 2)};
+    }
+
+    auto const keys_begin = thrust::counting_iterator<Key>{0};
+    thrust::device_vector<Value> found(num_keys);
+
+    auto const check_contents = [&]() {
+      REQUIRE(map.size(stream) == num_keys);
+      map.find(keys_begin, keys_begin + num_keys, found.begin(), stream);
+      auto const expected = thrust::make_transform_iterator(
+        keys_begin, cuda::proclaim_return_type<Value>([] __device__(Key k) { return k * 2; }));
+      REQUIRE(cuco::test::equal(found.begin(), found.end(), expected, thrust::equal_to<Value>{}));
+    };
+
+    SECTION("Pageable host input is staged through pinned buffers")
+    {
+      REQUIRE(map.insert_from_host(pairs.begin(), pairs.end(), chunk_size, num_stages, stream) ==
+              num_keys);
+      check_contents();
+
+      // Keys already present are not inserted again
+      REQUIRE(map.insert_from_host(pairs.begin(), pairs.end(), chunk_size, num_stages, stream) ==
+              0);
+      check_contents();
+    }
+
+    SECTION("Pinned host input is copied directly")
+    {
+      pair* pinned;
+      CUCO_CUDA_TRY(cudaMallocHost(&pinned, sizeof(pair) * num_keys));
+      std::copy(pairs.begin(), pairs.end(), pinned);
+
+      REQUIRE(map.insert_from_host(pinned, pinned + num_keys, chunk_size, num_stages, stream) ==
+              num_keys);
+      check_contents();
+
+      CUCO_CUDA_TRY(cudaFreeHost(pinned));
+    }
+
+    SECTION("Empty input and invalid pipeline parameters")
+    {
+      REQUIRE(map.insert_from_host(pairs.begin(), pairs.begin(), chunk_size, num_stages, stream) ==
+              0);
+      REQUIRE_THROWS_AS(map.insert_from_host(pairs.begin(), pairs.end(), 0, num_stages, stream),
+                        std::invalid_argument);
+      REQUIRE_THROWS_AS(map.insert_from_host(pairs.begin(), pairs.end(), chunk_size, 0, stream),
+                        std::invalid_argument);
+    }
+  }
+
+  CUCO_CUDA_TRY(cudaStreamDestroy(stream));
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cuco/static_map.cuh>
+#include <cuco/utility/reduction_functors.cuh>
+
+#include <cuda/functional>
+#include <thrust/device_vector.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <cstddef>
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("static_map tracked size test", "")
+{
+  using Key   = int;
+  using Value = int;
+
+  constexpr std::size_t num_keys{400};
+
+  cuco::static_map<Key, Value> map{cuco::extent<std::size_t>{800},
+                                   cuco::empty_key<Key>{-1},
+                                   cuco::empty_value<Value>{-1},
+                                   cuco::erased_key<Key>{-2}};
+
+  auto const keys_begin  = thrust::counting_iterator<Key>{0};
+  auto const pairs_begin = thrust::make_transform_iterator(
+    keys_begin, cuda::proclaim_return_type<cuco::pair<Key, Value>>([] __device__(auto i) {
+      return cuco::pair<Key, Value>{i, i};
+    }));
+
+  // keys inserted before enabling tracking are accounted for
+  map.insert(pairs_begin, pairs_begin + num_keys / 2);
+  map.enable_size_tracking();
+  REQUIRE(map.size() == num_keys / 2);
+
+  SECTION("Insert and erase update the counter")
+  {
+    // half of the keys are duplicates
+    map.insert_async(pairs_begin, pairs_begin + num_keys);
+    REQUIRE(map.size() == num_keys);
+    REQUIRE(map.size() == map.count(keys_begin, keys_begin + num_keys));
+
+    // all keys are duplicates
+    map.insert(pairs_begin, pairs_begin + num_keys);
+    REQUIRE(map.size() == num_keys);
+
+    map.erase(keys_begin, keys_begin + num_keys / 4);
+    REQUIRE(map.size() == num_keys - num_keys / 4);
+    REQUIRE(map.size() == map.count(keys_begin, keys_begin + num_keys));
+  }
+
+  SECTION("Insert or assign and insert or apply only count new keys")
+  {
+    map.insert_or_assign(pairs_begin, pairs_begin + num_keys);
+    REQUIRE(map.size() == num_keys);
+
+    map.insert_or_apply(pairs_begin, pairs_begin + 2 * num_keys / 3, cuco::reduce::plus{});
+    REQUIRE(map.size() == num_keys);
+    REQUIRE(map.size() == map.count(keys_begin, keys_begin + num_keys));
+  }
+
+  SECTION("Stream-ordered size is written to device memory")
+  {
+    thrust::device_vector<std::size_t> d_size(1);
+    map.size_async(d_size.data().get());
+    REQUIRE(d_size[0] == num_keys / 2);
+  }
+}
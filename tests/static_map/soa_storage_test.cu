@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_map.cuh>
+#include <cuco/storage.cuh>
+
+#include <cuda/functional>
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/sort.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+using size_type = int32_t;
+
+TEMPLATE_TEST_CASE_SIG(
+  "static_map struct of arrays storage tests",
+  "",
+  ((typename Key, typename Value, int CGSize, int BucketSize), Key, Value, CGSize, BucketSize),
+  (int32_t, int32_t, 1, 1),
+  (int32_t, int64_t, 1, 2),
+  (int64_t, int32_t, 2, 1),
+  (int64_t, int64_t, 2, 2))
+{
+  constexpr size_type num_keys{10'000};
+
+  using probe = cuco::linear_probing<CGSize, cuco::default_hash_function<Key>>;
+
+  auto map = cuco::static_map<Key,
+                              Value,
+                              cuco::extent<size_type>,
+                              cuda::thread_scope_device,
+                              thrust::equal_to<Key>,
+                              probe,
+                              cuco::cuda_allocator<cuda::std::byte>,
+                              cuco::soa_storage<BucketSize>>{
+    num_keys * 2,
+    cuco::empty_key<Key>{-1},
+    cuco::empty_value<Value>{-1},
+    cuco::erased_key<Key>{-2}};
+
+  auto const keys_begin  = thrust::counting_iterator<Key>{0};
+  auto const pairs_begin = thrust::make_transform_iterator(
+    keys_begin, cuda::proclaim_return_type<cuco::pair<Key, Value>>([] __device__(Key key) {
+      return cuco::pair<Key, Value>{key, static_cast<Value>(key * 2)};
+    }));
+  auto const value_matches_key = cuda::proclaim_return_type<bool>(
+    [] __device__(Value value, Key key) { return value == static_cast<Value>(key * 2); });
+
+  map.insert(pairs_begin, pairs_begin + num_keys);
+  REQUIRE(map.size() == num_keys);
+
+  SECTION("Duplicates are not inserted")
+  {
+    REQUIRE(map.insert(pairs_begin, pairs_begin + num_keys) == 0);
+    REQUIRE(map.size() == num_keys);
+  }
+
+  SECTION("Inserted keys are found with their payloads")
+  {
+    thrust::device_vector<bool> contained(num_keys * 2);
+    map.contains(keys_begin, keys_begin + num_keys * 2, contained.begin());
+    REQUIRE(cuco::test::all_of(
+      contained.begin(), contained.begin() + num_keys, thrust::identity<bool>{}));
+    REQUIRE(
+      cuco::test::none_of(contained.begin() + num_keys, contained.end(), thrust::identity<bool>{}));
+
+    thrust::device_vector<Value> found(num_keys);
+    map.find(keys_begin, keys_begin + num_keys, found.begin());
+    REQUIRE(cuco::test::equal(found.begin(), found.end(), keys_begin, value_matches_key));
+
+    REQUIRE(map.count(keys_begin, keys_begin + num_keys * 2) == num_keys);
+  }
+
+  SECTION("Erased keys are no longer contained")
+  {
+    map.erase(keys_begin, keys_begin + num_keys / 2);
+    REQUIRE(map.size() == num_keys / 2);
+
+    thrust::device_vector<bool> contained(num_keys);
+    map.contains(keys_begin, keys_begin + num_keys, contained.begin());
+    REQUIRE(cuco::test::none_of(
+      contained.begin(), contained.begin() + num_keys / 2, thrust::identity<bool>{}));
+    REQUIRE(cuco::test::all_of(
+      contained.begin() + num_keys / 2, contained.end(), thrust::identity<bool>{}));
+  }
+
+  SECTION("Rehashing and retrieving preserve all pairs")
+  {
+    map.rehash(num_keys * 4);
+    REQUIRE(map.size() == num_keys);
+
+    thrust::device_vector<Key> keys(num_keys);
+    thrust::device_vector<Value> values(num_keys);
+    map.retrieve_all(keys.begin(), values.begin());
+    thrust::sort_by_key(keys.begin(), keys.end(), values.begin());
+
+    REQUIRE(cuco::test::equal(keys.begin(), keys.end(), keys_begin, thrust::equal_to<Key>{}));
+    REQUIRE(cuco::test::equal(values.begin(), values.end(), keys.begin(), value_matches_key));
+  }
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_multimap.cuh>
+
+#include <cuda/functional>
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/sort.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+TEST_CASE("static_multimap CUDA graph capture tests", "")
+{
+  using Key       = int32_t;
+  using Value     = int32_t;
+  using map_type  = cuco::experimental::static_multimap<Key, Value>;
+  using size_type = map_type::size_type;
+
+  constexpr std::size_t num_keys{10'000};
+  constexpr std::size_t multiplicity{2};
+
+  cudaStream_t stream;
+  CUCO_CUDA_TRY(cudaStreamCreate(&stream));
+
+  {
+    auto map = map_type{num_keys * multiplicity * 2,
+                        cuco::empty_key<Key>{-1},
+                        cuco::empty_value<Value>{-1},
+                        {},
+                        {},
+                        {},
+                        {},
+                        {},
+                        stream};
+
+    auto const keys_begin  = thrust::counting_iterator<Key>{0};
+    auto const pairs_begin = thrust::make_transform_iterator(
+      thrust::counting_iterator<std::size_t>{0},
+      cuda::proclaim_return_type<cuco::pair<Key, Value>>([] __device__(auto i) {
+        return cuco::pair<Key, Value>{i % num_keys, i};
+      }));
+    // every key repeated `multiplicity` times, in sorted order
+    auto const expected_begin = thrust::make_transform_iterator(
+      thrust::counting_iterator<std::size_t>{0},
+      cuda::proclaim_return_type<Key>([] __device__(auto i) { return i / multiplicity; }));
+
+    thrust::device_vector<size_type> d_count(1);
+    thrust::device_vector<Key> probes(num_keys * multiplicity);
+    thrust::device_vector<cuco::pair<Key, Value>> matches(num_keys * multiplicity);
+
+    // The number of retrieved pairs is accumulated in pinned host memory
+    size_type* h_num_retrieved;
+    CUCO_CUDA_TRY(cudaMallocHost(&h_num_retrieved, sizeof(size_type)));
+    CUCO_CUDA_TRY(cudaStreamSynchronize(stream));
+
+    cudaGraph_t graph;
+    CUCO_CUDA_TRY(cudaStreamBeginCapture(stream, cudaStreamCaptureModeGlobal));
+    map.clear_async(stream);
+    map.insert_async(pairs_begin, pairs_begin + num_keys * multiplicity, stream);
+    map.count_async(keys_begin, keys_begin + 2 * num_keys, d_count.data().get(), stream);
+    map.retrieve_async(keys_begin,
+                       keys_begin + 2 * num_keys,
+                       probes.begin(),
+                       matches.begin(),
+                       h_num_retrieved,
+                       stream);
+    CUCO_CUDA_TRY(cudaStreamEndCapture(stream, &graph));
+
+    cudaGraphExec_t graph_exec;
+    CUCO_CUDA_TRY(cudaGraphInstantiate(&graph_exec, graph, 0));
+
+    for (int i = 0; i < 3; ++i) {
+      CUCO_CUDA_TRY(cudaGraphLaunch(graph_exec, stream));
+      CUCO_CUDA_TRY(cudaStreamSynchronize(stream));
+
+      REQUIRE(d_count[0] == num_keys * multiplicity);
+      REQUIRE(*h_num_retrieved == num_keys * multiplicity);
+
+      thrust::sort(probes.begin(), probes.end());
+      REQUIRE(
+        cuco::test::equal(probes.begin(), probes.end(), expected_begin, thrust::equal_to<Key>{}));
+    }
+
+    CUCO_CUDA_TRY(cudaGraphExecDestroy(graph_exec));
+    CUCO_CUDA_TRY(cudaGraphDestroy(graph));
+    CUCO_CUDA_TRY(cudaFreeHost(h_num_retrieved));
+  }
+
+  CUCO_CUDA_TRY(cudaStreamDestroy(stream));
+}
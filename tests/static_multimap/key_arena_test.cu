@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cuco/key_arena.cuh>
+#include <cuco/static_multimap.cuh>
+
+#include <cuda/functional>
+#include <thrust/device_vector.h>
+#include <thrust/host_vector.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+// Builds Arrow-style offsets and chars from a list of strings
+std::pair<thrust::device_vector<std::int32_t>, thrust::device_vector<char>> make_arena(
+  std::vector<std::string> const& strings)
+{
+  thrust::host_vector<std::int32_t> offsets{0};
+  thrust::host_vector<char> chars;
+  for (auto const& s : strings) {
+    chars.insert(chars.end(), s.begin(), s.end());
+    offsets.push_back(static_cast<std::int32_t>(chars.size()));
+  }
+  return {offsets, chars};
+}
+}  // namespace
+
+TEMPLATE_TEST_CASE_SIG("static_multimap key arena tests", "", ((int CGSize), CGSize), (1), (2))
+{
+  using probe_type = cuco::double_hashing<CGSize, cuco::arena_key_hash, cuco::arena_key_hash>;
+
+  // long keys exercise the 16-byte hashing and comparison path
+  std::vector<std::string> const build_strings{"apple",
+                                               "banana",
+                                               "apple",
+                                               "",
+                                               "a considerably longer key spanning chunks",
+                                               "banana",
+                                               ""};
+  std::vector<std::string> const probe_strings{
+    "banana", "cherry", "", "apple!", "a considerably longer key spanning chunks", "appl"};
+  std::vector<bool> const expected_contained{true, false, true, false, true, false};
+  constexpr std::size_t num_matches = 5;
+
+  auto const [build_offsets, build_chars] = make_arena(build_strings);
+  auto const [probe_offsets, probe_chars] = make_arena(probe_strings);
+
+  auto const build_arena =
+    cuco::key_arena_ref{build_offsets.data().get(), build_chars.data().get()};
+  auto const probe_arena =
+    cuco::key_arena_ref{probe_offsets.data().get(), probe_chars.data().get()};
+
+  auto map = cuco::experimental::static_multimap{
+    build_strings.size() * 2,
+    cuco::empty_key{cuco::arena_key::empty_sentinel()},
+    cuco::empty_value{std::int32_t{-1}},
+    cuco::arena_key_equal{build_arena},
+    probe_type{cuco::arena_key_hash{0}, cuco::arena_key_hash{1}}};
+
+  // each key maps to the row it was built from
+  auto const pairs_begin = thrust::make_transform_iterator(
+    thrust::counting_iterator<std::uint32_t>{0},
+    cuda::proclaim_return_type<cuco::pair<cuco::arena_key, std::int32_t>>(
+      [build_arena] __device__(std::uint32_t i) {
+        return cuco::pair<cuco::arena_key, std::int32_t>{build_arena.key(i),
+                                                          static_cast<std::int32_t>(i)};
+      }));
+  map.insert(pairs_begin, pairs_begin + build_strings.size());
+
+  SECTION("Duplicate keys are all kept")
+  {
+    REQUIRE(map.size() == build_strings.size());
+  }
+
+  SECTION("Keys from a different arena can be used as probe keys")
+  {
+    auto const probe_keys = probe_arena.probe_keys_begin();
+    thrust::device_vector<bool> contained(probe_strings.size());
+    map.contains(probe_keys, probe_keys + probe_strings.size(), contained.begin());
+
+    thrust::host_vector<bool> const h_contained = contained;
+    for (std::size_t i = 0; i < probe_strings.size(); ++i) {
+      REQUIRE(h_contained[i] == expected_contained[i]);
+    }
+  }
+
+  SECTION("Count matches every row with identical content")
+  {
+    auto const probe_keys = probe_arena.probe_keys_begin();
+    REQUIRE(map.count(probe_keys, probe_keys + probe_strings.size()) == num_matches);
+  }
+}
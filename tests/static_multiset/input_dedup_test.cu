@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_multiset.cuh>
+
+#include <cuda/functional>
+#include <thrust/device_vector.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/sequence.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+using size_type = int32_t;
+
+TEMPLATE_TEST_CASE_SIG(
+  "static_multiset input deduplication tests",
+  "",
+  ((typename Key, cuco::test::probe_sequence Probe, int CGSize), Key, Probe, CGSize),
+  (int32_t, cuco::test::probe_sequence::double_hashing, 1),
+  (int32_t, cuco::test::probe_sequence::double_hashing, 2),
+  (int64_t, cuco::test::probe_sequence::double_hashing, 1),
+  (int64_t, cuco::test::probe_sequence::double_hashing, 2),
+  (int32_t, cuco::test::probe_sequence::linear_probing, 1),
+  (int32_t, cuco::test::probe_sequence::linear_probing, 2),
+  (int64_t, cuco::test::probe_sequence::linear_probing, 1),
+  (int64_t, cuco::test::probe_sequence::linear_probing, 2))
+{
+  constexpr size_type num_keys{555};
+  constexpr size_type multiplicity{3};
+
+  using probe = std::conditional_t<Probe == cuco::test::probe_sequence::linear_probing,
+                                   cuco::linear_probing<CGSize, cuco::default_hash_function<Key>>,
+                                   cuco::double_hashing<CGSize, cuco::default_hash_function<Key>>>;
+
+  // room for the inserted keys and all their copies
+  auto set = cuco::static_multiset{num_keys * (multiplicity + 1) * 2,
+                                   cuco::empty_key<Key>{-1},
+                                   {},
+                                   probe{},
+                                   {},
+                                   cuco::storage<2>{}};
+
+  thrust::device_vector<Key> d_keys(num_keys);
+  thrust::sequence(d_keys.begin(), d_keys.end());
+  set.insert(d_keys.begin(), d_keys.end());
+
+  set.set_input_deduplication(true);
+  REQUIRE(set.input_deduplication());
+
+  auto query_begin = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    cuda::proclaim_return_type<Key>([] __device__(auto i) { return Key{i / multiplicity}; }));
+
+  SECTION("Count of 3n unique keys with input deduplication should be 3n.")
+  {
+    auto const count = set.count(query_begin, query_begin + num_keys * multiplicity);
+    REQUIRE(count == num_keys * multiplicity);
+  }
+
+  SECTION("Every copy of a key is inserted with input deduplication.")
+  {
+    set.insert(query_begin, query_begin + num_keys * multiplicity);
+    REQUIRE(set.size() == num_keys * (multiplicity + 1));
+  }
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cuco/static_multiset.cuh>
+
+#include <cuda/functional>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <cstddef>
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("static_multiset tracked size test", "")
+{
+  using Key = int;
+
+  constexpr std::size_t num_keys{400};
+
+  cuco::static_multiset<Key> set{cuco::extent<std::size_t>{1600}, cuco::empty_key<Key>{-1}};
+
+  auto const keys_begin = thrust::counting_iterator<Key>{0};
+
+  // keys inserted before enabling tracking are accounted for
+  set.insert(keys_begin, keys_begin + num_keys / 2);
+  set.enable_size_tracking();
+  REQUIRE(set.size() == num_keys / 2);
+
+  SECTION("Inserting duplicates updates the counter")
+  {
+    set.insert_async(keys_begin, keys_begin + num_keys);
+    REQUIRE(set.size() == num_keys / 2 + num_keys);
+    REQUIRE(set.size() == set.count(keys_begin, keys_begin + num_keys));
+
+    // every key is inserted once more
+    set.insert(keys_begin, keys_begin + num_keys);
+    REQUIRE(set.size() == num_keys / 2 + 2 * num_keys);
+    REQUIRE(set.size() == set.count(keys_begin, keys_begin + num_keys));
+  }
+
+  SECTION("Insert if only counts inserted keys")
+  {
+    auto const is_even = thrust::make_transform_iterator(
+      keys_begin, cuda::proclaim_return_type<bool>([] __device__(auto i) { return i % 2 == 0; }));
+    set.insert_if_async(keys_begin, keys_begin + num_keys, is_even, thrust::identity{});
+    REQUIRE(set.size() == num_keys / 2 + num_keys / 2);
+    REQUIRE(set.size() == set.count(keys_begin, keys_begin + num_keys));
+  }
+
+  SECTION("Clear resets the counter")
+  {
+    set.clear();
+    REQUIRE(set.size() == 0);
+  }
+}
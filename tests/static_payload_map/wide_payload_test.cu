@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_payload_map.cuh>
+
+#include <cuda/atomic>
+#include <cuda/functional>
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+
+using size_type = std::size_t;
+
+// 32-byte payload, too wide for `cuco::static_map`
+struct wide_row {
+  int64_t a;
+  int64_t b;
+  int64_t c;
+  int64_t d;
+};
+
+struct make_row {
+  __device__ wide_row operator()(int64_t i) const noexcept { return wide_row{i, 2 * i, 3 * i, 1}; }
+};
+
+struct row_matches_key {
+  __device__ bool operator()(wide_row const& row, int32_t key) const noexcept
+  {
+    return row.a == key and row.b == 2 * key and row.c == 3 * key and row.d == 1;
+  }
+
+  __device__ bool operator()(int32_t key, wide_row const& row) const noexcept
+  {
+    return (*this)(row, key);
+  }
+};
+
+// Field-wise atomic sum
+struct row_plus {
+  __device__ void operator()(wide_row& stored, wide_row const& input) const noexcept
+  {
+    cuda::atomic_ref<int64_t, cuda::thread_scope_device>{stored.a}.fetch_add(
+      input.a, cuda::memory_order_relaxed);
+    cuda::atomic_ref<int64_t, cuda::thread_scope_device>{stored.b}.fetch_add(
+      input.b, cuda::memory_order_relaxed);
+    cuda::atomic_ref<int64_t, cuda::thread_scope_device>{stored.c}.fetch_add(
+      input.c, cuda::memory_order_relaxed);
+    cuda::atomic_ref<int64_t, cuda::thread_scope_device>{stored.d}.fetch_add(
+      input.d, cuda::memory_order_relaxed);
+  }
+};
+
+TEMPLATE_TEST_CASE_SIG("static_payload_map wide payload tests",
+                       "",
+                       ((int CGSize), CGSize),
+                       (1),
+                       (2))
+{
+  using probe_type = cuco::linear_probing<CGSize, cuco::default_hash_function<int32_t>>;
+
+  constexpr size_type num_keys{1'000};
+
+  auto map = cuco::static_payload_map{num_keys * 2,
+                                      cuco::empty_key<int32_t>{-1},
+                                      cuco::empty_value<wide_row>{wide_row{0, 0, 0, 0}},
+                                      thrust::equal_to<int32_t>{},
+                                      probe_type{}};
+
+  auto const keys_begin = thrust::counting_iterator<int32_t>{0};
+  auto const rows_begin =
+    thrust::make_transform_iterator(thrust::counting_iterator<int64_t>{0}, make_row{});
+
+  SECTION("Inserted payloads can be found")
+  {
+    REQUIRE(map.insert(keys_begin, keys_begin + num_keys, rows_begin) == num_keys);
+    // duplicates neither overwrite nor count
+    REQUIRE(map.insert(keys_begin, keys_begin + num_keys, rows_begin) == 0);
+    REQUIRE(map.size() == num_keys);
+
+    thrust::device_vector<wide_row> found(num_keys * 2);
+    map.find(keys_begin, keys_begin + num_keys * 2, found.begin());
+
+    REQUIRE(
+      cuco::test::equal(found.begin(), found.begin() + num_keys, keys_begin, row_matches_key{}));
+    REQUIRE(cuco::test::all_of(
+      found.begin() + num_keys,
+      found.end(),
+      cuda::proclaim_return_type<bool>([] __device__(wide_row const& row) {
+        return row.a == 0 and row.b == 0 and row.c == 0 and row.d == 0;
+      })));
+  }
+
+  SECTION("All inserted rows are retrieved")
+  {
+    map.insert(keys_begin, keys_begin + num_keys, rows_begin);
+
+    thrust::device_vector<int32_t> keys(num_keys);
+    thrust::device_vector<wide_row> rows(num_keys);
+    auto const [keys_end, rows_end] = map.retrieve_all(keys.begin(), rows.begin());
+    REQUIRE(std::distance(keys.begin(), keys_end) == num_keys);
+    REQUIRE(std::distance(rows.begin(), rows_end) == num_keys);
+
+    REQUIRE(cuco::test::equal(keys.begin(), keys.end(), rows.begin(), row_matches_key{}));
+  }
+
+  SECTION("Wide payloads are aggregated with insert_or_apply")
+  {
+    constexpr size_type num_unique{100};
+    auto const dup_keys = thrust::make_transform_iterator(
+      thrust::counting_iterator<int32_t>{0},
+      cuda::proclaim_return_type<int32_t>([] __device__(int32_t i) { return i % num_unique; }));
+    auto const ones = thrust::constant_iterator<wide_row>{wide_row{1, 1, 1, 1}};
+
+    map.insert_or_apply(dup_keys, dup_keys + num_keys, ones, row_plus{});
+    REQUIRE(map.size() == num_unique);
+
+    thrust::device_vector<wide_row> found(num_unique);
+    map.find(keys_begin, keys_begin + num_unique, found.begin());
+
+    auto constexpr expected = static_cast<int64_t>(num_keys / num_unique);
+    REQUIRE(cuco::test::all_of(
+      found.begin(), found.end(), cuda::proclaim_return_type<bool>([] __device__(wide_row row) {
+        return row.a == expected and row.b == expected and row.c == expected and
+               row.d == expected;
+      })));
+  }
+
+  SECTION("Erase requires an erased key sentinel")
+  {
+    REQUIRE_THROWS_AS(map.erase(keys_begin, keys_begin + num_keys), std::logic_error);
+  }
+
+  SECTION("Erased keys are reinserted with an empty payload")
+  {
+    auto erasable_map = cuco::static_payload_map{num_keys * 2,
+                                                 cuco::empty_key<int32_t>{-1},
+                                                 cuco::empty_value<wide_row>{wide_row{0, 0, 0, 0}},
+                                                 cuco::erased_key<int32_t>{-2},
+                                                 thrust::equal_to<int32_t>{},
+                                                 probe_type{}};
+    auto const ones = thrust::constant_iterator<wide_row>{wide_row{1, 1, 1, 1}};
+
+    erasable_map.insert_or_apply(keys_begin, keys_begin + num_keys, ones, row_plus{});
+    erasable_map.erase(keys_begin, keys_begin + num_keys / 2);
+    REQUIRE(erasable_map.size() == num_keys / 2);
+
+    thrust::device_vector<bool> contained(num_keys);
+    erasable_map.contains(keys_begin, keys_begin + num_keys, contained.begin());
+    REQUIRE(cuco::test::none_of(
+      contained.begin(), contained.begin() + num_keys / 2, thrust::identity{}));
+    REQUIRE(
+      cuco::test::all_of(contained.begin() + num_keys / 2, contained.end(), thrust::identity{}));
+
+    thrust::device_vector<int32_t> keys(num_keys);
+    thrust::device_vector<wide_row> rows(num_keys);
+    auto const [keys_end, rows_end] = erasable_map.retrieve_all(keys.begin(), rows.begin());
+    REQUIRE(std::distance(keys.begin(), keys_end) == num_keys / 2);
+
+    // erased keys start over from the empty value while kept keys accumulate
+    erasable_map.insert_or_apply(keys_begin, keys_begin + num_keys, ones, row_plus{});
+    REQUIRE(erasable_map.size() == num_keys);
+
+    thrust::device_vector<wide_row> found(num_keys);
+    erasable_map.find(keys_begin, keys_begin + num_keys, found.begin());
+    REQUIRE(cuco::test::all_of(found.begin(),
+                               found.begin() + num_keys / 2,
+                               cuda::proclaim_return_type<bool>([] __device__(wide_row row) {
+                                 return row.a == 1 and row.b == 1 and row.c == 1 and row.d == 1;
+                               })));
+    REQUIRE(cuco::test::all_of(found.begin() + num_keys / 2,
+                               found.end(),
+                               cuda::proclaim_return_type<bool>([] __device__(wide_row row) {
+                                 return row.a == 2 and row.b == 2 and row.c == 2 and row.d == 2;
+                               })));
+  }
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_set.cuh>
+#include <cuco/utility/async_result.hpp>
+
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sort.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+TEST_CASE("static_set asynchronous result tests", "")
+{
+  using Key = int32_t;
+
+  constexpr std::size_t num_keys{10'000};
+
+  cudaStream_t stream;
+  CUCO_CUDA_TRY(cudaStreamCreate(&stream));
+
+  {
+    using set_type  = cuco::static_set<Key>;
+    using size_type = set_type::size_type;
+
+    auto set = set_type{num_keys * 2, cuco::empty_key<Key>{-1}, {}, {}, {}, {}, {}, stream};
+
+    auto const keys_begin = thrust::counting_iterator<Key>{0};
+    set.insert_async(keys_begin, keys_begin + num_keys, stream);
+
+    SECTION("Handles hold the results until get()")
+    {
+      auto size      = set.size_async(stream);
+      auto num_found = set.count_async(keys_begin, keys_begin + 2 * num_keys, stream);
+      REQUIRE(size.get() == num_keys);
+      REQUIRE(num_found.get() == num_keys);
+      REQUIRE(num_found.ready());
+
+      auto empty_count = set.count_async(keys_begin, keys_begin, stream);
+      REQUIRE(empty_count.get() == 0);
+    }
+
+    SECTION("Results written to device memory chain without host synchronization")
+    {
+      thrust::device_vector<size_type> d_results(2);
+      set.count_async(keys_begin, keys_begin + 2 * num_keys, d_results.data().get(), stream);
+
+      thrust::device_vector<Key> probes(num_keys);
+      thrust::device_vector<Key> matches(num_keys);
+      set.retrieve_async(keys_begin,
+                         keys_begin + 2 * num_keys,
+                         probes.begin(),
+                         matches.begin(),
+                         d_results.data().get() + 1,
+                         stream);
+      CUCO_CUDA_TRY(cudaStreamSynchronize(stream));
+
+      REQUIRE(d_results[0] == num_keys);
+      REQUIRE(d_results[1] == num_keys);
+
+      thrust::sort(matches.begin(), matches.end());
+      REQUIRE(
+        cuco::test::equal(matches.begin(), matches.end(), keys_begin, thrust::equal_to<Key>{}));
+    }
+
+    SECTION("Retrieving all keys returns a handle to the output size")
+    {
+      thrust::device_vector<Key> retrieved(num_keys);
+      auto num_retrieved = set.retrieve_all_async(retrieved.begin(), stream);
+      REQUIRE(num_retrieved.get() == num_keys);
+
+      thrust::sort(retrieved.begin(), retrieved.end());
+      REQUIRE(
+        cuco::test::equal(retrieved.begin(), retrieved.end(), keys_begin, thrust::equal_to<Key>{}));
+    }
+  }
+
+  SECTION("Handles are movable")
+  {
+    auto result    = cuco::async_result<int32_t>{};
+    *result.data() = 42;
+    result.record(stream);
+
+    auto moved = std::move(result);
+    REQUIRE(moved.get() == 42);
+  }
+
+  CUCO_CUDA_TRY(cudaStreamDestroy(stream));
+}
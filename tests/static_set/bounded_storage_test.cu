@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_set.cuh>
+#include <cuco/storage.cuh>
+
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <type_traits>
+
+using size_type = int32_t;
+
+TEMPLATE_TEST_CASE_SIG(
+  "static_set bounded storage tests",
+  "",
+  ((typename Key, cuco::test::probe_sequence Probe, int CGSize), Key, Probe, CGSize),
+  (int32_t, cuco::test::probe_sequence::linear_probing, 1),
+  (int32_t, cuco::test::probe_sequence::linear_probing, 2),
+  (int64_t, cuco::test::probe_sequence::linear_probing, 1),
+  (int32_t, cuco::test::probe_sequence::double_hashing, 1),
+  (int64_t, cuco::test::probe_sequence::double_hashing, 2))
+{
+  using probe = std::conditional_t<Probe == cuco::test::probe_sequence::linear_probing,
+                                   cuco::linear_probing<CGSize, cuco::default_hash_function<Key>>,
+                                   cuco::double_hashing<CGSize, cuco::default_hash_function<Key>>>;
+
+  auto set = cuco::static_set<Key,
+                              cuco::extent<size_type>,
+                              cuda::thread_scope_device,
+                              thrust::equal_to<Key>,
+                              probe,
+                              cuco::cuda_allocator<Key>,
+                              cuco::bounded_storage<2>>{
+    10'000, cuco::empty_key<Key>{-1}, cuco::erased_key<Key>{-2}};
+
+  // High occupancy makes negative lookups stop at the displacement bound rather than at an empty
+  // slot
+  auto const num_keys   = static_cast<size_type>(set.capacity() * 85 / 100);
+  auto const keys_begin = thrust::counting_iterator<Key>{0};
+
+  REQUIRE(set.insert(keys_begin, keys_begin + num_keys) == num_keys);
+  REQUIRE(set.size() == num_keys);
+
+  SECTION("Lookups find inserted keys and reject absent ones")
+  {
+    thrust::device_vector<bool> contained(num_keys * 2);
+    set.contains(keys_begin, keys_begin + num_keys * 2, contained.begin());
+    REQUIRE(cuco::test::all_of(
+      contained.begin(), contained.begin() + num_keys, thrust::identity<bool>{}));
+    REQUIRE(
+      cuco::test::none_of(contained.begin() + num_keys, contained.end(), thrust::identity<bool>{}));
+
+    thrust::device_vector<Key> found(num_keys);
+    set.find(keys_begin, keys_begin + num_keys, found.begin());
+    REQUIRE(cuco::test::equal(found.begin(), found.end(), keys_begin, thrust::equal_to<Key>{}));
+
+    REQUIRE(set.count(keys_begin, keys_begin + num_keys * 2) == num_keys);
+  }
+
+  SECTION("Erased keys are no longer contained")
+  {
+    set.erase(keys_begin, keys_begin + num_keys / 2);
+    REQUIRE(set.size() == num_keys - num_keys / 2);
+
+    thrust::device_vector<bool> contained(num_keys);
+    set.contains(keys_begin, keys_begin + num_keys, contained.begin());
+    REQUIRE(cuco::test::none_of(
+      contained.begin(), contained.begin() + num_keys / 2, thrust::identity<bool>{}));
+    REQUIRE(cuco::test::all_of(
+      contained.begin() + num_keys / 2, contained.end(), thrust::identity<bool>{}));
+  }
+
+  SECTION("Bounds are reset by clear and rebuilt by rehash")
+  {
+    set.rehash();
+    REQUIRE(set.size() == num_keys);
+    REQUIRE(set.count(keys_begin, keys_begin + num_keys * 2) == num_keys);
+
+    set.clear();
+    REQUIRE(set.size() == 0);
+    REQUIRE(set.count(keys_begin, keys_begin + num_keys) == 0);
+  }
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_set.cuh>
+
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/sort.h>
+
+#include <cuda/functional>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <type_traits>
+
+using size_type = int32_t;
+
+TEMPLATE_TEST_CASE_SIG(
+  "static_set cuckoo probing tests",
+  "",
+  ((typename Key, int CGSize, int NumHashes), Key, CGSize, NumHashes),
+  (int32_t, 1, 2),
+  (int32_t, 1, 3),
+  (int32_t, 2, 2),
+  (int64_t, 1, 3),
+  (int64_t, 2, 3))
+{
+  using hash  = cuco::default_hash_function<Key>;
+  using probe = std::conditional_t<NumHashes == 2,
+                                   cuco::cuckoo_probing<CGSize, hash>,
+                                   cuco::cuckoo_probing<CGSize, hash, hash, hash>>;
+
+  auto set = cuco::static_set<Key,
+                              cuco::extent<size_type>,
+                              cuda::thread_scope_device,
+                              thrust::equal_to<Key>,
+                              probe,
+                              cuco::cuda_allocator<Key>,
+                              cuco::storage<8>>{
+    10'000, cuco::empty_key<Key>{-1}, cuco::erased_key<Key>{-2}};
+
+  // Fills the set up to a 90% load factor, which requires displacements
+  auto const num_keys   = static_cast<size_type>(set.capacity() * 9 / 10);
+  auto const keys_begin = thrust::counting_iterator<Key>{0};
+
+  REQUIRE(set.insert(keys_begin, keys_begin + num_keys) == num_keys);
+  REQUIRE(set.size() == num_keys);
+
+  SECTION("Duplicates are not inserted")
+  {
+    REQUIRE(set.insert(keys_begin, keys_begin + num_keys) == 0);
+    REQUIRE(set.size() == num_keys);
+  }
+
+  SECTION("All keys remain reachable after displacements")
+  {
+    thrust::device_vector<bool> contained(num_keys * 2);
+    set.contains(keys_begin, keys_begin + num_keys * 2, contained.begin());
+    REQUIRE(cuco::test::all_of(
+      contained.begin(), contained.begin() + num_keys, thrust::identity<bool>{}));
+    REQUIRE(
+      cuco::test::none_of(contained.begin() + num_keys, contained.end(), thrust::identity<bool>{}));
+
+    thrust::device_vector<Key> found(num_keys);
+    set.find(keys_begin, keys_begin + num_keys, found.begin());
+    REQUIRE(cuco::test::equal(found.begin(), found.end(), keys_begin, thrust::equal_to<Key>{}));
+
+    thrust::device_vector<Key> keys(num_keys);
+    set.retrieve_all(keys.begin());
+    thrust::sort(keys.begin(), keys.end());
+    REQUIRE(cuco::test::equal(keys.begin(), keys.end(), keys_begin, thrust::equal_to<Key>{}));
+  }
+
+  SECTION("Erased keys are no longer contained")
+  {
+    set.erase(keys_begin, keys_begin + num_keys / 2);
+    REQUIRE(set.size() == num_keys - num_keys / 2);
+
+    thrust::device_vector<bool> contained(num_keys);
+    set.contains(keys_begin, keys_begin + num_keys, contained.begin());
+    REQUIRE(cuco::test::none_of(
+      contained.begin(), contained.begin() + num_keys / 2, thrust::identity<bool>{}));
+    REQUIRE(cuco::test::all_of(
+      contained.begin() + num_keys / 2, contained.end(), thrust::identity<bool>{}));
+  }
+}
+
+TEMPLATE_TEST_CASE_SIG(
+  "static_set cuckoo probing concurrent duplicate inserts",
+  "",
+  ((typename Key, int CGSize, int NumHashes), Key, CGSize, NumHashes),
+  (int32_t, 1, 2),
+  (int32_t, 1, 3),
+  (int32_t, 2, 2),
+  (int64_t, 1, 3),
+  (int64_t, 2, 3))
+{
+  using hash  = cuco::default_hash_function<Key>;
+  using probe = std::conditional_t<NumHashes == 2,
+                                   cuco::cuckoo_probing<CGSize, hash>,
+                                   cuco::cuckoo_probing<CGSize, hash, hash, hash>>;
+
+  auto set = cuco::static_set<Key,
+                              cuco::extent<size_type>,
+                              cuda::thread_scope_device,
+                              thrust::equal_to<Key>,
+                              probe,
+                              cuco::cuda_allocator<Key>,
+                              cuco::storage<8>>{
+    10'000, cuco::empty_key<Key>{-1}, cuco::erased_key<Key>{-2}};
+
+  // Neighboring threads insert the same key, up to a 95% load factor which requires
+  // displacements
+  constexpr size_type multiplicity = 4;
+  auto const num_keys              = static_cast<size_type>(set.capacity() * 95 / 100);
+  auto const keys_begin            = thrust::counting_iterator<Key>{0};
+  auto const inputs_begin          = thrust::make_transform_iterator(
+    keys_begin, cuda::proclaim_return_type<Key>([] __device__(Key i) { return i / multiplicity; }));
+
+  REQUIRE(set.insert(inputs_begin, inputs_begin + num_keys * multiplicity) == num_keys);
+  REQUIRE(set.size() == num_keys);
+
+  thrust::device_vector<Key> keys(num_keys);
+  auto const keys_end = set.retrieve_all(keys.begin());
+  REQUIRE(static_cast<size_type>(keys_end - keys.begin()) == num_keys);
+  thrust::sort(keys.begin(), keys.end());
+  REQUIRE(cuco::test::equal(keys.begin(), keys.end(), keys_begin, thrust::equal_to<Key>{}));
+}
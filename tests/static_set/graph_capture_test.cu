@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_set.cuh>
+#include <cuco/utility/allocator.hpp>
+
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sort.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+TEST_CASE("static_set CUDA graph capture tests", "")
+{
+  using Key = int32_t;
+
+  constexpr std::size_t num_keys{10'000};
+
+  cudaStream_t stream;
+  CUCO_CUDA_TRY(cudaStreamCreate(&stream));
+
+  auto const keys_begin = thrust::counting_iterator<Key>{0};
+
+  SECTION("Captured bulk operations produce the eager results on every replay")
+  {
+    using set_type  = cuco::static_set<Key>;
+    using size_type = set_type::size_type;
+
+    auto set = set_type{num_keys * 2, cuco::empty_key<Key>{-1}, {}, {}, {}, {}, {}, stream};
+
+    thrust::device_vector<size_type> d_results(3);
+    thrust::device_vector<bool> d_contained(2 * num_keys);
+    thrust::device_vector<Key> probes(num_keys);
+    thrust::device_vector<Key> matches(num_keys);
+    CUCO_CUDA_TRY(cudaStreamSynchronize(stream));
+
+    cudaGraph_t graph;
+    CUCO_CUDA_TRY(cudaStreamBeginCapture(stream, cudaStreamCaptureModeGlobal));
+    set.clear_async(stream);
+    set.insert_async(keys_begin, keys_begin + num_keys, stream);
+    set.size_async(d_results.data().get(), stream);
+    set.contains_async(keys_begin, keys_begin + 2 * num_keys, d_contained.begin(), stream);
+    set.count_async(keys_begin, keys_begin + 2 * num_keys, d_results.data().get() + 1, stream);
+    set.retrieve_async(keys_begin,
+                       keys_begin + 2 * num_keys,
+                       probes.begin(),
+                       matches.begin(),
+                       d_results.data().get() + 2,
+                       stream);
+    CUCO_CUDA_TRY(cudaStreamEndCapture(stream, &graph));
+
+    cudaGraphExec_t graph_exec;
+    CUCO_CUDA_TRY(cudaGraphInstantiate(&graph_exec, graph, 0));
+
+    for (int i = 0; i < 3; ++i) {
+      CUCO_CUDA_TRY(cudaGraphLaunch(graph_exec, stream));
+      CUCO_CUDA_TRY(cudaStreamSynchronize(stream));
+
+      REQUIRE(d_results[0] == num_keys);
+      REQUIRE(d_results[1] == num_keys);
+      REQUIRE(d_results[2] == num_keys);
+      REQUIRE(cuco::test::all_of(
+        d_contained.begin(), d_contained.begin() + num_keys, thrust::identity{}));
+      REQUIRE(cuco::test::none_of(
+        d_contained.begin() + num_keys, d_contained.end(), thrust::identity{}));
+
+      thrust::sort(matches.begin(), matches.end());
+      REQUIRE(
+        cuco::test::equal(matches.begin(), matches.end(), keys_begin, thrust::equal_to<Key>{}));
+    }
+
+    CUCO_CUDA_TRY(cudaGraphExecDestroy(graph_exec));
+    CUCO_CUDA_TRY(cudaGraphDestroy(graph));
+  }
+
+  SECTION("Temporaries are captured as memory nodes with a stream-ordered allocator")
+  {
+    using allocator_type = cuco::stream_ordered_allocator<Key>;
+    using set_type       = cuco::static_set<Key,
+                                      cuco::extent<std::size_t>,
+                                      cuda::thread_scope_device,
+                                      thrust::equal_to<Key>,
+                                      cuco::linear_probing<1, cuco::default_hash_function<Key>>,
+                                      allocator_type>;
+    using size_type      = set_type::size_type;
+
+    auto set = set_type{
+      num_keys * 2, cuco::empty_key<Key>{-1}, {}, {}, {}, {}, allocator_type{stream}, stream};
+    set.set_input_partitioning(4);
+
+    thrust::device_vector<size_type> d_num_retrieved(1);
+    thrust::device_vector<Key> retrieved(num_keys);
+    CUCO_CUDA_TRY(cudaStreamSynchronize(stream));
+
+    cudaGraph_t graph;
+    CUCO_CUDA_TRY(cudaStreamBeginCapture(stream, cudaStreamCaptureModeGlobal));
+    set.clear_async(stream);
+    set.insert_async(keys_begin, keys_begin + num_keys, stream);
+    set.retrieve_all_async(retrieved.begin(), d_num_retrieved.data().get(), stream);
+    CUCO_CUDA_TRY(cudaStreamEndCapture(stream, &graph));
+
+    cudaGraphExec_t graph_exec;
+    CUCO_CUDA_TRY(cudaGraphInstantiate(&graph_exec, graph, 0));
+
+    for (int i = 0; i < 2; ++i) {
+      CUCO_CUDA_TRY(cudaGraphLaunch(graph_exec, stream));
+      CUCO_CUDA_TRY(cudaStreamSynchronize(stream));
+
+      REQUIRE(d_num_retrieved[0] == num_keys);
+      thrust::sort(retrieved.begin(), retrieved.end());
+      REQUIRE(cuco::test::equal(
+        retrieved.begin(), retrieved.end(), keys_begin, thrust::equal_to<Key>{}));
+    }
+
+    CUCO_CUDA_TRY(cudaGraphExecDestroy(graph_exec));
+    CUCO_CUDA_TRY(cudaGraphDestroy(graph));
+
+    // Eager calls still work after the capture
+    set.insert_async(keys_begin, keys_begin + num_keys, stream);
+    REQUIRE(set.size(stream) == num_keys);
+  }
+
+  SECTION("Temporaries from a non stream-ordered allocator are rejected during capture")
+  {
+    using set_type  = cuco::static_set<Key>;
+    using size_type = set_type::size_type;
+
+    auto set = set_type{num_keys * 2, cuco::empty_key<Key>{-1}, {}, {}, {}, {}, {}, stream};
+
+    thrust::device_vector<size_type> d_num_retrieved(1);
+    thrust::device_vector<Key> retrieved(num_keys);
+    CUCO_CUDA_TRY(cudaStreamSynchronize(stream));
+
+    cudaGraph_t graph;
+    CUCO_CUDA_TRY(cudaStreamBeginCapture(stream, cudaStreamCaptureModeGlobal));
+    REQUIRE_THROWS_AS(
+      set.retrieve_all_async(retrieved.begin(), d_num_retrieved.data().get(), stream),
+      std::logic_error);
+    CUCO_CUDA_TRY(cudaStreamEndCapture(stream, &graph));
+    CUCO_CUDA_TRY(cudaGraphDestroy(graph));
+  }
+
+  CUCO_CUDA_TRY(cudaStreamDestroy(stream));
+}
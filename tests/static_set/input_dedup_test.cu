@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_set.cuh>
+
+#include <cuda/functional>
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using size_type = int32_t;
+
+TEMPLATE_TEST_CASE_SIG(
+  "static_set input deduplication tests",
+  "",
+  ((typename Key, cuco::test::probe_sequence Probe, int CGSize), Key, Probe, CGSize),
+  (int32_t, cuco::test::probe_sequence::double_hashing, 1),
+  (int32_t, cuco::test::probe_sequence::double_hashing, 2),
+  (int64_t, cuco::test::probe_sequence::double_hashing, 1),
+  (int32_t, cuco::test::probe_sequence::linear_probing, 1),
+  (int64_t, cuco::test::probe_sequence::linear_probing, 2),
+  (int64_t, cuco::test::probe_sequence::linear_probing, 4))
+{
+  constexpr size_type num_inputs{100'000};
+  constexpr size_type num_keys{17};
+
+  using probe = std::conditional_t<Probe == cuco::test::probe_sequence::linear_probing,
+                                   cuco::linear_probing<CGSize, cuco::default_hash_function<Key>>,
+                                   cuco::double_hashing<CGSize, cuco::default_hash_function<Key>>>;
+
+  auto set = cuco::static_set<Key,
+                              cuco::extent<size_type>,
+                              cuda::thread_scope_device,
+                              thrust::equal_to<Key>,
+                              probe>{num_keys * 2, cuco::empty_key<Key>{-1}};
+
+  REQUIRE_FALSE(set.input_deduplication());
+  set.set_input_deduplication(true);
+  REQUIRE(set.input_deduplication());
+
+  // heavily skewed input: every key appears thousands of times
+  auto const inputs_begin = thrust::make_transform_iterator(
+    thrust::counting_iterator<size_type>{0},
+    cuda::proclaim_return_type<Key>([] __device__(auto i) { return Key{i % num_keys}; }));
+
+  SECTION("Each distinct key is inserted once")
+  {
+    REQUIRE(set.insert(inputs_begin, inputs_begin + num_inputs) == num_keys);
+    REQUIRE(set.size() == num_keys);
+    REQUIRE(set.insert(inputs_begin, inputs_begin + num_inputs) == 0);
+  }
+
+  SECTION("Counts account for every copy of a key")
+  {
+    set.insert(inputs_begin, inputs_begin + num_inputs);
+    REQUIRE(set.count(inputs_begin, inputs_begin + num_inputs) == num_inputs);
+
+    thrust::device_vector<bool> contained(num_inputs);
+    set.contains(inputs_begin, inputs_begin + num_inputs, contained.begin());
+    REQUIRE(cuco::test::all_of(contained.begin(), contained.end(), thrust::identity<bool>{}));
+  }
+
+  SECTION("Stencil predicates are applied before deduplication")
+  {
+    auto const is_even = cuda::proclaim_return_type<bool>(
+      [] __device__(auto i) { return (i % num_keys) % 2 == 0; });
+    auto const stencil = thrust::counting_iterator<size_type>{0};
+    REQUIRE(set.insert_if(inputs_begin, inputs_begin + num_inputs, stencil, is_even) ==
+            (num_keys + 1) / 2);
+  }
+}
+
+// Equal to `thrust::equal_to`, but not known to the container to be bitwise equality
+struct custom_equal {
+  template <typename T>
+  __device__ bool operator()(T const& lhs, T const& rhs) const noexcept
+  {
+    return lhs == rhs;
+  }
+};
+
+TEST_CASE("static_set input deduplication requires bitwise key equality", "")
+{
+  using Key = int32_t;
+
+  auto set = cuco::static_set<Key,
+                              cuco::extent<size_type>,
+                              cuda::thread_scope_device,
+                              custom_equal>{100, cuco::empty_key<Key>{-1}};
+
+  set.set_input_deduplication(true);
+  REQUIRE_FALSE(set.input_deduplication());
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_set.cuh>
+
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+TEST_CASE("static_set insert from host tests", "")
+{
+  using Key      = int32_t;
+  using set_type = cuco::static_set<Key>;
+
+  constexpr std::size_t num_keys{100'000};
+
+  auto const chunk_size = GENERATE(std::size_t{1'000}, std::size_t{30'000}, num_keys * 2);
+  auto const num_stages = GENERATE(1, 3);
+  INFO("chunk_size=" << chunk_size);
+  INFO("num_stages=" << num_stages);
+
+  cudaStream_t stream;
+  CUCO_CUDA_TRY(cudaStreamCreate(&stream));
+
+  {
+    auto set = set_type{num_keys * 2, cuco::empty_key<Key>{-1}, {}, {}, {}, {}, {}, stream};
+
+    std::vector<Key> keys(num_keys);
+    std::iota(keys.begin(), keys.end(), Key{0});
+
+    auto const keys_begin = thrust::counting_iterator<Key>{0};
+    thrust::device_vector<bool> contained(num_keys * 2);
+
+    auto const check_contents = [&](std::size_t n) {
+      REQUIRE(set.size(stream) == n);
+      set.contains(keys_begin, keys_begin + num_keys * 2, contained.begin(), stream);
+      REQUIRE(cuco::test::all_of(contained.begin(), contained.begin() + n, thrust::identity{}));
+      REQUIRE(cuco::test::none_of(contained.begin() + n, contained.end(), thrust::identity{}));
+    };
+
+    SECTION("Pageable host input is staged through pinned buffers")
+    {
+      REQUIRE(set.insert_from_host(keys.begin(), keys.end(), chunk_size, num_stages, stream) ==
+              num_keys);
+      check_contents(num_keys);
+
+      // Keys already present are not inserted again
+      REQUIRE(set.insert_from_host(keys.begin(), keys.end(), chunk_size, num_stages, stream) == 0);
+      check_contents(num_keys);
+    }
+
+    SECTION("Consecutive calls reuse the staging buffers")
+    {
+      auto const half = keys.begin() + num_keys / 2;
+      REQUIRE(set.insert_from_host(keys.begin(), half, chunk_size, num_stages, stream) ==
+              num_keys / 2);
+      check_contents(num_keys / 2);
+
+      REQUIRE(set.insert_from_host(half, keys.end(), chunk_size, num_stages, stream) ==
+              num_keys - num_keys / 2);
+      check_contents(num_keys);
+
+      // A different shape rebuilds the pipeline
+      REQUIRE(set.insert_from_host(keys.begin(), keys.end(), chunk_size + 1, num_stages, stream) ==
+              0);
+      check_contents(num_keys);
+    }
+
+    SECTION("Pinned host input is copied directly")
+    {
+      Key* pinned;
+      CUCO_CUDA_TRY(cudaMallocHost(&pinned, sizeof(Key) * num_keys));
+      std::copy(keys.begin(), keys.end(), pinned);
+
+      REQUIRE(set.insert_from_host(pinned, pinned + num_keys, chunk_size, num_stages, stream) ==
+              num_keys);
+      check_contents(num_keys);
+
+      CUCO_CUDA_TRY(cudaFreeHost(pinned));
+    }
+
+    SECTION("Empty input and invalid pipeline parameters")
+    {
+      REQUIRE(set.insert_from_host(keys.begin(), keys.begin(), chunk_size, num_stages, stream) ==
+              0);
+      REQUIRE_THROWS_AS(set.insert_from_host(keys.begin(), keys.end(), 0, num_stages, stream),
+                        std::invalid_argument);
+      REQUIRE_THROWS_AS(set.insert_from_host(keys.begin(), keys.end(), chunk_size, 0, stream),
+                        std::invalid_argument);
+    }
+  }
+
+  CUCO_CUDA_TRY(cudaStreamDestroy(stream));
+}
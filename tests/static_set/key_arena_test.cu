@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cuco/key_arena.cuh>
+#include <cuco/static_set.cuh>
+
+#include <thrust/device_vector.h>
+#include <thrust/host_vector.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+// Builds Arrow-style offsets and chars from a list of strings
+std::pair<thrust::device_vector<std::int32_t>, thrust::device_vector<char>> make_arena(
+  std::vector<std::string> const& strings)
+{
+  thrust::host_vector<std::int32_t> offsets{0};
+  thrust::host_vector<char> chars;
+  for (auto const& s : strings) {
+    chars.insert(chars.end(), s.begin(), s.end());
+    offsets.push_back(static_cast<std::int32_t>(chars.size()));
+  }
+  return {offsets, chars};
+}
+}  // namespace
+
+TEMPLATE_TEST_CASE_SIG("static_set key arena tests", "", ((int CGSize), CGSize), (1), (2))
+{
+  using probe_type = cuco::double_hashing<CGSize, cuco::arena_key_hash, cuco::arena_key_hash>;
+
+  // long keys exercise the 16-byte hashing and comparison path
+  std::vector<std::string> const build_strings{"apple",
+                                               "banana",
+                                               "apple",
+                                               "",
+                                               "a considerably longer key spanning chunks",
+                                               "banana",
+                                               ""};
+  std::vector<std::string> const probe_strings{
+    "banana", "cherry", "", "apple!", "a considerably longer key spanning chunks", "appl"};
+  constexpr std::size_t num_unique = 4;
+
+  auto const [build_offsets, build_chars] = make_arena(build_strings);
+  auto const [probe_offsets, probe_chars] = make_arena(probe_strings);
+
+  auto const build_arena =
+    cuco::key_arena_ref{build_offsets.data().get(), build_chars.data().get()};
+  auto const probe_arena =
+    cuco::key_arena_ref{probe_offsets.data().get(), probe_chars.data().get()};
+
+  auto set = cuco::static_set{build_strings.size() * 2,
+                              cuco::empty_key{cuco::arena_key::empty_sentinel()},
+                              cuco::arena_key_equal{build_arena},
+                              probe_type{cuco::arena_key_hash{0}, cuco::arena_key_hash{1}}};
+
+  auto const build_keys   = build_arena.keys_begin();
+  auto const num_inserted = set.insert(build_keys, build_keys + build_strings.size());
+
+  SECTION("Duplicate keys are detected by content")
+  {
+    REQUIRE(num_inserted == num_unique);
+    REQUIRE(set.size() == num_unique);
+  }
+
+  SECTION("Keys from a different arena can be used as probe keys")
+  {
+    auto const probe_keys = probe_arena.probe_keys_begin();
+    thrust::device_vector<bool> contained(probe_strings.size());
+    set.contains(probe_keys, probe_keys + probe_strings.size(), contained.begin());
+
+    thrust::host_vector<bool> const h_contained = contained;
+    std::vector<bool> const expected{true, false, true, false, true, false};
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+      REQUIRE(h_contained[i] == expected[i]);
+    }
+  }
+
+  SECTION("Found slot keys refer to a row with identical content")
+  {
+    thrust::device_vector<cuco::arena_key> found(build_strings.size());
+    set.find(build_keys, build_keys + build_strings.size(), found.begin());
+
+    thrust::host_vector<cuco::arena_key> const h_found = found;
+    for (std::size_t i = 0; i < build_strings.size(); ++i) {
+      REQUIRE(build_strings[h_found[i].index] == build_strings[i]);
+    }
+  }
+}
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_set.cuh>
+#include <cuco/utility/allocator.hpp>
+
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sort.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+/// Keeps the stream busy for `cycles` clock cycles
+__global__ void spin(long long cycles)
+{
+  auto const start = clock64();
+  while (clock64() - start < cycles) {}
+}
+
+template <typename Set>
+void test_out_of_core_storage(Set& set, std::size_t num_keys)
+{
+  using Key = typename Set::key_type;
+
+  auto const keys_begin = thrust::counting_iterator<Key>{0};
+
+  REQUIRE(set.insert(keys_begin, keys_begin + num_keys) == num_keys);
+  REQUIRE(set.size() == num_keys);
+
+  thrust::device_vector<bool> contained(2 * num_keys);
+  set.contains(keys_begin, keys_begin + 2 * num_keys, contained.begin());
+  REQUIRE(cuco::test::all_of(contained.begin(), contained.begin() + num_keys, thrust::identity{}));
+  REQUIRE(cuco::test::none_of(contained.begin() + num_keys, contained.end(), thrust::identity{}));
+
+  thrust::device_vector<Key> retrieved(num_keys);
+  auto const end = set.retrieve_all(retrieved.begin());
+  REQUIRE(static_cast<std::size_t>(end - retrieved.begin()) == num_keys);
+  thrust::sort(retrieved.begin(), retrieved.end());
+  REQUIRE(
+    cuco::test::equal(retrieved.begin(), retrieved.end(), keys_begin, thrust::equal_to<Key>{}));
+}
+
+TEMPLATE_TEST_CASE_SIG(
+  "static_set out-of-core storage tests",
+  "",
+  ((typename Key, int CGSize), Key, CGSize),
+  (int32_t, 1),
+  (int32_t, 8),
+  (int64_t, 1),
+  (int64_t, 8))
+{
+  constexpr std::size_t num_keys{100'000};
+
+  using probe = cuco::linear_probing<CGSize, cuco::default_hash_function<Key>>;
+
+  SECTION("Pinned host storage is accessed in place by device kernels")
+  {
+    using set_type = cuco::static_set<Key,
+                                      cuco::extent<std::size_t>,
+                                      cuda::thread_scope_device,
+                                      thrust::equal_to<Key>,
+                                      probe,
+                                      cuco::pinned_allocator<Key>>;
+
+    auto set = set_type{num_keys * 2, cuco::empty_key<Key>{-1}};
+    test_out_of_core_storage(set, num_keys);
+  }
+
+  SECTION("Managed storage preferring the host")
+  {
+    using set_type = cuco::static_set<Key,
+                                      cuco::extent<std::size_t>,
+                                      cuda::thread_scope_device,
+                                      thrust::equal_to<Key>,
+                                      probe,
+                                      cuco::managed_allocator<Key>>;
+
+    auto set = set_type{num_keys * 2, cuco::empty_key<Key>{-1}};
+    test_out_of_core_storage(set, num_keys);
+  }
+
+  SECTION("Managed storage preferring the device can be prefetched back and forth")
+  {
+    using allocator_type = cuco::managed_allocator<Key>;
+    using set_type       = cuco::static_set<Key,
+                                      cuco::extent<std::size_t>,
+                                      cuda::thread_scope_device,
+                                      thrust::equal_to<Key>,
+                                      probe,
+                                      allocator_type>;
+
+    int device;
+    CUCO_CUDA_TRY(cudaGetDevice(&device));
+
+    auto set =
+      set_type{num_keys * 2, cuco::empty_key<Key>{-1}, {}, {}, {}, {}, allocator_type{device}};
+    set.prefetch_async(device);
+    test_out_of_core_storage(set, num_keys);
+
+    set.prefetch_async(cudaCpuDeviceId);
+    REQUIRE(set.size() == num_keys);
+  }
+}
+
+TEMPLATE_TEST_CASE_SIG("static_set out-of-core storage asynchronous insert tests",
+                       "",
+                       ((typename Allocator), Allocator),
+                       (cuco::pinned_allocator<int32_t>),
+                       (cuco::managed_allocator<int32_t>))
+{
+  using Key = int32_t;
+  constexpr std::size_t num_keys{100'000};
+
+  using set_type = cuco::static_set<Key,
+                                    cuco::extent<std::size_t>,
+                                    cuda::thread_scope_device,
+                                    thrust::equal_to<Key>,
+                                    cuco::linear_probing<1, cuco::default_hash_function<Key>>,
+                                    Allocator>;
+
+  cudaStream_t stream;
+  CUCO_CUDA_TRY(cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+
+  {
+    auto set = set_type{num_keys * 2, cuco::empty_key<Key>{-1}, {}, {}, {}, {}, {}, stream};
+    // Partitioning allocates temporaries, which must not synchronize the device
+    set.set_input_partitioning(8);
+
+    auto const keys_begin = thrust::counting_iterator<Key>{0};
+    // Warm up the pool of temporaries
+    set.insert(keys_begin, keys_begin + num_keys, stream);
+    set.clear(stream);
+
+    spin<<<1, 1, 0, stream>>>(1'000'000'000);
+    set.insert_async(keys_begin, keys_begin + num_keys, stream);
+    REQUIRE(cudaStreamQuery(stream) == cudaErrorNotReady);
+
+    CUCO_CUDA_TRY(cudaStreamSynchronize(stream));
+    REQUIRE(set.size(stream) == num_keys);
+  }
+
+  CUCO_CUDA_TRY(cudaStreamDestroy(stream));
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_set.cuh>
+
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+using size_type = int32_t;
+
+TEMPLATE_TEST_CASE_SIG(
+  "static_set partitioned bulk operations tests",
+  "",
+  ((typename Key, cuco::test::probe_sequence Probe, int CGSize), Key, Probe, CGSize),
+  (int32_t, cuco::test::probe_sequence::double_hashing, 1),
+  (int32_t, cuco::test::probe_sequence::double_hashing, 2),
+  (int64_t, cuco::test::probe_sequence::double_hashing, 1),
+  (int32_t, cuco::test::probe_sequence::linear_probing, 1),
+  (int32_t, cuco::test::probe_sequence::linear_probing, 2),
+  (int64_t, cuco::test::probe_sequence::linear_probing, 2))
+{
+  constexpr size_type num_keys{100'000};
+
+  using probe = std::conditional_t<
+    Probe == cuco::test::probe_sequence::linear_probing,
+    cuco::linear_probing<CGSize, cuco::default_hash_function<Key>>,
+    cuco::double_hashing<CGSize, cuco::default_hash_function<Key>>>;
+
+  auto set = cuco::static_set<Key,
+                              cuco::extent<size_type>,
+                              cuda::thread_scope_device,
+                              thrust::equal_to<Key>,
+                              probe>{num_keys * 2, cuco::empty_key<Key>{-1}};
+
+  REQUIRE(set.input_partition_bits() == 0);
+  set.set_input_partitioning(8);
+  REQUIRE(set.input_partition_bits() == 8);
+
+  auto const keys_begin = thrust::counting_iterator<Key>{0};
+
+  SECTION("Partitioned insert inserts every key once")
+  {
+    REQUIRE(set.insert(keys_begin, keys_begin + num_keys) == num_keys);
+    REQUIRE(set.size() == num_keys);
+    REQUIRE(set.insert(keys_begin, keys_begin + num_keys) == 0);
+  }
+
+  SECTION("Partitioned lookups write results at the input positions")
+  {
+    set.insert_async(keys_begin, keys_begin + num_keys);
+
+    thrust::device_vector<bool> contained(num_keys * 2);
+    set.contains(keys_begin, keys_begin + num_keys * 2, contained.begin());
+    REQUIRE(cuco::test::all_of(
+      contained.begin(), contained.begin() + num_keys, thrust::identity<bool>{}));
+    REQUIRE(cuco::test::none_of(
+      contained.begin() + num_keys, contained.end(), thrust::identity<bool>{}));
+
+    thrust::device_vector<Key> found(num_keys);
+    set.find(keys_begin, keys_begin + num_keys, found.begin());
+    REQUIRE(cuco::test::equal(found.begin(), found.end(), keys_begin, thrust::equal_to<Key>{}));
+  }
+
+  SECTION("Disabling partitioning restores in-order execution")
+  {
+    set.set_input_partitioning(0);
+    REQUIRE(set.insert(keys_begin, keys_begin + num_keys) == num_keys);
+    REQUIRE(set.size() == num_keys);
+  }
+
+  SECTION("Invalid partition bits are rejected")
+  {
+    REQUIRE_THROWS(set.set_input_partitioning(-1));
+    REQUIRE_THROWS(set.set_input_partitioning(17));
+  }
+}
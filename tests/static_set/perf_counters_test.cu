@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_set.cuh>
+
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+
+using size_type = int32_t;
+
+/// Hash function mapping all keys to the same home bucket
+struct constant_hash {
+  template <typename T>
+  __device__ uint32_t operator()(T) const
+  {
+    return 0;
+  }
+};
+
+TEMPLATE_TEST_CASE_SIG("static_set perf counters tests",
+                       "",
+                       ((typename Key, int CGSize, int BucketSize), Key, CGSize, BucketSize),
+                       (int32_t, 1, 1),
+                       (int32_t, 2, 2),
+                       (int64_t, 1, 2),
+                       (int64_t, 2, 1))
+{
+  constexpr size_type num_keys{10'000};
+
+  using probe = cuco::linear_probing<CGSize, cuco::default_hash_function<Key>>;
+
+  auto set = cuco::static_set<Key,
+                              cuco::extent<size_type>,
+                              cuda::thread_scope_device,
+                              thrust::equal_to<Key>,
+                              probe,
+                              cuco::cuda_allocator<Key>,
+                              cuco::counted_storage<BucketSize>>{num_keys * 2,
+                                                                 cuco::empty_key<Key>{-1}};
+
+  auto const keys_begin = thrust::counting_iterator<Key>{0};
+
+  SECTION("A new set has no events")
+  {
+    auto const counters = set.perf_counters();
+    REQUIRE(counters.probe_steps == 0);
+    REQUIRE(counters.cas_failures == 0);
+    REQUIRE(counters.duplicate_hits == 0);
+    REQUIRE(counters.bucket_full == 0);
+  }
+
+  SECTION("Every insertion probes at least one bucket")
+  {
+    REQUIRE(set.insert(keys_begin, keys_begin + num_keys) == num_keys);
+
+    auto const counters = set.perf_counters();
+    REQUIRE(counters.probe_steps >= counters.bucket_full + num_keys);
+    REQUIRE(counters.duplicate_hits == 0);
+  }
+
+  SECTION("Reinserting contained keys only counts duplicate hits")
+  {
+    set.insert(keys_begin, keys_begin + num_keys);
+    set.reset_perf_counters();
+    REQUIRE(set.insert(keys_begin, keys_begin + num_keys) == 0);
+
+    auto const counters = set.perf_counters();
+    REQUIRE(counters.duplicate_hits == num_keys);
+    REQUIRE(counters.cas_failures == 0);
+    REQUIRE(counters.probe_steps == counters.bucket_full + num_keys);
+  }
+
+  SECTION("Clearing the set resets the counters")
+  {
+    set.insert(keys_begin, keys_begin + num_keys);
+    set.clear();
+
+    auto const counters = set.perf_counters();
+    REQUIRE(counters.probe_steps == 0);
+    REQUIRE(counters.duplicate_hits == 0);
+  }
+}
+
+TEST_CASE("static_set perf counters collision tests", "")
+{
+  using Key = int32_t;
+
+  constexpr size_type num_keys{100};
+
+  auto set = cuco::static_set<Key,
+                              cuco::extent<size_type>,
+                              cuda::thread_scope_device,
+                              thrust::equal_to<Key>,
+                              cuco::linear_probing<1, constant_hash>,
+                              cuco::cuda_allocator<Key>,
+                              cuco::counted_storage<1>>{num_keys * 2, cuco::empty_key<Key>{-1}};
+
+  auto const keys_begin = thrust::counting_iterator<Key>{0};
+  REQUIRE(set.insert(keys_begin, keys_begin + num_keys) == num_keys);
+
+  // The key ending up at probe length `i` has passed at least `i` full buckets
+  auto const counters = set.perf_counters();
+  REQUIRE(counters.bucket_full >= static_cast<uint64_t>(num_keys * (num_keys - 1) / 2));
+  REQUIRE(counters.probe_steps == counters.bucket_full + num_keys);
+}
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_set.cuh>
+#include <cuco/utility/persistence.hpp>
+
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using size_type = int32_t;
+
+TEMPLATE_TEST_CASE_SIG("static_set persistence tests",
+                       "",
+                       ((typename Key, int CGSize, int BucketSize), Key, CGSize, BucketSize),
+                       (int32_t, 1, 1),
+                       (int32_t, 2, 2),
+                       (int64_t, 1, 2))
+{
+  constexpr size_type num_keys{10'000};
+
+  using probe    = cuco::linear_probing<CGSize, cuco::default_hash_function<Key>>;
+  using set_type = cuco::static_set<Key,
+                                    cuco::extent<size_type>,
+                                    cuda::thread_scope_device,
+                                    thrust::equal_to<Key>,
+                                    probe,
+                                    cuco::cuda_allocator<Key>,
+                                    cuco::storage<BucketSize>>;
+
+  auto const path = (std::filesystem::temp_directory_path() / "cuco_persistence_test.bin").string();
+
+  auto set = set_type{num_keys * 2, cuco::empty_key<Key>{-1}, cuco::erased_key<Key>{-2}};
+
+  auto const keys_begin = thrust::counting_iterator<Key>{0};
+  set.insert(keys_begin, keys_begin + num_keys);
+  set.erase(keys_begin, keys_begin + num_keys / 4);
+  set.save(path);
+
+  SECTION("The header describes the persisted set")
+  {
+    auto const header = cuco::read_persisted_header(path);
+    REQUIRE(header.kind == cuco::persisted_kind::static_set);
+    REQUIRE(header.key_bytes == sizeof(Key));
+    REQUIRE(header.bucket_size == BucketSize);
+    REQUIRE(header.cg_size == CGSize);
+    REQUIRE(header.capacity == set.capacity());
+    REQUIRE(header.payload_offset % cuco::persisted_header::payload_alignment == 0);
+    REQUIRE(std::filesystem::file_size(path) == header.payload_offset + header.payload_bytes);
+  }
+
+  SECTION("A loaded set holds the same elements, including tombstones")
+  {
+    auto const capacity = static_cast<size_type>(cuco::read_persisted_header(path).capacity);
+    auto loaded = set_type{capacity, cuco::empty_key<Key>{-1}, cuco::erased_key<Key>{-2}};
+    loaded.load(path);
+
+    REQUIRE(loaded.capacity() == set.capacity());
+    REQUIRE(loaded.size() == num_keys - num_keys / 4);
+    REQUIRE(loaded.tombstone_count() == num_keys / 4);
+
+    thrust::device_vector<bool> contained(num_keys);
+    loaded.contains(keys_begin, keys_begin + num_keys, contained.begin());
+    REQUIRE(cuco::test::all_of(
+      contained.begin(), contained.begin() + num_keys / 4, thrust::logical_not<bool>{}));
+    REQUIRE(
+      cuco::test::all_of(contained.begin() + num_keys / 4, contained.end(), thrust::identity{}));
+  }
+
+  SECTION("The allocator does not affect compatibility")
+  {
+    auto loaded = cuco::static_set<Key,
+                                   cuco::extent<size_type>,
+                                   cuda::thread_scope_device,
+                                   thrust::equal_to<Key>,
+                                   probe,
+                                   cuco::stream_ordered_allocator<Key>,
+                                   cuco::storage<BucketSize>>{
+      num_keys * 2, cuco::empty_key<Key>{-1}, cuco::erased_key<Key>{-2}};
+    loaded.load(path);
+
+    REQUIRE(loaded.size() == num_keys - num_keys / 4);
+    REQUIRE(loaded.count(keys_begin, keys_begin + num_keys) == num_keys - num_keys / 4);
+  }
+
+  SECTION("Loading into an incompatible set fails")
+  {
+    auto smaller = set_type{num_keys, cuco::empty_key<Key>{-1}, cuco::erased_key<Key>{-2}};
+    REQUIRE_THROWS_AS(smaller.load(path), cuco::logic_error);
+
+    auto other_sentinels =
+      set_type{num_keys * 2, cuco::empty_key<Key>{-3}, cuco::erased_key<Key>{-2}};
+    REQUIRE_THROWS_AS(other_sentinels.load(path), cuco::logic_error);
+  }
+
+  SECTION("Files that are not persisted containers are rejected")
+  {
+    std::ofstream{path, std::ios::binary | std::ios::trunc} << "not a cuco container";
+    REQUIRE_THROWS_AS(cuco::read_persisted_header(path), cuco::logic_error);
+    REQUIRE_THROWS_AS(set.load(path), cuco::logic_error);
+  }
+
+  SECTION("A failed load keeps the elements of a pending incremental rehash")
+  {
+    set.rehash_incremental_async(num_keys * 4, 1);
+    REQUIRE(set.is_rehashing());
+
+    auto smaller = set_type{num_keys, cuco::empty_key<Key>{-1}, cuco::erased_key<Key>{-2}};
+    smaller.save(path);
+    REQUIRE_THROWS_AS(set.load(path), cuco::logic_error);
+
+    REQUIRE(set.is_rehashing());
+    REQUIRE(set.size() == num_keys - num_keys / 4);
+    REQUIRE(set.count(keys_begin + num_keys / 4, keys_begin + num_keys) ==
+            num_keys - num_keys / 4);
+  }
+
+  std::filesystem::remove(path);
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_set.cuh>
+
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using size_type = int32_t;
+
+TEMPLATE_TEST_CASE_SIG("static_set purge tombstones tests",
+                       "",
+                       ((typename Key, int CGSize, int BucketSize), Key, CGSize, BucketSize),
+                       (int32_t, 1, 1),
+                       (int32_t, 2, 2),
+                       (int64_t, 1, 2),
+                       (int64_t, 2, 1))
+{
+  constexpr size_type num_keys{10'000};
+
+  using probe = cuco::linear_probing<CGSize, cuco::default_hash_function<Key>>;
+
+  auto set = cuco::static_set<Key,
+                              cuco::extent<size_type>,
+                              cuda::thread_scope_device,
+                              thrust::equal_to<Key>,
+                              probe,
+                              cuco::cuda_allocator<Key>,
+                              cuco::storage<BucketSize>>{
+    num_keys * 5 / 4, cuco::empty_key<Key>{-1}, cuco::erased_key<Key>{-2}};
+
+  auto const keys_begin = thrust::counting_iterator<Key>{0};
+
+  set.insert(keys_begin, keys_begin + num_keys);
+  set.erase(keys_begin, keys_begin + num_keys / 2);
+  REQUIRE(set.tombstone_count() == num_keys / 2);
+
+  SECTION("Purging removes all tombstones and keeps the remaining keys")
+  {
+    set.purge_tombstones();
+    REQUIRE(set.tombstone_count() == 0);
+    REQUIRE(set.size() == num_keys / 2);
+
+    thrust::device_vector<bool> contained(num_keys);
+    set.contains(keys_begin, keys_begin + num_keys, contained.begin());
+    REQUIRE(cuco::test::none_of(
+      contained.begin(), contained.begin() + num_keys / 2, thrust::identity<bool>{}));
+    REQUIRE(cuco::test::all_of(
+      contained.begin() + num_keys / 2, contained.end(), thrust::identity<bool>{}));
+    REQUIRE(set.count(keys_begin, keys_begin + num_keys) == num_keys / 2);
+  }
+
+  SECTION("Erased keys can be reinserted after purging")
+  {
+    set.purge_tombstones();
+    REQUIRE(set.insert(keys_begin, keys_begin + num_keys) == num_keys / 2);
+    REQUIRE(set.size() == num_keys);
+    REQUIRE(set.count(keys_begin, keys_begin + num_keys) == num_keys);
+  }
+
+  SECTION("Purging is triggered by the tombstone ratio")
+  {
+    REQUIRE_FALSE(set.purge_tombstones_if(0.9));
+    REQUIRE(set.tombstone_count() == num_keys / 2);
+
+    REQUIRE(set.purge_tombstones_if(0.1));
+    REQUIRE(set.tombstone_count() == 0);
+    REQUIRE(set.size() == num_keys / 2);
+  }
+}
+
+TEST_CASE("static_set purge tombstones without erased key", "")
+{
+  using Key = int32_t;
+  constexpr size_type num_keys{1'000};
+
+  auto set = cuco::static_set<Key>{num_keys * 2, cuco::empty_key<Key>{-1}};
+
+  auto const keys_begin = thrust::counting_iterator<Key>{0};
+  set.insert(keys_begin, keys_begin + num_keys);
+
+  // Empty slots must not be mistaken for tombstones
+  REQUIRE(set.tombstone_count() == 0);
+  REQUIRE_FALSE(set.purge_tombstones_if(0.0));
+  REQUIRE(set.size() == num_keys);
+}
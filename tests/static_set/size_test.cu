@@ -20,6 +20,8 @@
 #include <thrust/execution_policy.h>
 #include <thrust/sequence.h>
 
+#include <cstddef>
+
 #include <catch2/catch_test_macros.hpp>
 
 TEST_CASE("static_set size test", "")
@@ -41,3 +43,47 @@ TEST_CASE("static_set size test", "")
 
   REQUIRE(set.size() == 0);
 }
+
+TEST_CASE("static_set tracked size test", "")
+{
+  constexpr std::size_t num_keys{400};
+
+  cuco::static_set<int> set{
+    cuco::extent<std::size_t>{800}, cuco::empty_key{-1}, cuco::erased_key{-2}};
+
+  thrust::device_vector<int> d_keys(num_keys);
+  thrust::sequence(thrust::device, d_keys.begin(), d_keys.end());
+
+  // keys inserted before enabling tracking are accounted for
+  set.insert(d_keys.begin(), d_keys.begin() + num_keys / 2);
+  set.enable_size_tracking();
+  REQUIRE(set.size() == num_keys / 2);
+
+  SECTION("Insert and erase update the counter")
+  {
+    // half of the keys are duplicates
+    set.insert_async(d_keys.begin(), d_keys.end());
+    REQUIRE(set.size() == num_keys);
+
+    set.erase(d_keys.begin(), d_keys.begin() + num_keys / 4);
+    REQUIRE(set.size() == num_keys - num_keys / 4);
+
+    thrust::device_vector<int> d_found(num_keys);
+    thrust::device_vector<bool> d_inserted(num_keys);
+    set.insert_and_find(d_keys.begin(), d_keys.end(), d_found.begin(), d_inserted.begin());
+    REQUIRE(set.size() == num_keys);
+  }
+
+  SECTION("Stream-ordered size is written to device memory")
+  {
+    thrust::device_vector<std::size_t> d_size(1);
+    set.size_async(d_size.data().get());
+    REQUIRE(d_size[0] == num_keys / 2);
+  }
+
+  SECTION("Clear resets the counter")
+  {
+    set.clear();
+    REQUIRE(set.size() == 0);
+  }
+}
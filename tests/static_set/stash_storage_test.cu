@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_set.cuh>
+#include <cuco/storage.cuh>
+
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <iterator>
+
+using size_type = int32_t;
+
+TEMPLATE_TEST_CASE_SIG("static_set stash storage tests",
+                       "",
+                       ((typename Key, int CGSize), Key, CGSize),
+                       (int32_t, 1),
+                       (int32_t, 2),
+                       (int64_t, 1),
+                       (int64_t, 2))
+{
+  constexpr size_type stash_size = 64;
+
+  using probe = cuco::linear_probing<CGSize, cuco::default_hash_function<Key>>;
+
+  auto set = cuco::static_set<Key,
+                              cuco::extent<size_type>,
+                              cuda::thread_scope_device,
+                              thrust::equal_to<Key>,
+                              probe,
+                              cuco::cuda_allocator<Key>,
+                              cuco::stash_storage<1, stash_size, 8>>{
+    10'000, cuco::empty_key<Key>{-1}, cuco::erased_key<Key>{-2}};
+
+  auto const primary_capacity = static_cast<size_type>(set.capacity()) - stash_size;
+  auto const keys_begin       = thrust::counting_iterator<Key>{0};
+
+  SECTION("Keys past the probing bound are stashed at 95% load")
+  {
+    auto const num_keys = primary_capacity * 95 / 100;
+    thrust::device_vector<Key> unplaced(num_keys);
+    auto const unplaced_end = set.try_insert(keys_begin, keys_begin + num_keys, unplaced.begin());
+    auto const num_unplaced = static_cast<size_type>(std::distance(unplaced.begin(), unplaced_end));
+
+    REQUIRE(set.size() + num_unplaced == num_keys);
+    REQUIRE(set.stash_size() > 0);
+    REQUIRE(set.stash_size() <= stash_size);
+    REQUIRE(set.count(keys_begin, keys_begin + num_keys) == set.size());
+
+    thrust::device_vector<bool> contained(num_unplaced);
+    set.contains(unplaced.begin(), unplaced_end, contained.begin());
+    REQUIRE(cuco::test::none_of(contained.begin(), contained.end(), thrust::identity<bool>{}));
+
+    set.erase(keys_begin, keys_begin + num_keys);
+    REQUIRE(set.size() == 0);
+    REQUIRE(set.stash_size() == 0);
+  }
+
+  SECTION("Overfilled tables return the overflowing keys")
+  {
+    auto const num_keys = static_cast<size_type>(set.capacity()) + 1'000;
+    thrust::device_vector<Key> unplaced(num_keys);
+    auto const unplaced_end = set.try_insert(keys_begin, keys_begin + num_keys, unplaced.begin());
+    auto const num_unplaced = static_cast<size_type>(std::distance(unplaced.begin(), unplaced_end));
+
+    REQUIRE(num_unplaced >= 1'000);
+    REQUIRE(set.size() + num_unplaced == num_keys);
+    REQUIRE(set.count(unplaced.begin(), unplaced_end) == 0);
+
+    set.clear();
+    REQUIRE(set.size() == 0);
+    REQUIRE(set.stash_size() == 0);
+  }
+}
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_set.cuh>
+
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <numeric>
+
+using size_type = int32_t;
+
+/// Hash function mapping all keys to the same home bucket
+struct constant_hash {
+  template <typename T>
+  __device__ uint32_t operator()(T) const
+  {
+    return 0;
+  }
+};
+
+TEMPLATE_TEST_CASE_SIG("static_set statistics tests",
+                       "",
+                       ((typename Key, int CGSize, int BucketSize), Key, CGSize, BucketSize),
+                       (int32_t, 1, 1),
+                       (int32_t, 2, 2),
+                       (int64_t, 1, 2),
+                       (int64_t, 2, 1))
+{
+  constexpr size_type num_keys{10'000};
+
+  using probe = cuco::linear_probing<CGSize, cuco::default_hash_function<Key>>;
+
+  auto set = cuco::static_set<Key,
+                              cuco::extent<size_type>,
+                              cuda::thread_scope_device,
+                              thrust::equal_to<Key>,
+                              probe,
+                              cuco::cuda_allocator<Key>,
+                              cuco::storage<BucketSize>>{
+    num_keys * 2, cuco::empty_key<Key>{-1}, cuco::erased_key<Key>{-2}};
+
+  auto const sum = [](auto const& histogram) {
+    return std::accumulate(histogram.begin(), histogram.end(), size_type{0});
+  };
+
+  SECTION("An empty set has no elements and only empty buckets")
+  {
+    auto const stats = set.statistics();
+    REQUIRE(stats.capacity == set.capacity());
+    REQUIRE(stats.num_elements == 0);
+    REQUIRE(stats.num_tombstones == 0);
+    REQUIRE(stats.max_probe_length == 0);
+    REQUIRE(stats.bucket_fill_histogram.size() == BucketSize + 1);
+    REQUIRE(stats.bucket_fill_histogram.front() == stats.num_buckets);
+    REQUIRE(sum(stats.probe_length_histogram) == 0);
+    REQUIRE(stats.home_bucket_fraction() == 1.0);
+  }
+
+  SECTION("Histograms account for every element and bucket")
+  {
+    auto const keys_begin = thrust::counting_iterator<Key>{0};
+    set.insert(keys_begin, keys_begin + num_keys);
+
+    auto const stats = set.statistics();
+    REQUIRE(stats.num_elements == set.size());
+    REQUIRE(stats.num_buckets * BucketSize == stats.capacity);
+    REQUIRE(sum(stats.probe_length_histogram) == num_keys);
+    REQUIRE(sum(stats.bucket_fill_histogram) == stats.num_buckets);
+    REQUIRE(stats.load_factor() > 0.0);
+    REQUIRE(stats.home_bucket_fraction() <= 1.0);
+  }
+
+  SECTION("Erased slots are reported as tombstones")
+  {
+    auto const keys_begin = thrust::counting_iterator<Key>{0};
+    set.insert(keys_begin, keys_begin + num_keys);
+    set.erase(keys_begin, keys_begin + num_keys / 2);
+
+    auto const stats = set.statistics();
+    REQUIRE(stats.num_tombstones == num_keys / 2);
+    REQUIRE(stats.num_elements == num_keys / 2);
+    REQUIRE(sum(stats.probe_length_histogram) == num_keys / 2);
+  }
+}
+
+TEST_CASE("static_set statistics probe length tests", "")
+{
+  using Key = int32_t;
+
+  constexpr size_type num_keys{50};
+
+  SECTION("Sequential keys with an identity hash are located in their home bucket")
+  {
+    auto set = cuco::static_set<Key,
+                                cuco::extent<size_type>,
+                                cuda::thread_scope_device,
+                                thrust::equal_to<Key>,
+                                cuco::linear_probing<1, cuco::identity_hash<Key>>>{
+      num_keys * 2, cuco::empty_key<Key>{-1}};
+
+    auto const keys_begin = thrust::counting_iterator<Key>{0};
+    set.insert(keys_begin, keys_begin + num_keys);
+
+    auto const stats = set.statistics();
+    REQUIRE(stats.num_elements == num_keys);
+    REQUIRE(stats.max_probe_length == 0);
+    REQUIRE(stats.probe_length_histogram.front() == num_keys);
+    REQUIRE(stats.home_bucket_fraction() == 1.0);
+    REQUIRE(stats.mean_probe_length() == 0.0);
+  }
+
+  SECTION("Colliding keys occupy consecutive probe lengths")
+  {
+    auto set = cuco::static_set<Key,
+                                cuco::extent<size_type>,
+                                cuda::thread_scope_device,
+                                thrust::equal_to<Key>,
+                                cuco::linear_probing<1, constant_hash>>{num_keys * 2,
+                                                                        cuco::empty_key<Key>{-1}};
+
+    auto const keys_begin = thrust::counting_iterator<Key>{0};
+    set.insert(keys_begin, keys_begin + num_keys);
+
+    auto const stats = set.statistics();
+    REQUIRE(stats.num_elements == num_keys);
+    REQUIRE(stats.max_probe_length == num_keys - 1);
+    for (size_type i = 0; i < num_keys; ++i) {
+      REQUIRE(stats.probe_length_histogram[i] == 1);
+    }
+    REQUIRE(stats.mean_probe_length() == (num_keys - 1) / 2.0);
+  }
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_set.cuh>
+#include <cuco/utility/allocator.hpp>
+
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sort.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+TEST_CASE("static_set stream-ordered allocator tests", "")
+{
+  using Key       = int32_t;
+  using size_type = int32_t;
+
+  constexpr size_type num_keys{10'000};
+
+  cudaStream_t stream;
+  CUCO_CUDA_TRY(cudaStreamCreate(&stream));
+
+  {
+    using allocator_type = cuco::stream_ordered_allocator<Key>;
+    using set_type       = cuco::static_set<Key,
+                                      cuco::extent<size_type>,
+                                      cuda::thread_scope_device,
+                                      thrust::equal_to<Key>,
+                                      cuco::linear_probing<1, cuco::default_hash_function<Key>>,
+                                      allocator_type>;
+
+    auto set = set_type{
+      num_keys * 2, cuco::empty_key<Key>{-1}, {}, {}, {}, {}, allocator_type{stream}, stream};
+
+    auto const keys_begin = thrust::counting_iterator<Key>{0};
+
+    SECTION("Bulk operations with temporaries run back to back on a non-default stream")
+    {
+      for (int i = 0; i < 4; ++i) {
+        auto const expected = i == 0 ? num_keys : 0;
+        REQUIRE(set.insert(keys_begin, keys_begin + num_keys, stream) == expected);
+        REQUIRE(set.size(stream) == num_keys);
+      }
+
+      thrust::device_vector<Key> retrieved(num_keys);
+      auto const end = set.retrieve_all(retrieved.begin(), stream);
+      REQUIRE(static_cast<size_type>(end - retrieved.begin()) == num_keys);
+
+      thrust::sort(retrieved.begin(), retrieved.end());
+      REQUIRE(cuco::test::equal(
+        retrieved.begin(), retrieved.end(), keys_begin, thrust::equal_to<Key>{}));
+    }
+
+    SECTION("Rehashing releases the old storage in stream order")
+    {
+      set.insert(keys_begin, keys_begin + num_keys, stream);
+      set.rehash(num_keys * 4, stream);
+      REQUIRE(set.size(stream) == num_keys);
+    }
+  }
+
+  SECTION("Copies share the pool and rebound copies keep it")
+  {
+    auto const alloc   = cuco::stream_ordered_allocator<Key>{stream};
+    auto const rebound = cuco::stream_ordered_allocator<char>{alloc}.rebind_stream({});
+    REQUIRE(alloc == rebound);
+    REQUIRE(alloc != cuco::stream_ordered_allocator<Key>{stream});
+    REQUIRE(rebound.stream() == cuda::stream_ref{});
+  }
+
+  SECTION("Blocks released in a destroyed stream are reused in release order")
+  {
+    cudaStream_t released_in;
+    CUCO_CUDA_TRY(cudaStreamCreate(&released_in));
+    auto alloc = cuco::stream_ordered_allocator<Key>{released_in};
+
+    auto* const block = alloc.allocate(num_keys);
+    CUCO_CUDA_TRY(cudaMemsetAsync(block, 0, sizeof(Key) * num_keys, released_in));
+    alloc.deallocate(block, num_keys);
+    CUCO_CUDA_TRY(cudaStreamDestroy(released_in));
+
+    // The new stream may reuse the handle of the destroyed one
+    cudaStream_t reused_in;
+    CUCO_CUDA_TRY(cudaStreamCreate(&reused_in));
+    auto rebound = alloc.rebind_stream(reused_in);
+
+    auto* const reused = rebound.allocate(num_keys);
+    CUCO_CUDA_TRY(cudaMemsetAsync(reused, 0xff, sizeof(Key) * num_keys, reused_in));
+    std::vector<Key> h_reused(num_keys);
+    CUCO_CUDA_TRY(cudaMemcpyAsync(
+      h_reused.data(), reused, sizeof(Key) * num_keys, cudaMemcpyDeviceToHost, reused_in));
+    CUCO_CUDA_TRY(cudaStreamSynchronize(reused_in));
+    REQUIRE(std::all_of(h_reused.begin(), h_reused.end(), [](Key k) { return k == -1; }));
+
+    rebound.deallocate(reused, num_keys);
+    CUCO_CUDA_TRY(cudaStreamSynchronize(reused_in));
+    CUCO_CUDA_TRY(cudaStreamDestroy(reused_in));
+  }
+
+  CUCO_CUDA_TRY(cudaStreamDestroy(stream));
+}
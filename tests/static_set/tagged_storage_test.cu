@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_set.cuh>
+#include <cuco/storage.cuh>
+
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sort.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+using size_type = int32_t;
+
+TEMPLATE_TEST_CASE_SIG(
+  "static_set tagged storage tests",
+  "",
+  ((typename Key, int CGSize, int BucketSize, typename Hash), Key, CGSize, BucketSize, Hash),
+  (int32_t, 1, 4, cuco::default_hash_function<int32_t>),
+  (int32_t, 2, 8, cuco::default_hash_function<int32_t>),
+  (int64_t, 1, 8, cuco::default_hash_function<int64_t>),
+  (int64_t, 2, 4, cuco::default_hash_function<int64_t>),
+  (int32_t, 1, 8, cuco::xxhash3_128<int32_t>),
+  (int64_t, 2, 4, cuco::xxhash3_128<int64_t>))
+{
+  constexpr size_type num_keys{10'000};
+
+  using probe = cuco::linear_probing<CGSize, Hash>;
+
+  auto set = cuco::static_set<Key,
+                              cuco::extent<size_type>,
+                              cuda::thread_scope_device,
+                              thrust::equal_to<Key>,
+                              probe,
+                              cuco::cuda_allocator<Key>,
+                              cuco::tagged_storage<BucketSize>>{
+    num_keys * 2, cuco::empty_key<Key>{-1}, cuco::erased_key<Key>{-2}};
+
+  auto const keys_begin = thrust::counting_iterator<Key>{0};
+
+  set.insert(keys_begin, keys_begin + num_keys);
+  REQUIRE(set.size() == num_keys);
+
+  SECTION("Duplicates are not inserted")
+  {
+    REQUIRE(set.insert(keys_begin, keys_begin + num_keys) == 0);
+    REQUIRE(set.size() == num_keys);
+  }
+
+  SECTION("Inserted keys are found and absent keys are not")
+  {
+    thrust::device_vector<bool> contained(num_keys * 2);
+    set.contains(keys_begin, keys_begin + num_keys * 2, contained.begin());
+    REQUIRE(cuco::test::all_of(
+      contained.begin(), contained.begin() + num_keys, thrust::identity<bool>{}));
+    REQUIRE(
+      cuco::test::none_of(contained.begin() + num_keys, contained.end(), thrust::identity<bool>{}));
+
+    thrust::device_vector<Key> found(num_keys);
+    set.find(keys_begin, keys_begin + num_keys, found.begin());
+    REQUIRE(cuco::test::equal(found.begin(), found.end(), keys_begin, thrust::equal_to<Key>{}));
+
+    REQUIRE(set.count(keys_begin, keys_begin + num_keys * 2) == num_keys);
+  }
+
+  SECTION("Erased slots are reused by later insertions")
+  {
+    set.erase(keys_begin, keys_begin + num_keys / 2);
+    REQUIRE(set.size() == num_keys / 2);
+
+    thrust::device_vector<bool> contained(num_keys);
+    set.contains(keys_begin, keys_begin + num_keys, contained.begin());
+    REQUIRE(cuco::test::none_of(
+      contained.begin(), contained.begin() + num_keys / 2, thrust::identity<bool>{}));
+    REQUIRE(cuco::test::all_of(
+      contained.begin() + num_keys / 2, contained.end(), thrust::identity<bool>{}));
+
+    REQUIRE(set.insert(keys_begin, keys_begin + num_keys) == num_keys / 2);
+    REQUIRE(set.size() == num_keys);
+    REQUIRE(set.count(keys_begin, keys_begin + num_keys) == num_keys);
+  }
+
+  SECTION("Rehashing preserves all keys")
+  {
+    set.rehash(num_keys * 4);
+    REQUIRE(set.size() == num_keys);
+
+    thrust::device_vector<Key> keys(num_keys);
+    set.retrieve_all(keys.begin());
+    thrust::sort(keys.begin(), keys.end());
+    REQUIRE(cuco::test::equal(keys.begin(), keys.end(), keys_begin, thrust::equal_to<Key>{}));
+  }
+}
@@ -164,3 +164,24 @@ TEMPLATE_TEST_CASE_SIG(
 
   test_unique_sequence(set, num_keys);
 }
+
+TEMPLATE_TEST_CASE_SIG(
+  "static_set unique sequence multi-word hash tests",
+  "",
+  ((typename Key, cuco::test::probe_sequence Probe, int CGSize), Key, Probe, CGSize),
+  (int32_t, cuco::test::probe_sequence::double_hashing, 1),
+  (int64_t, cuco::test::probe_sequence::double_hashing, 2),
+  (int32_t, cuco::test::probe_sequence::linear_probing, 2),
+  (int64_t, cuco::test::probe_sequence::linear_probing, 1))
+{
+  constexpr size_type num_keys{400};
+
+  using probe = std::conditional_t<Probe == cuco::test::probe_sequence::linear_probing,
+                                   cuco::linear_probing<CGSize, cuco::xxhash3_128<Key>>,
+                                   cuco::double_hashing<CGSize, cuco::xxhash3_128<Key>>>;
+
+  auto set =
+    cuco::static_set{num_keys, cuco::empty_key<Key>{SENTINEL}, {}, probe{}, {}, cuco::storage<2>{}};
+
+  test_unique_sequence(set, num_keys);
+}
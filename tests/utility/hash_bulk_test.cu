@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/hash_functions.cuh>
+
+#include <cuda/std/cstddef>
+#include <thrust/device_vector.h>
+#include <thrust/host_vector.h>
+#include <thrust/sequence.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+TEMPLATE_TEST_CASE_SIG("utility cuco::hash_bulk test",
+                       "",
+                       ((typename Key, typename Hash), Key, Hash),
+                       (int32_t, cuco::xxhash_32<int32_t>),
+                       (int32_t, cuco::murmurhash3_32<int32_t>),
+                       (int64_t, cuco::xxhash_64<int64_t>),
+                       (int64_t, cuco::murmurhash3_x64_128<int64_t>))
+{
+  using result_type = typename Hash::result_type;
+
+  // Odd size so that the vectorized kernel also processes a partial vector
+  constexpr std::size_t num_keys{100'003};
+  auto const hash = Hash{};
+
+  thrust::host_vector<Key> h_keys(num_keys + 1);
+  thrust::sequence(h_keys.begin(), h_keys.end());
+  std::vector<result_type> expected(num_keys + 1);
+  for (std::size_t i = 0; i < h_keys.size(); ++i) {
+    expected[i] = hash(h_keys[i]);
+  }
+
+  thrust::device_vector<Key> d_keys = h_keys;
+  thrust::device_vector<result_type> d_hashes(num_keys + 1);
+
+  SECTION("Aligned device input is hashed with vector loads")
+  {
+    cuco::hash_bulk(d_keys.begin(), d_keys.end(), d_hashes.begin(), hash);
+    thrust::host_vector<result_type> const h_hashes = d_hashes;
+    REQUIRE(std::equal(h_hashes.begin(), h_hashes.end(), expected.begin()));
+  }
+
+  SECTION("Misaligned device input is hashed element-wise")
+  {
+    auto const* const first = thrust::raw_pointer_cast(d_keys.data()) + 1;
+    cuco::hash_bulk(first, first + num_keys, d_hashes.begin(), hash);
+    thrust::host_vector<result_type> const h_hashes = d_hashes;
+    REQUIRE(std::equal(h_hashes.begin(), h_hashes.begin() + num_keys, expected.begin() + 1));
+  }
+
+  SECTION("Host input is hashed on the host")
+  {
+    std::vector<result_type> h_hashes(num_keys + 1);
+    cuco::hash_bulk(h_keys.begin(), h_keys.end(), h_hashes.begin(), hash);
+    REQUIRE(h_hashes == expected);
+
+    std::vector<Key> const keys(h_keys.begin(), h_keys.end());
+    std::fill(h_hashes.begin(), h_hashes.end(), result_type{});
+    cuco::hash_bulk(keys.data(), keys.data() + keys.size(), h_hashes.data(), hash);
+    REQUIRE(h_hashes == expected);
+  }
+
+  SECTION("Host-only and device-only ranges cannot be mixed")
+  {
+    std::vector<result_type> h_hashes(num_keys + 1);
+    REQUIRE_THROWS_AS(cuco::hash_bulk(d_keys.begin(), d_keys.end(), h_hashes.begin(), hash),
+                      std::invalid_argument);
+    REQUIRE_THROWS_AS(cuco::hash_bulk(h_keys.begin(), h_keys.end(), d_hashes.begin(), hash),
+                      std::invalid_argument);
+  }
+}
+
+TEMPLATE_TEST_CASE_SIG("utility cuco::hash_strings_bulk test",
+                       "",
+                       ((typename Hash), Hash),
+                       (cuco::xxhash_32<char>),
+                       (cuco::xxhash_64<char>),
+                       (cuco::murmurhash3_32<char>))
+{
+  using result_type = typename Hash::result_type;
+
+  // Covers empty, per-thread, warp-staged and oversized strings
+  constexpr std::size_t num_strings{5'000};
+  constexpr std::size_t max_length{3'000};
+  auto const hash = Hash{};
+
+  std::vector<int64_t> offsets(num_strings + 1, 0);
+  for (std::size_t i = 0; i < num_strings; ++i) {
+    auto const length = i % 7 == 0 ? (i * 37) % max_length : i % 80;
+    offsets[i + 1]    = offsets[i] + static_cast<int64_t>(length);
+  }
+  std::vector<cuda::std::byte> chars(offsets.back());
+  for (std::size_t i = 0; i < chars.size(); ++i) {
+    chars[i] = static_cast<cuda::std::byte>((i * 131) % 251);
+  }
+
+  std::vector<result_type> expected(num_strings);
+  for (std::size_t i = 0; i < num_strings; ++i) {
+    expected[i] = hash.compute_hash(chars.data() + offsets[i], offsets[i + 1] - offsets[i]);
+  }
+
+  SECTION("Device strings are hashed with and without warp staging")
+  {
+    thrust::device_vector<int64_t> const d_offsets(offsets.begin(), offsets.end());
+    thrust::device_vector<cuda::std::byte> const d_chars(chars.begin(), chars.end());
+    thrust::device_vector<result_type> d_hashes(num_strings);
+
+    cuco::hash_strings_bulk(d_offsets.begin(),
+                            d_offsets.end(),
+                            thrust::raw_pointer_cast(d_chars.data()),
+                            d_hashes.begin(),
+                            hash);
+    thrust::host_vector<result_type> const h_hashes = d_hashes;
+    REQUIRE(std::equal(h_hashes.begin(), h_hashes.end(), expected.begin()));
+  }
+
+  SECTION("Host strings are hashed on the host")
+  {
+    std::vector<result_type> h_hashes(num_strings);
+    cuco::hash_strings_bulk(offsets.begin(), offsets.end(), chars.data(), h_hashes.begin(), hash);
+    REQUIRE(h_hashes == expected);
+  }
+
+  SECTION("Host-only and device-only ranges cannot be mixed")
+  {
+    thrust::device_vector<int64_t> const d_offsets(offsets.begin(), offsets.end());
+    std::vector<result_type> h_hashes(num_strings);
+    REQUIRE_THROWS_AS(
+      cuco::hash_strings_bulk(
+        d_offsets.begin(), d_offsets.end(), chars.data(), h_hashes.begin(), hash),
+      std::invalid_argument);
+  }
+
+  SECTION("Empty offsets are rejected")
+  {
+    std::vector<result_type> h_hashes(num_strings);
+    REQUIRE_THROWS_AS(cuco::hash_strings_bulk(
+                        offsets.begin(), offsets.begin(), chars.data(), h_hashes.begin(), hash),
+                      cuco::logic_error);
+  }
+}
@@ -221,6 +221,196 @@ TEST_CASE("utility cuco::xxhash_32 test", "")
   }
 }
 
+template <typename OutputIter>
+__global__ void check_xxhash3_64_result_kernel(OutputIter result)
+{
+  int i = 0;
+
+  result[i++] = check_hash_result<cuco::xxhash3_64<char>, uint64_t>(0, 14144645293874801883ull, 0);
+  result[i++] = check_hash_result<cuco::xxhash3_64<char>, uint64_t>(42, 8777568547874204941ull, 0);
+  result[i++] = check_hash_result<cuco::xxhash3_64<char>, uint64_t>(0, 6697150685477982789ull, 42);
+
+  result[i++] =
+    check_hash_result<cuco::xxhash3_64<int32_t>, uint64_t>(0, 5238470482016868669ull, 0);
+  result[i++] =
+    check_hash_result<cuco::xxhash3_64<int32_t>, uint64_t>(0, 14325386350854113765ull, 42);
+  result[i++] =
+    check_hash_result<cuco::xxhash3_64<int32_t>, uint64_t>(42, 2392174772787195229ull, 0);
+  result[i++] =
+    check_hash_result<cuco::xxhash3_64<int32_t>, uint64_t>(123456789, 5186869424260940993ull, 0);
+
+  result[i++] =
+    check_hash_result<cuco::xxhash3_64<int64_t>, uint64_t>(0, 14374147212387527897ull, 0);
+  result[i++] =
+    check_hash_result<cuco::xxhash3_64<int64_t>, uint64_t>(0, 5014318936221084462ull, 42);
+  result[i++] =
+    check_hash_result<cuco::xxhash3_64<int64_t>, uint64_t>(42, 15395265915043915720ull, 0);
+  result[i++] =
+    check_hash_result<cuco::xxhash3_64<int64_t>, uint64_t>(123456789, 2817400364357085909ull, 0);
+
+#if defined(CUCO_HAS_INT128)
+  result[i++] =
+    check_hash_result<cuco::xxhash3_64<__int128>, uint64_t>(123456789, 7602280935813847626ull, 0);
+#endif
+
+  result[i++] = check_hash_result<cuco::xxhash3_64<large_key<32>>, uint64_t>(
+    123456789, 9278458725499332637ull, 0);
+  result[i++] = check_hash_result<cuco::xxhash3_64<large_key<48>>, uint64_t>(
+    123456789, 18175377766974340274ull, 0);
+  result[i++] = check_hash_result<cuco::xxhash3_64<large_key<64>>, uint64_t>(
+    123456789, 15962532058857181731ull, 0);
+  result[i++] = check_hash_result<cuco::xxhash3_64<large_key<64>>, uint64_t>(
+    123456789, 14005426436104435755ull, 42);
+}
+
+TEST_CASE("utility cuco::xxhash3_64 test", "")
+{
+  // Reference hash values were computed using https://github.com/Cyan4973/xxHash
+  SECTION("Check if host-generated hash values match the reference implementation.")
+  {
+    CHECK(check_hash_result<cuco::xxhash3_64<char>, uint64_t>(0, 14144645293874801883ull, 0));
+    CHECK(check_hash_result<cuco::xxhash3_64<char>, uint64_t>(42, 8777568547874204941ull, 0));
+    CHECK(check_hash_result<cuco::xxhash3_64<char>, uint64_t>(0, 6697150685477982789ull, 42));
+
+    CHECK(check_hash_result<cuco::xxhash3_64<int32_t>, uint64_t>(0, 5238470482016868669ull, 0));
+    CHECK(check_hash_result<cuco::xxhash3_64<int32_t>, uint64_t>(0, 14325386350854113765ull, 42));
+    CHECK(check_hash_result<cuco::xxhash3_64<int32_t>, uint64_t>(42, 2392174772787195229ull, 0));
+    CHECK(
+      check_hash_result<cuco::xxhash3_64<int32_t>, uint64_t>(123456789, 5186869424260940993ull, 0));
+
+    CHECK(check_hash_result<cuco::xxhash3_64<int64_t>, uint64_t>(0, 14374147212387527897ull, 0));
+    CHECK(check_hash_result<cuco::xxhash3_64<int64_t>, uint64_t>(0, 5014318936221084462ull, 42));
+    CHECK(check_hash_result<cuco::xxhash3_64<int64_t>, uint64_t>(42, 15395265915043915720ull, 0));
+    CHECK(
+      check_hash_result<cuco::xxhash3_64<int64_t>, uint64_t>(123456789, 2817400364357085909ull, 0));
+
+#if defined(CUCO_HAS_INT128)
+    CHECK(check_hash_result<cuco::xxhash3_64<__int128>, uint64_t>(
+      123456789, 7602280935813847626ull, 0));
+#endif
+
+    // 128, 192 and 256-byte keys to test the mid-size and the long input paths
+    CHECK(check_hash_result<cuco::xxhash3_64<large_key<32>>, uint64_t>(
+      123456789, 9278458725499332637ull, 0));
+    CHECK(check_hash_result<cuco::xxhash3_64<large_key<48>>, uint64_t>(
+      123456789, 18175377766974340274ull, 0));
+    CHECK(check_hash_result<cuco::xxhash3_64<large_key<64>>, uint64_t>(
+      123456789, 15962532058857181731ull, 0));
+    CHECK(check_hash_result<cuco::xxhash3_64<large_key<64>>, uint64_t>(
+      123456789, 14005426436104435755ull, 42));
+  }
+
+  SECTION("Check if device-generated hash values match the reference implementation.")
+  {
+    thrust::device_vector<bool> result(16, true);
+
+    check_xxhash3_64_result_kernel<<<1, 1>>>(result.begin());
+
+    CHECK(cuco::test::all_of(result.begin(), result.end(), thrust::identity<bool>{}));
+  }
+}
+
+template <typename OutputIter>
+__global__ void check_xxhash3_128_result_kernel(OutputIter result)
+{
+  int i = 0;
+
+  result[i++] = check_hash_result<cuco::xxhash3_128<char>, uint64_t>(
+    0, {14144645293874801883ull, 12019366968424402794ull}, 0);
+  result[i++] = check_hash_result<cuco::xxhash3_128<char>, uint64_t>(
+    42, {8777568547874204941ull, 1497920308546659268ull}, 0);
+  result[i++] = check_hash_result<cuco::xxhash3_128<char>, uint64_t>(
+    0, {6697150685477982789ull, 16862835990649298218ull}, 42);
+
+  result[i++] = check_hash_result<cuco::xxhash3_128<int32_t>, uint64_t>(
+    0, {15845180571247577957ull, 3040916486473433971ull}, 0);
+  result[i++] = check_hash_result<cuco::xxhash3_128<int32_t>, uint64_t>(
+    0, {10984597573276123308ull, 16532782743564947617ull}, 42);
+  result[i++] = check_hash_result<cuco::xxhash3_128<int32_t>, uint64_t>(
+    42, {1932769535858151055ull, 11116380877631057972ull}, 0);
+  result[i++] = check_hash_result<cuco::xxhash3_128<int32_t>, uint64_t>(
+    123456789, {12236985229114957765ull, 16708601316877094708ull}, 0);
+
+  result[i++] = check_hash_result<cuco::xxhash3_128<int64_t>, uint64_t>(
+    0, {5027060195534464434ull, 3173501280862895444ull}, 0);
+  result[i++] = check_hash_result<cuco::xxhash3_128<int64_t>, uint64_t>(
+    0, {15439181912508745583ull, 3241074915469697710ull}, 42);
+  result[i++] = check_hash_result<cuco::xxhash3_128<int64_t>, uint64_t>(
+    42, {7044217293765171781ull, 11217127669921611398ull}, 0);
+  result[i++] = check_hash_result<cuco::xxhash3_128<int64_t>, uint64_t>(
+    123456789, {5686821628512271274ull, 3113600892957498625ull}, 0);
+
+#if defined(CUCO_HAS_INT128)
+  result[i++] = check_hash_result<cuco::xxhash3_128<__int128>, uint64_t>(
+    123456789, {11659008988222534993ull, 4643130342062838206ull}, 0);
+#endif
+
+  result[i++] = check_hash_result<cuco::xxhash3_128<large_key<32>>, uint64_t>(
+    123456789, {4197492376924200295ull, 11724804271630678269ull}, 0);
+  result[i++] = check_hash_result<cuco::xxhash3_128<large_key<48>>, uint64_t>(
+    123456789, {11558519142019828001ull, 18421782807902670675ull}, 0);
+  result[i++] = check_hash_result<cuco::xxhash3_128<large_key<64>>, uint64_t>(
+    123456789, {15962532058857181731ull, 18335114309281607096ull}, 0);
+  result[i++] = check_hash_result<cuco::xxhash3_128<large_key<64>>, uint64_t>(
+    123456789, {14005426436104435755ull, 1106243978523916700ull}, 42);
+}
+
+TEST_CASE("utility cuco::xxhash3_128 test", "")
+{
+  // Reference hash values were computed using https://github.com/Cyan4973/xxHash
+  SECTION("Check if host-generated hash values match the reference implementation.")
+  {
+    CHECK(check_hash_result<cuco::xxhash3_128<char>, uint64_t>(
+      0, {14144645293874801883ull, 12019366968424402794ull}, 0));
+    CHECK(check_hash_result<cuco::xxhash3_128<char>, uint64_t>(
+      42, {8777568547874204941ull, 1497920308546659268ull}, 0));
+    CHECK(check_hash_result<cuco::xxhash3_128<char>, uint64_t>(
+      0, {6697150685477982789ull, 16862835990649298218ull}, 42));
+
+    CHECK(check_hash_result<cuco::xxhash3_128<int32_t>, uint64_t>(
+      0, {15845180571247577957ull, 3040916486473433971ull}, 0));
+    CHECK(check_hash_result<cuco::xxhash3_128<int32_t>, uint64_t>(
+      0, {10984597573276123308ull, 16532782743564947617ull}, 42));
+    CHECK(check_hash_result<cuco::xxhash3_128<int32_t>, uint64_t>(
+      42, {1932769535858151055ull, 11116380877631057972ull}, 0));
+    CHECK(check_hash_result<cuco::xxhash3_128<int32_t>, uint64_t>(
+      123456789, {12236985229114957765ull, 16708601316877094708ull}, 0));
+
+    CHECK(check_hash_result<cuco::xxhash3_128<int64_t>, uint64_t>(
+      0, {5027060195534464434ull, 3173501280862895444ull}, 0));
+    CHECK(check_hash_result<cuco::xxhash3_128<int64_t>, uint64_t>(
+      0, {15439181912508745583ull, 3241074915469697710ull}, 42));
+    CHECK(check_hash_result<cuco::xxhash3_128<int64_t>, uint64_t>(
+      42, {7044217293765171781ull, 11217127669921611398ull}, 0));
+    CHECK(check_hash_result<cuco::xxhash3_128<int64_t>, uint64_t>(
+      123456789, {5686821628512271274ull, 3113600892957498625ull}, 0));
+
+#if defined(CUCO_HAS_INT128)
+    CHECK(check_hash_result<cuco::xxhash3_128<__int128>, uint64_t>(
+      123456789, {11659008988222534993ull, 4643130342062838206ull}, 0));
+#endif
+
+    // 128, 192 and 256-byte keys to test the mid-size and the long input paths
+    CHECK(check_hash_result<cuco::xxhash3_128<large_key<32>>, uint64_t>(
+      123456789, {4197492376924200295ull, 11724804271630678269ull}, 0));
+    CHECK(check_hash_result<cuco::xxhash3_128<large_key<48>>, uint64_t>(
+      123456789, {11558519142019828001ull, 18421782807902670675ull}, 0));
+    CHECK(check_hash_result<cuco::xxhash3_128<large_key<64>>, uint64_t>(
+      123456789, {15962532058857181731ull, 18335114309281607096ull}, 0));
+    CHECK(check_hash_result<cuco::xxhash3_128<large_key<64>>, uint64_t>(
+      123456789, {14005426436104435755ull, 1106243978523916700ull}, 42));
+  }
+
+  SECTION("Check if device-generated hash values match the reference implementation.")
+  {
+    thrust::device_vector<bool> result(16, true);
+
+    check_xxhash3_128_result_kernel<<<1, 1>>>(result.begin());
+
+    CHECK(cuco::test::all_of(result.begin(), result.end(), thrust::identity<bool>{}));
+  }
+}
+
 TEMPLATE_TEST_CASE_SIG("utility hasher compute_hash tests",
                        "",
                        ((typename Hash), Hash),
@@ -229,7 +419,11 @@ TEMPLATE_TEST_CASE_SIG("utility hasher compute_hash tests",
                        (cuco::xxhash_32<char>),
                        (cuco::xxhash_32<int32_t>),
                        (cuco::xxhash_64<char>),
-                       (cuco::xxhash_64<int32_t>))
+                       (cuco::xxhash_64<int32_t>),
+                       (cuco::xxhash3_64<char>),
+                       (cuco::xxhash3_64<int32_t>),
+                       (cuco::xxhash3_128<char>),
+                       (cuco::xxhash3_128<int32_t>))
 {
   using key_type = typename Hash::argument_type;
 
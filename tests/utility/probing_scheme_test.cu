@@ -22,13 +22,16 @@
 #include <cuco/probing_scheme.cuh>
 
 #include <thrust/device_vector.h>
+#include <thrust/host_vector.h>
 
 #include <cooperative_groups.h>
 
 #include <catch2/catch_template_test_macros.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <vector>
 
 template <class ProbingScheme, class Key, class Extent, class OutputIt>
 __global__ void generate_scalar_probing_sequence(Key key,
@@ -106,3 +109,45 @@ TEMPLATE_TEST_CASE_SIG(
   REQUIRE(cuco::test::equal(
     scalar_seq.begin(), scalar_seq.end(), cg_seq.begin(), thrust::equal_to<std::size_t>{}));
 }
+
+TEMPLATE_TEST_CASE_SIG(
+  "utility probing_scheme multi-word hash tests",
+  "",
+  ((typename Key, cuco::test::probe_sequence Probe, typename Hash), Key, Probe, Hash),
+  (int32_t, cuco::test::probe_sequence::double_hashing, cuco::xxhash3_128<int32_t>),
+  (int64_t, cuco::test::probe_sequence::double_hashing, cuco::xxhash3_128<int64_t>),
+  (int64_t, cuco::test::probe_sequence::double_hashing, cuco::murmurhash3_x64_128<int64_t>),
+  (int32_t, cuco::test::probe_sequence::linear_probing, cuco::xxhash3_128<int32_t>),
+  (int64_t, cuco::test::probe_sequence::linear_probing, cuco::murmurhash3_x64_128<int64_t>))
+{
+  auto const upper_bound = cuco::make_bucket_extent<1, 1>(cuco::extent<std::size_t>{10});
+  auto const num_buckets = static_cast<std::size_t>(upper_bound);
+  constexpr size_t seq_length{8};
+  constexpr Key key{42};
+
+  using probe = std::conditional_t<Probe == cuco::test::probe_sequence::linear_probing,
+                                   cuco::linear_probing<1, Hash>,
+                                   cuco::double_hashing<1, Hash>>;
+
+  // The start is drawn from the first hash word and the double hashing step from the second one
+  auto const hash  = Hash{}(key);
+  auto const start = static_cast<std::size_t>(hash[0]) % num_buckets;
+  auto const step  = Probe == cuco::test::probe_sequence::linear_probing
+                       ? std::size_t{1}
+                       : static_cast<std::size_t>(hash[1]) % (num_buckets - 1) + 1;
+  std::vector<std::size_t> expected(seq_length);
+  for (std::size_t i = 0; i < seq_length; ++i) {
+    expected[i] = (start + i * step) % num_buckets;
+  }
+
+  thrust::device_vector<size_t> scalar_seq(seq_length);
+  generate_scalar_probing_sequence<probe>
+    <<<1, 1>>>(key, upper_bound, seq_length, scalar_seq.begin());
+  thrust::device_vector<size_t> cg_seq(seq_length);
+  generate_cg_probing_sequence<probe><<<1, 1>>>(key, upper_bound, seq_length, cg_seq.begin());
+
+  thrust::host_vector<size_t> const h_scalar_seq = scalar_seq;
+  thrust::host_vector<size_t> const h_cg_seq     = cg_seq;
+  REQUIRE(std::equal(h_scalar_seq.begin(), h_scalar_seq.end(), expected.begin()));
+  REQUIRE(std::equal(h_cg_seq.begin(), h_cg_seq.end(), expected.begin()));
+}